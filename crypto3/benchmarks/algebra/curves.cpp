@@ -112,6 +112,15 @@ void benchmark_curve_operations(std::string const& curve_name)
             [](typename g1_type::value_type& A, typename scalar_field::value_type const& B) {
             return A *= B;
             });
+    if constexpr (curves::detail::has_glv_endomorphism<typename g1_type::params_type>::value) {
+        // The generic wnaf path, to compare with the GLV one above.
+        run_benchmark<g1_type, scalar_field>(
+                curve_name + " G1 scalar multiplication without GLV",
+                [](typename g1_type::value_type& A, typename scalar_field::value_type const& B) {
+                curves::detail::scalar_mul_inplace(A, static_cast<typename scalar_field::integral_type>(B.data));
+                return A;
+                });
+    }
 
     if constexpr (has_type_g2_type<curve_type>::value) {
         using g2_type = typename curve_type::template g2_type<>;
@@ -212,6 +221,16 @@ BOOST_AUTO_TEST_CASE(vesta)
     benchmark_curve_operations<nil::crypto3::algebra::curves::vesta>("Vesta");
 }
 
+BOOST_AUTO_TEST_CASE(alt_bn128_254)
+{
+    benchmark_curve_operations<nil::crypto3::algebra::curves::alt_bn128_254>("ALT_BN128-254");
+}
+
+BOOST_AUTO_TEST_CASE(secp256k1)
+{
+    benchmark_curve_operations<nil::crypto3::algebra::curves::secp_k1<256>>("secp256k1");
+}
+
 BOOST_AUTO_TEST_CASE(bls12_381)
 {
     benchmark_curve_operations<nil::crypto3::algebra::curves::bls12<381>>("BLS12-381");
@@ -29,6 +29,10 @@
 #include <nil/crypto3/algebra/pairing/pairing_policy.hpp>
 
 #include <optional>
+#include <type_traits>
+#include <vector>
+
+#include <boost/assert.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -104,6 +108,85 @@ namespace nil {
 
                 return PairingPolicy::miller_loop::process(prec_P, prec_Q);
             }
+
+            namespace detail {
+                template<typename PairingPolicy, typename = void>
+                struct has_multi_miller_loop : std::false_type { };
+
+                template<typename PairingPolicy>
+                struct has_multi_miller_loop<PairingPolicy, std::void_t<typename PairingPolicy::multi_miller_loop>>
+                    : std::true_type { };
+            }    // namespace detail
+
+            /**
+             * @brief Product of the Miller loops of pairs (prec_P[i], prec_Q[i]). Curves providing a
+             * multi_miller_loop in their pairing policy run the loops interleaved, sharing the squarings of the
+             * accumulator, other curves multiply separate Miller loops.
+             */
+            template<typename PairingCurveType, typename PairingPolicy = pairing::pairing_policy<PairingCurveType>>
+            typename PairingCurveType::gt_type::value_type
+                multi_miller_loop(const std::vector<typename PairingPolicy::g1_precomputed_type> &prec_P,
+                                  const std::vector<typename PairingPolicy::g2_precomputed_type> &prec_Q) {
+                BOOST_ASSERT(prec_P.size() == prec_Q.size());
+
+                if constexpr (detail::has_multi_miller_loop<PairingPolicy>::value) {
+                    return PairingPolicy::multi_miller_loop::process(prec_P, prec_Q);
+                } else {
+                    typename PairingCurveType::gt_type::value_type f =
+                        PairingCurveType::gt_type::value_type::one();
+                    for (std::size_t i = 0; i < prec_P.size(); ++i) {
+                        f = f * PairingPolicy::miller_loop::process(prec_P[i], prec_Q[i]);
+                    }
+                    return f;
+                }
+            }
+
+            /**
+             * @brief Product of pairings e(P[i], Q[i]) without the final exponentiation, like pair(). Pairs with a
+             * zero point contribute one and are skipped.
+             */
+            template<typename PairingCurveType, typename PairingPolicy = pairing::pairing_policy<PairingCurveType>>
+            typename PairingCurveType::gt_type::value_type
+                multi_pair(const std::vector<typename PairingCurveType::template g1_type<>::value_type> &P,
+                           const std::vector<typename PairingCurveType::template g2_type<>::value_type> &Q) {
+                BOOST_ASSERT(P.size() == Q.size());
+
+                std::vector<typename PairingPolicy::g1_precomputed_type> prec_P;
+                std::vector<typename PairingPolicy::g2_precomputed_type> prec_Q;
+                prec_P.reserve(P.size());
+                prec_Q.reserve(Q.size());
+                for (std::size_t i = 0; i < P.size(); ++i) {
+                    if (P[i].is_zero() || Q[i].is_zero()) {
+                        continue;
+                    }
+                    prec_P.emplace_back(PairingPolicy::precompute_g1::process(P[i]));
+                    prec_Q.emplace_back(PairingPolicy::precompute_g2::process(Q[i]));
+                }
+
+                return multi_miller_loop<PairingCurveType, PairingPolicy>(prec_P, prec_Q);
+            }
+
+            /**
+             * @brief Product of pairings e(P[i], Q[i]), with a single final exponentiation for all of them.
+             */
+            template<typename PairingCurveType, typename PairingPolicy = pairing::pairing_policy<PairingCurveType>>
+            std::optional<typename PairingCurveType::gt_type::value_type>
+                multi_pair_reduced(const std::vector<typename PairingCurveType::template g1_type<>::value_type> &P,
+                                   const std::vector<typename PairingCurveType::template g2_type<>::value_type> &Q) {
+                return PairingPolicy::final_exponentiation::process(multi_pair<PairingCurveType, PairingPolicy>(P, Q));
+            }
+
+            /**
+             * @brief Checks that the product of pairings e(P[i], Q[i]) is one. Pairing equations of the form
+             * e(A, B) == e(C, D) are checked as e(A, B) * e(-C, D) == 1 this way, with one multi-Miller loop and one
+             * final exponentiation.
+             */
+            template<typename PairingCurveType, typename PairingPolicy = pairing::pairing_policy<PairingCurveType>>
+            bool pairing_product_is_one(const std::vector<typename PairingCurveType::template g1_type<>::value_type> &P,
+                                        const std::vector<typename PairingCurveType::template g2_type<>::value_type> &Q) {
+                auto result = multi_pair_reduced<PairingCurveType, PairingPolicy>(P, Q);
+                return result && *result == PairingCurveType::gt_type::value_type::one();
+            }
         }    // namespace algebra
     }        // namespace crypto3
 }    // namespace nil
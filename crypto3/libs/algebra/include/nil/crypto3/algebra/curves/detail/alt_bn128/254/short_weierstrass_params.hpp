@@ -69,6 +69,24 @@ namespace nil {
 
                         constexpr static const std::array<typename field_type::value_type, 2> one_fill = {
                             field_type::value_type::one(), typename field_type::value_type(0x02u)};
+
+                        // GLV endomorphism (x, y) -> (glv_beta * x, y) = glv_lambda * (x, y), see scalar_mul.hpp.
+                        constexpr static const typename field_type::value_type glv_beta =
+                            0x30644e72e131a0295e6dd9e7e0acccb0c28f069fbb966e3de4bd44e5607cfd48_big_uint254;
+                        constexpr static const typename scalar_field_type::value_type glv_lambda =
+                            0x30644e72e131a029048b6e193fd84104cc37a73fec2bc5e9b8ca0b2d36636f23_big_uint254;
+                        constexpr static const typename scalar_field_type::value_type glv_a1 =
+                            0x6f4d8248eeb859fc8211bbeb7d4f1128_big_uint254;
+                        constexpr static const typename scalar_field_type::value_type glv_minus_b1 =
+                            0x89d3256894d213e3_big_uint254;
+                        constexpr static const typename scalar_field_type::value_type glv_a2 =
+                            0x89d3256894d213e3_big_uint254;
+                        constexpr static const typename scalar_field_type::value_type glv_b2 =
+                            0x6f4d8248eeb859fd0be4e1541221250b_big_uint254;
+                        constexpr static const typename scalar_field_type::integral_type glv_g1 =
+                            0x24ccef014a773d2d25398fd0300ff6565_big_uint254;
+                        constexpr static const typename scalar_field_type::integral_type glv_g2 =
+                            0x2d91d232ec7e0b3d7_big_uint254;
                     };
 
                     template<>
@@ -114,6 +132,22 @@ namespace nil {
                     constexpr std::array<
                         typename alt_bn128_g1_params<254, forms::short_weierstrass>::field_type::value_type,
                         2> const alt_bn128_g1_params<254, forms::short_weierstrass>::one_fill;
+                    constexpr typename alt_bn128_g1_params<254, forms::short_weierstrass>::field_type::value_type const
+                        alt_bn128_g1_params<254, forms::short_weierstrass>::glv_beta;
+                    constexpr typename alt_bn128_g1_params<254, forms::short_weierstrass>::scalar_field_type::value_type const
+                        alt_bn128_g1_params<254, forms::short_weierstrass>::glv_lambda;
+                    constexpr typename alt_bn128_g1_params<254, forms::short_weierstrass>::scalar_field_type::value_type const
+                        alt_bn128_g1_params<254, forms::short_weierstrass>::glv_a1;
+                    constexpr typename alt_bn128_g1_params<254, forms::short_weierstrass>::scalar_field_type::value_type const
+                        alt_bn128_g1_params<254, forms::short_weierstrass>::glv_minus_b1;
+                    constexpr typename alt_bn128_g1_params<254, forms::short_weierstrass>::scalar_field_type::value_type const
+                        alt_bn128_g1_params<254, forms::short_weierstrass>::glv_a2;
+                    constexpr typename alt_bn128_g1_params<254, forms::short_weierstrass>::scalar_field_type::value_type const
+                        alt_bn128_g1_params<254, forms::short_weierstrass>::glv_b2;
+                    constexpr typename alt_bn128_g1_params<254, forms::short_weierstrass>::scalar_field_type::integral_type const
+                        alt_bn128_g1_params<254, forms::short_weierstrass>::glv_g1;
+                    constexpr typename alt_bn128_g1_params<254, forms::short_weierstrass>::scalar_field_type::integral_type const
+                        alt_bn128_g1_params<254, forms::short_weierstrass>::glv_g2;
                     constexpr std::array<
                         typename alt_bn128_g2_params<254, forms::short_weierstrass>::field_type::value_type,
                         2> const alt_bn128_g2_params<254, forms::short_weierstrass>::zero_fill;
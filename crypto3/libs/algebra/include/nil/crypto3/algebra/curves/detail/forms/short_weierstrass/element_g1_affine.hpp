@@ -144,6 +144,15 @@ namespace nil {
 
                         /*************************  Reducing operations  ***********************************/
 
+                        /** @brief
+                         *
+                         * @return the element itself, so that affine points can be used wherever the
+                         * affine coordinates of a point are taken
+                         */
+                        constexpr curve_element to_affine() const {
+                            return *this;
+                        }
+
                         /** @brief
                          *
                          * @return return the corresponding element from affine coordinates to
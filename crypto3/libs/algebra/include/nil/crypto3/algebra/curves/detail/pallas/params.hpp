@@ -75,6 +75,24 @@ namespace nil {
                         constexpr static std::array<typename field_type::value_type, 2> one_fill = {
                             field_type::modulus - 1,
                             typename field_type::value_type(2u)};
+
+                        // GLV endomorphism (x, y) -> (glv_beta * x, y) = glv_lambda * (x, y), see scalar_mul.hpp.
+                        constexpr static typename field_type::value_type glv_beta =
+                            0x2d33357cb532458ed3552a23a8554e5005270d29d19fc7d27b7fd22f0201b547_big_uint255;
+                        constexpr static typename scalar_field_type::value_type glv_lambda =
+                            0x397e65a7d7c1ad71aee24b27e308f0a61259527ec1d4752e619d1840af55f1b1_big_uint255;
+                        constexpr static typename scalar_field_type::value_type glv_a1 =
+                            0x49e69d1640a899538cb1279300000000_big_uint255;
+                        constexpr static typename scalar_field_type::value_type glv_minus_b1 =
+                            0x49e69d1640f049157fcae1c700000001_big_uint255;
+                        constexpr static typename scalar_field_type::value_type glv_a2 =
+                            0x93cd3a2c8198e2690c7c095a00000001_big_uint255;
+                        constexpr static typename scalar_field_type::value_type glv_b2 =
+                            0x49e69d1640a899538cb1279300000000_big_uint255;
+                        constexpr static typename scalar_field_type::integral_type glv_g1 =
+                            0x1279a745902a2654e32c49e4bffffffff_big_uint255;
+                        constexpr static typename scalar_field_type::integral_type glv_g2 =
+                            0x1279a745903c12455ff2b871c00000003_big_uint255;
 #endif
                     };
 
@@ -87,6 +105,22 @@ namespace nil {
                         pallas_g1_params<forms::short_weierstrass>::zero_fill;
                     constexpr std::array<typename pallas_g1_params<forms::short_weierstrass>::field_type::value_type, 2>
                         pallas_g1_params<forms::short_weierstrass>::one_fill;
+                    constexpr typename pallas_g1_params<forms::short_weierstrass>::field_type::value_type
+                        pallas_g1_params<forms::short_weierstrass>::glv_beta;
+                    constexpr typename pallas_g1_params<forms::short_weierstrass>::scalar_field_type::value_type
+                        pallas_g1_params<forms::short_weierstrass>::glv_lambda;
+                    constexpr typename pallas_g1_params<forms::short_weierstrass>::scalar_field_type::value_type
+                        pallas_g1_params<forms::short_weierstrass>::glv_a1;
+                    constexpr typename pallas_g1_params<forms::short_weierstrass>::scalar_field_type::value_type
+                        pallas_g1_params<forms::short_weierstrass>::glv_minus_b1;
+                    constexpr typename pallas_g1_params<forms::short_weierstrass>::scalar_field_type::value_type
+                        pallas_g1_params<forms::short_weierstrass>::glv_a2;
+                    constexpr typename pallas_g1_params<forms::short_weierstrass>::scalar_field_type::value_type
+                        pallas_g1_params<forms::short_weierstrass>::glv_b2;
+                    constexpr typename pallas_g1_params<forms::short_weierstrass>::scalar_field_type::integral_type
+                        pallas_g1_params<forms::short_weierstrass>::glv_g1;
+                    constexpr typename pallas_g1_params<forms::short_weierstrass>::scalar_field_type::integral_type
+                        pallas_g1_params<forms::short_weierstrass>::glv_g2;
 #endif
 
                 }    // namespace detail
@@ -28,6 +28,9 @@
 #ifndef CRYPTO3_ALGEBRA_CURVES_SCALAR_MUL_HPP
 #define CRYPTO3_ALGEBRA_CURVES_SCALAR_MUL_HPP
 
+#include <array>
+#include <type_traits>
+
 #include <nil/crypto3/algebra/type_traits.hpp>
 
 #include <nil/crypto3/multiprecision/big_uint.hpp>
@@ -41,6 +44,65 @@ namespace nil {
             namespace curves {
                 namespace detail {
 
+                    /*
+                     * Curves with an endomorphism (x, y) -> (glv_beta * x, y), acting on the group as
+                     * multiplication by glv_lambda, set glv_beta in the params of the group, together with a
+                     * reduced basis (glv_a1, -glv_minus_b1), (glv_a2, glv_b2) of the lattice of (a, b) with
+                     * a + b * glv_lambda = 0 mod r, and glv_g1 = round(2^256 * glv_b2 / r),
+                     * glv_g2 = round(2^256 * glv_minus_b1 / r). Multiplication by a scalar field element then
+                     * goes through the GLV decomposition.
+                     *
+                     * It's only set for groups of prime order, where the endomorphism acts as glv_lambda on
+                     * every point, so the result is the same as of the generic multiplication for any point.
+                     */
+                    template<typename CurveParams, typename = void>
+                    struct has_glv_endomorphism : std::false_type {};
+
+                    template<typename CurveParams>
+                    struct has_glv_endomorphism<CurveParams, std::void_t<decltype(CurveParams::glv_beta)>>
+                        : std::true_type {};
+
+                    /*
+                     * Window of the wnaf for scalars of the given bit length. With the window w the table holds
+                     * 2^w odd multiples and the main loop makes about scalar_bits / (w + 3) additions, the window
+                     * minimizing the sum is taken.
+                     */
+                    constexpr std::size_t wnaf_window_size(std::size_t scalar_bits) {
+                        std::size_t best = 1;
+                        for (std::size_t w = 2; w <= 6; ++w) {
+                            if ((1ul << w) + scalar_bits / (w + 3) < (1ul << best) + scalar_bits / (best + 3)) {
+                                best = w;
+                            }
+                        }
+                        return best;
+                    }
+
+                    // Odd multiples base, 3 * base, 5 * base, ..., indexed by (wnaf digit) / 2.
+                    template<std::size_t WindowSize, typename CurveElementType>
+                    constexpr std::array<CurveElementType, 1ul << WindowSize> wnaf_table(CurveElementType base) {
+                        std::array<CurveElementType, 1ul << WindowSize> table;
+                        CurveElementType dbl = base;
+                        dbl.double_inplace();
+                        for (std::size_t i = 0; i < 1ul << WindowSize; ++i) {
+                            table[i] = base;
+                            base += dbl;
+                        }
+                        return table;
+                    }
+
+                    template<typename CurveElementType, std::size_t TableSize>
+                    constexpr void add_wnaf_digit(
+                            CurveElementType &result,
+                            const std::array<CurveElementType, TableSize> &table,
+                            long digit)
+                    {
+                        if (digit > 0) {
+                            result += table[digit / 2];
+                        } else {
+                            result -= table[(-digit) / 2];
+                        }
+                    }
+
                     template<typename CurveElementType, std::size_t Bits>
                     constexpr void scalar_mul_inplace(
                             CurveElementType &base,
@@ -51,15 +113,9 @@ namespace nil {
                             return;
                         }
 
-                        const size_t window_size = 3;
+                        constexpr std::size_t window_size = wnaf_window_size(Bits);
                         auto naf = nil::crypto3::multiprecision::find_wnaf_a(window_size + 1, scalar);
-                        std::array<CurveElementType, 1ul << window_size > table;
-                        CurveElementType dbl = base;
-                        dbl.double_inplace();
-                        for (size_t i = 0; i < 1ul << window_size; ++i) {
-                            table[i] = base;
-                            base += dbl;
-                        }
+                        const auto table = wnaf_table<window_size>(base);
 
                         base = CurveElementType::zero();
                         bool found_nonzero = false;
@@ -70,22 +126,96 @@ namespace nil {
 
                             if (naf[i] != 0) {
                                 found_nonzero = true;
-                                if (naf[i] > 0) {
-                                    base += table[naf[i] / 2];
-                                } else {
-                                    base -= table[(-naf[i]) / 2];
-                                }
+                                add_wnaf_digit(base, table, naf[i]);
                             }
                         }
                     }
 
+                    /*
+                     * GLV multiplication: the scalar is split as k = k1 + k2 * lambda mod r with k1, k2 of half
+                     * the size, and k1 * P + k2 * phi(P) is computed with interleaved wnafs, sharing the doublings.
+                     */
+                    template<typename CurveElementType>
+                    constexpr void glv_scalar_mul_inplace(
+                            CurveElementType &base,
+                            typename CurveElementType::params_type::scalar_field_type::value_type const& scalar)
+                    {
+                        using params_type = typename CurveElementType::params_type;
+                        using scalar_field_type = typename params_type::scalar_field_type;
+                        using scalar_value_type = typename scalar_field_type::value_type;
+                        using integral_type = typename scalar_field_type::integral_type;
+                        using wide_integral_type = nil::crypto3::multiprecision::big_uint<2 * integral_type::Bits>;
+
+                        // Coordinates of k in the lattice basis, c_i = round(k * g_i / 2^256).
+                        const wide_integral_type k = static_cast<integral_type>(scalar.data);
+                        const wide_integral_type half = wide_integral_type(1u) << 255;
+                        const scalar_value_type c1 = static_cast<integral_type>(
+                            (k * wide_integral_type(params_type::glv_g1) + half) >> 256);
+                        const scalar_value_type c2 = static_cast<integral_type>(
+                            (k * wide_integral_type(params_type::glv_g2) + half) >> 256);
+
+                        const scalar_value_type k1 = scalar - c1 * params_type::glv_a1 - c2 * params_type::glv_a2;
+                        const scalar_value_type k2 = c1 * params_type::glv_minus_b1 - c2 * params_type::glv_b2;
+
+                        // k1 and k2 are short, but either may be negative.
+                        auto magnitude = [](const scalar_value_type &value, bool &negative) {
+                            const integral_type v = static_cast<integral_type>(value.data);
+                            const integral_type minus_v = scalar_field_type::modulus - v;
+                            negative = minus_v < v;
+                            return negative ? minus_v : v;
+                        };
+                        bool k1_negative = false, k2_negative = false;
+                        const integral_type k1_magnitude = magnitude(k1, k1_negative);
+                        const integral_type k2_magnitude = magnitude(k2, k2_negative);
+
+                        constexpr std::size_t window_size = wnaf_window_size(integral_type::Bits / 2);
+                        const auto naf1 = nil::crypto3::multiprecision::find_wnaf_a(window_size + 1, k1_magnitude);
+                        const auto naf2 = nil::crypto3::multiprecision::find_wnaf_a(window_size + 1, k2_magnitude);
+
+                        const auto table1 = wnaf_table<window_size>(base);
+                        auto table2 = table1;
+                        for (auto &point : table2) {
+                            point.X *= params_type::glv_beta;
+                        }
+
+                        base = CurveElementType::zero();
+                        bool found_nonzero = false;
+                        for (long i = naf1.size() - 1; i >= 0; --i) {
+                            if (found_nonzero) {
+                                base.double_inplace();
+                            }
+
+                            if (naf1[i] != 0) {
+                                found_nonzero = true;
+                                add_wnaf_digit(base, table1, k1_negative ? -naf1[i] : naf1[i]);
+                            }
+                            if (naf2[i] != 0) {
+                                found_nonzero = true;
+                                add_wnaf_digit(base, table2, k2_negative ? -naf2[i] : naf2[i]);
+                            }
+                        }
+                    }
+
+                    // Multiplication by an element of the scalar field, the GLV one where the curve supports it.
+                    template<typename CurveElementType>
+                    constexpr void scalar_field_mul_inplace(
+                            CurveElementType &point,
+                            typename CurveElementType::params_type::scalar_field_type::value_type const& scalar)
+                    {
+                        if constexpr (has_glv_endomorphism<typename CurveElementType::params_type>::value) {
+                            glv_scalar_mul_inplace(point, scalar);
+                        } else {
+                            using scalar_integral_type = typename CurveElementType::params_type::scalar_field_type::integral_type;
+                            scalar_mul_inplace(point, static_cast<scalar_integral_type>(scalar.data));
+                        }
+                    }
+
                     template<typename CurveElementType>
                     constexpr CurveElementType& operator *= (
                             CurveElementType& point,
                             typename CurveElementType::params_type::scalar_field_type::value_type const& scalar)
                     {
-                        using scalar_integral_type = typename CurveElementType::params_type::scalar_field_type::integral_type;
-                        scalar_mul_inplace(point, static_cast<scalar_integral_type>(scalar.data));
+                        scalar_field_mul_inplace(point, scalar);
                         return point;
                     }
 
@@ -94,9 +224,8 @@ namespace nil {
                             CurveElementType const& point,
                             typename CurveElementType::params_type::scalar_field_type::value_type const& scalar)
                     {
-                        using scalar_integral_type = typename CurveElementType::params_type::scalar_field_type::integral_type;
                         CurveElementType res = point;
-                        scalar_mul_inplace(res, static_cast<scalar_integral_type>(scalar.data));
+                        scalar_field_mul_inplace(res, scalar);
                         return res;
                     }
 
@@ -105,9 +234,8 @@ namespace nil {
                             typename CurveElementType::params_type::scalar_field_type::value_type const& scalar,
                             CurveElementType const& point)
                     {
-                        using scalar_integral_type = typename CurveElementType::params_type::scalar_field_type::integral_type;
                         CurveElementType res = point;
-                        scalar_mul_inplace(res, static_cast<scalar_integral_type>(scalar.data));
+                        scalar_field_mul_inplace(res, scalar);
                         return res;
                     }
 
@@ -218,6 +218,24 @@ namespace nil {
                                 0x79BE667EF9DCBBAC55A06295CE870B07029BFCDB2DCE28D959F2815B16F81798_big_uint256),
                             typename field_type::value_type(
                                 0x483ADA7726A3C4655DA4FBFC0E1108A8FD17B448A68554199C47D08FFB10D4B8_big_uint256)};
+
+                        // GLV endomorphism (x, y) -> (glv_beta * x, y) = glv_lambda * (x, y), see scalar_mul.hpp.
+                        constexpr static const typename field_type::value_type glv_beta =
+                            0x7ae96a2b657c07106e64479eac3434e99cf0497512f58995c1396c28719501ee_big_uint256;
+                        constexpr static const typename scalar_field_type::value_type glv_lambda =
+                            0x5363ad4cc05c30e0a5261c028812645a122e22ea20816678df02967c1b23bd72_big_uint256;
+                        constexpr static const typename scalar_field_type::value_type glv_a1 =
+                            0x3086d221a7d46bcde86c90e49284eb15_big_uint256;
+                        constexpr static const typename scalar_field_type::value_type glv_minus_b1 =
+                            0xe4437ed6010e88286f547fa90abfe4c3_big_uint256;
+                        constexpr static const typename scalar_field_type::value_type glv_a2 =
+                            0x114ca50f7a8e2f3f657c1108d9d44cfd8_big_uint256;
+                        constexpr static const typename scalar_field_type::value_type glv_b2 =
+                            0x3086d221a7d46bcde86c90e49284eb15_big_uint256;
+                        constexpr static const typename scalar_field_type::integral_type glv_g1 =
+                            0x3086d221a7d46bcde86c90e49284eb15_big_uint256;
+                        constexpr static const typename scalar_field_type::integral_type glv_g2 =
+                            0xe4437ed6010e88286f547fa90abfe4c4_big_uint256;
                     };
 
                     constexpr typename secp_k1_types<256>::base_field_type::value_type const
@@ -231,6 +249,22 @@ namespace nil {
                     constexpr std::array<
                         typename secp_k1_g1_params<256, forms::short_weierstrass>::field_type::value_type, 2> const
                         secp_k1_g1_params<256, forms::short_weierstrass>::one_fill;
+                    constexpr typename secp_k1_g1_params<256, forms::short_weierstrass>::field_type::value_type const
+                        secp_k1_g1_params<256, forms::short_weierstrass>::glv_beta;
+                    constexpr typename secp_k1_g1_params<256, forms::short_weierstrass>::scalar_field_type::value_type const
+                        secp_k1_g1_params<256, forms::short_weierstrass>::glv_lambda;
+                    constexpr typename secp_k1_g1_params<256, forms::short_weierstrass>::scalar_field_type::value_type const
+                        secp_k1_g1_params<256, forms::short_weierstrass>::glv_a1;
+                    constexpr typename secp_k1_g1_params<256, forms::short_weierstrass>::scalar_field_type::value_type const
+                        secp_k1_g1_params<256, forms::short_weierstrass>::glv_minus_b1;
+                    constexpr typename secp_k1_g1_params<256, forms::short_weierstrass>::scalar_field_type::value_type const
+                        secp_k1_g1_params<256, forms::short_weierstrass>::glv_a2;
+                    constexpr typename secp_k1_g1_params<256, forms::short_weierstrass>::scalar_field_type::value_type const
+                        secp_k1_g1_params<256, forms::short_weierstrass>::glv_b2;
+                    constexpr typename secp_k1_g1_params<256, forms::short_weierstrass>::scalar_field_type::integral_type const
+                        secp_k1_g1_params<256, forms::short_weierstrass>::glv_g1;
+                    constexpr typename secp_k1_g1_params<256, forms::short_weierstrass>::scalar_field_type::integral_type const
+                        secp_k1_g1_params<256, forms::short_weierstrass>::glv_g2;
                 }    // namespace detail
             }        // namespace curves
         }            // namespace algebra
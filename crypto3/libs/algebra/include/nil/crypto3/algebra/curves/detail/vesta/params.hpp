@@ -76,6 +76,24 @@ namespace nil {
                         constexpr static std::array<typename field_type::value_type, 2> one_fill = {
                             field_type::modulus - 1,
                             typename field_type::value_type(2u)};
+
+                        // GLV endomorphism (x, y) -> (glv_beta * x, y) = glv_lambda * (x, y), see scalar_mul.hpp.
+                        constexpr static typename field_type::value_type glv_beta =
+                            0x6819a58283e528e511db4d81cf70f5a0fed467d47c033af2aa9d2e050aa0e4f_big_uint255;
+                        constexpr static typename scalar_field_type::value_type glv_lambda =
+                            0x12ccca834acdba712caad5dc57aab1b01d1f8bd237ad31491dad5ebdfdfe4ab9_big_uint255;
+                        constexpr static typename scalar_field_type::value_type glv_a1 =
+                            0x49e69d1640f049157fcae1c700000000_big_uint255;
+                        constexpr static typename scalar_field_type::value_type glv_minus_b1 =
+                            0x49e69d1640a899538cb1279300000001_big_uint255;
+                        constexpr static typename scalar_field_type::value_type glv_a2 =
+                            0x49e69d1640a899538cb1279300000001_big_uint255;
+                        constexpr static typename scalar_field_type::value_type glv_b2 =
+                            0x93cd3a2c8198e2690c7c095a00000001_big_uint255;
+                        constexpr static typename scalar_field_type::integral_type glv_g1 =
+                            0x24f34e8b2066389a431f0256800000003_big_uint255;
+                        constexpr static typename scalar_field_type::integral_type glv_g2 =
+                            0x1279a745902a2654e32c49e4c00000003_big_uint255;
 #endif
                     };
 
@@ -88,6 +106,22 @@ namespace nil {
                         vesta_g1_params<forms::short_weierstrass>::zero_fill;
                     constexpr std::array<typename vesta_g1_params<forms::short_weierstrass>::field_type::value_type, 2>
                         vesta_g1_params<forms::short_weierstrass>::one_fill;
+                    constexpr typename vesta_g1_params<forms::short_weierstrass>::field_type::value_type
+                        vesta_g1_params<forms::short_weierstrass>::glv_beta;
+                    constexpr typename vesta_g1_params<forms::short_weierstrass>::scalar_field_type::value_type
+                        vesta_g1_params<forms::short_weierstrass>::glv_lambda;
+                    constexpr typename vesta_g1_params<forms::short_weierstrass>::scalar_field_type::value_type
+                        vesta_g1_params<forms::short_weierstrass>::glv_a1;
+                    constexpr typename vesta_g1_params<forms::short_weierstrass>::scalar_field_type::value_type
+                        vesta_g1_params<forms::short_weierstrass>::glv_minus_b1;
+                    constexpr typename vesta_g1_params<forms::short_weierstrass>::scalar_field_type::value_type
+                        vesta_g1_params<forms::short_weierstrass>::glv_a2;
+                    constexpr typename vesta_g1_params<forms::short_weierstrass>::scalar_field_type::value_type
+                        vesta_g1_params<forms::short_weierstrass>::glv_b2;
+                    constexpr typename vesta_g1_params<forms::short_weierstrass>::scalar_field_type::integral_type
+                        vesta_g1_params<forms::short_weierstrass>::glv_g1;
+                    constexpr typename vesta_g1_params<forms::short_weierstrass>::scalar_field_type::integral_type
+                        vesta_g1_params<forms::short_weierstrass>::glv_g2;
 #endif
 
                 }    // namespace detail
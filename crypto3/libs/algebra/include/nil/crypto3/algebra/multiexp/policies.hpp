@@ -27,10 +27,17 @@
 #ifndef CRYPTO3_ALGEBRA_MULTIEXP_BASIC_POLICIES_HPP
 #define CRYPTO3_ALGEBRA_MULTIEXP_BASIC_POLICIES_HPP
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
 #include <vector>
 #include <boost/assert.hpp>
 
 #include <nil/crypto3/algebra/wnaf.hpp>
+#include <nil/crypto3/algebra/curves/forms.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/short_weierstrass/coordinates.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -52,6 +59,273 @@ namespace nil {
                             return (this->r < other.r);
                         }
                     };
+
+                    /**
+                     * Task runner of basic_multiexp_method_pippenger which calls func(task) for every task in
+                     * [0, tasks_count) on the calling thread. The parallel tree provides one running them on its
+                     * thread pool.
+                     */
+                    struct sequential_multiexp_tasks {
+                        static std::size_t workers_count() {
+                            return 1;
+                        }
+
+                        template<typename Func>
+                        static void run(std::size_t tasks_count, const Func &func) {
+                            for (std::size_t task = 0; task < tasks_count; ++task) {
+                                func(task);
+                            }
+                        }
+                    };
+
+                    template<typename Coordinates>
+                    struct is_jacobian_coordinates : std::false_type { };
+                    template<>
+                    struct is_jacobian_coordinates<curves::coordinates::jacobian> : std::true_type { };
+                    template<>
+                    struct is_jacobian_coordinates<curves::coordinates::jacobian_with_a4_0> : std::true_type { };
+                    template<>
+                    struct is_jacobian_coordinates<curves::coordinates::jacobian_with_a4_minus_3> : std::true_type { };
+
+                    template<typename Coordinates>
+                    struct is_projective_coordinates : std::false_type { };
+                    template<>
+                    struct is_projective_coordinates<curves::coordinates::projective> : std::true_type { };
+                    template<>
+                    struct is_projective_coordinates<curves::coordinates::projective_with_a4_minus_3>
+                        : std::true_type { };
+
+                    /**
+                     * Batch-affine bucket additions are only implemented for short Weierstrass points, stored
+                     * in the coordinates we know how to convert to affine with a shared inversion.
+                     */
+                    template<typename BaseValueType>
+                    constexpr bool supports_batch_affine_buckets() {
+                        using coordinates = typename BaseValueType::coordinates;
+                        return std::is_same<typename BaseValueType::form, curves::forms::short_weierstrass>::value &&
+                               (is_jacobian_coordinates<coordinates>::value ||
+                                is_projective_coordinates<coordinates>::value ||
+                                std::is_same<coordinates, curves::coordinates::affine>::value);
+                    }
+
+                    template<typename BaseValueType, typename = void>
+                    struct affine_value_type_of {
+                        using type = BaseValueType;
+                    };
+
+                    template<typename BaseValueType>
+                    struct affine_value_type_of<BaseValueType,
+                                                std::void_t<decltype(std::declval<BaseValueType>().to_affine())>> {
+                        using type = decltype(std::declval<BaseValueType>().to_affine());
+                    };
+
+                    /**
+                     * Converts bases[begin, end) to affine coordinates with a single field inversion
+                     * (Montgomery's trick), writing the points to result[begin, end).
+                     */
+                    template<typename InputBaseIterator, typename AffineValueType>
+                    void batch_to_affine(InputBaseIterator bases, std::size_t begin, std::size_t end,
+                                         std::vector<AffineValueType> &result) {
+                        using base_value_type = typename std::iterator_traits<InputBaseIterator>::value_type;
+                        using coordinates = typename base_value_type::coordinates;
+                        using field_value_type = std::remove_cv_t<decltype(std::declval<base_value_type>().X)>;
+
+                        if constexpr (std::is_same<coordinates, curves::coordinates::affine>::value) {
+                            for (std::size_t i = begin; i < end; ++i) {
+                                result[i] = bases[i];
+                            }
+                        } else {
+                            // prefix[i] is the product of Z coordinates of all non-zero points before i.
+                            std::vector<field_value_type> prefix(end - begin);
+                            field_value_type acc = field_value_type::one();
+                            for (std::size_t i = begin; i < end; ++i) {
+                                if (!bases[i].is_zero()) {
+                                    prefix[i - begin] = acc;
+                                    acc *= bases[i].Z;
+                                }
+                            }
+
+                            field_value_type inv = acc.inversed();
+                            for (std::size_t i = end; i-- > begin;) {
+                                const base_value_type &p = bases[i];
+                                if (p.is_zero()) {
+                                    result[i] = AffineValueType::zero();
+                                    continue;
+                                }
+                                const field_value_type z_inv = inv * prefix[i - begin];
+                                inv *= p.Z;
+                                if constexpr (is_jacobian_coordinates<coordinates>::value) {
+                                    // x = X/Z^2, y = Y/Z^3
+                                    const field_value_type z_inv2 = z_inv.squared();
+                                    result[i] = AffineValueType(p.X * z_inv2, p.Y * z_inv2 * z_inv);
+                                } else {
+                                    // x = X/Z, y = Y/Z
+                                    result[i] = AffineValueType(p.X * z_inv, p.Y * z_inv);
+                                }
+                            }
+                        }
+                    }
+
+                    template<typename BaseValueType, typename AffineValueType>
+                    BaseValueType from_affine_coordinates(const AffineValueType &p) {
+                        if constexpr (std::is_same<BaseValueType, AffineValueType>::value) {
+                            return p;
+                        } else {
+                            return p.is_zero() ? BaseValueType::zero() : BaseValueType(p.X, p.Y);
+                        }
+                    }
+
+                    /**
+                     * Sums buckets with the usual running sum: returns sum of (i + 1) * bucket(i).
+                     */
+                    template<typename BaseValueType, typename BucketAt>
+                    BaseValueType sum_buckets(std::size_t buckets_count, const BucketAt &bucket_at) {
+                        BaseValueType running_sum = BaseValueType::zero();
+                        BaseValueType result = BaseValueType::zero();
+                        for (std::size_t i = buckets_count; i-- > 0;) {
+                            running_sum += bucket_at(i);
+                            result += running_sum;
+                        }
+                        return result;
+                    }
+
+                    /**
+                     * Buckets kept in projective (or whatever the base type is) form, used when batch-affine
+                     * additions are not available or not worth it.
+                     */
+                    template<typename BaseValueType>
+                    class projective_buckets {
+                    public:
+                        explicit projective_buckets(std::size_t buckets_count) :
+                            buckets_(buckets_count, BaseValueType::zero()) {
+                        }
+
+                        void add(std::size_t bucket, const BaseValueType &point, bool negate) {
+                            if (negate) {
+                                buckets_[bucket] -= point;
+                            } else {
+                                buckets_[bucket] += point;
+                            }
+                        }
+
+                        BaseValueType sum() const {
+                            return sum_buckets<BaseValueType>(buckets_.size(),
+                                                              [this](std::size_t i) { return buckets_[i]; });
+                        }
+
+                    private:
+                        std::vector<BaseValueType> buckets_;
+                    };
+
+                    /**
+                     * Buckets kept in affine form. Additions are queued and applied in batches, so that all the
+                     * slope denominators of a batch share one field inversion. A batch contains at most one
+                     * addition per bucket; a point for a bucket that already has a queued addition goes to an
+                     * overflow bucket in projective form instead. With batches much smaller than the number of
+                     * buckets that happens rarely.
+                     */
+                    template<typename BaseValueType, typename AffineValueType>
+                    class batch_affine_buckets {
+                        using field_value_type = std::remove_cv_t<decltype(std::declval<AffineValueType>().X)>;
+
+                    public:
+                        batch_affine_buckets(std::size_t buckets_count, std::size_t batch_size) :
+                            buckets_(buckets_count), nonzero_(buckets_count, 0), queued_(buckets_count, 0),
+                            batch_size_(batch_size) {
+                            batch_.reserve(batch_size);
+                            prefix_.reserve(batch_size);
+                        }
+
+                        void add(std::size_t bucket, const AffineValueType &point, bool negate) {
+                            if (point.is_zero()) {
+                                return;
+                            }
+                            if (!nonzero_[bucket]) {
+                                buckets_[bucket] = negate ? -point : point;
+                                nonzero_[bucket] = 1;
+                                return;
+                            }
+                            if (queued_[bucket]) {
+                                add_to_overflow(bucket, negate ? -point : point);
+                                return;
+                            }
+                            queued_[bucket] = 1;
+                            batch_.emplace_back(bucket, negate ? -point : point);
+                            if (batch_.size() >= batch_size_) {
+                                flush();
+                            }
+                        }
+
+                        BaseValueType sum() {
+                            flush();
+                            return sum_buckets<BaseValueType>(buckets_.size(), [this](std::size_t i) {
+                                BaseValueType bucket = nonzero_[i] ? from_affine_coordinates<BaseValueType>(buckets_[i])
+                                                                   : BaseValueType::zero();
+                                if (!overflow_.empty()) {
+                                    bucket += overflow_[i];
+                                }
+                                return bucket;
+                            });
+                        }
+
+                    private:
+                        void add_to_overflow(std::size_t bucket, const AffineValueType &point) {
+                            if (overflow_.empty()) {
+                                overflow_.assign(buckets_.size(), BaseValueType::zero());
+                            }
+                            overflow_[bucket] += from_affine_coordinates<BaseValueType>(point);
+                        }
+
+                        void flush() {
+                            // Equal x coordinates mean doubling or cancellation. Those are rare, and the affine
+                            // formulas do not cover them, so such points go to the overflow buckets.
+                            std::size_t regular = 0;
+                            for (std::size_t j = 0; j < batch_.size(); ++j) {
+                                const std::size_t bucket = batch_[j].first;
+                                if (batch_[j].second.X == buckets_[bucket].X) {
+                                    add_to_overflow(bucket, batch_[j].second);
+                                    queued_[bucket] = 0;
+                                } else {
+                                    if (regular != j) {
+                                        batch_[regular] = batch_[j];
+                                    }
+                                    ++regular;
+                                }
+                            }
+                            batch_.resize(regular);
+
+                            prefix_.resize(batch_.size());
+                            field_value_type acc = field_value_type::one();
+                            for (std::size_t j = 0; j < batch_.size(); ++j) {
+                                prefix_[j] = acc;
+                                acc *= batch_[j].second.X - buckets_[batch_[j].first].X;
+                            }
+
+                            field_value_type inv = acc.inversed();
+                            for (std::size_t j = batch_.size(); j-- > 0;) {
+                                AffineValueType &bucket = buckets_[batch_[j].first];
+                                const AffineValueType &point = batch_[j].second;
+                                const field_value_type dx = point.X - bucket.X;
+                                const field_value_type lambda = (point.Y - bucket.Y) * inv * prefix_[j];
+                                inv *= dx;
+
+                                const field_value_type x = lambda.squared() - bucket.X - point.X;
+                                bucket.Y = lambda * (bucket.X - x) - bucket.Y;
+                                bucket.X = x;
+                                queued_[batch_[j].first] = 0;
+                            }
+                            batch_.clear();
+                        }
+
+                        std::vector<AffineValueType> buckets_;
+                        std::vector<std::uint8_t> nonzero_;
+                        std::vector<std::uint8_t> queued_;
+                        std::vector<BaseValueType> overflow_;
+                        std::vector<std::pair<std::size_t, AffineValueType>> batch_;
+                        std::vector<field_value_type> prefix_;
+                        std::size_t batch_size_;
+                    };
+
                 }    // namespace detail
 
                 /**
@@ -200,6 +474,151 @@ namespace nil {
                     }
                 };
 
+                /**
+                 * Pippenger's algorithm with signed digits.
+                 *
+                 * Scalars are recoded into signed c-bit digits in [-2^(c-1) + 1, 2^(c-1)], so every window
+                 * needs only 2^(c-1) buckets, the sign of a digit just negates the base. Windows and chunks of
+                 * bases are processed as independent tasks, which TaskRunner may run in parallel, and the
+                 * partial sums are combined at the end.
+                 *
+                 * For short Weierstrass curves bases are converted to affine coordinates once, and the bucket
+                 * additions are done in affine coordinates in batches sharing one field inversion, which is
+                 * considerably cheaper than mixed addition. Other curves accumulate buckets with the group
+                 * operations of the base type.
+                 */
+                template<typename TaskRunner = detail::sequential_multiexp_tasks>
+                struct basic_multiexp_method_pippenger {
+                    template<typename InputBaseIterator, typename InputFieldIterator>
+                    static inline typename std::iterator_traits<InputBaseIterator>::value_type
+                        process(InputBaseIterator bases,
+                                InputBaseIterator bases_end,
+                                InputFieldIterator exponents,
+                                InputFieldIterator exponents_end) {
+
+                        typedef typename std::iterator_traits<InputBaseIterator>::value_type base_value_type;
+                        typedef typename std::iterator_traits<InputFieldIterator>::value_type field_value_type;
+                        using integral_type = std::remove_cv_t<std::remove_reference_t<
+                            decltype(std::declval<field_value_type>().data.base())>>;
+
+                        const std::size_t length = std::distance(bases, bases_end);
+                        BOOST_ASSERT(length == std::size_t(std::distance(exponents, exponents_end)));
+
+                        if (length == 0) {
+                            return base_value_type::zero();
+                        }
+
+                        const std::size_t c = window_bits(length);
+                        const std::size_t buckets_count = std::size_t(1) << (c - 1);
+                        // With signed digits the top window must not produce a carry, so there is always a window
+                        // above the top bit of the modulus.
+                        const std::size_t windows_count = field_value_type::field_type::modulus_bits / c + 1;
+
+                        const std::size_t workers_count = std::max<std::size_t>(1, TaskRunner::workers_count());
+                        const std::size_t min_chunk_size = std::max<std::size_t>(1024, buckets_count);
+                        const std::size_t chunks_count = std::clamp<std::size_t>(
+                            (2 * workers_count + windows_count - 1) / windows_count, 1,
+                            std::max<std::size_t>(1, length / min_chunk_size));
+                        const std::size_t chunk_size = (length + chunks_count - 1) / chunks_count;
+
+                        const std::uint32_t window_mask = (std::uint32_t(1) << c) - 1;
+                        // digits[k * length + i] is the k-th signed digit of the i-th scalar.
+                        std::vector<std::int32_t> digits(windows_count * length);
+                        const std::size_t recode_chunk_size = std::max<std::size_t>(
+                            1024, (length + 4 * workers_count - 1) / (4 * workers_count));
+                        TaskRunner::run(
+                            (length + recode_chunk_size - 1) / recode_chunk_size, [&](std::size_t task) {
+                                const std::size_t end = std::min(length, (task + 1) * recode_chunk_size);
+                                for (std::size_t i = task * recode_chunk_size; i < end; ++i) {
+                                    integral_type scalar = exponents[i].data.base();
+                                    std::int32_t carry = 0;
+                                    for (std::size_t k = 0; k < windows_count; ++k) {
+                                        std::int32_t digit = std::int32_t(scalar & window_mask) + carry;
+                                        scalar >>= c;
+                                        carry = digit > std::int32_t(buckets_count) ? 1 : 0;
+                                        digits[k * length + i] = digit - (carry << c);
+                                    }
+                                    BOOST_ASSERT(carry == 0);
+                                }
+                            });
+
+                        std::vector<base_value_type> partial_sums(windows_count * chunks_count);
+
+                        constexpr bool use_batch_affine = detail::supports_batch_affine_buckets<base_value_type>();
+                        if constexpr (use_batch_affine) {
+                            using affine_value_type = typename detail::affine_value_type_of<base_value_type>::type;
+
+                            std::vector<affine_value_type> affine_bases(length);
+                            TaskRunner::run(
+                                (length + recode_chunk_size - 1) / recode_chunk_size, [&](std::size_t task) {
+                                    detail::batch_to_affine(bases, task * recode_chunk_size,
+                                                            std::min(length, (task + 1) * recode_chunk_size),
+                                                            affine_bases);
+                                });
+
+                            const std::size_t batch_size = std::clamp<std::size_t>(buckets_count / 8, 16, 1024);
+                            TaskRunner::run(windows_count * chunks_count, [&](std::size_t task) {
+                                detail::batch_affine_buckets<base_value_type, affine_value_type> buckets(
+                                    buckets_count, batch_size);
+                                accumulate_window(task, length, chunk_size, chunks_count, digits, affine_bases,
+                                                  buckets);
+                                partial_sums[task] = buckets.sum();
+                            });
+                        } else {
+                            TaskRunner::run(windows_count * chunks_count, [&](std::size_t task) {
+                                detail::projective_buckets<base_value_type> buckets(buckets_count);
+                                accumulate_window(task, length, chunk_size, chunks_count, digits, bases, buckets);
+                                partial_sums[task] = buckets.sum();
+                            });
+                        }
+
+                        base_value_type result = base_value_type::zero();
+                        for (std::size_t k = windows_count; k-- > 0;) {
+                            if (!result.is_zero()) {
+                                for (std::size_t i = 0; i < c; ++i) {
+                                    result.double_inplace();
+                                }
+                            }
+                            for (std::size_t chunk = 0; chunk < chunks_count; ++chunk) {
+                                result += partial_sums[k * chunks_count + chunk];
+                            }
+                        }
+
+                        return result;
+                    }
+
+                private:
+                    static std::size_t window_bits(std::size_t length) {
+                        if (length < 32) {
+                            return 3;
+                        }
+                        // Signed digits halve the number of buckets, so we can afford one bit more than the usual
+                        // ln(n) + 2 estimate.
+                        return std::min<std::size_t>(16, std::size_t(std::log(double(length))) + 3);
+                    }
+
+                    // Task 'task' handles window task / chunks_count for the bases of chunk task % chunks_count.
+                    template<typename PointsRange, typename Buckets>
+                    static void accumulate_window(std::size_t task, std::size_t length, std::size_t chunk_size,
+                                                  std::size_t chunks_count, const std::vector<std::int32_t> &digits,
+                                                  const PointsRange &points, Buckets &buckets) {
+                        const std::size_t window = task / chunks_count;
+                        const std::size_t begin = (task % chunks_count) * chunk_size;
+                        const std::size_t end = std::min(length, begin + chunk_size);
+                        const std::int32_t *window_digits = digits.data() + window * length;
+                        for (std::size_t i = begin; i < end; ++i) {
+                            const std::int32_t digit = window_digits[i];
+                            if (digit > 0) {
+                                buckets.add(digit - 1, points[i], false);
+                            } else if (digit < 0) {
+                                buckets.add(-digit - 1, points[i], true);
+                            }
+                        }
+                    }
+                };
+
+                using multiexp_method_pippenger = basic_multiexp_method_pippenger<>;
+
                 /**
                  * A variant of the Bos-Coster algorithm [1],
                  * with implementation suggestions from [2].
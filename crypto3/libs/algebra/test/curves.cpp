@@ -57,6 +57,7 @@
 #include <nil/crypto3/algebra/curves/pallas.hpp>
 #include <nil/crypto3/algebra/fields/fp2.hpp>
 #include <nil/crypto3/algebra/fields/fp3.hpp>
+#include <nil/crypto3/algebra/random_element.hpp>
 
 #include <nil/crypto3/multiprecision/literals.hpp>
 
@@ -636,6 +637,71 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(bls12_377_order_test, runner, bls12_377_orders_2_4
     BOOST_CHECK(runner::run());
 }
 
+/*
+ * GLV multiplication must give the same points as the generic wnaf one
+ */
+template<typename GroupType>
+void glv_scalar_mul_test() {
+    using params_type = typename GroupType::params_type;
+    using value_type = typename GroupType::value_type;
+    using scalar_field_type = typename GroupType::curve_type::scalar_field_type;
+    using scalar_type = typename scalar_field_type::value_type;
+    using integral_type = typename scalar_field_type::integral_type;
+
+    static_assert(curves::detail::has_glv_endomorphism<params_type>::value);
+
+    const value_type one = value_type::one();
+    value_type phi = one;
+    phi.X *= params_type::glv_beta;
+    BOOST_CHECK(phi.is_well_formed());
+    BOOST_CHECK_EQUAL(phi, one * params_type::glv_lambda);
+
+    std::vector<scalar_type> scalars = {
+        scalar_type::zero(), scalar_type::one(), -scalar_type::one(), scalar_type(2u),
+        params_type::glv_lambda, -params_type::glv_lambda, params_type::glv_a1, params_type::glv_b2,
+        scalar_type(scalar_field_type::modulus / 2u), scalar_type(scalar_field_type::modulus / 2u + 1u)};
+    for (std::size_t i = 0; i < 100; ++i) {
+        scalars.push_back(random_element<scalar_field_type>());
+    }
+
+    for (const auto &s : scalars) {
+        value_type p = one;
+        curves::detail::scalar_mul_inplace(
+            p, static_cast<integral_type>(random_element<scalar_field_type>().data));
+        value_type expected = p;
+        curves::detail::scalar_mul_inplace(expected, static_cast<integral_type>(s.data));
+
+        BOOST_CHECK_EQUAL(p * s, expected);
+        BOOST_CHECK_EQUAL(s * p, expected);
+        value_type q = p;
+        q *= s;
+        BOOST_CHECK_EQUAL(q, expected);
+        BOOST_CHECK_EQUAL(value_type::zero() * s, value_type::zero());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(glv_scalar_mul_test_pallas) {
+    glv_scalar_mul_test<curves::pallas::g1_type<>>();
+}
+
+BOOST_AUTO_TEST_CASE(glv_scalar_mul_test_vesta) {
+    glv_scalar_mul_test<curves::vesta::g1_type<>>();
+}
+
+BOOST_AUTO_TEST_CASE(glv_scalar_mul_test_alt_bn128_254) {
+    glv_scalar_mul_test<curves::alt_bn128_254::g1_type<>>();
+}
+
+BOOST_AUTO_TEST_CASE(glv_scalar_mul_test_secp256_k1) {
+    glv_scalar_mul_test<curves::secp_k1<256>::g1_type<>>();
+}
+
+BOOST_AUTO_TEST_CASE(glv_scalar_mul_test_no_endomorphism) {
+    static_assert(!curves::detail::has_glv_endomorphism<curves::bls12_381::g1_type<>::params_type>::value);
+    static_assert(!curves::detail::has_glv_endomorphism<curves::alt_bn128_254::g2_type<>::params_type>::value);
+    static_assert(!curves::detail::has_glv_endomorphism<curves::secp_r1<256>::g1_type<>::params_type>::value);
+}
+
 /*
  * Twisted Edwards forms
  * extended coordinates
@@ -88,10 +88,76 @@ class multiexp_runner {
                 scalars.begin(), scalars.end());
 
 
+        point pippenger_result = policies::multiexp_method_pippenger::process(
+                points.begin(), points.end(),
+                scalars.begin(), scalars.end());
+
         BOOST_CHECK_EQUAL(naive_result, bdlo12_result);
         BOOST_CHECK_EQUAL(naive_result, bos_coster_result);
+        BOOST_CHECK_EQUAL(naive_result, pippenger_result);
 
-        return (naive_result == bdlo12_result) && (naive_result == bos_coster_result);
+        return (naive_result == bdlo12_result) && (naive_result == bos_coster_result) &&
+               (naive_result == pippenger_result);
+    }
+};
+
+// Large enough for batch-affine buckets, with repeated and opposite bases, so that bucket additions hit doubling
+// and cancellation, and with scalars 0, 1 and -1.
+template<typename curve_group_type>
+class pippenger_runner {
+    public:
+    bool static run() {
+        using point = typename curve_group_type::value_type;
+        using scalar = typename curve_group_type::params_type::scalar_field_type;
+
+        std::size_t N = 4096;
+
+        std::vector<point> points(N);
+        std::vector<typename scalar::value_type> scalars(N);
+
+        for (std::size_t i = 0; i < N; ++i) {
+            switch (i % 4) {
+                case 0:
+                    points[i] = random_element<curve_group_type>();
+                    break;
+                case 1:
+                    points[i] = points[i - 1];
+                    break;
+                case 2:
+                    points[i] = -points[i - 1];
+                    break;
+                default:
+                    points[i] = point::zero();
+            }
+            switch (i % 7) {
+                case 0:
+                    scalars[i] = scalar::value_type::zero();
+                    break;
+                case 1:
+                    scalars[i] = scalar::value_type::one();
+                    break;
+                case 2:
+                    scalars[i] = -scalar::value_type::one();
+                    break;
+                case 3:
+                    scalars[i] = scalars[i / 2];
+                    break;
+                default:
+                    scalars[i] = random_element<scalar>();
+            }
+        }
+
+        point bdlo12_result = policies::multiexp_method_BDLO12::process(
+                points.begin(), points.end(),
+                scalars.begin(), scalars.end());
+
+        point pippenger_result = policies::multiexp_method_pippenger::process(
+                points.begin(), points.end(),
+                scalars.begin(), scalars.end());
+
+        BOOST_CHECK_EQUAL(bdlo12_result, pippenger_result);
+
+        return bdlo12_result == pippenger_result;
     }
 };
 
@@ -116,4 +182,15 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(multiexp_test, runner, multiexp_runners) {
     BOOST_CHECK(runner::run());
 }
 
+using pippenger_runners = boost::mpl::list<
+    pippenger_runner<curves::alt_bn128_254::template g1_type<>>,
+    pippenger_runner<curves::bls12_381::template g1_type<>>,
+    pippenger_runner<curves::bls12_381::template g2_type<>>,
+    pippenger_runner<curves::bls12_381::template g1_type<curves::coordinates::projective>>
+    >;
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(pippenger_test, runner, pippenger_runners) {
+    BOOST_CHECK(runner::run());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -187,6 +187,24 @@ void check_pairing_operations(std::vector<Fr_value_type> const& Fr_elements,
                       double_miller_loop<CurveType>(G1_prec_elements[prec_A1], G2_prec_elements[prec_B1],
                                                    G1_prec_elements[prec_A2], G2_prec_elements[prec_B2]));
     std::cout << " * Miller loop tests finished." << std::endl << std::endl;
+
+    std::cout << " * Multi-pairing tests started..." << std::endl;
+    BOOST_CHECK_EQUAL(multi_miller_loop<CurveType>({G1_prec_elements[prec_A1], G1_prec_elements[prec_A2]},
+                                                   {G2_prec_elements[prec_B1], G2_prec_elements[prec_B2]}),
+                      GT_elements[miller_loop_prec_A1_prec_B1] * GT_elements[miller_loop_prec_A2_prec_B2]);
+    BOOST_CHECK_EQUAL(*multi_pair_reduced<CurveType>({G1_elements[A1], G1_elements[A2]},
+                                                     {G2_elements[B1], G2_elements[B2]}),
+                      GT_elements[pair_reduceding_A1_B1_mul_pair_reduceding_A2_B2]);
+    BOOST_CHECK_EQUAL(*multi_pair_reduced<CurveType>({G1_elements[A1], G1_value_type::zero()},
+                                                     {G2_elements[B1], G2_elements[B2]}),
+                      GT_elements[pair_reduceding_A1_B1]);
+    BOOST_CHECK_EQUAL(*multi_pair_reduced<CurveType>({}, {}), GT_value_type::one());
+    // e(A1, B1) == e(VKx, VKy) * e(C1, VKz)
+    BOOST_CHECK(pairing_product_is_one<CurveType>({G1_elements[A1], -G1_elements[VKx], -G1_elements[C1]},
+                                                  {G2_elements[B1], G2_elements[VKy], G2_elements[VKz]}));
+    BOOST_CHECK(!pairing_product_is_one<CurveType>({G1_elements[A1], -G1_elements[VKx], -G1_elements[C2]},
+                                                   {G2_elements[B1], G2_elements[VKy], G2_elements[VKz]}));
+    std::cout << " * Multi-pairing tests finished." << std::endl << std::endl;
 }
 
 template<typename ElementType>
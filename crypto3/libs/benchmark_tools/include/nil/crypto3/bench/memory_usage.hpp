@@ -0,0 +1,195 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation <info@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_BENCH_MEMORY_USAGE_HPP
+#define CRYPTO3_BENCH_MEMORY_USAGE_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/log/trivial.hpp>
+
+#ifdef __unix__
+#include <sys/resource.h>
+#include <unistd.h>
+#endif
+
+namespace nil {
+    namespace crypto3 {
+        namespace bench {
+            namespace detail {
+
+                // Peak resident set size since the start of the process or the last reset through clear_refs,
+                // in bytes.
+                inline std::size_t read_peak_rss() {
+                    std::ifstream status("/proc/self/status");
+                    std::string line;
+                    while (std::getline(status, line)) {
+                        if (line.rfind("VmHWM:", 0) == 0) {
+                            return std::stoull(line.substr(6)) << 10;
+                        }
+                    }
+#ifdef __unix__
+                    struct rusage usage {};
+                    ::getrusage(RUSAGE_SELF, &usage);
+                    return static_cast<std::size_t>(usage.ru_maxrss) << 10;
+#else
+                    return 0;
+#endif
+                }
+
+                /**
+                 * Owns the peak RSS counter of the process. Resetting it through clear_refs loses the peak seen so
+                 * far, so every reset first folds the current peak into all the open memory phases. All the
+                 * accesses are serialized, phases may be opened and closed from several threads.
+                 */
+                class peak_rss_tracker {
+                public:
+                    static peak_rss_tracker& instance() {
+                        static peak_rss_tracker tracker;
+                        return tracker;
+                    }
+
+                    // Registers a phase, its peak is accumulated in *peak until close_phase.
+                    void open_phase(std::size_t* peak) {
+                        std::lock_guard<std::mutex> lock(mutex_);
+                        fold_peak();
+                        open_peaks_.push_back(peak);
+                        clear_peak();
+                    }
+
+                    void close_phase(std::size_t* peak) {
+                        std::lock_guard<std::mutex> lock(mutex_);
+                        fold_peak();
+                        open_peaks_.erase(std::remove(open_peaks_.begin(), open_peaks_.end(), peak),
+                                          open_peaks_.end());
+                    }
+
+                    // Peak so far of a phase which is still open.
+                    std::size_t phase_peak(const std::size_t* peak) {
+                        std::lock_guard<std::mutex> lock(mutex_);
+                        return std::max(*peak, read_peak_rss());
+                    }
+
+                    void reset_peak() {
+                        std::lock_guard<std::mutex> lock(mutex_);
+                        fold_peak();
+                        clear_peak();
+                    }
+
+                private:
+                    peak_rss_tracker() = default;
+
+                    void fold_peak() {
+                        if (open_peaks_.empty()) {
+                            return;
+                        }
+                        const std::size_t current_peak = read_peak_rss();
+                        for (std::size_t* peak : open_peaks_) {
+                            *peak = std::max(*peak, current_peak);
+                        }
+                    }
+
+                    static void clear_peak() {
+                        std::ofstream clear_refs("/proc/self/clear_refs");
+                        clear_refs << "5";
+                    }
+
+                    std::mutex mutex_;
+                    std::vector<std::size_t*> open_peaks_;
+                };
+
+            }    // namespace detail
+
+            // Resident set size of the process in bytes, 0 where it can't be read.
+            inline std::size_t current_rss_bytes() {
+#ifdef __unix__
+                std::ifstream statm("/proc/self/statm");
+                std::size_t total_pages = 0, resident_pages = 0;
+                if (statm >> total_pages >> resident_pages) {
+                    return resident_pages * static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+                }
+#endif
+                return 0;
+            }
+
+            // Peak resident set size since the start of the process or the last reset_peak_rss() call, in bytes.
+            inline std::size_t peak_rss_bytes() {
+                return detail::read_peak_rss();
+            }
+
+            // Makes peak_rss_bytes() start from the current RSS. Only works on Linux, elsewhere the peak is never
+            // reset. Open memory phases keep the peak seen before the reset.
+            inline void reset_peak_rss() {
+                detail::peak_rss_tracker::instance().reset_peak();
+            }
+
+            /**
+             * Measures the peak resident set size of a prover phase and logs it when the phase ends. Phases can be
+             * nested or run on several threads at once, each of them accounts for the whole process peak while it
+             * was open.
+             */
+            class memory_phase_scope {
+            public:
+                explicit memory_phase_scope(std::string name, bool log = true) : name(std::move(name)), log(log) {
+                    detail::peak_rss_tracker::instance().open_phase(&peak);
+                }
+
+                ~memory_phase_scope() {
+                    detail::peak_rss_tracker::instance().close_phase(&peak);
+                    if (log) {
+                        BOOST_LOG_TRIVIAL(info) << name << ": peak RSS " << (peak >> 20) << " MB";
+                    }
+                }
+
+                std::size_t peak_rss_bytes() const {
+                    return detail::peak_rss_tracker::instance().phase_peak(&peak);
+                }
+
+                memory_phase_scope(const memory_phase_scope&) = delete;
+                memory_phase_scope& operator=(const memory_phase_scope&) = delete;
+
+            private:
+                std::string name;
+                bool log;
+                std::size_t peak = 0;
+            };
+
+        }    // namespace bench
+    }        // namespace crypto3
+}    // namespace nil
+
+#ifdef PROFILING_ENABLED
+    #define PROFILE_MEMORY_PHASE(name) \
+        nil::crypto3::bench::memory_phase_scope memory_phase(name);
+#else
+    #define PROFILE_MEMORY_PHASE(name)
+#endif
+
+#endif    // CRYPTO3_BENCH_MEMORY_USAGE_HPP
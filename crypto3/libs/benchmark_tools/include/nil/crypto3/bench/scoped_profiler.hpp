@@ -30,6 +30,7 @@
 #include <string>
 #include <iostream>
 #include <iomanip>
+#include <mutex>
 #include <unordered_map>
 
 namespace nil {
@@ -67,7 +68,9 @@ class call_stats {
             return instance;
         }
 
+        // Can be called from several threads, e.g. by profiled parallel tasks.
         void add_stat(const std::string& name, uint64_t time_ms) {
+            std::lock_guard<std::mutex> lock(mutex);
             call_counts[name]++;
             call_miliseconds[name] += time_ms;
         }
@@ -83,6 +86,7 @@ class call_stats {
             }
         }
 
+        std::mutex mutex;
         std::unordered_map<std::string, uint64_t> call_counts;
         std::unordered_map<std::string, uint64_t> call_miliseconds;
 };
@@ -127,4 +131,12 @@ class scoped_aggregate_profiler
     #define PROFILE_FUNCTION_CALLS() 
 #endif
 
+// Same as PROFILE_FUNCTION_CALLS, but with a custom name. Can be used in the same scope as PROFILE_SCOPE.
+#ifdef PROFILING_ENABLED
+    #define PROFILE_SCOPE_CALLS(name) \
+        nil::crypto3::bench::detail::scoped_aggregate_profiler aggregate_profiler(name);
+#else
+    #define PROFILE_SCOPE_CALLS(name) 
+#endif
+
 #endif    // CRYPTO3_SCOPED_PROFILER_HPP
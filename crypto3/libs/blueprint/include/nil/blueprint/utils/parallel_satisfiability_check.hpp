@@ -0,0 +1,506 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation <info@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_BLUEPRINT_UTILS_PLONK_PARALLEL_SATISFIABILITY_CHECK_HPP
+#define CRYPTO3_BLUEPRINT_UTILS_PLONK_PARALLEL_SATISFIABILITY_CHECK_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <iostream>
+#include <mutex>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <boost/container_hash/hash.hpp>
+#include <boost/variant/static_visitor.hpp>
+#include <boost/variant/apply_visitor.hpp>
+
+#include <nil/blueprint/blueprint/plonk/circuit.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/plonk/constraint_system.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/plonk/constraint.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/plonk/assignment.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/plonk/variable.hpp>
+#include <nil/crypto3/zk/math/expression.hpp>
+
+namespace nil {
+    namespace blueprint {
+        namespace detail {
+
+            /**
+             * @brief Constraint expression flattened into a postfix program over the columns of one assignment
+             * table. Variables are resolved to column pointers once, so evaluation on a row does not walk the
+             * expression tree nor go through std::function, as plonk_constraint::evaluate does.
+             */
+            template<typename BlueprintFieldType>
+            class compiled_plonk_expression {
+            public:
+                using value_type = typename BlueprintFieldType::value_type;
+                using variable_type = crypto3::zk::snark::plonk_variable<value_type>;
+                using expression_type = crypto3::math::expression<variable_type>;
+                using column_type = crypto3::zk::snark::plonk_column<BlueprintFieldType>;
+                using assignment_type = crypto3::zk::snark::plonk_assignment_table<BlueprintFieldType>;
+
+                compiled_plonk_expression(const expression_type &expr, const assignment_type &assignments)
+                        : _rows_amount(assignments.rows_amount()) {
+                    compiler expression_compiler(*this, assignments);
+                    boost::apply_visitor(expression_compiler, expr.get_expr());
+                }
+
+                /// @brief Evaluates the expression on the given row. 'stack' is a scratch buffer, reused between calls.
+                value_type evaluate(std::size_t row, std::vector<value_type> &stack) const {
+                    stack.clear();
+                    for (const auto &instr : _program) {
+                        switch (instr.op) {
+                            case opcode::TERM: {
+                                value_type result = _coefficients[instr.argument];
+                                for (std::size_t i = instr.operands_begin; i < instr.operands_end; i++) {
+                                    result *= operand_value(_operands[i], row);
+                                }
+                                stack.emplace_back(std::move(result));
+                                break;
+                            }
+                            case opcode::ADD:
+                                stack[stack.size() - 2] += stack.back();
+                                stack.pop_back();
+                                break;
+                            case opcode::SUB:
+                                stack[stack.size() - 2] -= stack.back();
+                                stack.pop_back();
+                                break;
+                            case opcode::MULT:
+                                stack[stack.size() - 2] *= stack.back();
+                                stack.pop_back();
+                                break;
+                            case opcode::POW:
+                                stack.back() = stack.back().pow(instr.argument);
+                                break;
+                        }
+                    }
+                    return stack.back();
+                }
+
+            private:
+                enum class opcode : std::uint8_t { TERM, ADD, SUB, MULT, POW };
+
+                struct instruction {
+                    opcode op;
+                    // Coefficient index for TERM, the power for POW.
+                    std::size_t argument;
+                    std::size_t operands_begin;
+                    std::size_t operands_end;
+                };
+
+                struct operand {
+                    const column_type *column;
+                    std::int64_t rotation;
+                };
+
+                class compiler : public boost::static_visitor<void> {
+                public:
+                    compiler(compiled_plonk_expression &result, const assignment_type &assignments)
+                            : result(result), assignments(assignments) {
+                    }
+
+                    void operator()(const crypto3::math::term<variable_type> &term) {
+                        const std::size_t operands_begin = result._operands.size();
+                        for (const auto &var : term.get_vars()) {
+                            result._operands.push_back({&column(var), var.rotation});
+                        }
+                        result._program.push_back(
+                            {opcode::TERM, result._coefficients.size(), operands_begin, result._operands.size()});
+                        result._coefficients.push_back(term.get_coeff());
+                    }
+
+                    void operator()(const crypto3::math::pow_operation<variable_type> &pow) {
+                        boost::apply_visitor(*this, pow.get_expr().get_expr());
+                        result._program.push_back({opcode::POW, static_cast<std::size_t>(pow.get_power()), 0, 0});
+                    }
+
+                    void operator()(const crypto3::math::binary_arithmetic_operation<variable_type> &op) {
+                        boost::apply_visitor(*this, op.get_expr_left().get_expr());
+                        boost::apply_visitor(*this, op.get_expr_right().get_expr());
+                        switch (op.get_op()) {
+                            case crypto3::math::ArithmeticOperator::ADD:
+                                result._program.push_back({opcode::ADD, 0, 0, 0});
+                                break;
+                            case crypto3::math::ArithmeticOperator::SUB:
+                                result._program.push_back({opcode::SUB, 0, 0, 0});
+                                break;
+                            case crypto3::math::ArithmeticOperator::MULT:
+                                result._program.push_back({opcode::MULT, 0, 0, 0});
+                                break;
+                        }
+                    }
+
+                private:
+                    const column_type &column(const variable_type &var) const {
+                        switch (var.type) {
+                            case variable_type::column_type::witness:
+                                return assignments.witness(var.index);
+                            case variable_type::column_type::public_input:
+                                return assignments.public_input(var.index);
+                            case variable_type::column_type::constant:
+                                return assignments.constant(var.index);
+                            case variable_type::column_type::selector:
+                                return assignments.selector(var.index);
+                            default:
+                                std::cerr << "Invalid column type" << std::endl;
+                                abort();
+                        }
+                    }
+
+                    compiled_plonk_expression &result;
+                    const assignment_type &assignments;
+                };
+
+                value_type operand_value(const operand &op, std::size_t row) const {
+                    const std::size_t index = (_rows_amount + row + op.rotation) % _rows_amount;
+                    return index < op.column->size() ? (*op.column)[index] : value_type::zero();
+                }
+
+                std::size_t _rows_amount;
+                std::vector<instruction> _program;
+                std::vector<value_type> _coefficients;
+                std::vector<operand> _operands;
+            };
+
+            template<typename ValueType>
+            struct value_vector_hash {
+                std::size_t operator()(const std::vector<ValueType> &values) const {
+                    std::size_t seed = values.size();
+                    for (const auto &value : values) {
+                        boost::hash_combine(seed, std::hash<ValueType>()(value));
+                    }
+                    return seed;
+                }
+            };
+
+            /**
+             * @brief Runs check_task(0), ..., check_task(tasks_count - 1) on 'workers_count' threads. Tasks are
+             * taken in order, once some task returns false no new tasks are started.
+             *
+             * @return true if all the tasks have returned true.
+             */
+            template<typename TaskFunction>
+            bool parallel_check(std::size_t tasks_count, std::size_t workers_count, const TaskFunction &check_task) {
+                if (tasks_count == 0) {
+                    return true;
+                }
+                workers_count = std::clamp<std::size_t>(workers_count, 1, tasks_count);
+
+                std::atomic<std::size_t> next_task{0};
+                std::atomic<bool> failed{false};
+
+                std::vector<std::future<void>> workers;
+                for (std::size_t worker = 0; worker < workers_count; ++worker) {
+                    workers.emplace_back(std::async(std::launch::async, [&]() {
+                        for (std::size_t i = next_task++; i < tasks_count && !failed; i = next_task++) {
+                            if (!check_task(i)) {
+                                failed = true;
+                                return;
+                            }
+                        }
+                    }));
+                }
+                for (auto &worker : workers) {
+                    worker.get();
+                }
+                return !failed;
+            }
+
+            // Keeps the violation from the task with the smallest index, so the report does not depend on timing
+            // as long as the same violations are found.
+            class violation_report {
+            public:
+                void add(std::size_t task, const std::string &message) {
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    if (!_task || task < *_task) {
+                        _task = task;
+                        _message = message;
+                    }
+                }
+
+                const std::string &message() const {
+                    return _message;
+                }
+
+            private:
+                std::mutex _mutex;
+                std::optional<std::size_t> _task;
+                std::string _message;
+            };
+
+        }    // namespace detail
+
+        /**
+         * @brief Parallel version of is_satisfied for the whole circuit.
+         *
+         * Gate constraints are compiled once and checked on chunks of rows by 'workers_count' threads. Lookup
+         * tables are loaded into hash sets while gates are being checked, so each lookup costs one hash set probe
+         * instead of a scan over the table. The check stops at the first violation, which is printed in the same
+         * form as is_satisfied prints it.
+         *
+         * Tables which are not in the lookup library of 'bp', as in a circuit read from a file, are taken from
+         * bp.lookup_tables() and evaluated over the assignment table.
+         */
+        template<typename BlueprintFieldType>
+        bool is_satisfied_parallel(
+            const circuit<crypto3::zk::snark::plonk_constraint_system<BlueprintFieldType>> &bp,
+            const crypto3::zk::snark::plonk_assignment_table<BlueprintFieldType> &assignments,
+            std::size_t workers_count = std::thread::hardware_concurrency()) {
+
+            using value_type = typename BlueprintFieldType::value_type;
+            using compiled_expression_type = detail::compiled_plonk_expression<BlueprintFieldType>;
+            using lookup_table_type =
+                std::unordered_set<std::vector<value_type>, detail::value_vector_hash<value_type>>;
+
+            constexpr std::size_t rows_per_task = 1 << 12;
+            constexpr std::size_t copy_constraints_per_task = 1 << 14;
+
+            const auto &gates = bp.gates();
+            const auto &lookup_gates = bp.lookup_gates();
+            const auto &copy_constraints = bp.copy_constraints();
+            const std::size_t rows_amount = assignments.rows_amount();
+            const std::size_t row_chunks = (rows_amount + rows_per_task - 1) / rows_per_task;
+
+            const auto is_selected = [&assignments](std::size_t selector_index, std::size_t row) {
+                const auto &selector = assignments.selector(selector_index);
+                return row < selector.size() && !selector[row].is_zero();
+            };
+
+            std::vector<std::vector<compiled_expression_type>> compiled_gates(gates.size());
+            for (std::size_t i = 0; i < gates.size(); i++) {
+                for (const auto &constraint : gates[i].constraints) {
+                    compiled_gates[i].emplace_back(constraint, assignments);
+                }
+            }
+
+            // Tables used by lookup gates, in the order of their first use.
+            std::vector<std::size_t> table_ids;
+            std::unordered_map<std::size_t, std::size_t> table_positions;
+            std::vector<std::vector<std::vector<compiled_expression_type>>> compiled_lookup_inputs(lookup_gates.size());
+            for (std::size_t i = 0; i < lookup_gates.size(); i++) {
+                for (const auto &constraint : lookup_gates[i].constraints) {
+                    if (table_positions.emplace(constraint.table_id, table_ids.size()).second) {
+                        table_ids.push_back(constraint.table_id);
+                    }
+                    compiled_lookup_inputs[i].emplace_back();
+                    for (const auto &input : constraint.lookup_input) {
+                        compiled_lookup_inputs[i].back().emplace_back(input, assignments);
+                    }
+                }
+            }
+            std::vector<lookup_table_type> tables(table_ids.size());
+
+            const auto table_name = [&bp](std::size_t table_id) -> std::string {
+                const auto &names = bp.get_reserved_indices_right();
+                const auto it = names.find(table_id);
+                return it != names.end() ? it->second : "#" + std::to_string(table_id);
+            };
+
+            // Evaluates a table given as plonk_lookup_table over the rows where its selector is enabled.
+            const auto load_evaluated_table = [&](std::size_t table_id, lookup_table_type &result) {
+                const auto &table = bp.lookup_tables()[table_id - 1];
+                std::vector<std::vector<compiled_expression_type>> options;
+                for (const auto &option : table.lookup_options) {
+                    options.emplace_back();
+                    for (const auto &var : option) {
+                        options.back().emplace_back(typename compiled_expression_type::expression_type(var),
+                                                    assignments);
+                    }
+                }
+                std::vector<value_type> stack;
+                for (std::size_t row = 0; row < rows_amount; row++) {
+                    if (!is_selected(table.tag_index, row)) {
+                        continue;
+                    }
+                    for (const auto &option : options) {
+                        std::vector<value_type> item;
+                        item.reserve(option.size());
+                        for (const auto &expr : option) {
+                            item.emplace_back(expr.evaluate(row, stack));
+                        }
+                        result.insert(std::move(item));
+                    }
+                }
+            };
+
+            detail::violation_report report;
+
+            const auto load_table = [&](std::size_t task, std::size_t table_id, lookup_table_type &result) -> bool {
+                const auto &names = bp.get_reserved_indices_right();
+                const auto name_it = names.find(table_id);
+                if (name_it == names.end() ||
+                    bp.get_reserved_dynamic_tables().find(name_it->second) != bp.get_reserved_dynamic_tables().end()) {
+                    if (table_id == 0 || table_id > bp.lookup_tables().size()) {
+                        report.add(task, "Lookup table " + table_name(table_id) + " not found.\n" +
+                                         "Table id = " + std::to_string(table_id) + "\n");
+                        return false;
+                    }
+                    load_evaluated_table(table_id, result);
+                    return true;
+                }
+
+                const std::string &name = name_it->second;
+                const std::string main_table_name = name.substr(0, name.find("/"));
+                const std::string subtable_name = name.substr(name.find("/") + 1, name.size() - 1);
+                const auto &reserved_tables = bp.get_reserved_tables();
+                const auto table_it = reserved_tables.find(main_table_name);
+                if (table_it == reserved_tables.end() ||
+                    table_it->second->subtables.find(subtable_name) == table_it->second->subtables.end()) {
+                    report.add(task, "Lookup table " + name + " not found.\n" +
+                                     "Table id = " + std::to_string(table_id) + " table_name " + name + "\n");
+                    return false;
+                }
+                const auto &table = table_it->second->get_table();
+                const auto &column_indices = table_it->second->subtables.at(subtable_name).column_indices;
+                for (std::size_t row = 0; row < table[0].size(); row++) {
+                    std::vector<value_type> item;
+                    item.reserve(column_indices.size());
+                    for (const auto column_index : column_indices) {
+                        item.push_back(table[column_index][row]);
+                    }
+                    result.insert(std::move(item));
+                }
+                return true;
+            };
+
+            const auto check_gates = [&](std::size_t task, std::size_t gate_index, std::size_t rows_begin) -> bool {
+                const auto &gate = gates[gate_index];
+                const std::size_t rows_end = std::min(rows_begin + rows_per_task, rows_amount);
+                std::vector<value_type> stack;
+                for (std::size_t row = rows_begin; row < rows_end; row++) {
+                    if (!is_selected(gate.selector_index, row)) {
+                        continue;
+                    }
+                    for (std::size_t j = 0; j < compiled_gates[gate_index].size(); j++) {
+                        const value_type constraint_result = compiled_gates[gate_index][j].evaluate(row, stack);
+                        if (!constraint_result.is_zero()) {
+                            std::stringstream message;
+                            message << "Constraint " << j << " from gate " << gate_index << " on row " << row
+                                    << " is not satisfied." << std::endl
+                                    << "Constraint result: " << constraint_result << std::endl
+                                    << "Constraint: " << gate.constraints[j] << std::endl;
+                            report.add(task, message.str());
+                            return false;
+                        }
+                    }
+                }
+                return true;
+            };
+
+            const auto check_lookups = [&](std::size_t task, std::size_t gate_index, std::size_t rows_begin) -> bool {
+                const auto &gate = lookup_gates[gate_index];
+                const std::size_t rows_end = std::min(rows_begin + rows_per_task, rows_amount);
+                std::vector<value_type> stack;
+                std::vector<value_type> input_values;
+                for (std::size_t row = rows_begin; row < rows_end; row++) {
+                    if (!is_selected(gate.tag_index, row)) {
+                        continue;
+                    }
+                    for (std::size_t j = 0; j < gate.constraints.size(); j++) {
+                        input_values.clear();
+                        for (const auto &input : compiled_lookup_inputs[gate_index][j]) {
+                            input_values.emplace_back(input.evaluate(row, stack));
+                        }
+                        const std::size_t table_id = gate.constraints[j].table_id;
+                        const auto &table = tables[table_positions.at(table_id)];
+                        if (table.find(input_values) == table.end()) {
+                            std::stringstream message;
+                            message << "Constraint " << j << " from lookup gate " << gate_index << " from table "
+                                    << table_name(table_id) << " on row " << row << " is not satisfied."
+                                    << std::endl << "Input values: ";
+                            for (const auto &value : input_values) {
+                                message << std::hex << value << std::dec << " ";
+                            }
+                            message << std::endl;
+                            report.add(task, message.str());
+                            return false;
+                        }
+                    }
+                }
+                return true;
+            };
+
+            const auto check_copy_constraints = [&](std::size_t task, std::size_t begin) -> bool {
+                const std::size_t end = std::min(begin + copy_constraints_per_task, copy_constraints.size());
+                for (std::size_t i = begin; i < end; i++) {
+                    const auto &first = var_value(assignments, copy_constraints[i].first);
+                    const auto &second = var_value(assignments, copy_constraints[i].second);
+                    if (first != second) {
+                        std::stringstream message;
+                        message << "Copy constraint number " << i << " is not satisfied."
+                                << " First variable: " << copy_constraints[i].first
+                                << " second variable: " << copy_constraints[i].second << std::endl
+                                << first << " != " << second << std::endl;
+                        report.add(task, message.str());
+                        return false;
+                    }
+                }
+                return true;
+            };
+
+            std::cout << "Satisfiability check. Check" << std::endl;
+
+            // Gates are checked while lookup tables are being loaded.
+            const std::size_t gate_tasks = gates.size() * row_chunks;
+            bool satisfied = detail::parallel_check(
+                gate_tasks + table_ids.size(), workers_count, [&](std::size_t task) {
+                    if (task < gate_tasks) {
+                        return check_gates(task, task / row_chunks, (task % row_chunks) * rows_per_task);
+                    }
+                    const std::size_t position = task - gate_tasks;
+                    return load_table(task, table_ids[position], tables[position]);
+                });
+
+            if (satisfied) {
+                const std::size_t lookup_tasks = lookup_gates.size() * row_chunks;
+                const std::size_t copy_tasks =
+                    (copy_constraints.size() + copy_constraints_per_task - 1) / copy_constraints_per_task;
+                satisfied = detail::parallel_check(
+                    lookup_tasks + copy_tasks, workers_count, [&](std::size_t task) {
+                        if (task < lookup_tasks) {
+                            return check_lookups(task, task / row_chunks, (task % row_chunks) * rows_per_task);
+                        }
+                        return check_copy_constraints(task, (task - lookup_tasks) * copy_constraints_per_task);
+                    });
+            }
+
+            if (!satisfied) {
+                std::cout << std::endl << report.message();
+            }
+            return satisfied;
+        }
+
+    }    // namespace blueprint
+}    // namespace nil
+#endif    // CRYPTO3_BLUEPRINT_UTILS_PLONK_PARALLEL_SATISFIABILITY_CHECK_HPP
@@ -0,0 +1,170 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation <info@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE blueprint_satisfiability_check_test
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/pallas.hpp>
+
+#include <nil/blueprint/blueprint/plonk/assignment.hpp>
+#include <nil/blueprint/blueprint/plonk/circuit.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/plonk/constraint_system.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/plonk/lookup_table.hpp>
+#include <nil/blueprint/utils/satisfiability_check.hpp>
+#include <nil/blueprint/utils/parallel_satisfiability_check.hpp>
+
+using namespace nil::blueprint;
+using namespace nil::crypto3;
+
+namespace {
+    using field_type = algebra::curves::pallas::base_field_type;
+    using value_type = typename field_type::value_type;
+    using var = zk::snark::plonk_variable<value_type>;
+    using constraint_system_type = zk::snark::plonk_constraint_system<field_type>;
+    using constraint_type = zk::snark::plonk_constraint<field_type>;
+    using lookup_constraint_type = zk::snark::plonk_lookup_constraint<field_type>;
+    using lookup_table_type = zk::snark::plonk_lookup_table<field_type>;
+
+    // Spans two row chunks of the parallel checker.
+    constexpr std::size_t rows_amount = 5000;
+    constexpr std::size_t dynamic_table_rows = 256;
+
+    struct satisfiability_fixture {
+        // w0 is a counter, w1 its low byte and w2 their product. The low byte is range checked with the
+        // byte_range_table and its square is looked up in a dynamic table of squares, stored in c0.
+        // Copy constraints bind w2 on a few rows to the public input column.
+        satisfiability_fixture(bool use_lookup_library) : table(3, 1, 1, 4) {
+            std::size_t dynamic_table_id = 1;
+            std::size_t byte_range_table_id = 0;
+            if (use_lookup_library) {
+                bp.reserve_dynamic_table("squares");
+                bp.reserve_table("byte_range_table/full");
+                dynamic_table_id = bp.get_reserved_indices().at("squares");
+                byte_range_table_id = bp.get_reserved_indices().at("byte_range_table/full");
+            }
+
+            const std::size_t gate_selector = bp.add_gate({
+                var(2, 0) - var(0, 0) * var(1, 0),
+                var(0, 1) - var(0, 0) - 1});
+            const std::size_t dynamic_table_selector = bp.get_dynamic_lookup_table_selector();
+            lookup_table_type squares(1, dynamic_table_selector);
+            squares.append_option({var(0, 0, true, var::column_type::constant)});
+            bp.add_lookup_table(squares);
+            std::vector<lookup_constraint_type> lookups = {
+                {dynamic_table_id, {var(1, 0) * var(1, 0)}}};
+            if (use_lookup_library) {
+                lookups.push_back({byte_range_table_id, {var(1, 0)}});
+            }
+            const std::size_t lookup_selector = bp.add_lookup_gate(lookups);
+
+            for (std::size_t row = 0; row < rows_amount; row++) {
+                table.witness(0, row) = row;
+                table.witness(1, row) = row % 256;
+                table.witness(2, row) = row * (row % 256);
+                table.constant(0, row) = row < dynamic_table_rows ? row * row : 0;
+                table.public_input(0, row) = 0;
+                for (std::size_t selector = 0; selector < 4; selector++) {
+                    table.selector(selector, row) = 0;
+                }
+                if (row + 1 < rows_amount) {
+                    table.enable_selector(gate_selector, row);
+                }
+                if (row < dynamic_table_rows) {
+                    table.enable_selector(dynamic_table_selector, row);
+                }
+                table.enable_selector(lookup_selector, row);
+            }
+
+            for (std::size_t i = 0; i < 10; i++) {
+                const std::size_t row = 13 + 467 * i;
+                table.public_input(0, i) = row * (row % 256);
+                bp.add_copy_constraint({var(0, i, false, var::column_type::public_input),
+                                        var(2, row, false, var::column_type::witness)});
+            }
+        }
+
+        // Both checkers must agree, the result should not depend on the number of threads.
+        bool check() {
+            const auto &zk_table = static_cast<const zk::snark::plonk_assignment_table<field_type> &>(table);
+            const bool expected = is_satisfied(bp, zk_table);
+            BOOST_CHECK_EQUAL(is_satisfied_parallel(bp, zk_table, 1), expected);
+            BOOST_CHECK_EQUAL(is_satisfied_parallel(bp, zk_table, 4), expected);
+            return expected;
+        }
+
+        circuit<constraint_system_type> bp;
+        assignment<constraint_system_type> table;
+    };
+}    // namespace
+
+BOOST_AUTO_TEST_SUITE(blueprint_satisfiability_check_test_suite)
+
+BOOST_AUTO_TEST_CASE(blueprint_parallel_satisfiability_check_test) {
+    satisfiability_fixture fixture(true);
+    BOOST_CHECK(fixture.check());
+
+    // Gate violation in the second row chunk.
+    fixture.table.witness(2, 4500) += 1;
+    BOOST_CHECK(!fixture.check());
+    fixture.table.witness(2, 4500) -= 1;
+
+    // Gate violation through the rotated variable.
+    fixture.table.witness(0, rows_amount - 1) += 1;
+    BOOST_CHECK(!fixture.check());
+    fixture.table.witness(0, rows_amount - 1) -= 1;
+    BOOST_CHECK(fixture.check());
+
+    // Value out of the byte range, the gate still holds.
+    fixture.table.witness(1, 4200) = 300;
+    fixture.table.witness(2, 4200) = 4200 * 300;
+    BOOST_CHECK(!fixture.check());
+    fixture.table.witness(1, 4200) = 4200 % 256;
+    fixture.table.witness(2, 4200) = 4200 * (4200 % 256);
+
+    // Dynamic table misses one of the squares.
+    fixture.table.constant(0, 5) = 0;
+    BOOST_CHECK(!fixture.check());
+    fixture.table.constant(0, 5) = 25;
+
+    // Copy constraint violation.
+    fixture.table.public_input(0, 7) += 1;
+    BOOST_CHECK(!fixture.check());
+    fixture.table.public_input(0, 7) -= 1;
+
+    BOOST_CHECK(fixture.check());
+}
+
+// Circuits read from a file have no lookup library, tables are taken from the constraint system.
+BOOST_AUTO_TEST_CASE(blueprint_parallel_satisfiability_check_without_lookup_library_test) {
+    satisfiability_fixture fixture(false);
+    const auto &zk_table = static_cast<const zk::snark::plonk_assignment_table<field_type> &>(fixture.table);
+    BOOST_CHECK(is_satisfied_parallel(fixture.bp, zk_table));
+
+    fixture.table.constant(0, 5) = 0;
+    BOOST_CHECK(!is_satisfied_parallel(fixture.bp, zk_table));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
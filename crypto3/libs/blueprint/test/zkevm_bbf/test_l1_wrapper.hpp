@@ -24,6 +24,8 @@
 
 #pragma once
 
+#include <chrono>
+
 #include <nil/crypto3/algebra/curves/pallas.hpp>
 #include <nil/crypto3/algebra/fields/arithmetic_params/pallas.hpp>
 #include <nil/crypto3/algebra/curves/vesta.hpp>
@@ -97,7 +99,10 @@ std::pair<std::vector<std::vector<std::uint8_t>>, std::vector<boost::property_tr
     return {{bytecode0}, {pt}};
 }
 
-template <typename BlueprintFieldType>
+template <
+    typename BlueprintFieldType,
+    zk::snark::lookup_argument_type LookupArgument = zk::snark::lookup_argument_type::PLOOKUP
+>
 bool check_proof(
     nil::blueprint::circuit<zk::snark::plonk_constraint_system<BlueprintFieldType>> bp,
     assignment<zk::snark::plonk_constraint_system<BlueprintFieldType>> assignment,
@@ -117,7 +122,7 @@ bool check_proof(
 
     using lpc_type = nil::crypto3::zk::commitments::list_polynomial_commitment<BlueprintFieldType, lpc_params_type>;
     using lpc_scheme_type = typename nil::crypto3::zk::commitments::lpc_commitment_scheme<lpc_type>;
-    using lpc_placeholder_params_type = nil::crypto3::zk::snark::placeholder_params<circuit_params, lpc_scheme_type>;
+    using lpc_placeholder_params_type = nil::crypto3::zk::snark::placeholder_params<circuit_params, lpc_scheme_type, LookupArgument>;
     typename lpc_type::fri_type::params_type fri_params(1, std::ceil(log2(assignment.rows_amount())), Lambda, 2);
     lpc_scheme_type lpc_scheme(fri_params);
 
@@ -132,9 +137,12 @@ bool check_proof(
             bp, assignment.private_table(), desc);
 
     std::cout << "Prover" << std::endl;
+    auto prover_start = std::chrono::steady_clock::now();
     auto lpc_proof = nil::crypto3::zk::snark::placeholder_prover<BlueprintFieldType, lpc_placeholder_params_type>::process(
             lpc_preprocessed_public_data, std::move(lpc_preprocessed_private_data), desc, bp,
             lpc_scheme);
+    std::cout << "Prover time = " << std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - prover_start).count() << " ms" << std::endl;
 
     // We must not use the same instance of lpc_scheme.
     lpc_scheme_type verifier_lpc_scheme(fri_params);
@@ -252,6 +260,7 @@ public:
     explicit BBFTestFixture(){
         check_satisfiability = true;
         generate_proof = false;
+        generate_logup_proof = false;
         print_to_file = false;
 
         std::size_t argc = boost::unit_test::framework::master_test_suite().argc;
@@ -260,6 +269,7 @@ public:
             if( std::string(argv[i]) == "--print" ) print_to_file = true;
             if( std::string(argv[i]) == "--no-sat-check" ) check_satisfiability = false;
             if( std::string(argv[i]) == "--proof" ) generate_proof = true;
+            if( std::string(argv[i]) == "--logup" ) generate_logup_proof = true;
         }
         std::string suite(boost::unit_test::framework::get<boost::unit_test::test_suite>(boost::unit_test::framework::current_test_case().p_parent_id).p_name);
         std::string test(boost::unit_test::framework::current_test_case().p_name);
@@ -296,12 +306,18 @@ public:
         if( result && generate_proof ){
             result = result & check_proof(bp, assignment, desc);
         }
+        // Proves the circuit again with the LogUp lookup argument to compare both prover times.
+        if( result && generate_logup_proof ){
+            std::cout << "LogUp lookup argument" << std::endl;
+            result = result & check_proof<field_type, zk::snark::lookup_argument_type::LOGUP>(bp, assignment, desc);
+        }
         std::cout << std::endl;
         return result;
     }
 
     bool check_satisfiability;
     bool generate_proof;
+    bool generate_logup_proof;
     bool print_to_file;
     std::string output_file;
 };
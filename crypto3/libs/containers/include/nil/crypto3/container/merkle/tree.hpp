@@ -37,6 +37,7 @@
 
 #include <nil/crypto3/hash/type_traits.hpp>
 #include <nil/crypto3/hash/algorithm/hash.hpp>
+#include <nil/crypto3/hash/two_to_one_compressor.hpp>
 #include <nil/crypto3/container/merkle/node.hpp>
 
 namespace nil {
@@ -479,6 +480,17 @@ namespace nil {
                     return accumulators::extract::hash<T>(acc);
                 }
 
+                // Hash of the Arity nodes starting at 'first'. Binary trees use the fixed-length compression of
+                // the hash when there is one, it gives the same digest without the accumulator.
+                template<typename T, std::size_t Arity, typename NodeIterator>
+                typename T::digest_type generate_node_hash(NodeIterator first) {
+                    if constexpr (Arity == 2 && hashes::has_two_to_one_compressor<T>::value) {
+                        return hashes::compress<T>(first[0], first[1]);
+                    } else {
+                        return generate_hash<T>(first, first + Arity);
+                    }
+                }
+
                 template<typename T, std::size_t Arity, typename LeafIterator>
                 merkle_tree_impl<T, Arity> make_merkle_tree(LeafIterator first, LeafIterator last) {
                     typedef T node_type;
@@ -496,7 +508,7 @@ namespace nil {
 
                     for (size_t row_number = 1; row_number < ret.row_count(); ++row_number, row_size /= Arity) {
                         for (size_t i = 0; i < row_size; ++i, it += Arity) {
-                            ret.emplace_back(generate_hash<hash_type>(it, it + Arity));
+                            ret.emplace_back(generate_node_hash<hash_type, Arity>(it));
                         }
                     }
                     return ret;
@@ -9,6 +9,8 @@
 #ifndef CRYPTO3_HASH_NIL_POSEIDON_SPONGE_HPP
 #define CRYPTO3_HASH_NIL_POSEIDON_SPONGE_HPP
 
+#include <boost/assert.hpp>
+
 #include <nil/crypto3/hash/detail/poseidon/poseidon_policy.hpp>
 #include <nil/crypto3/hash/detail/poseidon/poseidon_permutation.hpp>
 
@@ -94,6 +96,21 @@ namespace nil {
                         state_count_ = 1;
                     }
 
+                    // The state words and how many of them are filled, restoring both continues the sponge exactly.
+                    const state_type &state() const {
+                        return state_;
+                    }
+
+                    std::size_t state_count() const {
+                        return state_count_;
+                    }
+
+                    void set_state(const state_type &state, std::size_t state_count) {
+                        BOOST_ASSERT(state_count >= 1 && state_count <= state_words);
+                        state_ = state;
+                        state_count_ = state_count;
+                    }
+
                 private:
                     state_type state_;
                     std::size_t state_count_;
@@ -0,0 +1,171 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation <info@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_HASH_TWO_TO_ONE_COMPRESSOR_HPP
+#define CRYPTO3_HASH_TWO_TO_ONE_COMPRESSOR_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include <nil/crypto3/hash/keccak.hpp>
+#include <nil/crypto3/hash/sha2.hpp>
+#include <nil/crypto3/hash/poseidon.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace hashes {
+            /*!
+             * @brief Hash of two digests, e.g. of the children of a binary Merkle tree node.
+             *
+             * compress(left, right) is equal to hashing left and then right through the accumulator, but the input
+             * length is known in advance: padding is constant, no accumulator is set up, and the data is put into
+             * the hash state directly. Specialized for Keccak, SHA-256 and Poseidon, for other hashes
+             * has_two_to_one_compressor is false and the caller falls back to the accumulator.
+             */
+            template<typename Hash, typename Enable = void>
+            struct two_to_one_compressor;
+
+            template<typename Hash, typename Enable = void>
+            struct has_two_to_one_compressor : std::false_type { };
+
+            template<typename Hash>
+            struct has_two_to_one_compressor<Hash, std::void_t<decltype(two_to_one_compressor<Hash>::compress)>>
+                : std::true_type { };
+
+#ifndef __ZKLLVM__
+            template<std::size_t DigestBits>
+            struct two_to_one_compressor<keccak_1600<DigestBits>> {
+                using policy_type = typename keccak_1600<DigestBits>::policy_type;
+                using permutation_type = detail::keccak_1600_impl<policy_type>;
+                using state_type = typename policy_type::state_type;
+                using digest_type = typename policy_type::digest_type;
+
+                constexpr static const std::size_t rate_bytes = policy_type::block_bits / 8;
+                constexpr static const std::size_t digest_bytes = DigestBits / 8;
+
+                static digest_type compress(const digest_type &left, const digest_type &right) {
+                    state_type state = {};
+                    std::size_t pos = 0;
+                    auto absorb = [&state, &pos](const digest_type &input) {
+                        for (std::uint8_t byte : input) {
+                            if (pos == rate_bytes) {
+                                permutation_type::permute(state);
+                                pos = 0;
+                            }
+                            state[pos / 8] ^= std::uint64_t(byte) << (8 * (pos % 8));
+                            ++pos;
+                        }
+                    };
+                    absorb(left);
+                    absorb(right);
+                    if (pos == rate_bytes) {
+                        permutation_type::permute(state);
+                        pos = 0;
+                    }
+                    // Keccak padding, the same keccak_1600_padder appends.
+                    state[pos / 8] ^= std::uint64_t(0x01) << (8 * (pos % 8));
+                    state[(rate_bytes - 1) / 8] ^= std::uint64_t(0x80) << (8 * ((rate_bytes - 1) % 8));
+                    permutation_type::permute(state);
+
+                    digest_type result;
+                    for (std::size_t i = 0; i < digest_bytes; ++i) {
+                        result[i] = static_cast<std::uint8_t>(state[i / 8] >> (8 * (i % 8)));
+                    }
+                    return result;
+                }
+            };
+
+            template<>
+            struct two_to_one_compressor<sha2<256>> {
+                using policy_type = typename sha2<256>::policy_type;
+                using compressor_type =
+                    davies_meyer_compressor<typename policy_type::block_cipher_type, detail::state_adder>;
+                using state_type = typename policy_type::state_type;
+                using block_type = typename policy_type::block_type;
+                using digest_type = typename policy_type::digest_type;
+
+                static digest_type compress(const digest_type &left, const digest_type &right) {
+                    // Two digests fill exactly one block, the padding block only depends on the length.
+                    static const block_type padding_block = {0x80000000, 0, 0, 0, 0, 0, 0, 0,
+                                                             0,          0, 0, 0, 0, 0, 0, 512};
+                    block_type block;
+                    for (std::size_t i = 0; i < 8; ++i) {
+                        block[i] = load_big_endian(left, i);
+                        block[i + 8] = load_big_endian(right, i);
+                    }
+
+                    state_type state = typename policy_type::iv_generator()();
+                    compressor_type::process_block(state, block);
+                    compressor_type::process_block(state, padding_block);
+
+                    digest_type result;
+                    for (std::size_t i = 0; i < 8; ++i) {
+                        for (std::size_t j = 0; j < 4; ++j) {
+                            result[4 * i + j] = static_cast<std::uint8_t>(state[i] >> (24 - 8 * j));
+                        }
+                    }
+                    return result;
+                }
+
+            private:
+                static std::uint32_t load_big_endian(const digest_type &digest, std::size_t word) {
+                    return (std::uint32_t(digest[4 * word]) << 24) | (std::uint32_t(digest[4 * word + 1]) << 16) |
+                           (std::uint32_t(digest[4 * word + 2]) << 8) | std::uint32_t(digest[4 * word + 3]);
+                }
+            };
+
+            // The sponge puts the two elements right after the capacity element and squeezes the last one. With
+            // the rate of at least two that is a single permutation.
+            template<typename PolicyType>
+            struct two_to_one_compressor<poseidon<PolicyType>, std::enable_if_t<(PolicyType::state_words >= 3)>> {
+                using policy_type = PolicyType;
+                using permutation_type = detail::poseidon_permutation<policy_type>;
+                using state_type = typename policy_type::state_type;
+                using digest_type = typename policy_type::digest_type;
+
+                static digest_type compress(const digest_type &left, const digest_type &right) {
+                    state_type state;
+                    state.fill(0u);
+                    state[1] = left;
+                    state[2] = right;
+                    permutation_type::permute(state);
+                    return state[policy_type::state_words - 1];
+                }
+            };
+#endif
+
+            /*!
+             * @brief Hash of left and right, the same as hashing them one after another with Hash.
+             */
+            template<typename Hash>
+            typename Hash::digest_type compress(const typename Hash::digest_type &left,
+                                                const typename Hash::digest_type &right) {
+                return two_to_one_compressor<Hash>::compress(left, right);
+            }
+        }    // namespace hashes
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_HASH_TWO_TO_ONE_COMPRESSOR_HPP
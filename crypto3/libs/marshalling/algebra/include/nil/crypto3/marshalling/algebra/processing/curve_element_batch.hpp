@@ -0,0 +1,195 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation <info@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef CRYPTO3_MARSHALLING_PROCESSING_CURVE_ELEMENT_BATCH_HPP
+#define CRYPTO3_MARSHALLING_PROCESSING_CURVE_ELEMENT_BATCH_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+#include <nil/marshalling/status_type.hpp>
+
+#include <nil/crypto3/algebra/type_traits.hpp>
+#include <nil/crypto3/algebra/curves/detail/scalar_mul.hpp>
+#include <nil/crypto3/algebra/multiexp/policies.hpp>
+
+#include <nil/crypto3/marshalling/algebra/processing/curve_element.hpp>
+#include <nil/crypto3/marshalling/algebra/types/detail/parallel_chunks.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace marshalling {
+            namespace processing {
+
+                /// Checks done on the points after they are read.
+                enum class curve_element_validation {
+                    /// No checks, for trusted data such as files written by ourselves.
+                    none,
+                    /// The points are on the curve.
+                    on_curve,
+                    /// The points are on the curve and in the prime order subgroup.
+                    subgroup
+                };
+
+                namespace detail {
+                    /// Points are much more expensive to convert than field elements, so the chunks are shorter.
+                    constexpr static const std::size_t min_curve_element_chunk_size = 256;
+                }    // namespace detail
+
+                /**
+                 * @brief Writes a batch of points, each of them taking curve_element_marshalling_params::length()
+                 * units, in the same format as curve_element_writer.
+                 *
+                 * Short Weierstrass points are converted to affine coordinates with one field inversion per
+                 * chunk (Montgomery's trick) instead of separate inversions for every point, and the chunks are
+                 * run by TaskRunner (see types::detail::for_each_chunk).
+                 */
+                template<typename Endianness, typename Group,
+                         typename TaskRunner = types::detail::sequential_chunk_tasks>
+                struct curve_element_batch_writer {
+                    using group_type = Group;
+                    using group_value_type = typename group_type::value_type;
+                    using params_type = curve_element_marshalling_params<group_type>;
+                    using writer_type = curve_element_writer<Endianness, group_type>;
+
+                    static constexpr std::size_t length(std::size_t size) {
+                        return size * params_type::length();
+                    }
+
+                    template<typename TIter>
+                    static status_type process(const group_value_type *points, std::size_t size, TIter iter) {
+                        std::atomic<status_type> status{status_type::success};
+                        types::detail::for_each_chunk<TaskRunner>(
+                            size,
+                            [points, iter, &status](std::size_t begin, std::size_t end) {
+                                const status_type chunk_status = write_chunk(points, begin, end, iter);
+                                if (chunk_status != status_type::success) {
+                                    status = chunk_status;
+                                }
+                            },
+                            detail::min_curve_element_chunk_size);
+                        return status;
+                    }
+
+                private:
+                    template<typename TIter>
+                    static status_type write_chunk(const group_value_type *points, std::size_t begin,
+                                                   std::size_t end, TIter iter) {
+                        // Writers only set the units they need, e.g. just the flags for the point at infinity.
+                        std::fill(iter + length(begin), iter + length(end), 0);
+
+                        if constexpr (algebra::policies::detail::supports_batch_affine_buckets<group_value_type>()) {
+                            using affine_value_type =
+                                typename algebra::policies::detail::affine_value_type_of<group_value_type>::type;
+                            using affine_writer_type =
+                                curve_element_writer<Endianness, typename affine_value_type::group_type>;
+
+                            std::vector<affine_value_type> affine_points(end - begin);
+                            algebra::policies::detail::batch_to_affine(points + begin, 0, end - begin,
+                                                                       affine_points);
+                            for (std::size_t i = begin; i < end; ++i) {
+                                TIter point_iter = iter + length(i);
+                                const status_type status =
+                                    affine_writer_type::process(affine_points[i - begin], point_iter);
+                                if (status != status_type::success) {
+                                    return status;
+                                }
+                            }
+                        } else {
+                            for (std::size_t i = begin; i < end; ++i) {
+                                TIter point_iter = iter + length(i);
+                                const status_type status = writer_type::process(points[i], point_iter);
+                                if (status != status_type::success) {
+                                    return status;
+                                }
+                            }
+                        }
+                        return status_type::success;
+                    }
+                };
+
+                /**
+                 * @brief Reads a batch of points written by curve_element_writer or curve_element_batch_writer.
+                 *
+                 * The points are decompressed (a square root each) in chunks run by TaskRunner, and validated
+                 * in the same pass. Subgroup membership is the costly part of the validation, it may be
+                 * lowered to curve_element_validation::on_curve or skipped with curve_element_validation::none
+                 * for trusted data.
+                 *
+                 * @return status_type::invalid_msg_data if any of the points fails the validation.
+                 */
+                template<typename Endianness, typename Group,
+                         typename TaskRunner = types::detail::sequential_chunk_tasks>
+                struct curve_element_batch_reader {
+                    using group_type = Group;
+                    using group_value_type = typename group_type::value_type;
+                    using params_type = curve_element_marshalling_params<group_type>;
+                    using reader_type = curve_element_reader<Endianness, group_type>;
+
+                    static constexpr std::size_t length(std::size_t size) {
+                        return size * params_type::length();
+                    }
+
+                    template<typename TIter>
+                    static status_type process(group_value_type *points, std::size_t size, TIter iter,
+                                               curve_element_validation validation =
+                                                   curve_element_validation::subgroup) {
+                        std::atomic<status_type> status{status_type::success};
+                        types::detail::for_each_chunk<TaskRunner>(
+                            size,
+                            [points, iter, validation, &status](std::size_t begin, std::size_t end) {
+                                for (std::size_t i = begin; i < end && status == status_type::success; ++i) {
+                                    TIter point_iter = iter + length(i);
+                                    const status_type point_status = reader_type::process(points[i], point_iter);
+                                    if (point_status != status_type::success) {
+                                        status = point_status;
+                                    } else if (!is_valid(points[i], validation)) {
+                                        status = status_type::invalid_msg_data;
+                                    }
+                                }
+                            },
+                            detail::min_curve_element_chunk_size);
+                        return status;
+                    }
+
+                private:
+                    static bool is_valid(const group_value_type &point, curve_element_validation validation) {
+                        switch (validation) {
+                            case curve_element_validation::none:
+                                return true;
+                            case curve_element_validation::on_curve:
+                                return point.is_well_formed();
+                            case curve_element_validation::subgroup:
+                                return point.is_well_formed() && algebra::curves::detail::subgroup_check(point);
+                        }
+                        return false;
+                    }
+                };
+
+            }    // namespace processing
+        }        // namespace marshalling
+    }            // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_MARSHALLING_PROCESSING_CURVE_ELEMENT_BATCH_HPP
@@ -0,0 +1,314 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation <info@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef CRYPTO3_MARSHALLING_PROCESSING_FIELD_ELEMENT_VECTOR_HPP
+#define CRYPTO3_MARSHALLING_PROCESSING_FIELD_ELEMENT_VECTOR_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+#include <nil/marshalling/field_type.hpp>
+#include <nil/marshalling/status_type.hpp>
+
+#include <nil/crypto3/multiprecision/big_mod.hpp>
+
+#include <nil/crypto3/algebra/type_traits.hpp>
+
+#include <nil/crypto3/marshalling/algebra/types/field_element.hpp>
+#include <nil/crypto3/marshalling/algebra/types/detail/parallel_chunks.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace marshalling {
+            namespace processing {
+
+                /**
+                 * @brief Bulk codec of a contiguous vector of field elements in the canonical format.
+                 *
+                 * Produces exactly the bytes of types::field_element_vector: the element count as std::size_t
+                 * followed by the elements, every one taking field_element::length() bytes. Output is laid out in
+                 * advance, so the elements are converted and written in chunks run by TaskRunner (see
+                 * types::detail::for_each_chunk), instead of one by one through the marshalling objects.
+                 */
+                template<typename Endianness, typename FieldValueType,
+                         typename TaskRunner = types::detail::sequential_chunk_tasks>
+                struct field_element_vector_codec {
+                    using field_value_type = FieldValueType;
+                    using field_base_type = nil::crypto3::marshalling::field_type<Endianness>;
+                    using element_type = types::field_element<field_base_type, field_value_type>;
+                    using size_type = types::integral<field_base_type, std::size_t>;
+
+                    static_assert(algebra::is_field_element<field_value_type>::value);
+
+                    static constexpr std::size_t element_length() {
+                        return element_type::max_length();
+                    }
+
+                    static constexpr std::size_t length(std::size_t size) {
+                        return size_type::max_length() + size * element_length();
+                    }
+
+                    static status_type write(const field_value_type *values, std::size_t size, std::uint8_t *out,
+                                             std::size_t out_size) {
+                        if (out_size < length(size)) {
+                            return status_type::buffer_overflow;
+                        }
+                        std::uint8_t *iter = out;
+                        size_type(size).write_no_status(iter);
+                        types::detail::for_each_chunk<TaskRunner>(
+                            size, [values, out](std::size_t begin, std::size_t end) {
+                                std::uint8_t *iter = out + length(begin);
+                                for (std::size_t i = begin; i < end; ++i) {
+                                    element_type(values[i]).write(iter, element_length());
+                                }
+                            });
+                        return status_type::success;
+                    }
+
+                    /// @brief Reads the vector, data_size may be larger than the encoded vector.
+                    static status_type read(std::vector<field_value_type> &values, const std::uint8_t *data,
+                                            std::size_t data_size) {
+                        if (data_size < size_type::max_length()) {
+                            return status_type::not_enough_data;
+                        }
+                        const std::uint8_t *iter = data;
+                        size_type size;
+                        size.read_no_status(iter);
+                        if ((data_size - size_type::max_length()) / element_length() < size.value()) {
+                            return status_type::not_enough_data;
+                        }
+
+                        values.resize(size.value());
+                        types::detail::for_each_chunk<TaskRunner>(
+                            values.size(), [&values, data](std::size_t begin, std::size_t end) {
+                                const std::uint8_t *iter = data + length(begin);
+                                element_type element;
+                                for (std::size_t i = begin; i < end; ++i) {
+                                    element.read(iter, element_length());
+                                    values[i] = element.value();
+                                }
+                            });
+                        return status_type::success;
+                    }
+                };
+
+                namespace detail {
+                    template<typename FieldValueType, typename Enable = void>
+                    struct field_element_components {
+                        using base_value_type = FieldValueType;
+                        constexpr static const std::size_t count = 1;
+
+                        template<typename Func>
+                        static void apply(FieldValueType &value, const Func &func) {
+                            func(value.data);
+                        }
+
+                        template<typename Func>
+                        static void apply(const FieldValueType &value, const Func &func) {
+                            func(value.data);
+                        }
+                    };
+
+                    // Extended field elements are stored as their components in the base field, in the same
+                    // order as in the canonical format.
+                    template<typename FieldValueType>
+                    struct field_element_components<
+                        FieldValueType,
+                        typename std::enable_if<algebra::is_extended_field_element<FieldValueType>::value>::type> {
+                        using underlying_type = field_element_components<typename FieldValueType::underlying_type>;
+                        using base_value_type = typename underlying_type::base_value_type;
+                        constexpr static const std::size_t count =
+                            std::tuple_size<typename FieldValueType::data_type>::value * underlying_type::count;
+
+                        template<typename Func>
+                        static void apply(FieldValueType &value, const Func &func) {
+                            for (auto &component : value.data) {
+                                underlying_type::apply(component, func);
+                            }
+                        }
+
+                        template<typename Func>
+                        static void apply(const FieldValueType &value, const Func &func) {
+                            for (const auto &component : value.data) {
+                                underlying_type::apply(component, func);
+                            }
+                        }
+                    };
+
+                    inline void write_raw_header_word(std::uint8_t *&iter, std::uint64_t value, std::size_t bytes) {
+                        for (std::size_t i = 0; i < bytes; ++i) {
+                            *iter++ = static_cast<std::uint8_t>(value >> (8 * i));
+                        }
+                    }
+
+                    inline std::uint64_t read_raw_header_word(const std::uint8_t *&iter, std::size_t bytes) {
+                        std::uint64_t value = 0;
+                        for (std::size_t i = 0; i < bytes; ++i) {
+                            value |= std::uint64_t(*iter++) << (8 * i);
+                        }
+                        return value;
+                    }
+                }    // namespace detail
+
+                /**
+                 * @brief Internal format of a contiguous vector of field elements, storing the raw representation
+                 * of the elements (Montgomery form for the fields which use it) as is.
+                 *
+                 * No conversion is done in either direction: writing copies the limbs out and reading copies them
+                 * back in with memcpy. The format depends on the field, its in-memory representation and the
+                 * byte order of the machine, all of which are recorded in the header and checked on reading:
+                 *
+                 *   magic "nilfvraw" | version: u32 | representation: u32 | byte order mark: u32 |
+                 *   limbs bytes: u32 | components: u32 | modulus bits: u32 | modulus: limbs bytes | size: u64
+                 *
+                 * (all header words are little-endian), followed by size * components raw values of limbs bytes
+                 * each. The elements are not validated on reading, so the format is only meant for data written
+                 * by the prover itself, e.g. intermediate state kept between its stages. Data exchanged with
+                 * other parties uses field_element_vector_codec. The elements are copied in chunks run by
+                 * TaskRunner.
+                 */
+                template<typename FieldValueType, typename TaskRunner = types::detail::sequential_chunk_tasks>
+                struct raw_field_element_vector_codec {
+                    using field_value_type = FieldValueType;
+                    using components_type = detail::field_element_components<field_value_type>;
+                    using base_value_type = typename components_type::base_value_type;
+                    using modular_type = typename base_value_type::data_type;
+                    using raw_type = typename modular_type::base_type;
+                    using montgomery_ops_type =
+                        nil::crypto3::multiprecision::detail::montgomery_modular_ops<raw_type::Bits>;
+
+                    static_assert(algebra::is_field_element<field_value_type>::value);
+                    static_assert(nil::crypto3::multiprecision::is_big_mod_v<modular_type>);
+                    static_assert(std::is_trivially_copyable<raw_type>::value);
+
+                    enum class representation : std::uint32_t { regular = 0, montgomery = 1 };
+
+                    constexpr static const std::array<std::uint8_t, 8> magic = {'n', 'i', 'l', 'f', 'v', 'r', 'a', 'w'};
+                    constexpr static const std::uint32_t version = 1;
+                    constexpr static const std::uint32_t byte_order_mark = 0x01020304;
+
+                    constexpr static const representation field_representation =
+                        std::is_same<typename modular_type::modular_ops_t, montgomery_ops_type>::value ?
+                            representation::montgomery :
+                            representation::regular;
+
+                    static constexpr std::size_t header_length() {
+                        return magic.size() + 6 * sizeof(std::uint32_t) + sizeof(raw_type) + sizeof(std::uint64_t);
+                    }
+
+                    static constexpr std::size_t element_length() {
+                        return components_type::count * sizeof(raw_type);
+                    }
+
+                    static constexpr std::size_t length(std::size_t size) {
+                        return header_length() + size * element_length();
+                    }
+
+                    static status_type write(const field_value_type *values, std::size_t size, std::uint8_t *out,
+                                             std::size_t out_size) {
+                        if (out_size < length(size)) {
+                            return status_type::buffer_overflow;
+                        }
+                        write_header(out, size);
+                        types::detail::for_each_chunk<TaskRunner>(
+                            size, [values, out](std::size_t begin, std::size_t end) {
+                                std::uint8_t *iter = out + length(begin);
+                                for (std::size_t i = begin; i < end; ++i) {
+                                    components_type::apply(values[i], [&iter](const modular_type &component) {
+                                        const raw_type &raw =
+                                            nil::crypto3::multiprecision::detail::get_raw_base(component);
+                                        std::memcpy(iter, &raw, sizeof(raw_type));
+                                        iter += sizeof(raw_type);
+                                    });
+                                }
+                            });
+                        return status_type::success;
+                    }
+
+                    /**
+                     * @brief Reads the vector, data_size may be larger than the encoded vector.
+                     * @return status_type::invalid_msg_data if the data was written for another field, with
+                     * another representation or on a machine with another byte order.
+                     */
+                    static status_type read(std::vector<field_value_type> &values, const std::uint8_t *data,
+                                            std::size_t data_size) {
+                        if (data_size < header_length()) {
+                            return status_type::not_enough_data;
+                        }
+                        std::uint8_t expected_header[header_length()];
+                        write_header(expected_header, 0);
+                        const std::size_t size_offset = header_length() - sizeof(std::uint64_t);
+                        if (std::memcmp(data, expected_header, size_offset) != 0) {
+                            return status_type::invalid_msg_data;
+                        }
+                        const std::uint8_t *iter = data + size_offset;
+                        const std::uint64_t size = detail::read_raw_header_word(iter, sizeof(std::uint64_t));
+                        if ((data_size - header_length()) / element_length() < size) {
+                            return status_type::not_enough_data;
+                        }
+
+                        values.resize(size);
+                        types::detail::for_each_chunk<TaskRunner>(
+                            values.size(), [&values, data](std::size_t begin, std::size_t end) {
+                                const std::uint8_t *iter = data + length(begin);
+                                raw_type raw;
+                                for (std::size_t i = begin; i < end; ++i) {
+                                    components_type::apply(values[i], [&iter, &raw](modular_type &component) {
+                                        std::memcpy(&raw, iter, sizeof(raw_type));
+                                        nil::crypto3::multiprecision::detail::set_raw_base(component, raw);
+                                        iter += sizeof(raw_type);
+                                    });
+                                }
+                            });
+                        return status_type::success;
+                    }
+
+                private:
+                    static void write_header(std::uint8_t *out, std::uint64_t size) {
+                        const raw_type modulus(base_value_type::field_type::modulus);
+                        std::uint8_t *iter = std::copy(magic.begin(), magic.end(), out);
+                        detail::write_raw_header_word(iter, version, sizeof(std::uint32_t));
+                        detail::write_raw_header_word(iter, static_cast<std::uint32_t>(field_representation),
+                                                      sizeof(std::uint32_t));
+                        std::memcpy(iter, &byte_order_mark, sizeof(std::uint32_t));
+                        iter += sizeof(std::uint32_t);
+                        detail::write_raw_header_word(iter, sizeof(raw_type), sizeof(std::uint32_t));
+                        detail::write_raw_header_word(iter, components_type::count, sizeof(std::uint32_t));
+                        detail::write_raw_header_word(iter, base_value_type::field_type::modulus_bits,
+                                                      sizeof(std::uint32_t));
+                        std::memcpy(iter, &modulus, sizeof(raw_type));
+                        iter += sizeof(raw_type);
+                        detail::write_raw_header_word(iter, size, sizeof(std::uint64_t));
+                    }
+                };
+
+            }    // namespace processing
+        }        // namespace marshalling
+    }            // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_MARSHALLING_PROCESSING_FIELD_ELEMENT_VECTOR_HPP
@@ -0,0 +1,85 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation <info@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef CRYPTO3_MARSHALLING_ALGEBRA_PARALLEL_CHUNKS_HPP
+#define CRYPTO3_MARSHALLING_ALGEBRA_PARALLEL_CHUNKS_HPP
+
+#include <algorithm>
+#include <cstddef>
+
+namespace nil {
+    namespace crypto3 {
+        namespace marshalling {
+            namespace types {
+                namespace detail {
+
+                    /// Vectors of field elements shorter than this are converted as a single chunk.
+                    constexpr static const std::size_t min_parallel_chunk_size = 1 << 14;
+
+                    /**
+                     * Task runner of for_each_chunk which converts the chunks one after another on the calling
+                     * thread. The parallel tree provides one running them on its thread pool.
+                     */
+                    struct sequential_chunk_tasks {
+                        static std::size_t workers_count() {
+                            return 1;
+                        }
+
+                        template<typename Func>
+                        static void run(std::size_t tasks_count, const Func &func) {
+                            for (std::size_t task = 0; task < tasks_count; ++task) {
+                                func(task);
+                            }
+                        }
+                    };
+
+                    /**
+                     * Calls func(begin, end) for consecutive chunks of [0, size), one chunk per worker of
+                     * TaskRunner, but with at least min_chunk_size elements in a chunk. Elements of a vector are
+                     * converted independently, so the chunks need no synchronization as long as every chunk
+                     * writes to its own part of the output.
+                     */
+                    template<typename TaskRunner = sequential_chunk_tasks, typename Func>
+                    void for_each_chunk(std::size_t size, const Func &func,
+                                        std::size_t min_chunk_size = min_parallel_chunk_size) {
+                        const std::size_t chunks_count =
+                            std::clamp<std::size_t>(size / std::max<std::size_t>(min_chunk_size, 1), 1,
+                                                    std::max<std::size_t>(TaskRunner::workers_count(), 1));
+                        if (chunks_count == 1) {
+                            func(std::size_t(0), size);
+                            return;
+                        }
+
+                        const std::size_t chunk_size = (size + chunks_count - 1) / chunks_count;
+                        TaskRunner::run((size + chunk_size - 1) / chunk_size,
+                                        [&func, chunk_size, size](std::size_t chunk) {
+                                            const std::size_t begin = chunk * chunk_size;
+                                            func(begin, std::min(size, begin + chunk_size));
+                                        });
+                    }
+                }    // namespace detail
+            }        // namespace types
+        }            // namespace marshalling
+    }                // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_MARSHALLING_ALGEBRA_PARALLEL_CHUNKS_HPP
@@ -566,6 +566,7 @@ namespace nil {
                     using field_element_type = field_element<TTypeBase, FieldValueType>;
 
                     field_element_vector<FieldValueType, TTypeBase> result;
+                    result.value().reserve(field_elem_vector.size());
                     for (std::size_t i = 0; i < field_elem_vector.size(); i++) {
                         result.value().push_back(field_element_type(field_elem_vector[i]));
                     }
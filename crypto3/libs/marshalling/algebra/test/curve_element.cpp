@@ -83,6 +83,8 @@
 #include <nil/crypto3/marshalling/algebra/processing/secp_k1.hpp>
 #include <nil/crypto3/marshalling/algebra/processing/secp_r1.hpp>
 
+#include <nil/crypto3/marshalling/algebra/processing/curve_element_batch.hpp>
+
 template<typename T, typename endianness>
 void test_group_element(T val) {
     using namespace nil::crypto3::marshalling;
@@ -194,3 +196,101 @@ BOOST_AUTO_TEST_CASE(curve_element_ed25519) {
 }
 
 BOOST_AUTO_TEST_SUITE_END()
+
+// Runs the chunks of four workers in reverse order, as a thread pool may finish them in any order.
+struct reversed_chunk_tasks {
+    static std::size_t workers_count() {
+        return 4;
+    }
+
+    template<typename Func>
+    static void run(std::size_t tasks_count, const Func &func) {
+        for (std::size_t task = tasks_count; task-- > 0;) {
+            func(task);
+        }
+    }
+};
+
+template<typename group_type, typename endianness>
+void test_curve_element_batch(std::size_t size) {
+    using namespace nil::crypto3::marshalling;
+    using value_type = typename group_type::value_type;
+    using writer_type = processing::curve_element_writer<endianness, group_type>;
+    using batch_writer_type = processing::curve_element_batch_writer<endianness, group_type, reversed_chunk_tasks>;
+    using batch_reader_type = processing::curve_element_batch_reader<endianness, group_type, reversed_chunk_tasks>;
+    constexpr std::size_t length = processing::curve_element_marshalling_params<group_type>::length();
+
+    std::vector<value_type> points(size);
+    for (std::size_t i = 0; i < size; ++i) {
+        // Every 7th point is the point at infinity.
+        points[i] = i % 7 == 3 ? value_type::zero() : nil::crypto3::algebra::random_element<group_type>();
+    }
+
+    // The batch must produce the same bytes as the points written one by one.
+    std::vector<std::uint8_t> expected(length * size, 0);
+    for (std::size_t i = 0; i < size; ++i) {
+        auto iter = expected.begin() + i * length;
+        BOOST_CHECK(writer_type::process(points[i], iter) == status_type::success);
+    }
+
+    std::vector<std::uint8_t> bytes(batch_writer_type::length(size), 0xFF);
+    BOOST_CHECK(batch_writer_type::process(points.data(), size, bytes.begin()) == status_type::success);
+    BOOST_CHECK(bytes == expected);
+
+    for (auto validation : {processing::curve_element_validation::none,
+                            processing::curve_element_validation::on_curve,
+                            processing::curve_element_validation::subgroup}) {
+        std::vector<value_type> read_points(size);
+        BOOST_CHECK(batch_reader_type::process(read_points.data(), size, bytes.cbegin(), validation) ==
+                    status_type::success);
+        for (std::size_t i = 0; i < size; ++i) {
+            BOOST_CHECK_EQUAL(read_points[i].to_affine(), points[i].to_affine());
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(curve_element_batch_test_suite)
+
+using big_endian = nil::crypto3::marshalling::endian::big_endian;
+
+BOOST_AUTO_TEST_CASE(curve_element_batch_pallas) {
+    // Long enough to be split into several chunks.
+    test_curve_element_batch<nil::crypto3::algebra::curves::pallas::g1_type<>, big_endian>(1000);
+    test_curve_element_batch<nil::crypto3::algebra::curves::pallas::g1_type<>, big_endian>(0);
+}
+
+BOOST_AUTO_TEST_CASE(curve_element_batch_bls12_381) {
+    test_curve_element_batch<nil::crypto3::algebra::curves::bls12_381::g1_type<>, big_endian>(100);
+    test_curve_element_batch<nil::crypto3::algebra::curves::bls12_381::g2_type<>, big_endian>(100);
+}
+
+BOOST_AUTO_TEST_CASE(curve_element_batch_validation) {
+    using namespace nil::crypto3::marshalling;
+    using group_type = nil::crypto3::algebra::curves::bls12_381::g1_type<>;
+    using value_type = group_type::value_type;
+    using field_value_type = group_type::field_type::value_type;
+    using batch_writer_type = processing::curve_element_batch_writer<big_endian, group_type>;
+    using batch_reader_type = processing::curve_element_batch_reader<big_endian, group_type>;
+
+    // A point on the curve, but, with the large cofactor of BLS12-381 G1, outside of the prime order subgroup.
+    field_value_type x = 1u;
+    while (!(x.pow(3u) + group_type::params_type::b).is_square()) {
+        ++x;
+    }
+    const value_type outside(x, (x.pow(3u) + group_type::params_type::b).sqrt(), field_value_type::one());
+    BOOST_CHECK(outside.is_well_formed());
+
+    std::vector<value_type> points = {value_type::one(), outside, value_type::one()};
+    std::vector<std::uint8_t> bytes(batch_writer_type::length(points.size()));
+    BOOST_CHECK(batch_writer_type::process(points.data(), points.size(), bytes.begin()) == status_type::success);
+
+    std::vector<value_type> read_points(points.size());
+    BOOST_CHECK(batch_reader_type::process(read_points.data(), points.size(), bytes.cbegin()) ==
+                status_type::invalid_msg_data);
+    BOOST_CHECK(batch_reader_type::process(read_points.data(), points.size(), bytes.cbegin(),
+                                           processing::curve_element_validation::on_curve) ==
+                status_type::success);
+    BOOST_CHECK_EQUAL(read_points[1].to_affine(), outside.to_affine());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -38,9 +38,13 @@
 
 #include <nil/crypto3/algebra/random_element.hpp>
 #include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/fields/pallas/base_field.hpp>
+#include <nil/crypto3/algebra/fields/vesta/base_field.hpp>
+#include <nil/crypto3/algebra/fields/goldilocks64/base_field.hpp>
 
 #include <nil/marshalling/algorithms/pack.hpp>
 #include <nil/crypto3/marshalling/algebra/types/field_element.hpp>
+#include <nil/crypto3/marshalling/algebra/processing/field_element_vector.hpp>
 
 template<typename T, typename Endianness>
 void test_field_element(T val) {
@@ -127,3 +131,126 @@ BOOST_AUTO_TEST_CASE(field_element_bls12_381_g2_field_le) {
 }
 
 BOOST_AUTO_TEST_SUITE_END()
+
+template<typename FieldType>
+std::vector<typename FieldType::value_type> random_field_vector(std::size_t size) {
+    std::vector<typename FieldType::value_type> vec(size);
+    for (auto &v : vec) {
+        v = nil::crypto3::algebra::random_element<FieldType>();
+    }
+    return vec;
+}
+
+// Runs the chunks of four workers in reverse order, as a thread pool may finish them in any order.
+struct reversed_chunk_tasks {
+    static std::size_t workers_count() {
+        return 4;
+    }
+
+    template<typename Func>
+    static void run(std::size_t tasks_count, const Func &func) {
+        for (std::size_t task = tasks_count; task-- > 0;) {
+            func(task);
+        }
+    }
+};
+
+template<typename FieldType, typename Endianness>
+void test_field_element_vector_codec(std::size_t size) {
+    using namespace nil::crypto3::marshalling;
+    using value_type = typename FieldType::value_type;
+    using codec_type = processing::field_element_vector_codec<Endianness, value_type, reversed_chunk_tasks>;
+
+    const auto vec = random_field_vector<FieldType>(size);
+
+    // The bulk codec must produce the same bytes as the marshalling field_element_vector.
+    auto filled = types::fill_field_element_vector<value_type, Endianness>(vec);
+    std::vector<std::uint8_t> expected(filled.length());
+    auto write_iter = expected.begin();
+    BOOST_CHECK(filled.write(write_iter, expected.size()) == status_type::success);
+    BOOST_CHECK((types::make_field_element_vector<value_type, Endianness>(filled) == vec));
+
+    std::vector<std::uint8_t> bytes(codec_type::length(vec.size()));
+    BOOST_CHECK(codec_type::write(vec.data(), vec.size(), bytes.data(), bytes.size()) == status_type::success);
+    BOOST_CHECK(bytes == expected);
+
+    std::vector<value_type> read_vec;
+    BOOST_CHECK(codec_type::read(read_vec, bytes.data(), bytes.size()) == status_type::success);
+    BOOST_CHECK(read_vec == vec);
+
+    BOOST_CHECK(codec_type::write(vec.data(), vec.size(), bytes.data(), bytes.size() - 1) ==
+                status_type::buffer_overflow);
+    BOOST_CHECK(codec_type::read(read_vec, bytes.data(), bytes.size() - 1) == status_type::not_enough_data);
+}
+
+template<typename FieldType>
+void test_raw_field_element_vector_codec(std::size_t size) {
+    using namespace nil::crypto3::marshalling;
+    using value_type = typename FieldType::value_type;
+    using codec_type = processing::raw_field_element_vector_codec<value_type, reversed_chunk_tasks>;
+
+    const auto vec = random_field_vector<FieldType>(size);
+
+    std::vector<std::uint8_t> bytes(codec_type::length(vec.size()));
+    BOOST_CHECK(codec_type::write(vec.data(), vec.size(), bytes.data(), bytes.size()) == status_type::success);
+
+    std::vector<value_type> read_vec;
+    BOOST_CHECK(codec_type::read(read_vec, bytes.data(), bytes.size()) == status_type::success);
+    BOOST_CHECK(read_vec == vec);
+    BOOST_CHECK(codec_type::read(read_vec, bytes.data(), bytes.size() - 1) == status_type::not_enough_data);
+}
+
+BOOST_AUTO_TEST_SUITE(field_element_vector_codec_test_suite)
+
+BOOST_AUTO_TEST_CASE(field_element_vector_codec_pallas) {
+    // Long enough to be split into several chunks.
+    test_field_element_vector_codec<nil::crypto3::algebra::fields::pallas_base_field,
+                                    nil::crypto3::marshalling::option::big_endian>(100000);
+    test_field_element_vector_codec<nil::crypto3::algebra::fields::pallas_base_field,
+                                    nil::crypto3::marshalling::option::little_endian>(1000);
+    test_field_element_vector_codec<nil::crypto3::algebra::fields::pallas_base_field,
+                                    nil::crypto3::marshalling::option::big_endian>(0);
+}
+
+BOOST_AUTO_TEST_CASE(field_element_vector_codec_goldilocks) {
+    test_field_element_vector_codec<nil::crypto3::algebra::fields::goldilocks64_base_field,
+                                    nil::crypto3::marshalling::option::big_endian>(100000);
+}
+
+BOOST_AUTO_TEST_CASE(field_element_vector_codec_bls12_381_g2_field) {
+    test_field_element_vector_codec<nil::crypto3::algebra::curves::bls12<381>::g2_type<>::field_type,
+                                    nil::crypto3::marshalling::option::big_endian>(1000);
+}
+
+BOOST_AUTO_TEST_CASE(raw_field_element_vector_codec_roundtrip) {
+    test_raw_field_element_vector_codec<nil::crypto3::algebra::fields::pallas_base_field>(100000);
+    test_raw_field_element_vector_codec<nil::crypto3::algebra::fields::pallas_base_field>(0);
+    test_raw_field_element_vector_codec<nil::crypto3::algebra::fields::goldilocks64_base_field>(1000);
+    test_raw_field_element_vector_codec<nil::crypto3::algebra::curves::bls12<381>::g2_type<>::field_type>(1000);
+}
+
+BOOST_AUTO_TEST_CASE(raw_field_element_vector_codec_header) {
+    using namespace nil::crypto3::marshalling;
+    using pallas_codec_type =
+        processing::raw_field_element_vector_codec<nil::crypto3::algebra::fields::pallas_base_field::value_type>;
+    using vesta_codec_type =
+        processing::raw_field_element_vector_codec<nil::crypto3::algebra::fields::vesta_base_field::value_type>;
+
+    static_assert(pallas_codec_type::field_representation == pallas_codec_type::representation::montgomery);
+
+    const auto vec = random_field_vector<nil::crypto3::algebra::fields::pallas_base_field>(16);
+    std::vector<std::uint8_t> bytes(pallas_codec_type::length(vec.size()));
+    BOOST_CHECK(pallas_codec_type::write(vec.data(), vec.size(), bytes.data(), bytes.size()) ==
+                status_type::success);
+
+    // Same size of the elements, but another field.
+    std::vector<nil::crypto3::algebra::fields::vesta_base_field::value_type> vesta_vec;
+    BOOST_CHECK(vesta_codec_type::read(vesta_vec, bytes.data(), bytes.size()) == status_type::invalid_msg_data);
+
+    // Raw data must not be taken for the canonical format or the other way around.
+    std::vector<nil::crypto3::algebra::fields::pallas_base_field::value_type> read_vec;
+    bytes[0] ^= 1;
+    BOOST_CHECK(pallas_codec_type::read(read_vec, bytes.data(), bytes.size()) == status_type::invalid_msg_data);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
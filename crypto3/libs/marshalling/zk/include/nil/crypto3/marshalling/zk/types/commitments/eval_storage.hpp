@@ -105,15 +105,18 @@ namespace nil {
                         TTypeBase,
                         nil::crypto3::marshalling::types::integral<TTypeBase, uint8_t>
                     > filled_eval_points_num;
+                    std::size_t z_val_size = 0;
                     for( std::size_t i = 0; i < batches.size(); i++ ){
                         for( std::size_t j = 0; j < z.get_batch_size(batches[i]); j++ ){
                             filled_eval_points_num.value().push_back(
                                 nil::crypto3::marshalling::types::integral<TTypeBase, uint8_t>(z.get_poly_points_number(batches[i], j))
                             );
+                            z_val_size += z.get_poly_points_number(batches[i], j);
                         }
                     }
 
                     std::vector<typename EvalStorage::field_type::value_type> z_val;
+                    z_val.reserve(z_val_size);
                     for( std::size_t i = 0; i < batches.size(); i++ ){
                         for(std::size_t j = 0; j < z.get_batch_size(batches[i]); j++ ){
                             for(std::size_t k = 0; k < z.get_poly_points_number(batches[i], j); k++ ){
@@ -407,13 +407,34 @@ namespace nil {
                     nil::crypto3::marshalling::types::standard_array_list<
                         TTypeBase, typename types::merkle_node_value<TTypeBase, typename FRI::merkle_proof_type>::type
                     > filled_fri_roots;
+                    filled_fri_roots.value().reserve(proof.fri_roots.size());
                     for( size_t i = 0; i < proof.fri_roots.size(); i++){
                         filled_fri_roots.value().push_back(fill_merkle_node_value<typename FRI::commitment_type, Endianness>(proof.fri_roots[i]));
                     }
 
                     std::size_t lambda = proof.query_proofs.size();
+
+                    // Count the values up front, so the flat buffers below are allocated once.
+                    std::size_t initial_val_size = 0;
+                    std::size_t initial_proofs_count = 0;
+                    std::size_t round_val_size = 0;
+                    std::size_t round_proofs_count = 0;
+                    for( std::size_t i = 0; i < lambda; i++ ){
+                        for( const auto &it: proof.query_proofs[i].initial_proof){
+                            for( const auto &values: it.second.values ){
+                                initial_val_size += values.size() * FRI::m;
+                            }
+                            initial_proofs_count++;
+                        }
+                        for( const auto &round_proof: proof.query_proofs[i].round_proofs ){
+                            round_val_size += round_proof.y.size() * 2;
+                            round_proofs_count++;
+                        }
+                    }
+
                     // initial_polynomials values
                     std::vector<typename FRI::field_type::value_type> initial_val;
+                    initial_val.reserve(initial_val_size);
                     for( std::size_t i = 0; i < lambda; i++ ){
                         auto &query_proof = proof.query_proofs[i];
                         for( const auto &it: query_proof.initial_proof){
@@ -446,6 +467,7 @@ namespace nil {
 
                     // fill round values
                     std::vector<typename FRI::field_type::value_type> round_val;
+                    round_val.reserve(round_val_size);
                     for( std::size_t i = 0; i < lambda; i++ ){
                         auto &query_proof = proof.query_proofs[i];
                         for( std::size_t j = 0; j < query_proof.round_proofs.size(); j++ ){
@@ -475,6 +497,7 @@ namespace nil {
                         TTypeBase,
                         typename types::merkle_proof<TTypeBase, typename FRI::merkle_proof_type>
                     > filled_initial_merkle_proofs;
+                    filled_initial_merkle_proofs.value().reserve(initial_proofs_count);
                     for( std::size_t i = 0; i < lambda; i++){
                         const auto &query_proof = proof.query_proofs[i];
                         for( const auto &it:query_proof.initial_proof){
@@ -490,6 +513,7 @@ namespace nil {
                         TTypeBase,
                         typename types::merkle_proof<TTypeBase, typename FRI::merkle_proof_type>
                     > filled_round_merkle_proofs;
+                    filled_round_merkle_proofs.value().reserve(round_proofs_count);
                     for( std::size_t i = 0; i < lambda; i++){
                         const auto &query_proof = proof.query_proofs[i];
                         for( const auto &round_proof:query_proof.round_proofs){
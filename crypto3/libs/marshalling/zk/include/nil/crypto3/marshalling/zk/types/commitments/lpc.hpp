@@ -286,10 +286,12 @@ namespace nil {
                     >;
                 };
 
-                template<typename Endianness, typename LPCScheme>
+                // The polynomials are taken from 'polys' instead of the scheme, e.g. none of them when they are
+                // stored separately.
+                template<typename Endianness, typename LPCScheme, typename PolysMap>
                 typename commitment_scheme_state<nil::crypto3::marshalling::field_type<Endianness>, LPCScheme,
                                                  std::enable_if_t<nil::crypto3::zk::is_lpc<LPCScheme>>>::type
-                fill_commitment_scheme(const LPCScheme &scheme) {
+                fill_commitment_scheme(const LPCScheme &scheme, const PolysMap &polys) {
                     using TTypeBase = nil::crypto3::marshalling::field_type<Endianness>;
                     using result_type = typename commitment_scheme_state<nil::crypto3::marshalling::field_type<Endianness>, LPCScheme>::type;
 
@@ -298,12 +300,14 @@ namespace nil {
                     nil::crypto3::marshalling::types::standard_array_list<
                             TTypeBase,
                             typename precommitment_type<TTypeBase, LPCScheme>::type> filled_trees_values;
-                    for (const auto&[key, value]: scheme.get_trees()) {
+                    // Spilled batches are read back one at a time.
+                    for (const auto&[key, value]: scheme.trees_view()) {
                         filled_trees_keys.value().push_back(nil::crypto3::marshalling::types::integral<TTypeBase, std::size_t>(key));
                         // Precommitment for LPC is a merkle tree. We may want to abstract away this part into a separate
                         // fill_precommitment function.
                         filled_trees_values.value().push_back(
-                            fill_merkle_tree<typename LPCScheme::precommitment_type, Endianness>(value));
+                            fill_merkle_tree<typename LPCScheme::precommitment_type, Endianness>(
+                                *nil::crypto3::zk::detail::load_batch(value)));
                     }
 
                     //std::map<std::size_t, bool> _batch_fixed;
@@ -326,10 +330,17 @@ namespace nil {
                         filled_batch_fixed_values,
                         fill_commitment_preprocessed_data<Endianness, LPCScheme>(scheme.get_fixed_polys_values()),
                         fill_polys_evaluator<Endianness, typename LPCScheme::polys_evaluator_type>(
-                            static_cast<typename LPCScheme::polys_evaluator_type>(scheme))
+                            static_cast<const typename LPCScheme::polys_evaluator_type&>(scheme), polys)
                     ));
                 }
 
+                template<typename Endianness, typename LPCScheme>
+                typename commitment_scheme_state<nil::crypto3::marshalling::field_type<Endianness>, LPCScheme,
+                                                 std::enable_if_t<nil::crypto3::zk::is_lpc<LPCScheme>>>::type
+                fill_commitment_scheme(const LPCScheme &scheme) {
+                    return fill_commitment_scheme<Endianness, LPCScheme>(scheme, scheme.polys_view());
+                }
+
                 template<typename Endianness, typename LPCScheme>
                 outcome::result<LPCScheme, nil::crypto3::marshalling::status_type>
                 make_commitment_scheme(
@@ -42,6 +42,7 @@
 #include <nil/crypto3/marshalling/zk/types/commitments/eval_storage.hpp>
 
 #include <nil/crypto3/zk/commitments/type_traits.hpp>
+#include <nil/crypto3/zk/detail/batch_source.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -77,9 +78,11 @@ namespace nil {
                     > // This one closes the tuple
                 >; // this one closes the bundle
 
-                template <typename Endianness, typename PolysEvaluator>
+                // The polynomials are taken from 'polys' instead of the evaluator, e.g. the batches of a commitment
+                // scheme some of which are spilled out of memory. They are read one batch at a time.
+                template <typename Endianness, typename PolysEvaluator, typename PolysMap>
                 polys_evaluator<nil::crypto3::marshalling::field_type<Endianness>, PolysEvaluator>
-                fill_polys_evaluator(const PolysEvaluator& evaluator) {
+                fill_polys_evaluator(const PolysEvaluator& evaluator, const PolysMap& polys) {
 
                     using nil::crypto3::marshalling::types::fill_size_t;
                     using nil::crypto3::marshalling::types::fill_std_map;
@@ -98,13 +101,13 @@ namespace nil {
 
                     using result_type = polys_evaluator<nil::crypto3::marshalling::field_type<Endianness>, PolysEvaluator>;
 
-                    auto [filled_polys_keys, filled_polys_values] = fill_std_map<
-                            TTypeBase,
-                            size_t_marshalling_type,
-                            polynomial_vector_marshalling_type,
-                            std::size_t,
-                            std::vector<polynomial_type>>(
-                        evaluator._polys, fill_size_t<TTypeBase>, fill_polynomial_vector<Endianness, polynomial_type>);
+                    standard_array_list<TTypeBase, size_t_marshalling_type> filled_polys_keys;
+                    standard_array_list<TTypeBase, polynomial_vector_marshalling_type> filled_polys_values;
+                    for (const auto& [key, batch]: polys) {
+                        filled_polys_keys.value().push_back(fill_size_t<TTypeBase>(key));
+                        filled_polys_values.value().push_back(fill_polynomial_vector<Endianness, polynomial_type>(
+                            *nil::crypto3::zk::detail::load_batch(batch)));
+                    }
 
                     // Note that we marshall a bool value as an std::size_t.
                     auto [filled_locked_keys, filled_locked_values] = fill_std_map<
@@ -144,6 +147,12 @@ namespace nil {
                     );
                 }
 
+                template <typename Endianness, typename PolysEvaluator>
+                polys_evaluator<nil::crypto3::marshalling::field_type<Endianness>, PolysEvaluator>
+                fill_polys_evaluator(const PolysEvaluator& evaluator) {
+                    return fill_polys_evaluator<Endianness, PolysEvaluator>(evaluator, evaluator._polys);
+                }
+
                 template <typename Endianness, typename PolysEvaluator>
                 PolysEvaluator make_polys_evaluator(
                     const polys_evaluator<nil::crypto3::marshalling::field_type<Endianness>, PolysEvaluator>& filled_polys_evaluator)
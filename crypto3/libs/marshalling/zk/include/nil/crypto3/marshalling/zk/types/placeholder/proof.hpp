@@ -193,6 +193,7 @@ namespace nil {
                         typename commitment<TTypeBase, typename Proof::commitment_scheme_type>::type,
                         nil::crypto3::marshalling::option::sequence_size_field_prefix<nil::crypto3::marshalling::types::integral<TTypeBase, std::uint8_t>>
                     > filled_commitments;
+                    filled_commitments.value().reserve(proof.commitments.size());
                     for( const auto &it:proof.commitments){
                         filled_commitments.value().push_back(
                             fill_commitment<Endianness, typename Proof::commitment_scheme_type>(it.second)
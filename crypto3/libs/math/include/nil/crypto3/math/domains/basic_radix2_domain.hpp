@@ -51,6 +51,8 @@ namespace nil {
                 typedef std::pair<std::vector<field_value_type>, std::vector<field_value_type>> cache_type;
                 std::shared_ptr<cache_type> fft_cache;
 
+            public:
+                /// @brief Builds the FFT tables now instead of on the first fft or inverse_fft call.
                 void create_fft_cache() {
                     fft_cache = std::make_shared<cache_type>(std::vector<field_value_type>(),
                                                              std::vector<field_value_type>());
@@ -58,7 +60,6 @@ namespace nil {
                     detail::create_fft_cache<FieldType>(this->m, omega.inversed(), fft_cache->second);
                 }
 
-            public:
                 typedef FieldType field_type;
 
                 field_value_type omega;
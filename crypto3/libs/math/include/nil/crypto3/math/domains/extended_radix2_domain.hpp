@@ -51,13 +51,14 @@ namespace nil {
 
                 std::unique_ptr<cache_type> fft_cache;
 
+            public:
+                /// @brief Builds the FFT tables now instead of on the first fft or inverse_fft call.
                 void create_fft_cache() {
                     fft_cache = std::make_unique<cache_type>(std::vector<field_value_type>(),
                                                              std::vector<field_value_type>());
                     detail::create_fft_cache<FieldType>(small_m, omega, fft_cache->first);
                     detail::create_fft_cache<FieldType>(small_m, omega.inversed(), fft_cache->second);
                 }
-            public:
                 typedef FieldType field_type;
 
                 const std::size_t small_m;
@@ -51,6 +51,8 @@ namespace nil {
 
                 std::unique_ptr<cache_type> small_fft_cache, big_fft_cache;
 
+            public:
+                /// @brief Builds the FFT tables now instead of on the first fft or inverse_fft call.
                 void create_fft_cache() {
                     small_fft_cache = std::make_unique<cache_type>(
                         std::make_pair(std::vector<field_value_type>(), std::vector<field_value_type>()));
@@ -61,7 +63,6 @@ namespace nil {
                     detail::create_fft_cache<FieldType>(small_m, small_omega, small_fft_cache->first);
                     detail::create_fft_cache<FieldType>(small_m, small_omega.inversed(), small_fft_cache->second);
                 }
-            public:
                 typedef FieldType field_type;
 
                 const std::size_t big_m;
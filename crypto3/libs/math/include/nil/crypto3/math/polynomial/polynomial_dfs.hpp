@@ -138,7 +138,7 @@ namespace nil {
                                      "DFS optimal polynomial size must be a power of two");
                 }
 
-                polynomial_dfs(size_t d, container_type&& c) : val(c), _d(d) {
+                polynomial_dfs(size_t d, container_type&& c) : val(std::move(c)), _d(d) {
                     BOOST_ASSERT_MSG(val.size() == detail::power_of_two(val.size()),
                                      "DFS optimal polynomial size must be a power of two");
                 }
@@ -556,6 +556,22 @@ namespace nil {
                     return *this;
                 }
 
+                /**
+                 * Multiplies by a polynomial given by its values on the same domain, e.g. by
+                 * a polynomial_dfs_rotated_view of a column, without copying these values.
+                 */
+                template<typename PolynomialDFSView>
+                polynomial_dfs& pointwise_multiplication(const PolynomialDFSView& other) {
+                    BOOST_ASSERT_MSG(other.size() == this->size(), "Pointwise multiplication requires equal domains");
+                    BOOST_ASSERT_MSG(this->_d + other.degree() < this->size(),
+                                     "Product degree does not fit the domain, resize the polynomial first");
+                    this->_d += other.degree();
+                    for (std::size_t i = 0; i < this->size(); ++i) {
+                        this->val[i] *= other[i];
+                    }
+                    return *this;
+                }
+
                 /**
                  * Perform the multiplication of two polynomials, polynomial A * constant alpha,
                  * and stores result in polynomial A.
@@ -28,6 +28,7 @@
 #define CRYPTO3_MATH_POLYNOMIAL_POLYNOM_DFS_VIEW_HPP
 
 #include <algorithm>
+#include <iterator>
 #include <vector>
 
 #include <nil/crypto3/math/polynomial/basic_operations.hpp>
@@ -502,6 +503,60 @@ namespace nil {
                     return tmp;
                 }
             };
+
+            /**
+             * Read-only view of a column rotated by a number of rows, P(omega^rotation * X), for a polynomial
+             * stored in DFS form. The column may be given on the original domain or on an extended one,
+             * row i of the view is row (i + rotation * stride) mod n of the column, stride being the ratio
+             * of the column size to the original domain size. No values are copied.
+             */
+            template<typename PolynomialDFSType>
+            class polynomial_dfs_rotated_view {
+            public:
+                typedef PolynomialDFSType polynomial_type;
+                typedef typename polynomial_type::value_type value_type;
+                typedef typename polynomial_type::size_type size_type;
+
+                polynomial_dfs_rotated_view(const polynomial_type &column, int rotation, size_type domain_size)
+                    : _column(&column), _mask(column.size() - 1) {
+                    BOOST_ASSERT_MSG(column.size() % domain_size == 0,
+                                     "Column size must be a multiple of the original domain size");
+                    const std::ptrdiff_t n = column.size();
+                    const std::ptrdiff_t shift = rotation * std::ptrdiff_t(column.size() / domain_size);
+                    _shift = ((shift % n) + n) % n;
+                }
+
+                const value_type &operator[](size_type i) const BOOST_NOEXCEPT {
+                    return (*_column)[(i + _shift) & _mask];
+                }
+
+                size_type size() const BOOST_NOEXCEPT {
+                    return _column->size();
+                }
+
+                size_type degree() const BOOST_NOEXCEPT {
+                    return _column->degree();
+                }
+
+                const polynomial_type &column() const BOOST_NOEXCEPT {
+                    return *_column;
+                }
+
+                /**
+                 * Copies the rotated values, equivalent to polynomial_shift on the column.
+                 */
+                polynomial_type materialize() const {
+                    polynomial_type result(_column->degree(), _column->size());
+                    std::rotate_copy(_column->begin(), std::next(_column->begin(), _shift), _column->end(),
+                                     result.begin());
+                    return result;
+                }
+
+            private:
+                const polynomial_type *_column;
+                size_type _mask;
+                size_type _shift;
+            };
         }    // namespace math
     }        // namespace crypto3
 }    // namespace nil
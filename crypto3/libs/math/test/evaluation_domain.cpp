@@ -28,6 +28,7 @@
 #include <boost/test/unit_test.hpp>
 
 #include <memory>
+#include <thread>
 #include <vector>
 #include <cstdint>
 #include <algorithm>
@@ -538,4 +539,58 @@ BOOST_AUTO_TEST_CASE(get_vanishing_polynomial) {
                             arithmetic_sequence_domain<field_type>>(4);
 }
 
+BOOST_AUTO_TEST_CASE(resident_evaluation_domains_are_shared) {
+    typedef curves::bls12<381>::scalar_field_type field_type;
+
+    // Without a scope every call builds a new domain.
+    BOOST_CHECK(make_evaluation_domain<field_type>(16) != make_evaluation_domain<field_type>(16));
+    {
+        resident_evaluation_domains<field_type> outer;
+        auto domain = make_evaluation_domain<field_type>(16);
+        BOOST_CHECK(std::dynamic_pointer_cast<basic_radix2_domain<field_type>>(domain));
+        {
+            resident_evaluation_domains<field_type> inner;
+            BOOST_CHECK(make_evaluation_domain<field_type>(16) == domain);
+        }
+        BOOST_CHECK(make_evaluation_domain<field_type>(16) == domain);
+        BOOST_CHECK(make_evaluation_domain<field_type>(32) != domain);
+        BOOST_CHECK_EQUAL(resident_evaluation_domains<field_type>::size(), 2);
+
+
+        std::vector<field_type::value_type> a = {1u, 2u, 3u, 4u, 5u, 6u, 7u, 8u, 9u, 10u, 11u, 12u, 13u, 14u, 15u, 16u};
+        std::vector<field_type::value_type> b = a;
+        domain->fft(a);
+        build_evaluation_domain<field_type>(16)->fft(b);
+        BOOST_CHECK(a == b);
+    }
+    BOOST_CHECK_EQUAL(resident_evaluation_domains<field_type>::size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(resident_evaluation_domains_fft_from_threads) {
+    typedef curves::bls12<381>::scalar_field_type field_type;
+
+    // A kept domain has its FFT tables built already, the threads only read them.
+    resident_evaluation_domains<field_type> scope;
+    auto domain = make_evaluation_domain<field_type>(64);
+
+    std::vector<field_type::value_type> input(64);
+    for (std::size_t i = 0; i < input.size(); ++i) {
+        input[i] = field_type::value_type(i + 1);
+    }
+    std::vector<field_type::value_type> expected = input;
+    build_evaluation_domain<field_type>(64)->fft(expected);
+
+    std::vector<std::vector<field_type::value_type>> results(4, input);
+    std::vector<std::thread> threads;
+    for (auto &result : results) {
+        threads.emplace_back([&domain, &result]() { domain->fft(result); });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    for (const auto &result : results) {
+        BOOST_CHECK(result == expected);
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -36,6 +36,8 @@
 #include <nil/crypto3/algebra/fields/arithmetic_params/bls12.hpp>
 
 #include <nil/crypto3/math/polynomial/polynomial_dfs_view.hpp>
+#include <nil/crypto3/math/polynomial/polynomial_dfs.hpp>
+#include <nil/crypto3/math/polynomial/shift.hpp>
 
 using namespace nil::crypto3::algebra;
 using namespace nil::crypto3::math;
@@ -657,3 +659,45 @@ BOOST_AUTO_TEST_CASE(polynomial_dfs_view_modulus) {
 }
 
 BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(polynomial_dfs_rotated_view_test_suite)
+
+BOOST_AUTO_TEST_CASE(polynomial_dfs_rotated_view_matches_shift) {
+    using polynomial_dfs_type = polynomial_dfs<typename FieldType::value_type>;
+    const std::size_t domain_size = 8;
+
+    polynomial_dfs_type column(domain_size - 1, domain_size);
+    for (std::size_t i = 0; i < domain_size; i++) {
+        column[i] = typename FieldType::value_type(3 * i * i + 7);
+    }
+    polynomial_dfs_type extended = column;
+    extended.resize(4 * domain_size);
+
+    for (int rotation : {-3, -1, 1, 2, 9}) {
+        polynomial_dfs_rotated_view<polynomial_dfs_type> view(column, rotation, domain_size);
+        polynomial_dfs_type shifted = polynomial_shift(column, rotation, domain_size);
+        BOOST_CHECK_EQUAL(view.size(), shifted.size());
+        BOOST_CHECK_EQUAL(view.degree(), shifted.degree());
+        for (std::size_t i = 0; i < view.size(); i++) {
+            BOOST_CHECK_EQUAL(view[i], shifted[i]);
+        }
+        BOOST_CHECK(view.materialize() == shifted);
+
+        // Rotation on the extended domain is a shift by rotation * stride rows.
+        polynomial_dfs_rotated_view<polynomial_dfs_type> extended_view(extended, rotation, domain_size);
+        polynomial_dfs_type extended_shifted = shifted;
+        extended_shifted.resize(4 * domain_size);
+        for (std::size_t i = 0; i < extended_view.size(); i++) {
+            BOOST_CHECK_EQUAL(extended_view[i], extended_shifted[i]);
+        }
+
+        polynomial_dfs_type product = extended;
+        product.pointwise_multiplication(extended_view);
+        polynomial_dfs_type expected = column;
+        expected *= shifted;
+        expected.resize(product.size());
+        BOOST_CHECK(product == expected);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
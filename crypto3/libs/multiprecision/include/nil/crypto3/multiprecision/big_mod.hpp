@@ -25,6 +25,7 @@
 
 #include "nil/crypto3/multiprecision/detail/big_mod/modular_ops.hpp"
 #include "nil/crypto3/multiprecision/detail/big_mod/modular_ops_storage.hpp"
+#include "nil/crypto3/multiprecision/detail/big_mod/raw_base_access.hpp"  // IWYU pragma: keep (for set_raw_base)
 #include "nil/crypto3/multiprecision/detail/big_mod/test_support.hpp"  // IWYU pragma: keep (for get_raw_base)
 #include "nil/crypto3/multiprecision/detail/integer_ops_base.hpp"  // IWYU pragma: keep (used for is_zero)
 #include "nil/crypto3/multiprecision/type_traits.hpp"
@@ -256,6 +257,9 @@ namespace nil::crypto3::multiprecision {
 
         template<typename big_mod_t>
         friend constexpr const auto& detail::get_raw_base(const big_mod_t& a);
+        template<typename big_mod_t>
+        friend constexpr void detail::set_raw_base(big_mod_t& a,
+                                                   const typename big_mod_t::base_type& raw_base);
     };
 
     template<const auto& Modulus, template<std::size_t> typename modular_ops_template>
@@ -0,0 +1,22 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation <info@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#pragma once
+
+#include "nil/crypto3/multiprecision/type_traits.hpp"
+
+namespace nil::crypto3::multiprecision::detail {
+    // Sets the raw internal representation (e.g. Montgomery form), as returned by get_raw_base. Used by
+    // serialization formats which store the raw representation as is, the caller must make sure that it was
+    // produced with the same modulus and modular ops.
+    template<typename big_mod_t>
+    constexpr void set_raw_base(big_mod_t& a, const typename big_mod_t::base_type& raw_base) {
+        static_assert(is_big_mod_v<big_mod_t>);
+        a.m_raw_base = raw_base;
+    }
+}  // namespace nil::crypto3::multiprecision::detail
@@ -29,6 +29,7 @@
 #include <string>
 #include <fstream>
 #include <sstream>
+#include <stdexcept>
 #include <filesystem>
 #include <unordered_set>
 
@@ -39,6 +40,7 @@
 #include <nil/blueprint/transpiler/templates/permutation_argument_chunked.hpp>
 #include <nil/blueprint/transpiler/templates/lookup_argument.hpp>
 #include <nil/blueprint/transpiler/templates/lookup_argument_chunked.hpp>
+#include <nil/blueprint/transpiler/templates/logup_argument.hpp>
 #include <nil/blueprint/transpiler/templates/commitment_scheme.hpp>
 #include <nil/blueprint/transpiler/templates/external_gate.hpp>
 #include <nil/blueprint/transpiler/templates/external_lookup.hpp>
@@ -308,7 +310,7 @@ namespace nil {
                 std::string library_lookups;
 
                 for(auto const& i: lookups_list) {
-                    std::string lookup_evaluation = lookup_evaluation_template;
+                    std::string lookup_evaluation = _use_logup ? logup_evaluation_template : lookup_evaluation_template;
                     boost::replace_all(lookup_evaluation, "$LOOKUP_ID$" , to_string(i) );
                     boost::replace_all(lookup_evaluation, "$LOOKUP_ASSEMBLY_CODE$", lookup_codes.at(i));
                     library_lookups += lookup_evaluation;
@@ -358,7 +360,14 @@ namespace nil {
                         out << "\t\tl = addmod( l, mulmod( mulmod($STATE$theta_acc, $STATE$selector_value, modulus), sum, modulus), modulus);" << std::endl;
                         out << "\t\t$STATE$theta_acc = mulmod($STATE$theta_acc, $STATE$theta, modulus);" << std::endl;
                     }
-                    out << "\t\t$STATE$g = mulmod($STATE$g, mulmod(addmod(1, $STATE$beta, modulus), addmod(l, $STATE$gamma, modulus), modulus), modulus);" << std::endl;
+                    if (_use_logup) {
+                        // g/h += 1/(l + gamma)
+                        out << "\t\tl = addmod(l, $STATE$gamma, modulus);" << std::endl;
+                        out << "\t\t$STATE$g = addmod(mulmod($STATE$g, l, modulus), $STATE$h, modulus);" << std::endl;
+                        out << "\t\t$STATE$h = mulmod($STATE$h, l, modulus);" << std::endl;
+                    } else {
+                        out << "\t\t$STATE$g = mulmod($STATE$g, mulmod(addmod(1, $STATE$beta, modulus), addmod(l, $STATE$gamma, modulus), modulus), modulus);" << std::endl;
+                    }
                 }
 
                 return out.str();
@@ -598,6 +607,34 @@ namespace nil {
                 return gate_argument_str.str();
             }
 
+            // Table options enter LogUp with their multiplicities: g/h -= m_j/(t_j + gamma).
+            // m_j is the j-th column of the lookup batch, the shifted table values are not needed.
+            void print_logup_tables(std::stringstream &lookup_str){
+                std::size_t j = 0;
+                std::size_t table_index = 1;
+                for(const auto &table: _constraint_system.lookup_tables()){
+                    variable_type sel_var(table.tag_index, 0, true, variable_type::column_type::selector);
+                    lookup_str << "\t\t\tstate.selector_value = basic_marshalling.get_uint256_be(blob, " << _var_indices.at(sel_var) * 0x20 << ");" << std::endl;
+
+                    for( const auto &option: table.lookup_options ){
+                        lookup_str <<
+                            "\t\t\tl = mulmod( " << table_index << ", state.selector_value, modulus);" << std::endl;
+                        lookup_str << "\t\t\tstate.theta_acc=state.theta;" << std::endl;
+                        for( const auto &var: option ){
+                            lookup_str <<
+                                "\t\t\tl = addmod( l, mulmod(state.selector_value,  mulmod( state.theta_acc, basic_marshalling.get_uint256_be(blob, " << _var_indices.at(var) * 0x20 << "), modulus), modulus), modulus);" << std::endl;
+                            lookup_str << "\t\t\tstate.theta_acc = mulmod(state.theta_acc, state.theta, modulus);" << std::endl;
+                        }
+                        lookup_str << "\t\t\tl = addmod(l, state.gamma, modulus);" << std::endl;
+                        lookup_str << "\t\t\tstate.g = addmod(mulmod(state.g, l, modulus), modulus - mulmod(basic_marshalling.get_uint256_be(sorted, " << j * 0x60 << "), state.h, modulus), modulus);" << std::endl;
+                        lookup_str << "\t\t\tstate.h = mulmod(state.h, l, modulus);" << std::endl;
+                        j++;
+                    }
+                    table_index++;
+                }
+                lookup_str << std::endl;
+            }
+
             std::string print_lookup_argument(){
                 std::size_t lookup_count = _constraint_system.lookup_gates().size();
                 if (lookup_count == 0)
@@ -665,7 +702,7 @@ namespace nil {
                         lookup_str << lookup_codes[i] << std::endl;
                         lookup_str << "// -- /lookup " << i << " is inlined -- " << std::endl;
                     } else {
-                        std::string lookup_eval_string = lookup_call_template;
+                        std::string lookup_eval_string = _use_logup ? logup_call_template : lookup_call_template;
                         boost::replace_all(lookup_eval_string, "$TEST_NAME$", _test_name);
                         boost::replace_all(lookup_eval_string, "$LOOKUP_LIB_ID$", to_string(lookup_lib[i]));
                         boost::replace_all(lookup_eval_string, "$LOOKUP_ID$", to_string(i));
@@ -686,6 +723,11 @@ namespace nil {
                     out.close();
                 }
 
+                if (_use_logup) {
+                    print_logup_tables(lookup_str);
+                    return lookup_str.str();
+                }
+
                 j = 0;
                 std::size_t table_index = 1;
                 for(const auto &table: _constraint_system.lookup_tables()){
@@ -831,6 +873,11 @@ namespace nil {
 
             void print(){
                 if(_use_lookups && _placeholder_info.lookup_poly_amount > 1){
+                    // The LogUp contract only checks the unsplit fractional sum, it would accept the helper
+                    // columns of a chunked argument unchecked.
+                    if( _use_logup ){
+                        throw std::invalid_argument("LogUp lookup argument chunking is not supported in evm contracts");
+                    }
                     std::cout << "Lookup argument chunking not supported in evm contracts" << std::endl;
                     return;
                 }
@@ -852,7 +899,7 @@ namespace nil {
                 reps["$VERIFICATION_KEY2$"] = "0x" + to_string(_common_data.vk.fixed_values_commitment);
                 reps["$BATCHES_NUM$"] = to_string(_placeholder_info.batches_num);
                 reps["$EVAL_PROOF_OFFSET$"] = "0x" + to_hex_string(_placeholder_info.batches_num * 0x28 - 0x27);
-                reps["$SORTED_COLUMNS_NUMBER$"] = to_string(_constraint_system.sorted_lookup_columns_number());
+                reps["$SORTED_COLUMNS_NUMBER$"] = to_string(nil::crypto3::zk::snark::lookup_batch_columns_number<PlaceholderParams>(_constraint_system));
                 reps["$LOOKUP_OPTIONS_NUMBER$"] = to_string(_constraint_system.lookup_options_num());
                 reps["$LOOKUP_CONSTRAINTS_NUMBER$"] = to_string(_constraint_system.lookup_constraints_num());
                 reps["$Z_OFFSET$"] = "0x" + to_hex_string(_z_offset);
@@ -888,7 +935,7 @@ namespace nil {
                     _placeholder_info,
                     _desc,
                     reps, _common_data, _fri_params, _permutation_size, _placeholder_info.quotient_size,
-                    _use_lookups?_constraint_system.sorted_lookup_columns_number():0, _use_lookups);
+                    _use_lookups?nil::crypto3::zk::snark::lookup_batch_columns_number<PlaceholderParams>(_constraint_system):0, _use_lookups);
 
                 replace_and_print(modular_verifier_template, reps, _folder_name + "/modular_verifier.sol");
                 if( _placeholder_info.permutation_poly_amount == 1 ){
@@ -899,7 +946,9 @@ namespace nil {
                 replace_and_print(modular_gate_argument_library_template, reps, _folder_name + "/gate_argument.sol");
                 replace_and_print(modular_commitment_library_template, reps, _folder_name + "/commitment.sol");
                 if(_use_lookups){
-                    if( _placeholder_info.lookup_poly_amount == 1)
+                    if( _use_logup )
+                        replace_and_print(modular_logup_argument_library_template, reps, _folder_name + "/lookup_argument.sol");
+                    else if( _placeholder_info.lookup_poly_amount == 1)
                         replace_and_print(modular_lookup_argument_library_template, reps, _folder_name + "/lookup_argument.sol");
                     else{
                         replace_and_print(modular_lookup_argument_chunked_library_template, reps, _folder_name + "/lookup_argument.sol");
@@ -917,6 +966,8 @@ namespace nil {
             std::string _folder_name;
             std::string _test_name;
             bool        _use_lookups;
+            static constexpr bool _use_logup =
+                PlaceholderParams::lookup_argument == nil::crypto3::zk::snark::lookup_argument_type::LOGUP;
             bool        _use_permutations;
             std::size_t _z_offset;
             std::size_t _special_selectors_offset;
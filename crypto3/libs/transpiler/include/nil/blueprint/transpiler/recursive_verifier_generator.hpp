@@ -58,6 +58,8 @@ namespace nil {
             using common_data_type = CommonDataType;
             using verification_key_type = typename common_data_type::verification_key_type;
             using commitment_scheme_type = typename PlaceholderParams::commitment_scheme_type;
+            static_assert(PlaceholderParams::lookup_argument != nil::crypto3::zk::snark::lookup_argument_type::LOGUP,
+                          "Recursive verifier is generated for the Plookup argument only");
             using constraint_system_type = typename PlaceholderParams::constraint_system_type;
             using columns_rotations_type = std::vector<std::set<int>>;
             using variable_type = typename constraint_system_type::variable_type;
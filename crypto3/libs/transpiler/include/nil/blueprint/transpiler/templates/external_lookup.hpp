@@ -24,6 +24,25 @@ $LOOKUP_ASSEMBLY_CODE$
 
         return( g, theta_acc );
     }
+)";
+        std::string logup_evaluation_template = R"(
+    function evaluate_lookup_$LOOKUP_ID$_be(
+        bytes calldata blob,
+        uint256 theta,
+        uint256 theta_acc,
+        uint256 gamma,
+        uint256 g,
+        uint256 h
+    ) external pure returns (uint256, uint256, uint256) {
+        uint256 l;
+        uint256 selector_value;
+        uint256 sum;
+        uint256 prod;
+
+$LOOKUP_ASSEMBLY_CODE$
+
+        return( g, h, theta_acc );
+    }
 )";
         std::string modular_external_lookup_library_template = R"(
 // SPDX-License-Identifier: Apache-2.0.
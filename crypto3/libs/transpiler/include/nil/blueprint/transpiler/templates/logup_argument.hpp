@@ -0,0 +1,106 @@
+#ifndef __MODULAR_LOGUP_ARGUMENT_CONTRACT_TEMPLATE_HPP__
+#define __MODULAR_LOGUP_ARGUMENT_CONTRACT_TEMPLATE_HPP__
+
+#include <string>
+
+namespace nil {
+    namespace blueprint {
+        // LogUp keeps the sum of the terms as a fraction: state.g is the numerator, state.h is the denominator.
+        std::string logup_call_template =
+            "\t\t\t(state.g, state.h, state.theta_acc) = lookup_$TEST_NAME$_$LOOKUP_LIB_ID$.evaluate_lookup_$LOOKUP_ID$_be( blob, state.theta, state.theta_acc, state.gamma, state.g, state.h );\n" ;
+
+        std::string modular_logup_argument_library_template = R"(
+// SPDX-License-Identifier: Apache-2.0.
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Generated by ZKLLVM-transpiler
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//---------------------------------------------------------------------------//
+pragma solidity >=0.8.4;
+
+import "../../cryptography/transcript.sol";
+// Move away unused structures from types.sol
+import "../../types.sol";
+import "../../basic_marshalling.sol";
+import "../../cryptography/transcript.sol";
+import "../../interfaces/modular_lookup_argument.sol";
+$LOOKUP_INCLUDES$
+import "hardhat/console.sol";
+
+contract modular_lookup_argument_$TEST_NAME$ is ILookupArgument{
+    uint256 constant modulus = $MODULUS$;
+    uint8 constant multiplicity_columns = $SORTED_COLUMNS_NUMBER$;
+    uint8 constant lookup_options_num = $LOOKUP_OPTIONS_NUMBER$;
+    uint8 constant lookup_constraints_num = $LOOKUP_CONSTRAINTS_NUMBER$;
+
+    struct lookup_state{
+        uint256 theta;
+        uint256 gamma;
+        uint256 S_value;
+        uint256 S_shifted_value;
+        uint256 q_last;
+        uint256 q_blind;
+        uint256 mask;
+        uint256 selector_value;
+        uint256 theta_acc;
+        uint256 g;
+        uint256 h;
+    }
+
+    function verify(
+        bytes calldata zvalues, // Table values and permutations' values
+        bytes calldata sorted, // Multiplicities batch values
+        uint256 lookup_commitment,
+        uint256 l0,
+        bytes32 tr_state_before // It's better than transfer all random values
+    ) external view returns (uint256[4] memory F, bytes32 tr_state_after){
+        bytes calldata blob = zvalues[0x80:];
+        lookup_state memory state;
+        state.S_value = basic_marshalling.get_uint256_be(zvalues, 0x80 + $V_L_OFFSET$);
+        state.S_shifted_value = basic_marshalling.get_uint256_be(zvalues, 0x80 + $V_L_OFFSET$ + 0x20);
+        state.q_last = basic_marshalling.get_uint256_be(zvalues, 0x0);
+        state.q_blind = basic_marshalling.get_uint256_be(zvalues, 0x40);
+        state.mask = addmod(1, modulus - addmod(state.q_last , state.q_blind, modulus), modulus);
+
+        types.transcript_data memory tr_state;
+        tr_state.current_challenge = tr_state_before;
+        {
+            state.theta = transcript.get_field_challenge(tr_state, modulus); //theta
+            uint256 l;
+            state.g = 0;
+            state.h = 1;
+
+            transcript.update_transcript_b32(tr_state, bytes32(lookup_commitment));
+            state.gamma = transcript.get_field_challenge(tr_state, modulus); //gamma
+$LOOKUP_ARGUMENT_COMPUTATION$
+        }
+
+        F[0] = mulmod(l0, state.S_value, modulus);
+        F[1] = mulmod(state.q_last, state.S_value, modulus);
+        F[2] = mulmod(
+            state.mask,
+            addmod(
+                mulmod(addmod(state.S_shifted_value, modulus - state.S_value, modulus), state.h, modulus),
+                modulus - state.g,
+                modulus
+            ),
+            modulus
+        );
+        tr_state_after = tr_state.current_challenge;
+    }
+}
+)";
+    }
+}
+
+#endif //__MODULAR_LOGUP_ARGUMENT_CONTRACT_TEMPLATE_HPP__
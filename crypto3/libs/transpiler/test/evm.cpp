@@ -1147,6 +1147,8 @@ BOOST_AUTO_TEST_SUITE(placeholder_circuit7)
     using lpc_type = commitments::list_polynomial_commitment<field_type, lpc_params_type>;
     using lpc_scheme_type = typename commitments::lpc_commitment_scheme<lpc_type>;
     using lpc_placeholder_params_type = nil::crypto3::zk::snark::placeholder_params<circuit_params, lpc_scheme_type>;
+    using logup_placeholder_params_type = nil::crypto3::zk::snark::placeholder_params<
+        circuit_params, lpc_scheme_type, nil::crypto3::zk::snark::lookup_argument_type::LOGUP>;
     using policy_type = zk::snark::detail::placeholder_policy<field_type, circuit_params>;
 
 BOOST_FIXTURE_TEST_CASE(transpiler_test, test_tools::random_test_initializer<field_type>) {
@@ -1233,6 +1235,131 @@ BOOST_FIXTURE_TEST_CASE(transpiler_test, test_tools::random_test_initializer<fie
     }
 }
 
+BOOST_FIXTURE_TEST_CASE(transpiler_logup_test, test_tools::random_test_initializer<field_type>) {
+    auto circuit = circuit_test_7<field_type>(this->alg_random_engines.template get_alg_engine<field_type>(), this->generic_random_engine);
+
+    plonk_table_description<field_type> desc(
+        placeholder_test_params::witness_columns,
+        placeholder_test_params::public_input_columns,
+        placeholder_test_params::constant_columns,
+        placeholder_test_params::selector_columns
+    );
+
+    desc.rows_amount = circuit.table_rows;
+    desc.usable_rows_amount = circuit.usable_rows;
+    std::size_t table_rows_log = std::ceil(std::log2(circuit.table_rows));
+
+    typename policy_type::constraint_system_type constraint_system(
+        circuit.gates,
+        circuit.copy_constraints,
+        circuit.lookup_gates,
+        circuit.lookup_tables
+    );
+    typename policy_type::variable_assignment_type assignments = circuit.table;
+
+    typename lpc_type::fri_type::params_type fri_params(
+        1, table_rows_log, placeholder_test_params::lambda, 4
+    );
+    lpc_scheme_type lpc_scheme(fri_params);
+
+    transcript_type transcript;
+
+    typename placeholder_public_preprocessor<field_type, logup_placeholder_params_type>::preprocessed_data_type
+        lpc_preprocessed_public_data = placeholder_public_preprocessor<field_type, logup_placeholder_params_type>::process(
+            constraint_system, assignments.public_table(), desc, lpc_scheme
+        );
+
+    std::string output = "circuit7_logup_lpc";
+
+    auto printer = nil::blueprint::lpc_evm_verifier_printer<logup_placeholder_params_type>(
+        constraint_system,
+        lpc_preprocessed_public_data.common_data,
+        output
+    );
+    printer.print();
+
+    if (should_save_proof_data()) {
+        typename placeholder_private_preprocessor<field_type, logup_placeholder_params_type>::preprocessed_data_type
+            lpc_preprocessed_private_data =
+                placeholder_private_preprocessor<field_type, logup_placeholder_params_type>::process(
+                    constraint_system,
+                    assignments.private_table(),
+                    desc
+                );
+
+        auto lpc_proof = placeholder_prover<field_type, logup_placeholder_params_type>::process(
+            lpc_preprocessed_public_data,
+            lpc_preprocessed_private_data,
+            desc,
+            constraint_system,
+            lpc_scheme
+        );
+
+        print_placeholder_proof_with_params<Endianness, logup_placeholder_params_type>(
+            lpc_preprocessed_public_data,
+            lpc_proof,
+            lpc_scheme,
+            desc,
+            output
+        );
+        print_public_input(
+            desc.public_input_columns == 0 ? std::vector<typename field_type::value_type>({})
+                                           : assignments.public_input(0),
+            output + "/" + public_input_filename
+        );
+
+        auto verifier_res = placeholder_verifier<field_type, logup_placeholder_params_type>::process(
+            lpc_preprocessed_public_data.common_data,
+            lpc_proof,
+            desc,
+            constraint_system,
+            lpc_scheme
+        );
+        BOOST_CHECK(verifier_res);
+    }
+}
+
+BOOST_FIXTURE_TEST_CASE(transpiler_logup_chunked_test, test_tools::random_test_initializer<field_type>) {
+    auto circuit = circuit_test_7<field_type>(this->alg_random_engines.template get_alg_engine<field_type>(), this->generic_random_engine);
+
+    plonk_table_description<field_type> desc(
+        placeholder_test_params::witness_columns,
+        placeholder_test_params::public_input_columns,
+        placeholder_test_params::constant_columns,
+        placeholder_test_params::selector_columns
+    );
+
+    desc.rows_amount = circuit.table_rows;
+    desc.usable_rows_amount = circuit.usable_rows;
+    std::size_t table_rows_log = std::ceil(std::log2(circuit.table_rows));
+
+    typename policy_type::constraint_system_type constraint_system(
+        circuit.gates,
+        circuit.copy_constraints,
+        circuit.lookup_gates,
+        circuit.lookup_tables
+    );
+    typename policy_type::variable_assignment_type assignments = circuit.table;
+
+    typename lpc_type::fri_type::params_type fri_params(
+        1, table_rows_log, placeholder_test_params::lambda, 4
+    );
+    lpc_scheme_type lpc_scheme(fri_params);
+
+    typename placeholder_public_preprocessor<field_type, logup_placeholder_params_type>::preprocessed_data_type
+        lpc_preprocessed_public_data = placeholder_public_preprocessor<field_type, logup_placeholder_params_type>::process(
+            constraint_system, assignments.public_table(), desc, lpc_scheme, 10
+        );
+
+    // Chunked LogUp helper columns have no EVM check, so no contract must be generated for them.
+    auto printer = nil::blueprint::lpc_evm_verifier_printer<logup_placeholder_params_type>(
+        constraint_system,
+        lpc_preprocessed_public_data.common_data,
+        "circuit7_logup_chunk10"
+    );
+    BOOST_CHECK_THROW(printer.print(), std::invalid_argument);
+}
+
 // TODO implement for EVM
 /*
 BOOST_FIXTURE_TEST_CASE(transpiler_test10, test_initializer) {
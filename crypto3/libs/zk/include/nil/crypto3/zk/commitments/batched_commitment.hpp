@@ -207,16 +207,21 @@ namespace nil {
 
                     void eval_polys() {
                         for(auto const &[k, poly] : _polys) {
-                            _z.set_batch_size(k, poly.size());
-                            auto const &point = _points.at(k);
+                            eval_batch(k, poly);
+                        }
+                    }
 
-                            BOOST_ASSERT(poly.size() == point.size() || point.size() == 1);
+                    // Evaluates the polynomials of batch 'k' at its points, they may be stored outside of _polys.
+                    void eval_batch(std::size_t k, const std::vector<polynomial_type>& poly) {
+                        _z.set_batch_size(k, poly.size());
+                        auto const &point = _points.at(k);
 
-                            for (std::size_t i = 0; i < poly.size(); ++i) {
-                                _z.set_poly_points_number(k, i, point[i].size());
-                                for (std::size_t j = 0; j < point[i].size(); j++) {
-                                    _z.set(k, i, j, poly[i].evaluate(point[i][j]));
-                                }
+                        BOOST_ASSERT(poly.size() == point.size() || point.size() == 1);
+
+                        for (std::size_t i = 0; i < poly.size(); ++i) {
+                            _z.set_poly_points_number(k, i, point[i].size());
+                            for (std::size_t j = 0; j < point[i].size(); j++) {
+                                _z.set(k, i, j, poly[i].evaluate(point[i][j]));
                             }
                         }
                     }
@@ -53,6 +53,7 @@
 #include <nil/crypto3/zk/commitments/type_traits.hpp>
 #include <nil/crypto3/zk/commitments/detail/polynomial/fold_polynomial.hpp>
 #include <nil/crypto3/zk/commitments/detail/polynomial/proof_of_work.hpp>
+#include <nil/crypto3/zk/detail/batch_source.hpp>
 #include <nil/crypto3/zk/detail/field_element_consumer.hpp>
 
 #include <nil/crypto3/bench/scoped_profiler.hpp>
@@ -105,6 +106,7 @@ namespace nil {
 
                         using merkle_tree_type = containers::merkle_tree<MerkleTreeHashType, 2>;
                         using merkle_proof_type =  typename containers::merkle_proof<MerkleTreeHashType, 2>;
+                        using merkle_verified_nodes_type = containers::merkle_verified_nodes<MerkleTreeHashType, 2>;
                         using precommitment_type = merkle_tree_type;
                         using commitment_type = typename precommitment_type::value_type;
                         using transcript_type = transcript::fiat_shamir_heuristic_sequential<TranscriptHashType>;
@@ -583,6 +585,21 @@ namespace nil {
                     return typename FRI::merkle_proof_type(tree, min_x_index);
                 }
 
+                // Index of the point of the first FRI domain which is queried by the given challenge.
+                template<typename FRI>
+                static std::uint64_t get_query_index(
+                        const typename FRI::params_type &fri_params,
+                        const typename FRI::field_type::value_type &challenge) {
+                    const std::size_t domain_size = fri_params.D[0]->size();
+                    const typename FRI::field_type::value_type x =
+                        challenge.pow((FRI::field_type::modulus - 1) / domain_size);
+                    std::uint64_t x_index = 0;
+                    while (x_index < domain_size && fri_params.D[0]->get_domain_element(x_index) != x) {
+                        ++x_index;
+                    }
+                    return x_index;
+                }
+
                 template<typename FRI>
                 static inline std::size_t get_folded_index(std::size_t x_index, std::size_t domain_size,
                                                            const std::size_t fri_step) {
@@ -772,19 +789,14 @@ namespace nil {
                     return std::make_tuple(fs, fri_trees, commitments_proof);
                 }
 
-                /** @brief Convert a set of polynomials from DFS form into coefficients form */
+                /** @brief Convert a batch of polynomials from DFS form into coefficients form */
                 template<typename FRI, typename PolynomialType>
-                static std::map<
-                    std::size_t,
-                    std::vector<math::polynomial<typename FRI::field_type::value_type>>
-                >  convert_polynomials_to_coefficients(
+                static std::vector<math::polynomial<typename FRI::field_type::value_type>>
+                convert_batch_to_coefficients(
                     const typename FRI::params_type &fri_params,
-                    const std::map<std::size_t, std::vector<PolynomialType>> &g)
+                    const std::vector<PolynomialType> &g_k)
                 {
-                    std::map<
-                        std::size_t,
-                        std::vector<math::polynomial<typename FRI::field_type::value_type>>
-                    > g_coeffs;
+                    std::vector<math::polynomial<typename FRI::field_type::value_type>> g_k_coeffs;
 
                     if constexpr (std::is_same<
                         math::polynomial_dfs<typename FRI::field_type::value_type>,
@@ -792,91 +804,63 @@ namespace nil {
                     ) {
                         std::unordered_map<std::size_t,
                                            std::shared_ptr<math::evaluation_domain<typename FRI::field_type>>> d_cache;
-                        for (const auto &[key, poly_vector]: g) {
-                            for (const auto& poly: poly_vector) {
-                                if (poly.size() != fri_params.D[0]->size()) {
-                                    if (d_cache.find(poly.size()) == d_cache.end()) {
-                                        d_cache[poly.size()] =
-                                            math::make_evaluation_domain<typename FRI::field_type>(poly.size());
-                                    }
-                                    g_coeffs[key].emplace_back(poly.coefficients(d_cache[poly.size()]));
-                                } else {
-                                    // These polynomials won't be used
-                                    g_coeffs[key].emplace_back(math::polynomial<typename FRI::field_type::value_type>());
+                        for (const auto& poly: g_k) {
+                            if (poly.size() != fri_params.D[0]->size()) {
+                                if (d_cache.find(poly.size()) == d_cache.end()) {
+                                    d_cache[poly.size()] =
+                                        math::make_evaluation_domain<typename FRI::field_type>(poly.size());
                                 }
+                                g_k_coeffs.emplace_back(poly.coefficients(d_cache[poly.size()]));
+                            } else {
+                                // These polynomials won't be used
+                                g_k_coeffs.emplace_back(math::polynomial<typename FRI::field_type::value_type>());
                             }
                         }
                     }
 
-                    return std::move(g_coeffs);
+                    return g_k_coeffs;
                 }
 
 
                 template<typename FRI, typename PolynomialType>
-                static std::map<std::size_t, typename FRI::initial_proof_type>
-                build_initial_proof(
-                    const std::map<std::size_t, typename FRI::precommitment_type> &precommitments,
+                static typename FRI::initial_proof_type
+                build_batch_initial_proof(
+                    const typename FRI::precommitment_type &precommitment,
                     const typename FRI::params_type &fri_params,
-                    const std::map<std::size_t, std::vector<PolynomialType>> &g,
-                    const std::map<
-                        std::size_t,
-                        std::vector<math::polynomial<typename FRI::field_type::value_type>>
-                    > &g_coeffs,
+                    const std::vector<PolynomialType> &g_k,
+                    const std::vector<math::polynomial<typename FRI::field_type::value_type>> &g_k_coeffs,
                     std::uint64_t x_index)
                 {
                     std::vector<std::array<typename FRI::field_type::value_type, FRI::m>> s;
                     std::vector<std::array<std::size_t, FRI::m>> s_indices;
                     std::tie(s, s_indices) = calculate_s<FRI>(x_index, fri_params.step_list[0], fri_params.D[0]);
 
-                    std::map<std::size_t, typename FRI::initial_proof_type> initial_proof;
-
-                    for (const auto &it: g) {
-                        auto k = it.first;
-                        initial_proof[k] = {};
-                        initial_proof[k].values.resize(it.second.size());
-                        std::size_t coset_size = 1 << fri_params.step_list[0];
-                        BOOST_ASSERT(coset_size / FRI::m == s.size());
-                        BOOST_ASSERT(coset_size / FRI::m == s_indices.size());
-
-                        // Fill values
-                        const auto& g_k = it.second; // g[k]
-
-                        for (std::size_t polynomial_index = 0; polynomial_index < g_k.size(); ++polynomial_index) {
-                            initial_proof[k].values[polynomial_index].resize(coset_size / FRI::m);
-                            if constexpr (std::is_same<
-                                    math::polynomial_dfs<typename FRI::field_type::value_type>,
-                                    PolynomialType>::value
-                        ) {
-                                if (g_k[polynomial_index].size() == fri_params.D[0]->size()) {
-                                    for (std::size_t j = 0; j < coset_size / FRI::m; j++) {
-                                        std::size_t ind0 = std::min(s_indices[j][0], s_indices[j][1]);
-                                        std::size_t ind1 = std::max(s_indices[j][0], s_indices[j][1]);
-                                        initial_proof[k].values[polynomial_index][j][0] = g_k[polynomial_index][ind0];
-                                        initial_proof[k].values[polynomial_index][j][1] = g_k[polynomial_index][ind1];
-                                    }
-                                } else {
-                                    // Convert to coefficients form and evaluate. coset_size / FRI::m is usually just 1,
-                                    // It makes no sense to resize in dfs form to then use just 2 values in 2 points.
-                                    for (std::size_t j = 0; j < coset_size / FRI::m; j++) {
-                                        typename FRI::field_type::value_type s0;
-                                        typename FRI::field_type::value_type s1;
-                                        if( s_indices[j][0] < s_indices[j][1]){
-                                            s0 = s[j][0];
-                                            s1 = s[j][1];
-                                        } else {
-                                            s0 = s[j][1];
-                                            s1 = s[j][0];
-                                        }
-                                        initial_proof[k].values[polynomial_index][j][0] = g_coeffs.at(k)[polynomial_index].evaluate(s0);
-                                        initial_proof[k].values[polynomial_index][j][1] = g_coeffs.at(k)[polynomial_index].evaluate(s1);
-                                    }
+                    typename FRI::initial_proof_type initial_proof;
+                    initial_proof.values.resize(g_k.size());
+                    std::size_t coset_size = 1 << fri_params.step_list[0];
+                    BOOST_ASSERT(coset_size / FRI::m == s.size());
+                    BOOST_ASSERT(coset_size / FRI::m == s_indices.size());
+
+                    // Fill values
+                    for (std::size_t polynomial_index = 0; polynomial_index < g_k.size(); ++polynomial_index) {
+                        initial_proof.values[polynomial_index].resize(coset_size / FRI::m);
+                        if constexpr (std::is_same<
+                                math::polynomial_dfs<typename FRI::field_type::value_type>,
+                                PolynomialType>::value
+                    ) {
+                            if (g_k[polynomial_index].size() == fri_params.D[0]->size()) {
+                                for (std::size_t j = 0; j < coset_size / FRI::m; j++) {
+                                    std::size_t ind0 = std::min(s_indices[j][0], s_indices[j][1]);
+                                    std::size_t ind1 = std::max(s_indices[j][0], s_indices[j][1]);
+                                    initial_proof.values[polynomial_index][j][0] = g_k[polynomial_index][ind0];
+                                    initial_proof.values[polynomial_index][j][1] = g_k[polynomial_index][ind1];
                                 }
                             } else {
-                                // Same for poly in coefficients form.
+                                // Convert to coefficients form and evaluate. coset_size / FRI::m is usually just 1,
+                                // It makes no sense to resize in dfs form to then use just 2 values in 2 points.
                                 for (std::size_t j = 0; j < coset_size / FRI::m; j++) {
                                     typename FRI::field_type::value_type s0;
                                     typename FRI::field_type::value_type s1;
-
                                     if( s_indices[j][0] < s_indices[j][1]){
                                         s0 = s[j][0];
                                         s1 = s[j][1];
@@ -884,19 +868,35 @@ namespace nil {
                                         s0 = s[j][1];
                                         s1 = s[j][0];
                                     }
-                                    initial_proof[k].values[polynomial_index][j][0] = g_k[polynomial_index].evaluate(s0);
-                                    initial_proof[k].values[polynomial_index][j][1] = g_k[polynomial_index].evaluate(s1);
+                                    initial_proof.values[polynomial_index][j][0] = g_k_coeffs[polynomial_index].evaluate(s0);
+                                    initial_proof.values[polynomial_index][j][1] = g_k_coeffs[polynomial_index].evaluate(s1);
                                 }
                             }
-                        }
+                        } else {
+                            // Same for poly in coefficients form.
+                            for (std::size_t j = 0; j < coset_size / FRI::m; j++) {
+                                typename FRI::field_type::value_type s0;
+                                typename FRI::field_type::value_type s1;
 
-                        // Fill merkle proofs
-                        initial_proof[k].p = make_proof_specialized<FRI>(
-                                get_folded_index<FRI>(x_index, fri_params.D[0]->size(), fri_params.step_list[0]),
-                                fri_params.D[0]->size(), precommitments.at(k) );
+                                if( s_indices[j][0] < s_indices[j][1]){
+                                    s0 = s[j][0];
+                                    s1 = s[j][1];
+                                } else {
+                                    s0 = s[j][1];
+                                    s1 = s[j][0];
+                                }
+                                initial_proof.values[polynomial_index][j][0] = g_k[polynomial_index].evaluate(s0);
+                                initial_proof.values[polynomial_index][j][1] = g_k[polynomial_index].evaluate(s1);
+                            }
+                        }
                     }
 
-                    return std::move(initial_proof);
+                    // Fill merkle proofs
+                    initial_proof.p = make_proof_specialized<FRI>(
+                            get_folded_index<FRI>(x_index, fri_params.D[0]->size(), fri_params.step_list[0]),
+                            fri_params.D[0]->size(), precommitment);
+
+                    return initial_proof;
                 }
 
                 template<typename FRI, typename PolynomialType>
@@ -983,15 +983,9 @@ namespace nil {
                     typename FRI::round_proofs_batch_type proof;
 
                     for (std::size_t query_id = 0; query_id < fri_params.lambda; query_id++) {
-                        std::size_t domain_size = fri_params.D[0]->size();
-                        typename FRI::field_type::value_type x = challenges[query_id];
-                        x = x.pow((FRI::field_type::modulus - 1) / domain_size);
+                        PROFILE_SCOPE_CALLS("Basic FRI query round proofs");
 
-                        std::uint64_t x_index = 0;
-
-                        while (fri_params.D[0]->get_domain_element(x_index) != x) {
-                            ++x_index;
-                        }
+                        std::uint64_t x_index = get_query_index<FRI>(fri_params, challenges[query_id]);
 
                         // Fill round proofs
                         std::vector<typename FRI::round_proof_type> round_proofs =
@@ -1003,50 +997,53 @@ namespace nil {
                     return proof;
                 }
 
-                template<typename FRI, typename PolynomialType>
+                template<typename FRI, typename PolynomialType,
+                         typename PrecommitmentsMap = std::map<std::size_t, typename FRI::precommitment_type>,
+                         typename PolysMap = std::map<std::size_t, std::vector<PolynomialType>>>
                 static typename FRI::initial_proofs_batch_type query_phase_initial_proofs(
-                    const std::map<std::size_t, typename FRI::precommitment_type> &precommitments,
+                    const PrecommitmentsMap &precommitments,
                     const typename FRI::params_type &fri_params,
-                    const std::map<std::size_t, std::vector<PolynomialType>> &g,
+                    const PolysMap &g,
                     const std::vector<typename FRI::field_type::value_type>& challenges)
                 {
                     typename FRI::initial_proofs_batch_type proof;
+                    proof.initial_proofs.resize(fri_params.lambda);
 
-                    // If we have DFS polynomials, and we are going to resize them, better convert them to coefficients form,
-                    // and compute their values in those 2 * FRI::lambda points each, which is normally 2 * 20.
-                    // In case lambda becomes much larger than log(2, average polynomial size), then this will not be optimal.
-                    // For lambda = 20 and 2^20 rows in assignment table, it's faster and uses less RAM.
-                    std::map<std::size_t, std::vector<math::polynomial<typename FRI::field_type::value_type>>> g_coeffs =
-                        convert_polynomials_to_coefficients<FRI, PolynomialType>(fri_params, g);
-
+                    std::vector<std::uint64_t> x_indices(fri_params.lambda);
                     for (std::size_t query_id = 0; query_id < fri_params.lambda; query_id++) {
-                        std::size_t domain_size = fri_params.D[0]->size();
-                        typename FRI::field_type::value_type x = challenges[query_id];
-                        x = x.pow((FRI::field_type::modulus - 1) / domain_size);
+                        x_indices[query_id] = get_query_index<FRI>(fri_params, challenges[query_id]);
+                    }
 
-                        std::uint64_t x_index = 0;
+                    // Batch by batch, so that a batch which is read on demand is dropped before the next one is read.
+                    for (const auto &[k, batch]: g) {
+                        PROFILE_SCOPE_CALLS("Basic FRI query initial proofs");
 
-                        while (fri_params.D[0]->get_domain_element(x_index) != x) {
-                            ++x_index;
-                        }
+                        const auto g_k = zk::detail::load_batch(batch);
+                        const auto precommitment = zk::detail::load_batch(precommitments.at(k));
 
-                        std::map<std::size_t, typename FRI::initial_proof_type>
-                            initial_proof = build_initial_proof<FRI, PolynomialType>(
-                                    precommitments,
-                                    fri_params, g, g_coeffs, x_index);
+                        // If we have DFS polynomials, and we are going to resize them, better convert them to coefficients form,
+                        // and compute their values in those 2 * FRI::lambda points each, which is normally 2 * 20.
+                        // In case lambda becomes much larger than log(2, average polynomial size), then this will not be optimal.
+                        // For lambda = 20 and 2^20 rows in assignment table, it's faster and uses less RAM.
+                        const auto g_k_coeffs = convert_batch_to_coefficients<FRI, PolynomialType>(fri_params, *g_k);
 
-                        proof.initial_proofs.emplace_back(std::move(initial_proof));
+                        for (std::size_t query_id = 0; query_id < fri_params.lambda; query_id++) {
+                            proof.initial_proofs[query_id][k] = build_batch_initial_proof<FRI, PolynomialType>(
+                                *precommitment, fri_params, *g_k, g_k_coeffs, x_indices[query_id]);
+                        }
                     }
                     return proof;
                 }
 
-                template<typename FRI, typename PolynomialType>
+                template<typename FRI, typename PolynomialType,
+                         typename PrecommitmentsMap = std::map<std::size_t, typename FRI::precommitment_type>,
+                         typename PolysMap = std::map<std::size_t, std::vector<PolynomialType>>>
                 static std::vector<typename FRI::query_proof_type>
                 query_phase_with_challenges(
-                    const std::map<std::size_t, typename FRI::precommitment_type> &precommitments,
+                    const PrecommitmentsMap &precommitments,
                     const typename FRI::params_type &fri_params,
                     const std::vector<typename FRI::field_type::value_type>& challenges,
-                    const std::map<std::size_t, std::vector<PolynomialType>> &g,
+                    const PolysMap &g,
                     const std::vector<typename FRI::precommitment_type> &fri_trees,
                     const std::vector<PolynomialType> &fs,
                     const math::polynomial<typename FRI::field_type::value_type> &final_polynomial)
@@ -1069,13 +1066,15 @@ namespace nil {
                     return query_proofs;
                 }
 
-                template<typename FRI, typename PolynomialType>
+                template<typename FRI, typename PolynomialType,
+                         typename PrecommitmentsMap = std::map<std::size_t, typename FRI::precommitment_type>,
+                         typename PolysMap = std::map<std::size_t, std::vector<PolynomialType>>>
                 static std::vector<typename FRI::query_proof_type>
                 query_phase(
-                    const std::map<std::size_t, typename FRI::precommitment_type> &precommitments,
+                    const PrecommitmentsMap &precommitments,
                     const typename FRI::params_type &fri_params,
                     typename FRI::transcript_type &transcript,
-                    const std::map<std::size_t, std::vector<PolynomialType>> &g,
+                    const PolysMap &g,
                     const std::vector<typename FRI::precommitment_type> &fri_trees,
                     const std::vector<PolynomialType> &fs,
                     const math::polynomial<typename FRI::field_type::value_type> &final_polynomial)
@@ -1116,11 +1115,13 @@ namespace nil {
                                 typename FRI::transcript_hash_type,
                                 FRI::m, typename FRI::grinding_type>,
                             FRI>::value,
-                        bool>::type = true>
+                        bool>::type = true,
+                    typename PrecommitmentsMap = std::map<std::size_t, typename FRI::precommitment_type>,
+                    typename PolysMap = std::map<std::size_t, std::vector<PolynomialType>>>
                 static typename FRI::proof_type proof_eval(
-                    const std::map<std::size_t, std::vector<PolynomialType>> &g,
+                    const PolysMap &g,
                     const PolynomialType& combined_Q,
-                    const std::map<std::size_t, typename FRI::precommitment_type> &precommitments,
+                    const PrecommitmentsMap &precommitments,
                     const typename FRI::precommitment_type &combined_Q_precommitment,
                     const typename FRI::params_type &fri_params,
                     typename FRI::transcript_type &transcript
@@ -1169,7 +1170,8 @@ namespace nil {
                     const std::vector<std::vector<std::tuple<std::size_t, std::size_t>>>                &poly_ids,
                     const std::vector<typename FRI::field_type::value_type>                             &combined_U,
                     const std::vector<math::polynomial<typename FRI::field_type::value_type>>           &denominators,
-                    typename FRI::transcript_type &transcript
+                    typename FRI::transcript_type &transcript,
+                    typename FRI::merkle_verified_nodes_type                                            *verified_nodes = nullptr
                 ) {
                     BOOST_ASSERT(check_step_list<FRI>(fri_params));
                     BOOST_ASSERT(combined_U.size() == denominators.size());
@@ -1196,19 +1198,22 @@ namespace nil {
                             transcript, proof.proof_of_work, fri_params.grinding_parameter)){
                         return false;
                     }
+                    if (proof.query_proofs.size() != fri_params.lambda) {
+                        return false;
+                    }
+
+                    // All the query challenges are taken first, then the queries are checked independently.
+                    const std::vector<typename FRI::field_type::value_type> x_challenges =
+                        transcript.template challenges<typename FRI::field_type>(fri_params.lambda);
+
                     for (std::size_t query_id = 0; query_id < fri_params.lambda; query_id++) {
+                        PROFILE_SCOPE_CALLS("Basic FRI query verification");
                         const typename FRI::query_proof_type &query_proof = proof.query_proofs[query_id];
 
                         std::size_t domain_size = fri_params.D[0]->size();
                         std::size_t coset_size = 1 << fri_params.step_list[0];
-                        typename FRI::field_type::value_type x_challenge = transcript.template challenge<typename FRI::field_type>();
-                        typename FRI::field_type::value_type x = x_challenge.pow((FRI::field_type::modulus - 1)/domain_size);
-                        std::uint64_t x_index = 0;
-                        for( x_index = 0; x_index < domain_size; x_index++ ){
-                            if( fri_params.D[0]->get_domain_element(x_index) == x ){
-                                break;
-                            }
-                        }
+                        std::uint64_t x_index = get_query_index<FRI>(fri_params, x_challenges[query_id]);
+                        typename FRI::field_type::value_type x;
 
                         std::vector<std::array<typename FRI::field_type::value_type, FRI::m>> s;
                         std::vector<std::array<std::size_t, FRI::m>> s_indices;
@@ -1232,7 +1237,12 @@ namespace nil {
                                     leaf_data.consume(query_proof.initial_proof.at(k).values[i][idx][1]);
                                 }
                             }
-                            if (!query_proof.initial_proof.at(k).p.validate(leaf_data)) {
+                            // Initial proofs opening a commitment shared between proofs, e.g. the fixed values of a
+                            // circuit, may reuse the nodes which were already authenticated.
+                            bool valid = verified_nodes != nullptr ?
+                                query_proof.initial_proof.at(k).p.validate(leaf_data, *verified_nodes) :
+                                query_proof.initial_proof.at(k).p.validate(leaf_data);
+                            if (!valid) {
                                 BOOST_LOG_TRIVIAL(info) << "Wrong initial proof";
                                 return false;
                             }
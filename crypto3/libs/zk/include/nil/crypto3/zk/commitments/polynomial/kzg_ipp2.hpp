@@ -219,39 +219,21 @@ namespace nil {
                         BOOST_ASSERT(wkey.has_correct_len(std::distance(b_first, b_last)));
                         BOOST_ASSERT(std::distance(a_first, a_last) == std::distance(b_first, b_last));
 
-                        // (A * v)
-                        gt_value_type t1 = gt_value_type::one();
-                        std::for_each(boost::make_zip_iterator(boost::make_tuple(a_first, vkey.a.begin())),
-                                      boost::make_zip_iterator(boost::make_tuple(a_last, vkey.a.end())),
-                                      [&](const boost::tuple<const g1_value_type &, const g2_value_type &> &t) {
-                                          t1 = t1 * algebra::pair<curve_type>(t.template get<0>(), t.template get<1>());
-                                      });
-
-                        // (B * v)
-                        gt_value_type t2 = gt_value_type::one();
-                        std::for_each(boost::make_zip_iterator(boost::make_tuple(wkey.a.begin(), b_first)),
-                                      boost::make_zip_iterator(boost::make_tuple(wkey.a.end(), b_last)),
-                                      [&](const boost::tuple<const g1_value_type &, const g2_value_type &> &t) {
-                                          t2 = t2 * algebra::pair<curve_type>(t.template get<0>(), t.template get<1>());
-                                      });
-
-                        gt_value_type u1 = gt_value_type::one();
-                        std::for_each(boost::make_zip_iterator(boost::make_tuple(a_first, vkey.b.begin())),
-                                      boost::make_zip_iterator(boost::make_tuple(a_last, vkey.b.end())),
-                                      [&](const boost::tuple<const g1_value_type &, const g2_value_type &> &t) {
-                                          u1 = u1 * algebra::pair<curve_type>(t.template get<0>(), t.template get<1>());
-                                      });
-
-                        gt_value_type u2 = gt_value_type::one();
-                        std::for_each(boost::make_zip_iterator(boost::make_tuple(wkey.b.begin(), b_first)),
-                                      boost::make_zip_iterator(boost::make_tuple(wkey.b.end(), b_last)),
-                                      [&](const boost::tuple<const g1_value_type &, const g2_value_type &> &t) {
-                                          u2 = u2 * algebra::pair<curve_type>(t.template get<0>(), t.template get<1>());
-                                      });
-
-                        // (A * v)(w * B)
-                        return std::make_pair(algebra::final_exponentiation<curve_type>(t1 * t2),
-                                              algebra::final_exponentiation<curve_type>(u1 * u2));
+                        // Each of T and U is a single multi-pairing: one interleaved Miller loop over all pairs of
+                        // (A * v)(w * B) and one final exponentiation.
+                        std::vector<g1_value_type> t_g1(a_first, a_last);
+                        t_g1.insert(t_g1.end(), wkey.a.begin(), wkey.a.end());
+                        std::vector<g2_value_type> t_g2(vkey.a.begin(), vkey.a.end());
+                        t_g2.insert(t_g2.end(), b_first, b_last);
+
+                        std::vector<g1_value_type> u_g1(a_first, a_last);
+                        u_g1.insert(u_g1.end(), wkey.b.begin(), wkey.b.end());
+                        std::vector<g2_value_type> u_g2(vkey.b.begin(), vkey.b.end());
+                        u_g2.insert(u_g2.end(), b_first, b_last);
+
+                        return std::make_pair(
+                            *algebra::final_exponentiation<curve_type>(algebra::multi_pair<curve_type>(t_g1, t_g2)),
+                            *algebra::final_exponentiation<curve_type>(algebra::multi_pair<curve_type>(u_g1, u_g2)));
                     }
 
                     /// Commits to a single vector of G1 elements in the following way:
@@ -264,22 +246,13 @@ namespace nil {
                     static output_type single(const vkey_type &vkey, InputG1Iterator a_first, InputG1Iterator a_last) {
                         BOOST_ASSERT(vkey.has_correct_len(std::distance(a_first, a_last)));
 
-                        gt_value_type t1 = gt_value_type::one();
-                        std::for_each(boost::make_zip_iterator(boost::make_tuple(a_first, vkey.a.begin())),
-                                      boost::make_zip_iterator(boost::make_tuple(a_last, vkey.a.end())),
-                                      [&](const boost::tuple<const g1_value_type &, const g2_value_type &> &t) {
-                                          t1 = t1 * algebra::pair<curve_type>(t.template get<0>(), t.template get<1>());
-                                      });
-
-                        gt_value_type u1 = gt_value_type::one();
-                        std::for_each(boost::make_zip_iterator(boost::make_tuple(a_first, vkey.b.begin())),
-                                      boost::make_zip_iterator(boost::make_tuple(a_last, vkey.b.end())),
-                                      [&](const boost::tuple<const g1_value_type &, const g2_value_type &> &t) {
-                                          u1 = u1 * algebra::pair<curve_type>(t.template get<0>(), t.template get<1>());
-                                      });
-
-                        return std::make_pair(algebra::final_exponentiation<curve_type>(t1),
-                                              algebra::final_exponentiation<curve_type>(u1));
+                        const std::vector<g1_value_type> a(a_first, a_last);
+
+                        return std::make_pair(
+                            *algebra::final_exponentiation<curve_type>(algebra::multi_pair<curve_type>(
+                                a, std::vector<g2_value_type>(vkey.a.begin(), vkey.a.end()))),
+                            *algebra::final_exponentiation<curve_type>(algebra::multi_pair<curve_type>(
+                                a, std::vector<g2_value_type>(vkey.b.begin(), vkey.b.end()))));
                     }
                 };
             }    // namespace commitments
@@ -30,6 +30,10 @@
 #ifndef CRYPTO3_ZK_LIST_POLYNOMIAL_COMMITMENT_SCHEME_HPP
 #define CRYPTO3_ZK_LIST_POLYNOMIAL_COMMITMENT_SCHEME_HPP
 
+#include <algorithm>
+#include <iterator>
+#include <memory>
+
 #include <nil/crypto3/math/polynomial/polynomial.hpp>
 #include <nil/crypto3/math/polynomial/lagrange_interpolation.hpp>
 
@@ -38,6 +42,8 @@
 
 #include <nil/crypto3/zk/commitments/batched_commitment.hpp>
 #include <nil/crypto3/zk/commitments/detail/polynomial/basic_fri.hpp>
+#include <nil/crypto3/zk/detail/batch_source.hpp>
+#include <nil/crypto3/zk/detail/spill_storage.hpp>
 
 
 namespace nil {
@@ -73,17 +79,100 @@ namespace nil {
                     using preprocessed_data_type = std::map<std::size_t, std::vector<value_type>>;
                     using polys_evaluator_type = polys_evaluator<typename LPCScheme::params_type,
                         typename LPCScheme::commitment_type, PolynomialType>;
+                    using spill_storage_type = zk::detail::spill_storage;
 
                 private:
+                    struct spilled_batch {
+                        // Regions of the polynomials with their degrees.
+                        std::vector<std::pair<typename spill_storage_type::region, std::size_t>> polys;
+                        typename spill_storage_type::region tree;
+                        std::size_t tree_leaves;
+                        // Kept in memory for the transcript.
+                        commitment_type root;
+                    };
+
                     std::map<std::size_t, precommitment_type> _trees;
                     typename fri_type::params_type _fri_params;
                     value_type _etha;
                     std::map<std::size_t, bool> _batch_fixed;
                     preprocessed_data_type _fixed_polys_values;
+                    // Not a part of the state, copies of the scheme share it to verify proofs of the same circuit.
+                    std::shared_ptr<typename fri_type::merkle_verified_nodes_type> _verified_nodes;
+                    // Batches moved out of memory by spill_batch(), the storage is shared with copies of the scheme.
+                    std::map<std::size_t, spilled_batch> _spilled_batches;
+                    std::shared_ptr<spill_storage_type> _spill_storage;
+                    // Batches moved behind shared pointers by share_fixed_batches(), copies of the scheme read the
+                    // same polynomials and tree.
+                    struct shared_batch {
+                        std::vector<polynomial_type> polys;
+                        precommitment_type tree;
+                    };
+                    std::map<std::size_t, std::shared_ptr<const shared_batch>> _shared_batches;
+
+                    std::shared_ptr<const std::vector<polynomial_type>> load_spilled_polys(
+                            const spilled_batch& spilled) const {
+                        auto polys = std::make_shared<std::vector<polynomial_type>>();
+                        polys->reserve(spilled.polys.size());
+                        for (const auto& [region, degree]: spilled.polys) {
+                            polys->emplace_back(degree, region.count);
+                            _spill_storage->template restore<value_type>(region, polys->back().begin());
+                        }
+                        return polys;
+                    }
+
+                    std::shared_ptr<const precommitment_type> load_spilled_tree(const spilled_batch& spilled) const {
+                        // The tree is filled in place, moving it would copy its nodes.
+                        auto tree = std::make_shared<precommitment_type>(spilled.tree_leaves);
+                        tree->reserve(spilled.tree.count);
+                        _spill_storage->template restore<typename precommitment_type::value_type>(
+                            spilled.tree, std::back_inserter(*tree));
+                        return tree;
+                    }
 
                 public:
+                    /**
+                     * The trees and the polynomials of all the batches by index, including the shared ones. Spilled
+                     * batches are read back by zk::detail::load_batch() one at a time, the views must not outlive
+                     * the scheme.
+                     */
+                    std::map<std::size_t, zk::detail::batch_source<precommitment_type>> trees_view() const {
+                        std::map<std::size_t, zk::detail::batch_source<precommitment_type>> result;
+                        for (const auto& [index, tree]: _trees) {
+                            result[index].in_memory = &tree;
+                        }
+                        for (const auto& [index, batch]: _shared_batches) {
+                            result[index].in_memory = &batch->tree;
+                        }
+                        for (const auto& [index, spilled]: _spilled_batches) {
+                            result[index].load = [this, &spilled]() { return load_spilled_tree(spilled); };
+                        }
+                        return result;
+                    }
+
+                    std::map<std::size_t, zk::detail::batch_source<std::vector<polynomial_type>>> polys_view() const {
+                        std::map<std::size_t, zk::detail::batch_source<std::vector<polynomial_type>>> result;
+                        for (const auto& [index, polys]: this->_polys) {
+                            auto spilled = _spilled_batches.find(index);
+                            if (spilled != _spilled_batches.end() && !spilled->second.polys.empty()) {
+                                result[index].load = [this, &spilled = spilled->second]() {
+                                    return load_spilled_polys(spilled);
+                                };
+                            } else {
+                                result[index].in_memory = &polys;
+                            }
+                        }
+                        for (const auto& [index, batch]: _shared_batches) {
+                            result[index].in_memory = &batch->polys;
+                        }
+                        return result;
+                    }
+
                     // Getters for the upper fields. Used from marshalling only so far.
-                    const std::map<std::size_t, precommitment_type>& get_trees() const {return _trees;}
+                    const std::map<std::size_t, precommitment_type>& get_trees() const {
+                        BOOST_ASSERT_MSG(_spilled_batches.empty(), "Spilled batches must be restored first");
+                        BOOST_ASSERT_MSG(_shared_batches.empty(), "Shared batches are not a part of the state");
+                        return _trees;
+                    }
                     const typename fri_type::params_type& get_fri_params() const {return _fri_params;}
                     const value_type& get_etha() const {return _etha;}
                     const std::map<std::size_t, bool>& get_batch_fixed() const {return _batch_fixed;}
@@ -92,6 +181,12 @@ namespace nil {
                     // We must set it in verifier, taking this value from common data.
                     void set_fixed_polys_values(const preprocessed_data_type& value) {_fixed_polys_values = value;}
 
+                    // Lets verify_eval reuse the Merkle nodes authenticated while verifying other proofs which open the
+                    // same commitment, normally the fixed values batch.
+                    void set_verified_nodes(std::shared_ptr<typename fri_type::merkle_verified_nodes_type> verified_nodes) {
+                        _verified_nodes = std::move(verified_nodes);
+                    }
+
                     // This constructor is normally used from marshalling, to recover the LPC state from a file.
                     // Maybe we want the move variant of this constructor.
                     lpc_commitment_scheme(
@@ -123,7 +218,7 @@ namespace nil {
                             if (!fixed)
                                 continue;
                             result[index] = {};
-                            for (const auto& poly: this->_polys.at(index)){
+                            for (const auto& poly: *zk::detail::load_batch(polys_view().at(index))){
                                 result[index].push_back(poly.evaluate(etha));
                             }
                         }
@@ -148,11 +243,106 @@ namespace nil {
                         _batch_fixed[index] = true;
                     }
 
+                    // Bytes taken by the polynomials and the Merkle tree of a batch, none once it is spilled.
+                    std::size_t batch_memory_usage(std::size_t index) const {
+                        std::size_t result = 0;
+                        auto polys = this->_polys.find(index);
+                        if (polys != this->_polys.end()) {
+                            for (const auto& poly: polys->second) {
+                                result += poly.size() * sizeof(value_type);
+                            }
+                        }
+                        auto tree = _trees.find(index);
+                        if (tree != _trees.end()) {
+                            result += tree->second.size() * sizeof(typename precommitment_type::value_type);
+                        }
+                        return result;
+                    }
+
+                    /**
+                     * Moves the Merkle tree of a committed batch, and its polynomials if they are in DFS form, to
+                     * 'spill_storage' and returns the bytes released. The evaluation proof reads spilled batches
+                     * back one at a time, restore_spilled_batches() reads all of them back for good.
+                     */
+                    std::size_t spill_batch(std::size_t index, std::shared_ptr<spill_storage_type> spill_storage) {
+                        // Only committed batches have a tree.
+                        if (_spilled_batches.count(index) != 0 || _trees.count(index) == 0) {
+                            return 0;
+                        }
+                        const std::size_t released = batch_memory_usage(index);
+
+                        spilled_batch& spilled = _spilled_batches[index];
+                        if constexpr (std::is_same<math::polynomial_dfs<value_type>, PolynomialType>::value) {
+                            for (const auto& poly: this->_polys[index]) {
+                                spilled.polys.emplace_back(spill_storage->spill(poly), poly.degree());
+                            }
+                            std::vector<polynomial_type>().swap(this->_polys[index]);
+                        }
+                        const precommitment_type& tree = _trees.at(index);
+                        spilled.tree = spill_storage->spill(tree);
+                        spilled.tree_leaves = tree.leaves();
+                        spilled.root = tree.root();
+                        _trees.erase(index);
+
+                        _spill_storage = std::move(spill_storage);
+                        return released - batch_memory_usage(index);
+                    }
+
+                    /**
+                     * Moves the polynomials and the Merkle trees of the fixed batches behind shared pointers, so
+                     * copies of the scheme, e.g. one per proof of the same circuit, share them instead of copying.
+                     * They are read-only afterwards.
+                     */
+                    void share_fixed_batches() {
+                        restore_spilled_batches();
+                        for (const auto& [index, fixed]: _batch_fixed) {
+                            auto tree = _trees.find(index);
+                            if (!fixed || tree == _trees.end()) {
+                                continue;
+                            }
+                            // merkle_tree has no real move, the tree is copied once here.
+                            _shared_batches[index].reset(
+                                new shared_batch{std::move(this->_polys[index]), tree->second});
+                            this->_polys.erase(index);
+                            _trees.erase(tree);
+                        }
+                    }
+
+                    bool has_spilled_batches() const {
+                        return !_spilled_batches.empty();
+                    }
+
+                    void restore_spilled_batches() {
+                        for (const auto& [index, spilled]: _spilled_batches) {
+                            if constexpr (std::is_same<math::polynomial_dfs<value_type>, PolynomialType>::value) {
+                                auto& polys = this->_polys[index];
+                                polys.reserve(spilled.polys.size());
+                                for (const auto& [region, degree]: spilled.polys) {
+                                    polys.emplace_back(degree, region.count);
+                                    _spill_storage->template restore<value_type>(region, polys.back().begin());
+                                }
+                            }
+                            // The tree is filled in place, moving it would copy its nodes.
+                            precommitment_type& tree = _trees.try_emplace(index, spilled.tree_leaves).first->second;
+                            tree.reserve(spilled.tree.count);
+                            _spill_storage->template restore<typename precommitment_type::value_type>(
+                                spilled.tree, std::back_inserter(tree));
+                        }
+                        _spilled_batches.clear();
+                        _spill_storage.reset();
+                    }
+
                     proof_type proof_eval(transcript_type &transcript) {
                         PROFILE_SCOPE("LPC proof_eval");
 
                         eval_polys_and_add_roots_to_transcipt(transcript);
+                        return proof_eval_from_evaluations(transcript);
+                    }
 
+                    /** The part of proof_eval() after eval_polys_and_add_roots_to_transcipt(), so a prover
+                     * may stop in between, e.g. to save its state, and finish the same proof later.
+                     */
+                    proof_type proof_eval_from_evaluations(transcript_type &transcript) {
                         // Prepare z-s and combined_Q;
                         auto theta = transcript.template challenge<field_type>();
                         polynomial_type combined_Q = prepare_combined_Q(theta);
@@ -162,14 +352,20 @@ namespace nil {
                     }
 
                     void eval_polys_and_add_roots_to_transcipt(transcript_type &transcript) {
-                        this->eval_polys();
+                        for (const auto& [index, polys]: polys_view()) {
+                            this->eval_batch(index, *zk::detail::load_batch(polys));
+                        }
 
-                        BOOST_ASSERT(this->_points.size() == this->_polys.size());
+                        BOOST_ASSERT(this->_points.size() == this->_polys.size() + _shared_batches.size());
                         BOOST_ASSERT(this->_points.size() == this->_z.get_batches_num());
 
-                        // For each batch we have a merkle tree.
-                        for (auto const& it: this->_trees) {
-                            transcript(it.second.root());
+                        // For each batch we have a merkle tree, the roots of the spilled ones are kept in memory.
+                        for (auto const& it: trees_view()) {
+                            if (it.second.in_memory != nullptr) {
+                                transcript(it.second.in_memory->root());
+                            } else {
+                                transcript(_spilled_batches.at(it.first).root);
+                            }
                         }
                     }
 
@@ -183,10 +379,9 @@ namespace nil {
                     lpc_proof_type proof_eval_lpc_proof(
                             const polynomial_type& combined_Q,
                             const std::vector<typename fri_type::field_type::value_type>& challenges) {
-
                         typename fri_type::initial_proofs_batch_type initial_proofs =
                             nil::crypto3::zk::algorithms::query_phase_initial_proofs<fri_type, polynomial_type>(
-                            this->_trees, this->_fri_params, this->_polys, challenges);
+                            trees_view(), this->_fri_params, polys_view(), challenges);
                         return {this->_z, initial_proofs};
                     }
 
@@ -255,9 +450,9 @@ namespace nil {
 
                         typename fri_type::proof_type fri_proof = nil::crypto3::zk::algorithms::proof_eval<
                                 fri_type, polynomial_type>(
-                            this->_polys,
+                            polys_view(),
                             combined_Q,
-                            this->_trees,
+                            trees_view(),
                             combined_Q_precommitment,
                             this->_fri_params,
                             transcript
@@ -276,63 +471,84 @@ namespace nil {
                             const typename field_type::value_type& theta,
                             std::size_t starting_power = 0) {
                         this->build_points_map();
+                        const auto polys = polys_view();
 
                         typename field_type::value_type theta_acc = theta.pow(starting_power);
                         polynomial_type combined_Q;
-                        math::polynomial<value_type> V;
 
                         auto points = this->get_unique_points();
                         math::polynomial<value_type> combined_Q_normal;
 
-                        for (auto const &point: points) {
-                            V = {-point, 1u};
-                            math::polynomial<value_type> Q_normal;
+                        // The terms each polynomial adds to the quotients: the index of the point, the power of theta
+                        // and the value at the point. The powers of theta go over the points first and then over the
+                        // fixed batches at etha, which has the last index. The quotients are then summed up batch by
+                        // batch, so only one spilled batch is read back at a time.
+                        struct Q_term {
+                            std::size_t point_index;
+                            value_type theta_power;
+                            value_type value;
+                        };
+                        std::map<std::size_t, std::vector<std::vector<Q_term>>> terms;
+                        for (std::size_t i: this->_z.get_batches()) {
+                            terms[i].resize(this->_z.get_batch_size(i));
+                        }
+                        for (std::size_t point_index = 0; point_index < points.size(); ++point_index) {
                             for (std::size_t i: this->_z.get_batches()) {
                                 for (std::size_t j = 0; j < this->_z.get_batch_size(i); j++) {
-                                    auto iter = this->_points_map[i][j].find(point);
+                                    auto iter = this->_points_map[i][j].find(points[point_index]);
                                     if (iter == this->_points_map[i][j].end())
                                         continue;
 
-                                    math::polynomial<value_type> g_normal;
-                                    if constexpr(std::is_same<math::polynomial_dfs<value_type>, PolynomialType>::value ) {
-                                        g_normal = math::polynomial<value_type>(this->_polys[i][j].coefficients());
-                                    } else {
-                                        g_normal = this->_polys[i][j];
-                                    }
-                                    g_normal *= theta_acc;
-                                    Q_normal += g_normal;
-                                    Q_normal -= this->_z.get(i, j, iter->second) * theta_acc;
+                                    terms[i][j].push_back({point_index, theta_acc, this->_z.get(i, j, iter->second)});
                                     theta_acc *= theta;
                                 }
                             }
-                            Q_normal = Q_normal / V;
-                            combined_Q_normal += Q_normal;
                         }
-
-                        // TODO(martun): the following code is the same as above with point = _etha, de-duplicate it.
                         for (std::size_t i: this->_z.get_batches()) {
                             if (!_batch_fixed[i])
                                 continue;
 
-                            math::polynomial<value_type> Q_normal;
-                            auto point = _etha;
-                            V = {-point, 1u};
                             for (std::size_t j = 0; j < this->_z.get_batch_size(i); j++) {
+                                terms[i][j].push_back({points.size(), theta_acc, _fixed_polys_values[i][j]});
+                                theta_acc *= theta;
+                            }
+                        }
+
+                        // Q_normals[p] is the sum of the terms at point p before the division by (X - point).
+                        std::vector<math::polynomial<value_type>> Q_normals(points.size() + 1);
+                        std::vector<bool> used(points.size() + 1, false);
+                        for (const auto& [i, batch_terms]: terms) {
+                            if (std::all_of(batch_terms.begin(), batch_terms.end(),
+                                            [](const auto& poly_terms) { return poly_terms.empty(); })) {
+                                continue;
+                            }
+                            const auto batch = zk::detail::load_batch(polys.at(i));
+                            for (std::size_t j = 0; j < batch_terms.size(); j++) {
+                                if (batch_terms[j].empty())
+                                    continue;
+
                                 math::polynomial<value_type> g_normal;
-                                if constexpr(std::is_same<math::polynomial_dfs<value_type>, PolynomialType>::value) {
-                                    g_normal = math::polynomial<value_type>(this->_polys[i][j].coefficients());
+                                if constexpr(std::is_same<math::polynomial_dfs<value_type>, PolynomialType>::value ) {
+                                    g_normal = math::polynomial<value_type>((*batch)[j].coefficients());
                                 } else {
-                                    g_normal = this->_polys[i][j];
+                                    g_normal = (*batch)[j];
+                                }
+                                for (const auto& term: batch_terms[j]) {
+                                    math::polynomial<value_type> scaled = g_normal;
+                                    scaled *= term.theta_power;
+                                    Q_normals[term.point_index] += scaled;
+                                    Q_normals[term.point_index] -= term.value * term.theta_power;
+                                    used[term.point_index] = true;
                                 }
-
-                                g_normal *= theta_acc;
-                                Q_normal += g_normal;
-                                Q_normal -= _fixed_polys_values[i][j] * theta_acc;
-                                theta_acc *= theta;
                             }
+                        }
 
-                            Q_normal = Q_normal / V;
-                            combined_Q_normal += Q_normal;
+                        for (std::size_t point_index = 0; point_index <= points.size(); ++point_index) {
+                            if (!used[point_index])
+                                continue;
+                            auto const &point = point_index < points.size() ? points[point_index] : _etha;
+                            math::polynomial<value_type> V = {-point, 1u};
+                            combined_Q_normal += Q_normals[point_index] / V;
                         }
 
                         if constexpr (std::is_same<math::polynomial_dfs<value_type>, PolynomialType>::value) {
@@ -439,7 +655,8 @@ namespace nil {
                             poly_map,
                             U,
                             V,
-                            transcript
+                            transcript,
+                            _verified_nodes.get()
                         )) {
                             return false;
                         }
@@ -482,7 +699,8 @@ namespace nil {
                             _fri_params == other._fri_params &&
                             _etha == other._etha &&
                             _batch_fixed == other._batch_fixed &&
-                            _fixed_polys_values == other._fixed_polys_values;
+                            _fixed_polys_values == other._fixed_polys_values &&
+                            _shared_batches == other._shared_batches;
                     }
                 };
 
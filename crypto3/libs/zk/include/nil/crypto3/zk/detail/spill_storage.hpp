@@ -0,0 +1,206 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation <info@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ZK_DETAIL_SPILL_STORAGE_HPP
+#define CRYPTO3_ZK_DETAIL_SPILL_STORAGE_HPP
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace nil {
+    namespace crypto3 {
+        namespace zk {
+            namespace detail {
+
+                // Field elements are written as their underlying integers, other values as they are.
+                template<typename T, typename Enable = void>
+                struct spill_word {
+                    using type = T;
+                    static const type &to(const T &value) {
+                        return value;
+                    }
+                    static T from(const type &word) {
+                        return word;
+                    }
+                };
+
+                template<typename T>
+                struct spill_word<T, std::void_t<typename T::data_type, decltype(std::declval<T>().data)>> {
+                    using type = typename T::data_type;
+                    static const type &to(const T &value) {
+                        return value.data;
+                    }
+                    static T from(const type &word) {
+                        return T(word);
+                    }
+                };
+
+                /**
+                 * Scratch file the prover moves cold values to when they do not fit into its memory budget.
+                 *
+                 * The file is unlinked as soon as it is created, so it goes away with the process however that
+                 * ends. Spilled values are kept until the storage is destroyed: a region may be restored any
+                 * number of times, also by copies of the objects which spilled it. Restoring maps the region
+                 * instead of reading it, the pages are dropped again once the values are copied out.
+                 *
+                 * Values are written within the process which reads them back, the file is not a format.
+                 */
+                class spill_storage {
+                public:
+                    struct region {
+                        std::size_t offset = 0;
+                        std::size_t count = 0;
+                    };
+
+                    explicit spill_storage(const std::string &directory)
+                        : _page_size(static_cast<std::size_t>(::sysconf(_SC_PAGESIZE)))
+                        , _size(0)
+                        , _bytes_spilled(0) {
+                        std::string path = directory + "/placeholder-spill-XXXXXX";
+                        _fd = ::mkstemp(path.data());
+                        if (_fd < 0) {
+                            throw std::runtime_error("Can't create a spill file in " + directory + ": " +
+                                                     std::strerror(errno));
+                        }
+                        ::unlink(path.c_str());
+                    }
+
+                    spill_storage(const spill_storage &) = delete;
+                    spill_storage &operator=(const spill_storage &) = delete;
+
+                    ~spill_storage() {
+                        ::close(_fd);
+                    }
+
+                    /**
+                     * Writes the values of 'range' at the end of the file.
+                     */
+                    template<typename Range>
+                    region spill(const Range &range) {
+                        using value_type = std::decay_t<decltype(*std::begin(range))>;
+                        using word = spill_word<value_type>;
+                        static_assert(std::is_trivially_copyable<typename word::type>::value,
+                                      "Spilled values must be trivially copyable");
+
+                        const std::size_t count = std::distance(std::begin(range), std::end(range));
+                        const region result = allocate(count, count * sizeof(typename word::type));
+
+                        std::vector<typename word::type> buffer;
+                        buffer.reserve(std::min(count, buffer_words<typename word::type>()));
+                        std::size_t offset = result.offset;
+                        for (auto it = std::begin(range); it != std::end(range); ++it) {
+                            buffer.push_back(word::to(*it));
+                            if (buffer.size() == buffer.capacity()) {
+                                offset = write(offset, buffer);
+                                buffer.clear();
+                            }
+                        }
+                        write(offset, buffer);
+                        return result;
+                    }
+
+                    /**
+                     * Copies the values of 'spilled' to 'out', which takes 'spilled.count' values.
+                     */
+                    template<typename T, typename OutputIterator>
+                    void restore(const region &spilled, OutputIterator out) const {
+                        using word = spill_word<T>;
+                        const std::size_t bytes = spilled.count * sizeof(typename word::type);
+                        if (bytes == 0) {
+                            return;
+                        }
+                        void *mapped = ::mmap(nullptr, bytes, PROT_READ, MAP_PRIVATE, _fd, spilled.offset);
+                        if (mapped == MAP_FAILED) {
+                            throw std::runtime_error(std::string("Can't map the spill file: ") + std::strerror(errno));
+                        }
+                        ::madvise(mapped, bytes, MADV_SEQUENTIAL);
+                        const auto *words = static_cast<const typename word::type *>(mapped);
+                        for (std::size_t i = 0; i < spilled.count; ++i) {
+                            *out++ = word::from(words[i]);
+                        }
+                        ::munmap(mapped, bytes);
+                    }
+
+                    // Bytes written to the file so far.
+                    std::size_t bytes_spilled() const {
+                        return _bytes_spilled;
+                    }
+
+                private:
+                    // Regions start on a page, so each of them can be mapped on its own.
+                    region allocate(std::size_t count, std::size_t bytes) {
+                        region result {_size, count};
+                        _size += (bytes + _page_size - 1) / _page_size * _page_size;
+                        _bytes_spilled += bytes;
+                        return result;
+                    }
+
+                    template<typename Word>
+                    static constexpr std::size_t buffer_words() {
+                        return std::max<std::size_t>(1, (1 << 20) / sizeof(Word));
+                    }
+
+                    template<typename Word>
+                    std::size_t write(std::size_t offset, const std::vector<Word> &buffer) {
+                        const char *data = reinterpret_cast<const char *>(buffer.data());
+                        std::size_t left = buffer.size() * sizeof(Word);
+                        while (left != 0) {
+                            ssize_t written = ::pwrite(_fd, data, left, offset);
+                            if (written < 0) {
+                                if (errno == EINTR) {
+                                    continue;
+                                }
+                                throw std::runtime_error(std::string("Can't write to the spill file: ") +
+                                                         std::strerror(errno));
+                            }
+                            data += written;
+                            left -= written;
+                            offset += written;
+                        }
+                        return offset;
+                    }
+
+                    int _fd;
+                    std::size_t _page_size;
+                    std::size_t _size;
+                    std::size_t _bytes_spilled;
+                };
+            }    // namespace detail
+        }        // namespace zk
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ZK_DETAIL_SPILL_STORAGE_HPP
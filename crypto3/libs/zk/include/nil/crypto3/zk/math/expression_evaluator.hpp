@@ -33,6 +33,7 @@
 
 #include <nil/crypto3/math/algorithms/make_evaluation_domain.hpp>
 #include <nil/crypto3/math/polynomial/polynomial_dfs.hpp>
+#include <nil/crypto3/math/polynomial/polynomial_dfs_view.hpp>
 #include <nil/crypto3/math/domains/evaluation_domain.hpp>
 
 namespace nil {
@@ -44,6 +45,8 @@ namespace nil {
                 template<typename ValueType>
                 class multiplier {
                 public:
+                    static constexpr bool supports_rotated_views = false;
+
                     inline void multiply(ValueType &res, const ValueType &val) {
                         res *= val;
                     }
@@ -56,6 +59,9 @@ namespace nil {
                     using ValueType = typename nil::crypto3::math::polynomial_dfs<FieldValueType>;
                     using FieldType = typename FieldValueType::field_type;
                     using DomainType = typename nil::crypto3::math::evaluation_domain<FieldType>;
+                    using rotated_view_type = polynomial_dfs_rotated_view<ValueType>;
+
+                    static constexpr bool supports_rotated_views = true;
 
                     std::unordered_map<std::size_t, std::shared_ptr<DomainType>> domains;
 
@@ -78,6 +84,28 @@ namespace nil {
                             domains[val_domain_size],
                             domains[new_domain_size]);
                     }
+
+                    // Multiplies without copying the rotated column when it's already on the product domain.
+                    inline void multiply(ValueType &res, const rotated_view_type &val) {
+                        const std::size_t new_domain_size =
+                            detail::power_of_two(std::max(
+                                {res.size(),
+                                 val.size(),
+                                 res.degree() + val.degree() + 1}));
+                        if (val.size() != new_domain_size) {
+                            multiply(res, val.materialize());
+                            return;
+                        }
+                        if (res.size() != new_domain_size) {
+                            for (auto domain_size : {res.size(), new_domain_size}) {
+                                if (domains.find(domain_size) == domains.end()) {
+                                    domains[domain_size] = make_evaluation_domain<FieldType>(domain_size);
+                                }
+                            }
+                            res.resize(new_domain_size, domains[res.size()], domains[new_domain_size]);
+                        }
+                        res.pointwise_multiplication(val);
+                    }
                 };
             }
 
@@ -209,7 +237,25 @@ namespace nil {
                     const math::expression<VariableType>& expr,
                     std::function<const ValueType&(const VariableType&)> get_var_value)
                         : _expr(expr)
-                        , _get_var_value(get_var_value) {
+                        , _get_var_value(get_var_value)
+                        , _rotation_domain_size(0) {
+                }
+
+                /**
+                 * Rotation-aware evaluation of polynomial DFS expressions: variables with a non-zero rotation are
+                 * requested from 'get_var_value' with rotation 0 and read through a polynomial_dfs_rotated_view,
+                 * so the caller only keeps one copy of each column.
+                 *  @param rotation_domain_size - size of the domain the rotations are defined on.
+                 */
+                cached_expression_evaluator(
+                    const math::expression<VariableType>& expr,
+                    std::function<const ValueType&(const VariableType&)> get_var_value,
+                    std::size_t rotation_domain_size)
+                        : _expr(expr)
+                        , _get_var_value(get_var_value)
+                        , _rotation_domain_size(rotation_domain_size) {
+                    static_assert(MultiplicationType::supports_rotated_views,
+                                  "Rotated views are supported for polynomial DFS values only");
                 }
 
                 ValueType evaluate() {
@@ -237,6 +283,20 @@ namespace nil {
                     }
                     ValueType result = term.get_coeff();
                     for (const VariableType& var : term.get_vars()) {
+                        if constexpr (MultiplicationType::supports_rotated_views) {
+                            if (_rotation_domain_size != 0 && var.rotation != 0) {
+                                VariableType column_var = var;
+                                column_var.rotation = 0;
+                                typename MultiplicationType::rotated_view_type rotated(
+                                    _get_var_value(column_var), var.rotation, _rotation_domain_size);
+                                if (result.is_one()) {
+                                    result = rotated.materialize();
+                                } else {
+                                    multiplicator.multiply(result, rotated);
+                                }
+                                continue;
+                            }
+                        }
                         if (result.is_one()) {
                             result = _get_var_value(var);
                         } else {
@@ -306,6 +366,9 @@ namespace nil {
                 // A function used to retrieve the value of a variable.
                 std::function<const ValueType&(const VariableType &var)> _get_var_value;
 
+                // Zero if the getter resolves rotations itself.
+                std::size_t _rotation_domain_size;
+
                 // Shows how many times each subexpression appears. We count have the expression
                 // itself as a key, but apparently it's waay too slow. Just map the hash->count, assume
                 // it's a good estimate to what we want.
@@ -0,0 +1,340 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation <info@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ZK_PLONK_PLACEHOLDER_COLUMN_CACHE_HPP
+#define CRYPTO3_ZK_PLONK_PLACEHOLDER_COLUMN_CACHE_HPP
+
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <boost/assert.hpp>
+
+#include <nil/crypto3/math/polynomial/polynomial_dfs.hpp>
+#include <nil/crypto3/math/domains/evaluation_domain.hpp>
+#include <nil/crypto3/math/algorithms/make_evaluation_domain.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/plonk/assignment.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/plonk/constraint_system.hpp>
+#include <nil/crypto3/zk/detail/spill_storage.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace zk {
+            namespace snark {
+                namespace detail {
+
+                    /**
+                     * Values of the table columns on extended domains, shared by the arguments of one prover run.
+                     *
+                     * The coefficients of a column are computed once, on its first extension, and each extension
+                     * after that costs one FFT. An extension to a size which divides the size of an already cached
+                     * one is read from it with a stride, without any FFT.
+                     *
+                     * Extensions are kept until released, the gates argument releases the ones of each of its
+                     * domain sizes once they are evaluated. With a non-zero memory budget the least recently used
+                     * values are also evicted once the cache grows over it, and recomputed when needed again. Values are handed out as shared pointers, so an
+                     * eviction never invalidates values the caller still holds. With a spill storage evicted
+                     * extensions are written there once and read back instead of being recomputed.
+                     *
+                     * Columns of the original size are not copied, they point into the table, which must outlive
+                     * the cache.
+                     */
+                    template<typename FieldType>
+                    class placeholder_column_cache {
+                    public:
+                        using value_type = typename FieldType::value_type;
+                        using polynomial_dfs_type = math::polynomial_dfs<value_type>;
+                        using column_ptr = std::shared_ptr<const polynomial_dfs_type>;
+                        using domain_type = math::evaluation_domain<FieldType>;
+                        using spill_storage_type = zk::detail::spill_storage;
+
+                        placeholder_column_cache(
+                            const plonk_polynomial_dfs_table<FieldType> &columns,
+                            std::shared_ptr<domain_type> basic_domain,
+                            std::size_t memory_budget = 0
+                        )
+                            : _columns(columns)
+                            , _memory_budget(memory_budget)
+                            , _memory_usage(0)
+                            , _use_counter(0)
+                            , _fft_count(0) {
+                            _domains[basic_domain->m] = basic_domain;
+                        }
+
+                        /**
+                         * Sets the values of a column which is not in the table, e.g. of a special selector.
+                         */
+                        template<typename VariableType>
+                        void set_column(const VariableType &var, polynomial_dfs_type values) {
+                            column_entry &entry = _entries[make_key(var)];
+                            drop_extensions(entry);
+                            entry.values = std::make_shared<polynomial_dfs_type>(std::move(values));
+                        }
+
+                        /**
+                         * Sets the special selectors: all usable rows, and all usable rows except the first one.
+                         */
+                        void set_special_selectors(
+                            const polynomial_dfs_type &mask_polynomial,
+                            const polynomial_dfs_type &lagrange_0
+                        ) {
+                            using variable_type = plonk_variable<value_type>;
+                            set_column(
+                                variable_type(PLONK_SPECIAL_SELECTOR_ALL_USABLE_ROWS_SELECTED, 0, false,
+                                              variable_type::column_type::selector),
+                                mask_polynomial);
+                            set_column(
+                                variable_type(PLONK_SPECIAL_SELECTOR_ALL_NON_FIRST_USABLE_ROWS_SELECTED, 0, false,
+                                              variable_type::column_type::selector),
+                                mask_polynomial - lagrange_0);
+                        }
+
+                        /**
+                         * Values of the column of 'var' on the domain of the given size, the rotation of 'var'
+                         * is ignored.
+                         */
+                        template<typename VariableType>
+                        column_ptr get(const VariableType &var, std::size_t size) {
+                            const key_type key = make_key(var);
+                            column_entry &entry = _entries[key];
+                            const polynomial_dfs_type &column = column_values(key, entry);
+
+                            if (column.size() == size) {
+                                return entry.values ? entry.values : column_ptr(column_ptr(), &column);
+                            }
+
+                            auto it = entry.extensions.find(size);
+                            if (it != entry.extensions.end()) {
+                                it->second.last_use = ++_use_counter;
+                                return it->second.values;
+                            }
+
+                            column_ptr result = restore(entry, size);
+                            for (const auto &[cached_size, cached] : entry.extensions) {
+                                if (!result && cached_size > size && cached_size % size == 0) {
+                                    result = downsample(*cached.values, size);
+                                }
+                            }
+                            if (!result) {
+                                if (entry.coefficients.empty()) {
+                                    entry.coefficients = column.coefficients(get_domain(column.size()));
+                                    _memory_usage += bytes(entry.coefficients.size());
+                                }
+                                entry.coefficients_last_use = ++_use_counter;
+
+                                BOOST_ASSERT_MSG(size > column.degree(),
+                                                 "Extension size must be greater than the column degree");
+                                std::vector<value_type> values(entry.coefficients.begin(), entry.coefficients.end());
+                                values.resize(size, value_type::zero());
+                                get_domain(size)->fft(values);
+                                ++_fft_count;
+                                result = std::make_shared<polynomial_dfs_type>(column.degree(), std::move(values));
+                            }
+
+                            entry.extensions[size] = {result, ++_use_counter};
+                            _memory_usage += bytes(size);
+                            evict(key, size);
+                            return result;
+                        }
+
+                        /**
+                         * Drops all cached values, e.g. once the table is released.
+                         */
+                        void clear() {
+                            _entries.clear();
+                            _memory_usage = 0;
+                        }
+
+                        /**
+                         * Drops the extensions of all columns to the given size, kept in memory or spilled. The
+                         * coefficients stay, a later extension to that size costs one FFT.
+                         */
+                        void release(std::size_t size) {
+                            for (auto &[key, entry] : _entries) {
+                                if (entry.extensions.erase(size) != 0) {
+                                    _memory_usage -= bytes(size);
+                                }
+                                entry.spilled.erase(size);
+                            }
+                        }
+
+                        void set_memory_budget(std::size_t memory_budget) {
+                            _memory_budget = memory_budget;
+                        }
+
+                        std::size_t memory_budget() const {
+                            return _memory_budget;
+                        }
+
+                        void set_spill_storage(std::shared_ptr<spill_storage_type> spill_storage) {
+                            _spill_storage = std::move(spill_storage);
+                        }
+
+                        // Bytes taken by the cached coefficients and extensions.
+                        std::size_t memory_usage() const {
+                            return _memory_usage;
+                        }
+
+                        // Number of FFTs run to extend columns, for profiling and tests.
+                        std::size_t fft_count() const {
+                            return _fft_count;
+                        }
+
+                    private:
+                        using key_type = std::pair<std::uint8_t, std::size_t>;
+
+                        struct extension_entry {
+                            column_ptr values;
+                            std::size_t last_use;
+                        };
+
+                        struct spilled_extension {
+                            typename spill_storage_type::region region;
+                            std::size_t degree;
+                        };
+
+                        struct column_entry {
+                            // Set for columns which are not in the table.
+                            std::shared_ptr<polynomial_dfs_type> values;
+                            std::vector<value_type> coefficients;
+                            std::size_t coefficients_last_use = 0;
+                            std::map<std::size_t, extension_entry> extensions;
+                            std::map<std::size_t, spilled_extension> spilled;
+                        };
+
+                        template<typename VariableType>
+                        static key_type make_key(const VariableType &var) {
+                            return {static_cast<std::uint8_t>(var.type), var.index};
+                        }
+
+                        static std::size_t bytes(std::size_t size) {
+                            return size * sizeof(value_type);
+                        }
+
+                        const polynomial_dfs_type &column_values(const key_type &key, const column_entry &entry) const {
+                            if (entry.values) {
+                                return *entry.values;
+                            }
+                            using variable_type = plonk_variable<value_type>;
+                            return _columns.get_variable_value_without_rotation(variable_type(
+                                key.second, 0, false, static_cast<typename variable_type::column_type>(key.first)));
+                        }
+
+                        std::shared_ptr<domain_type> get_domain(std::size_t size) {
+                            auto &domain = _domains[size];
+                            if (!domain) {
+                                domain = math::make_evaluation_domain<FieldType>(size);
+                            }
+                            return domain;
+                        }
+
+                        static column_ptr downsample(const polynomial_dfs_type &values, std::size_t size) {
+                            const std::size_t step = values.size() / size;
+                            auto result = std::make_shared<polynomial_dfs_type>(values.degree(), size);
+                            for (std::size_t i = 0; i < size; ++i) {
+                                (*result)[i] = values[i * step];
+                            }
+                            return result;
+                        }
+
+                        column_ptr restore(const column_entry &entry, std::size_t size) const {
+                            auto it = entry.spilled.find(size);
+                            if (it == entry.spilled.end()) {
+                                return nullptr;
+                            }
+                            auto result = std::make_shared<polynomial_dfs_type>(it->second.degree, size);
+                            _spill_storage->template restore<value_type>(it->second.region, result->begin());
+                            return result;
+                        }
+
+                        void drop_extensions(column_entry &entry) {
+                            for (const auto &[size, extension] : entry.extensions) {
+                                _memory_usage -= bytes(size);
+                            }
+                            entry.extensions.clear();
+                            entry.spilled.clear();
+                            _memory_usage -= bytes(entry.coefficients.size());
+                            entry.coefficients.clear();
+                            entry.coefficients.shrink_to_fit();
+                        }
+
+                        // Evicts the least recently used values, but not the ones just handed out.
+                        void evict(const key_type &current_key, std::size_t current_size) {
+                            while (_memory_budget != 0 && _memory_usage > _memory_budget) {
+                                column_entry *victim = nullptr;
+                                std::size_t victim_size = 0;
+                                std::size_t oldest = std::numeric_limits<std::size_t>::max();
+                                for (auto &[key, entry] : _entries) {
+                                    for (const auto &[size, extension] : entry.extensions) {
+                                        if ((key != current_key || size != current_size) && extension.last_use < oldest) {
+                                            oldest = extension.last_use;
+                                            victim = &entry;
+                                            victim_size = size;
+                                        }
+                                    }
+                                    if (key != current_key && !entry.coefficients.empty() &&
+                                            entry.coefficients_last_use < oldest) {
+                                        oldest = entry.coefficients_last_use;
+                                        victim = &entry;
+                                        victim_size = 0;
+                                    }
+                                }
+                                if (victim == nullptr) {
+                                    break;
+                                }
+                                if (victim_size != 0) {
+                                    auto &values = victim->extensions.at(victim_size).values;
+                                    if (_spill_storage && victim->spilled.count(victim_size) == 0) {
+                                        victim->spilled[victim_size] = {_spill_storage->spill(*values),
+                                                                        values->degree()};
+                                    }
+                                    victim->extensions.erase(victim_size);
+                                    _memory_usage -= bytes(victim_size);
+                                } else {
+                                    _memory_usage -= bytes(victim->coefficients.size());
+                                    victim->coefficients.clear();
+                                    victim->coefficients.shrink_to_fit();
+                                }
+                            }
+                        }
+
+                        const plonk_polynomial_dfs_table<FieldType> &_columns;
+                        std::map<key_type, column_entry> _entries;
+                        std::map<std::size_t, std::shared_ptr<domain_type>> _domains;
+                        std::shared_ptr<spill_storage_type> _spill_storage;
+                        std::size_t _memory_budget;
+                        std::size_t _memory_usage;
+                        std::size_t _use_counter;
+                        std::size_t _fft_count;
+                    };
+                }    // namespace detail
+            }        // namespace snark
+        }            // namespace zk
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ZK_PLONK_PLACEHOLDER_COLUMN_CACHE_HPP
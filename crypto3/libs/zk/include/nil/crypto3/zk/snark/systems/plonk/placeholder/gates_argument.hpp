@@ -47,6 +47,7 @@
 #include <nil/crypto3/zk/snark/arithmetization/plonk/constraint_system.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/params.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/detail/placeholder_policy.hpp>
+#include <nil/crypto3/zk/snark/systems/plonk/placeholder/detail/column_cache.hpp>
 #include <nil/crypto3/zk/snark/arithmetization/plonk/constraint.hpp>
 #include <nil/crypto3/zk/math/expression.hpp>
 #include <nil/crypto3/zk/math/expression_evaluator.hpp>
@@ -75,42 +76,62 @@ namespace nil {
 
                     constexpr static const std::size_t argument_size = 1;
 
+                    using column_cache_type = detail::placeholder_column_cache<FieldType>;
+                    using column_ptr = typename column_cache_type::column_ptr;
+
                     static inline void build_variable_value_map(
                         const math::expression<polynomial_dfs_variable_type>& expr,
                         const plonk_polynomial_dfs_table<FieldType>& assignments,
                         std::shared_ptr<math::evaluation_domain<FieldType>> domain,
                         std::size_t extended_domain_size,
-                        std::unordered_map<polynomial_dfs_variable_type, polynomial_dfs_type>& variable_values_out,
+                        std::unordered_map<polynomial_dfs_variable_type, column_ptr>& variable_values_out,
                         const polynomial_dfs_type &mask_polynomial,
-                        const polynomial_dfs_type &lagrange_0
+                        const polynomial_dfs_type &lagrange_0,
+                        column_cache_type *column_cache = nullptr
                     ) {
 
+                        // Rotated variables are read through views of the unrotated column, so the columns are
+                        // counted and stored without rotation.
                         std::unordered_map<polynomial_dfs_variable_type, size_t> variable_counts;
 
                         math::expression_for_each_variable_visitor<polynomial_dfs_variable_type> visitor(
                             [&variable_counts](const polynomial_dfs_variable_type& var) {
-                                variable_counts[var]++;
+                                polynomial_dfs_variable_type column_var = var;
+                                column_var.rotation = 0;
+                                variable_counts[column_var]++;
                         });
-                        std::shared_ptr<math::evaluation_domain<FieldType>> extended_domain =
-                            math::make_evaluation_domain<FieldType>(extended_domain_size);
+                        std::shared_ptr<math::evaluation_domain<FieldType>> extended_domain;
 
                         visitor.visit(expr);
 
                         for (const auto& [var, count]: variable_counts) {
                             if (variable_values_out.find(var) != variable_values_out.end())
                                 continue;
+                            // Columns used once are multiplied on the original domain.
+                            const std::size_t size = count > 1 ? extended_domain_size : domain->m;
+                            if (column_cache != nullptr) {
+                                // The cache also holds the special selectors, see placeholder_prover.
+                                variable_values_out[var] = column_cache->get(var, size);
+                                continue;
+                            }
                             // We may have variable values in required sizes in some cases.
+                            polynomial_dfs_type assignment;
                             if( var.index == PLONK_SPECIAL_SELECTOR_ALL_USABLE_ROWS_SELECTED && var.type == polynomial_dfs_variable_type::column_type::selector ) {
-                                variable_values_out[var] = mask_polynomial;
+                                assignment = mask_polynomial;
                             } else if (var.index ==  PLONK_SPECIAL_SELECTOR_ALL_NON_FIRST_USABLE_ROWS_SELECTED && var.type == polynomial_dfs_variable_type::column_type::selector){
-                                variable_values_out[var] = mask_polynomial - lagrange_0;
+                                assignment = mask_polynomial - lagrange_0;
+                            } else if (size == domain->m) {
+                                variable_values_out[var] = column_ptr(
+                                    column_ptr(), &assignments.get_variable_value_without_rotation(var));
+                                continue;
                             } else {
-                                polynomial_dfs_type assignment = assignments.get_variable_value(var, domain);
-                                if (count > 1) {
-                                    assignment.resize(extended_domain_size, domain, extended_domain);
+                                if (!extended_domain) {
+                                    extended_domain = math::make_evaluation_domain<FieldType>(extended_domain_size);
                                 }
-                                variable_values_out[var] = assignment;
+                                assignment = assignments.get_variable_value_without_rotation(var);
+                                assignment.resize(extended_domain_size, domain, extended_domain);
                             }
+                            variable_values_out[var] = std::make_shared<polynomial_dfs_type>(std::move(assignment));
                         }
                     }
 
@@ -121,14 +142,39 @@ namespace nil {
                         std::uint32_t max_gates_degree,
                         const polynomial_dfs_type &mask_polynomial,
                         const polynomial_dfs_type &lagrange_0,
-                        transcript_type& transcript
+                        transcript_type& transcript,
+                        column_cache_type *column_cache = nullptr
+                    ) {
+                        typename FieldType::value_type theta = transcript.template challenge<FieldType>();
+
+                        std::array<polynomial_dfs_type, argument_size> F;
+                        accumulate_eval(
+                            constraint_system, column_polynomials, original_domain, max_gates_degree,
+                            mask_polynomial, lagrange_0, theta, FieldType::value_type::one(), F[0], column_cache);
+                        return F;
+                    }
+
+                    /**
+                     * Adds alpha * F to 'accumulator', where F is the result of prove_eval with the challenge theta.
+                     * Lets the prover add the gates straight into the quotient, without a polynomial of their own.
+                     */
+                    static inline void accumulate_eval(
+                        const typename policy_type::constraint_system_type &constraint_system,
+                        const plonk_polynomial_dfs_table<FieldType>& column_polynomials,
+                        std::shared_ptr<math::evaluation_domain<FieldType>> original_domain,
+                        std::uint32_t max_gates_degree,
+                        const polynomial_dfs_type &mask_polynomial,
+                        const polynomial_dfs_type &lagrange_0,
+                        const typename FieldType::value_type &theta,
+                        const typename FieldType::value_type &alpha,
+                        polynomial_dfs_type &accumulator,
+                        column_cache_type *column_cache = nullptr
                     ) {
                         PROFILE_SCOPE("gate_argument_time");
 
                         // max_gates_degree that comes from the outside does not take into account multiplication
                         // by selector.
                         ++max_gates_degree;
-                        typename FieldType::value_type theta = transcript.template challenge<FieldType>();
 
                         auto value_type_to_polynomial_dfs = [](
                             const typename variable_type::assignment_type& coeff) {
@@ -147,7 +193,8 @@ namespace nil {
 
                         std::vector<math::expression<polynomial_dfs_variable_type>> expressions(extended_domain_sizes.size());
 
-                        auto theta_acc = FieldType::value_type::one();
+                        // Alpha is folded into the powers of theta, it costs no extra pass.
+                        auto theta_acc = alpha;
 
                         // Every constraint has variable type 'variable_type', but we want it to use
                         // 'polynomial_dfs_variable_type' instead. The only difference is the coefficient type
@@ -186,8 +233,7 @@ namespace nil {
                             }
                         }
 
-                        std::unordered_map<polynomial_dfs_variable_type, polynomial_dfs_type> variable_values;
-                        std::array<polynomial_dfs_type, argument_size> F;
+                        std::unordered_map<polynomial_dfs_variable_type, column_ptr> variable_values;
 
                         for (size_t i = 0; i < extended_domain_sizes.size(); ++i) {
                             if (i != 0 && extended_domain_sizes[i] != extended_domain_sizes[i-1]) {
@@ -196,20 +242,26 @@ namespace nil {
                             build_variable_value_map(
                                 expressions[i], column_polynomials, original_domain,
                                 extended_domain_sizes[i], variable_values,
-                                mask_polynomial, lagrange_0
+                                mask_polynomial, lagrange_0, column_cache
                             );
+                            // The smaller extensions are read from the larger ones, which are not needed after that.
+                            if (column_cache != nullptr && i != 0) {
+                                column_cache->release(extended_domain_sizes[i - 1]);
+                            }
 
                             math::cached_expression_evaluator<polynomial_dfs_variable_type> evaluator(
                                 expressions[i], [&assignments=variable_values, domain_size=extended_domain_sizes[i]]
                                 (const polynomial_dfs_variable_type &var) -> const polynomial_dfs_type& {
-                                    return assignments[var];
-                                }
+                                    return *assignments[var];
+                                },
+                                original_domain->m
                             );
 
-                            F[0] += evaluator.evaluate();
+                            accumulator += evaluator.evaluate();
+                        }
+                        if (column_cache != nullptr) {
+                            column_cache->release(extended_domain_sizes.back());
                         }
-
-                        return F;
                     }
 
                     static inline std::array<typename FieldType::value_type, argument_size>
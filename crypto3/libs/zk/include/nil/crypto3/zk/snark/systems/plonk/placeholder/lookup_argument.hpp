@@ -35,6 +35,7 @@
 
 #include <nil/crypto3/math/polynomial/polynomial.hpp>
 #include <nil/crypto3/math/polynomial/shift.hpp>
+#include <nil/crypto3/math/polynomial/polynomial_dfs_view.hpp>
 #include <nil/crypto3/math/domains/evaluation_domain.hpp>
 #include <nil/crypto3/math/algorithms/make_evaluation_domain.hpp>
 
@@ -46,6 +47,7 @@
 #include <nil/crypto3/zk/snark/arithmetization/plonk/lookup_constraint.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/params.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/detail/placeholder_policy.hpp>
+#include <nil/crypto3/zk/snark/systems/plonk/placeholder/detail/column_cache.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/preprocessor.hpp>
 #include <nil/crypto3/zk/snark/arithmetization/plonk/assignment.hpp>
 
@@ -118,6 +120,7 @@ namespace nil {
                     using VariableType = plonk_variable<typename FieldType::value_type>;
                     using DfsVariableType = plonk_variable<polynomial_dfs_type>;
                     using commitment_scheme_type = CommitmentSchemeTypePermutation;
+                    using column_cache_type = detail::placeholder_column_cache<FieldType>;
 
 
                     static constexpr std::size_t argument_size = 4;
@@ -138,7 +141,8 @@ namespace nil {
                                 &preprocessed_data,
                             const plonk_polynomial_dfs_table<FieldType>& plonk_columns,
                             commitment_scheme_type &commitment_scheme,
-                            transcript_type &transcript)
+                            transcript_type &transcript,
+                            column_cache_type *column_cache = nullptr)
                         : constraint_system(constraint_system)
                         , preprocessed_data(preprocessed_data)
                         , plonk_columns(plonk_columns)
@@ -148,7 +152,20 @@ namespace nil {
                         , lookup_gates(constraint_system.lookup_gates())
                         , lookup_tables(constraint_system.lookup_tables())
                         , lookup_chunks(0)
+                        , column_cache(column_cache)
                     {
+                        // Without a cache shared with the other arguments, the extensions are only shared
+                        // between lookup inputs and values.
+                        if (this->column_cache == nullptr) {
+                            own_column_cache = std::make_unique<column_cache_type>(plonk_columns, basic_domain);
+                            polynomial_dfs_type mask_assignment(0, basic_domain->m, FieldType::value_type::one());
+                            mask_assignment -= preprocessed_data.q_last;
+                            mask_assignment -= preprocessed_data.q_blind;
+                            own_column_cache->set_special_selectors(
+                                mask_assignment, preprocessed_data.common_data.lagrange_0);
+                            this->column_cache = own_column_cache.get();
+                        }
+
                         // $/theta = \challenge$
                         theta = transcript.template challenge<FieldType>();
                     }
@@ -161,16 +178,13 @@ namespace nil {
                             0, basic_domain->m, FieldType::value_type::one());
                         polynomial_dfs_type zero_polynomial(
                             0, basic_domain->m, FieldType::value_type::zero());
-                        polynomial_dfs_type mask_assignment =
-                            one_polynomial -  preprocessed_data.q_last - preprocessed_data.q_blind;
-                        polynomial_dfs_type lagrange0 = preprocessed_data.common_data.lagrange_0;
 
                         std::unique_ptr<std::vector<polynomial_dfs_type>> lookup_value_ptr =
-                            prepare_lookup_value(mask_assignment, lagrange0);
+                            prepare_lookup_value();
                         auto& lookup_value = *lookup_value_ptr;
 
                         std::unique_ptr<std::vector<polynomial_dfs_type>> lookup_input_ptr =
-                            prepare_lookup_input(mask_assignment, lagrange0);
+                            prepare_lookup_input();
                         auto& lookup_input = *lookup_input_ptr;
 
 
@@ -291,10 +305,12 @@ namespace nil {
 
                         std::vector<polynomial_dfs_type> F_dfs_3_parts(std::next(sorted.begin(), 1), sorted.end());
                         for (std::size_t i = 0; i < F_dfs_3_parts.size(); i++) {
-                            polynomial_dfs_type sorted_shifted = math::polynomial_shift(
+                            math::polynomial_dfs_rotated_view<polynomial_dfs_type> sorted_shifted(
                                 sorted[i], preprocessed_data.common_data.desc.usable_rows_amount,
                                 basic_domain->m);
-                            F_dfs_3_parts[i] -= sorted_shifted;
+                            for (std::size_t j = 0; j < F_dfs_3_parts[i].size(); j++) {
+                                F_dfs_3_parts[i][j] -= sorted_shifted[j];
+                            }
                             F_dfs_3_parts[i] *= alpha_challenges[i] * preprocessed_data.common_data.lagrange_0;
                         }
 
@@ -340,8 +356,7 @@ namespace nil {
 
                         auto part1 = (one+beta) * gamma;
                         for (std::size_t i = 0; i < lookup_value.size(); i++) {
-                            auto lookup_shifted = math::polynomial_shift(lookup_value[i], 1, basic_domain->m);
-                            g_multipliers.push_back( part1 + lookup_value[i] + beta * lookup_shifted);
+                            g_multipliers.push_back(shifted_combination(lookup_value[i], part1, beta));
                             if( g_multipliers.size() == lookup_part_sizes[current_part] ){
                                 g *= math::polynomial_product<FieldType>(std::move(g_multipliers));
                                 result.push_back(g);
@@ -375,8 +390,7 @@ namespace nil {
 
                         std::size_t current_part = 0;
                         for (std::size_t i = 0; i < sorted.size(); i++) {
-                            auto sorted_shifted = math::polynomial_shift(sorted[i], 1, basic_domain->m);
-                            h_multipliers.push_back((one + beta) * gamma + sorted[i] + beta * sorted_shifted);
+                            h_multipliers.push_back(shifted_combination(sorted[i], (one + beta) * gamma, beta));
                             if( h_multipliers.size() == lookup_part_sizes[current_part] ){
                                 h = math::polynomial_product<FieldType>(h_multipliers);
                                 result.push_back(h);
@@ -429,10 +443,7 @@ namespace nil {
                         return V_L;
                     }
 
-                    std::unique_ptr<std::vector<polynomial_dfs_type>> prepare_lookup_value(
-                        const polynomial_dfs_type &mask_assignment,
-                        const polynomial_dfs_type &lagrange0
-                    ) {
+                    std::unique_ptr<std::vector<polynomial_dfs_type>> prepare_lookup_value() {
                         PROFILE_SCOPE("Lookup argument preparing lookup value");
 
                         typename FieldType::value_type theta_acc;
@@ -441,33 +452,37 @@ namespace nil {
                         auto lookup_value_ptr = std::make_unique<std::vector<polynomial_dfs_type>>();
                         for (std::size_t t_id = 0; t_id < lookup_tables.size(); t_id++) {
                             const plonk_lookup_table<FieldType> &l_table = lookup_tables[t_id];
-                            polynomial_dfs_type lookup_tag;
-                            if( l_table.tag_index == PLONK_SPECIAL_SELECTOR_ALL_USABLE_ROWS_SELECTED ){
-                                lookup_tag = mask_assignment;
-                            } else if( l_table.tag_index == PLONK_SPECIAL_SELECTOR_ALL_NON_FIRST_USABLE_ROWS_SELECTED ){
-                                lookup_tag = mask_assignment - lagrange0;
-                            } else {
-                                lookup_tag = plonk_columns.selector(l_table.tag_index);
-                            }
+                            const VariableType tag_var(
+                                l_table.tag_index, 0, false, VariableType::column_type::selector);
+                            const std::size_t tag_degree = column_cache->get(tag_var, basic_domain->m)->degree();
                             for (std::size_t o_id = 0; o_id < l_table.lookup_options.size(); o_id++) {
-                                polynomial_dfs_type v = (typename FieldType::value_type(t_id + 1)) * lookup_tag;
+                                // All the products are taken on the domain of the one of the highest degree,
+                                // the tag and the columns are extended to it once, by the column cache.
+                                std::size_t columns_degree = 0;
+                                for (std::size_t i = 0; i < l_table.columns_number; i++) {
+                                    columns_degree = std::max(columns_degree,
+                                        column_cache->get(l_table.lookup_options[o_id][i], basic_domain->m)->degree());
+                                }
+                                const std::size_t size = math::detail::power_of_two(
+                                    std::max<std::size_t>(basic_domain->m, tag_degree + columns_degree + 1));
+                                auto lookup_tag = column_cache->get(tag_var, size);
+
+                                polynomial_dfs_type v = (typename FieldType::value_type(t_id + 1)) * *lookup_tag;
                                 theta_acc = theta;
                                 for (std::size_t i = 0; i < l_table.columns_number; i++) {
-                                    polynomial_dfs_type c;
-                                    c = plonk_columns.get_variable_value_without_rotation(l_table.lookup_options[o_id][i]);
-                                    v += theta_acc * lookup_tag * c;
+                                    polynomial_dfs_type c = *column_cache->get(l_table.lookup_options[o_id][i], size);
+                                    c *= *lookup_tag;
+                                    c *= theta_acc;
+                                    v += c;
                                     theta_acc *= theta;
                                 }
-                                lookup_value_ptr->push_back(v);
+                                lookup_value_ptr->push_back(std::move(v));
                             }
                         }
                         return std::move(lookup_value_ptr);
                     }
 
-                    std::unique_ptr<std::vector<polynomial_dfs_type>> prepare_lookup_input(
-                        const polynomial_dfs_type &mask_assignment,
-                        const polynomial_dfs_type &lagrange0
-                    ) {
+                    std::unique_ptr<std::vector<polynomial_dfs_type>> prepare_lookup_input() {
                         PROFILE_SCOPE("Lookup argument preparing lookup input");
 
                         auto value_type_to_polynomial_dfs = [](
@@ -484,42 +499,31 @@ namespace nil {
                         auto lookup_input_ptr = std::make_unique<std::vector<polynomial_dfs_type>>();
                         for (const auto &gate : lookup_gates) {
                             math::expression<DfsVariableType> expr;
-                            polynomial_dfs_type lookup_selector;
-                            if( gate.tag_index == PLONK_SPECIAL_SELECTOR_ALL_USABLE_ROWS_SELECTED ){
-                                lookup_selector = mask_assignment;
-                            } else if( gate.tag_index == PLONK_SPECIAL_SELECTOR_ALL_NON_FIRST_USABLE_ROWS_SELECTED ){
-                                lookup_selector = mask_assignment - lagrange0;
-                            } else
-                                lookup_selector = plonk_columns.selector(gate.tag_index);
+                            const VariableType selector_var(
+                                gate.tag_index, 0, false, VariableType::column_type::selector);
+                            const polynomial_dfs_type &lookup_selector = *column_cache->get(selector_var, basic_domain->m);
                             for (const auto &constraint : gate.constraints) {
                                 polynomial_dfs_type l = lookup_selector * (typename FieldType::value_type(constraint.table_id));
                                 theta_acc = theta;
                                 for(std::size_t k = 0; k < constraint.lookup_input.size(); k++){
                                     expr = converter.convert(constraint.lookup_input[k]);
-                                    // For each variable with a rotation pre-compute its value.
-                                    std::unordered_map<DfsVariableType, polynomial_dfs_type> rotated_variable_values;
-
-                                    math::expression_for_each_variable_visitor<DfsVariableType> visitor(
-                                        [&rotated_variable_values, &assignments=plonk_columns, &domain=basic_domain]
-                                        (const DfsVariableType& var) {
-                                            if (var.rotation == 0)
-                                                return;
-                                            rotated_variable_values[var] = assignments.get_variable_value(var, domain);
-                                        }
-                                    );
-                                    visitor.visit(expr);
-
+                                    // Rotated variables are read through views of the columns.
                                     math::cached_expression_evaluator<DfsVariableType> evaluator(expr,
-                                        [&assignments=plonk_columns, &rotated_variable_values]
+                                        [&assignments=plonk_columns]
                                         (const DfsVariableType &var) -> const polynomial_dfs_type& {
-                                            if (var.rotation == 0) {
-                                                return assignments.get_variable_value_without_rotation(var);
-                                            }
-                                            return rotated_variable_values[var];
-                                        }
+                                            return assignments.get_variable_value_without_rotation(var);
+                                        },
+                                        basic_domain->m
                                     );
 
-                                    l += theta_acc * lookup_selector * evaluator.evaluate();
+                                    // The selector is extended to the domain of the product by the column cache.
+                                    polynomial_dfs_type input = evaluator.evaluate();
+                                    const std::size_t size = math::detail::power_of_two(std::max(
+                                        {basic_domain->m, input.size(), lookup_selector.degree() + input.degree() + 1}));
+                                    input.resize(size);
+                                    input *= *column_cache->get(selector_var, size);
+                                    input *= theta_acc;
+                                    l += input;
                                     theta_acc *= theta;
                                 }
                                 lookup_input_ptr->push_back(l);
@@ -529,7 +533,21 @@ namespace nil {
                     }
 
 
-                private:
+                protected:
+
+                    // constant + column(X) + beta * column(omega * X) in one pass, the shifted column is not copied.
+                    polynomial_dfs_type shifted_combination(
+                        const polynomial_dfs_type &column,
+                        const typename FieldType::value_type &constant,
+                        const typename FieldType::value_type &beta
+                    ) const {
+                        math::polynomial_dfs_rotated_view<polynomial_dfs_type> shifted(column, 1, basic_domain->m);
+                        polynomial_dfs_type result(column.degree(), column.size());
+                        for (std::size_t j = 0; j < column.size(); j++) {
+                            result[j] = constant + column[j] + beta * shifted[j];
+                        }
+                        return result;
+                    }
 
                     polynomial_dfs_type reduce_dfs_polynomial_domain(
                         const polynomial_dfs_type &polynomial,
@@ -664,6 +682,8 @@ namespace nil {
                     const std::vector<plonk_lookup_table<FieldType>>& lookup_tables;
                     typename FieldType::value_type theta;
                     std::size_t lookup_chunks;
+                    column_cache_type *column_cache;
+                    std::unique_ptr<column_cache_type> own_column_cache;
                 };
 
                 template<typename FieldType, typename CommitmentSchemeTypePermutation, typename ParamsType>
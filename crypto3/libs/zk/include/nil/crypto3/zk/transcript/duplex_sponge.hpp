@@ -0,0 +1,568 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation <info@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ZK_TRANSCRIPT_DUPLEX_SPONGE_HPP
+#define CRYPTO3_ZK_TRANSCRIPT_DUPLEX_SPONGE_HPP
+
+#include <algorithm>
+#include <array>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+#include <nil/crypto3/multiprecision/big_uint.hpp>
+
+#include <nil/crypto3/hash/keccak.hpp>
+#include <nil/crypto3/hash/poseidon.hpp>
+#include <nil/crypto3/hash/type_traits.hpp>
+#include <nil/crypto3/hash/detail/keccak/keccak_impl.hpp>
+#include <nil/crypto3/hash/detail/poseidon/poseidon_permutation.hpp>
+
+#include <nil/crypto3/algebra/type_traits.hpp>
+
+#include <nil/crypto3/zk/transcript/fiat_shamir.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace zk {
+            namespace transcript {
+
+                /*!
+                 * @brief Selects the duplex-sponge transcript for the permutation of Hash.
+                 *
+                 * Used in place of the transcript hash, e.g. as
+                 * list_polynomial_commitment_params<merkle_hash_type, duplex_sponge<hashes::keccak_1600<256>>, 2>.
+                 * Everywhere else, e.g. for hashing of the constraint system, it behaves exactly as Hash.
+                 *
+                 * The transcript keeps a sponge state and absorbs the data into it directly, instead of hashing the
+                 * previous digest together with each new message. Absorbing and squeezing never allocate, and a
+                 * copy of the transcript is a copy of a fixed size state, which is what grinding does per attempt.
+                 * Challenges differ from the ones of fiat_shamir_heuristic_sequential<Hash>, so the prover and the
+                 * verifier must use the same mode.
+                 */
+                template<typename Hash>
+                struct duplex_sponge : public Hash {
+                    using sponge_hash_type = Hash;
+                };
+
+                namespace detail {
+
+                    template<typename Hash>
+                    struct is_keccak_1600 : std::false_type { };
+
+                    template<std::size_t DigestBits>
+                    struct is_keccak_1600<hashes::keccak_1600<DigestBits>> : std::true_type { };
+
+                    template<typename Range, typename = void>
+                    struct is_absorbable_range : std::false_type { };
+
+                    template<typename Range>
+                    struct is_absorbable_range<Range, std::void_t<decltype(std::begin(std::declval<const Range &>()))>>
+                        : std::true_type { };
+
+                    /*!
+                     * @brief Writes the value as Bytes big-endian bytes.
+                     */
+                    template<std::size_t Bytes, std::size_t Bits>
+                    void big_uint_to_bytes(const multiprecision::big_uint<Bits> &value,
+                                           std::array<std::uint8_t, Bytes> &bytes) {
+                        static_assert(Bits <= Bytes * CHAR_BIT, "Bytes are too few for the value");
+                        auto end = value.export_bits(bytes.begin(), CHAR_BIT, true);
+                        const std::size_t count = end - bytes.begin();
+                        std::copy_backward(bytes.begin(), end, bytes.end());
+                        std::fill(bytes.begin(), bytes.end() - count, 0);
+                    }
+
+                    /*!
+                     * @brief Reads the value from Bytes big-endian bytes.
+                     */
+                    template<std::size_t Bytes, std::size_t Bits>
+                    void big_uint_from_bytes(const std::array<std::uint8_t, Bytes> &bytes,
+                                             multiprecision::big_uint<Bits> &value) {
+                        static_assert(Bytes * CHAR_BIT <= Bits, "Value is too small for the bytes");
+                        value.import_bits(bytes.begin(), bytes.end(), CHAR_BIT, true);
+                    }
+
+                    /*!
+                     * @brief Writes the value as 8 big-endian bytes, returns the end of the written bytes.
+                     */
+                    template<typename OutputIterator>
+                    OutputIterator write_state_word(std::uint64_t value, OutputIterator out) {
+                        for (std::size_t i = sizeof(value); i != 0; --i) {
+                            *out++ = static_cast<std::uint8_t>(value >> (CHAR_BIT * (i - 1)));
+                        }
+                        return out;
+                    }
+
+                    /*!
+                     * @brief Reads 8 big-endian bytes written by write_state_word, advances the iterator past them.
+                     */
+                    template<typename InputIterator>
+                    std::uint64_t read_state_word(InputIterator &in) {
+                        std::uint64_t value = 0;
+                        for (std::size_t i = 0; i < sizeof(value); ++i) {
+                            value = (value << CHAR_BIT) | *in++;
+                        }
+                        return value;
+                    }
+
+                    /*!
+                     * @brief Writes the canonical value of a field element as big-endian bytes.
+                     */
+                    template<typename FieldElement, typename OutputIterator>
+                    OutputIterator write_state_element(const FieldElement &value, OutputIterator out) {
+                        using field_type = typename FieldElement::field_type;
+                        std::array<std::uint8_t, (field_type::modulus_bits + CHAR_BIT - 1) / CHAR_BIT> bytes;
+                        big_uint_to_bytes(static_cast<typename field_type::integral_type>(value.data), bytes);
+                        return std::copy(bytes.begin(), bytes.end(), out);
+                    }
+
+                    /*!
+                     * @brief Reads a field element written by write_state_element, advances the iterator past it.
+                     */
+                    template<typename FieldElement, typename InputIterator>
+                    FieldElement read_state_element(InputIterator &in) {
+                        using field_type = typename FieldElement::field_type;
+                        constexpr std::size_t bytes_count = (field_type::modulus_bits + CHAR_BIT - 1) / CHAR_BIT;
+                        std::array<std::uint8_t, bytes_count> bytes;
+                        std::copy(in, in + bytes_count, bytes.begin());
+                        in += bytes_count;
+                        multiprecision::big_uint<bytes_count * CHAR_BIT> value;
+                        big_uint_from_bytes(bytes, value);
+                        return FieldElement(value);
+                    }
+
+                    /*!
+                     * @brief Byte-oriented duplex sponge over Keccak-f[1600], with the rate of Hash.
+                     *
+                     * Bytes are xored into the little-endian lanes of the state. The switch from absorbing to
+                     * squeezing pads the absorbed data with pad10*1 and permutes, so messages are separated from
+                     * challenges. Absorbing after squeezing starts at the beginning of the rate again.
+                     */
+                    template<typename Hash>
+                    class keccak_duplex_sponge {
+                    public:
+                        using policy_type = typename Hash::policy_type;
+                        using permutation_type = hashes::detail::keccak_1600_impl<policy_type>;
+                        using state_type = typename policy_type::state_type;
+
+                        constexpr static const std::size_t rate_bytes = policy_type::block_bits / CHAR_BIT;
+
+                        // The lanes, the position in the rate and the squeezing flag.
+                        using serialized_state_type = std::array<
+                            std::uint8_t,
+                            std::tuple_size<state_type>::value * sizeof(typename state_type::value_type) +
+                                sizeof(std::uint64_t) + 1>;
+
+                        keccak_duplex_sponge() : state(), pos(0), squeezing(false) {
+                        }
+
+                        serialized_state_type get_state() const {
+                            serialized_state_type result;
+                            auto out = result.begin();
+                            for (const auto &lane : state) {
+                                out = write_state_word(lane, out);
+                            }
+                            out = write_state_word(pos, out);
+                            *out = squeezing ? 1 : 0;
+                            return result;
+                        }
+
+                        void set_state(const serialized_state_type &serialized) {
+                            auto in = serialized.begin();
+                            for (auto &lane : state) {
+                                lane = read_state_word(in);
+                            }
+                            pos = std::min<std::size_t>(read_state_word(in), rate_bytes);
+                            squeezing = (*in != 0);
+                        }
+
+                        void absorb_byte(std::uint8_t byte) {
+                            if (squeezing) {
+                                squeezing = false;
+                                pos = 0;
+                            }
+                            if (pos == rate_bytes) {
+                                permutation_type::permute(state);
+                                pos = 0;
+                            }
+                            xor_byte(pos++, byte);
+                        }
+
+                        template<typename FieldElement>
+                        void absorb_element(const FieldElement &value) {
+                            using field_type = typename FieldElement::field_type;
+                            constexpr std::size_t bytes_count = (field_type::modulus_bits + CHAR_BIT - 1) / CHAR_BIT;
+
+                            std::array<std::uint8_t, bytes_count> bytes;
+                            big_uint_to_bytes(static_cast<typename field_type::integral_type>(value.data), bytes);
+                            for (std::uint8_t byte : bytes) {
+                                absorb_byte(byte);
+                            }
+                        }
+
+                        void end_message() {
+                        }
+
+                        std::uint8_t squeeze_byte() {
+                            if (!squeezing) {
+                                if (pos == rate_bytes) {
+                                    permutation_type::permute(state);
+                                    pos = 0;
+                                }
+                                xor_byte(pos, 0x01);
+                                xor_byte(rate_bytes - 1, 0x80);
+                                permutation_type::permute(state);
+                                squeezing = true;
+                                pos = 0;
+                            }
+                            if (pos == rate_bytes) {
+                                permutation_type::permute(state);
+                                pos = 0;
+                            }
+                            const std::size_t i = pos++;
+                            return static_cast<std::uint8_t>(state[i / 8] >> (8 * (i % 8)));
+                        }
+
+                    private:
+                        void xor_byte(std::size_t i, std::uint8_t byte) {
+                            state[i / 8] ^= static_cast<typename state_type::value_type>(byte) << (8 * (i % 8));
+                        }
+
+                        state_type state;
+                        std::size_t pos;
+                        bool squeezing;
+                    };
+
+                    /*!
+                     * @brief Field-native duplex sponge over the Poseidon permutation of Hash.
+                     *
+                     * The first state element is the capacity, the rest is the rate. Elements of the sponge field
+                     * are added to the rate directly. Bytes and elements of other fields are packed big-endian into
+                     * elements of (modulus_bits - 1) / 8 bytes, the last one of each message is flushed by
+                     * end_message(). The switch to squeezing adds a padding one to the next rate element.
+                     */
+                    template<typename Hash>
+                    class poseidon_duplex_sponge {
+                    public:
+                        using policy_type = typename Hash::policy_type;
+                        using permutation_type = hashes::detail::poseidon_permutation<policy_type>;
+                        using state_type = typename permutation_type::state_type;
+                        using field_type = typename policy_type::field_type;
+                        using value_type = typename field_type::value_type;
+                        using integral_type = typename field_type::integral_type;
+
+                        constexpr static const std::size_t rate = policy_type::state_words - 1;
+                        constexpr static const std::size_t chunk_bytes = (field_type::modulus_bits - 1) / CHAR_BIT;
+                        constexpr static const std::size_t element_bytes =
+                            (field_type::modulus_bits + CHAR_BIT - 1) / CHAR_BIT;
+
+                        // The state elements, the pending chunk, the positions and the squeezing flag.
+                        using serialized_state_type = std::array<
+                            std::uint8_t,
+                            (policy_type::state_words + 1) * element_bytes + 2 * sizeof(std::uint64_t) + 1>;
+
+                        poseidon_duplex_sponge() : pos(0), squeezing(false), chunk(0u), chunk_size(0) {
+                            state.fill(value_type::zero());
+                        }
+
+                        serialized_state_type get_state() const {
+                            serialized_state_type result;
+                            auto out = result.begin();
+                            for (const auto &element : state) {
+                                out = write_state_element(element, out);
+                            }
+                            // The chunk is shorter than the modulus, so it is kept exactly as an element.
+                            out = write_state_element(value_type(chunk), out);
+                            out = write_state_word(pos, out);
+                            out = write_state_word(chunk_size, out);
+                            *out = squeezing ? 1 : 0;
+                            return result;
+                        }
+
+                        void set_state(const serialized_state_type &serialized) {
+                            auto in = serialized.begin();
+                            for (auto &element : state) {
+                                element = read_state_element<value_type>(in);
+                            }
+                            chunk = static_cast<integral_type>(read_state_element<value_type>(in).data);
+                            pos = std::min<std::size_t>(read_state_word(in), rate);
+                            chunk_size = std::min<std::size_t>(read_state_word(in), chunk_bytes - 1);
+                            squeezing = (*in != 0);
+                        }
+
+                        void absorb_byte(std::uint8_t byte) {
+                            chunk <<= CHAR_BIT;
+                            chunk += byte;
+                            if (++chunk_size == chunk_bytes) {
+                                flush_chunk();
+                            }
+                        }
+
+                        template<typename FieldElement>
+                        void absorb_element(const FieldElement &value) {
+                            if constexpr (std::is_same_v<typename FieldElement::field_type, field_type>) {
+                                flush_chunk();
+                                absorb_native(value);
+                            } else {
+                                using other_field_type = typename FieldElement::field_type;
+                                constexpr std::size_t bytes_count =
+                                    (other_field_type::modulus_bits + CHAR_BIT - 1) / CHAR_BIT;
+
+                                std::array<std::uint8_t, bytes_count> bytes;
+                                big_uint_to_bytes(static_cast<typename other_field_type::integral_type>(value.data), bytes);
+                                for (std::uint8_t byte : bytes) {
+                                    absorb_byte(byte);
+                                }
+                            }
+                        }
+
+                        void end_message() {
+                            flush_chunk();
+                        }
+
+                        value_type squeeze_element() {
+                            flush_chunk();
+                            if (!squeezing) {
+                                absorb_native(value_type::one());
+                                permutation_type::permute(state);
+                                squeezing = true;
+                                pos = 0;
+                            }
+                            if (pos == rate) {
+                                permutation_type::permute(state);
+                                pos = 0;
+                            }
+                            return state[1 + pos++];
+                        }
+
+                    private:
+                        void absorb_native(const value_type &value) {
+                            if (squeezing) {
+                                squeezing = false;
+                                pos = 0;
+                            }
+                            if (pos == rate) {
+                                permutation_type::permute(state);
+                                pos = 0;
+                            }
+                            state[1 + pos++] += value;
+                        }
+
+                        void flush_chunk() {
+                            if (chunk_size != 0) {
+                                absorb_native(value_type(chunk));
+                                chunk = 0u;
+                                chunk_size = 0;
+                            }
+                        }
+
+                        state_type state;
+                        std::size_t pos;
+                        bool squeezing;
+                        integral_type chunk;
+                        std::size_t chunk_size;
+                    };
+                }    // namespace detail
+
+                /*!
+                 * @brief Duplex-sponge Fiat–Shamir transcript, has the interface of the sequential one.
+                 *
+                 * Field elements are absorbed as big-endian bytes of their canonical values, or natively by the
+                 * Poseidon sponge, elements of extension fields component-wise, curve elements as affine X and Y.
+                 * Ranges are absorbed element by element, and each operator() call is one message.
+                 * Field challenges are squeezed with 128 extra bits and reduced, so their bias is negligible.
+                 */
+                template<typename Hash>
+                struct fiat_shamir_heuristic_sequential<duplex_sponge<Hash>, void> {
+                    typedef duplex_sponge<Hash> hash_type;
+
+                    constexpr static const bool is_poseidon =
+                        nil::crypto3::hashes::is_specialization_of<nil::crypto3::hashes::poseidon, Hash>::value;
+
+                    static_assert(is_poseidon || detail::is_keccak_1600<Hash>::value,
+                                  "Duplex-sponge transcript is available for Keccak and Poseidon only");
+
+                    using sponge_type = typename std::conditional_t<is_poseidon,
+                                                                    detail::poseidon_duplex_sponge<Hash>,
+                                                                    detail::keccak_duplex_sponge<Hash>>;
+                    using transcript_state_type = typename sponge_type::serialized_state_type;
+
+                    fiat_shamir_heuristic_sequential() {
+                    }
+
+                    template<typename InputRange>
+                    fiat_shamir_heuristic_sequential(const InputRange &r) {
+                        (*this)(r);
+                    }
+
+                    template<typename InputIterator>
+                    fiat_shamir_heuristic_sequential(InputIterator first, InputIterator last) {
+                        (*this)(first, last);
+                    }
+
+                    template<typename InputRange>
+                    typename std::enable_if_t<
+                        !algebra::is_curve_element<InputRange>::value &&
+                        !algebra::is_field_element<InputRange>::value>
+                    operator()(const InputRange &r) {
+                        absorb(r);
+                        sponge.end_message();
+                    }
+
+                    template<typename InputIterator>
+                    void operator()(InputIterator first, InputIterator last) {
+                        for (; first != last; ++first) {
+                            absorb(*first);
+                        }
+                        sponge.end_message();
+                    }
+
+                    template<typename element>
+                    typename std::enable_if_t<
+                        algebra::is_curve_element<element>::value ||
+                        algebra::is_field_element<element>::value
+                        >
+                    operator()(element const& data) {
+                        absorb(data);
+                        sponge.end_message();
+                    }
+
+                    template<typename Field>
+                    typename Field::value_type challenge() {
+                        if constexpr (is_poseidon) {
+                            auto result = sponge.squeeze_element();
+                            if constexpr (std::is_same_v<typename Field::value_type, decltype(result)>) {
+                                return result;
+                            } else {
+                                return typename Field::value_type(
+                                    static_cast<typename sponge_type::integral_type>(result.data));
+                            }
+                        } else {
+                            constexpr std::size_t bytes_count = (Field::modulus_bits + 128 + CHAR_BIT - 1) / CHAR_BIT;
+
+                            std::array<std::uint8_t, bytes_count> bytes;
+                            for (auto &byte : bytes) {
+                                byte = sponge.squeeze_byte();
+                            }
+                            multiprecision::big_uint<bytes_count * CHAR_BIT> raw_result;
+                            detail::big_uint_from_bytes(bytes, raw_result);
+                            return typename Field::value_type(raw_result);
+                        }
+                    }
+
+                    template<typename Integral>
+                    Integral int_challenge() {
+                        using unsigned_type = std::make_unsigned_t<Integral>;
+                        unsigned_type result = 0;
+                        if constexpr (is_poseidon) {
+                            using field_type = typename sponge_type::field_type;
+                            std::array<std::uint8_t, (field_type::modulus_bits + CHAR_BIT - 1) / CHAR_BIT> bytes;
+                            detail::big_uint_to_bytes(
+                                static_cast<typename field_type::integral_type>(sponge.squeeze_element().data), bytes);
+                            for (std::size_t i = bytes.size() - sizeof(Integral); i < bytes.size(); ++i) {
+                                result = static_cast<unsigned_type>((result << (CHAR_BIT - 1)) << 1) | bytes[i];
+                            }
+                        } else {
+                            for (std::size_t i = 0; i < sizeof(Integral); ++i) {
+                                result = static_cast<unsigned_type>((result << (CHAR_BIT - 1)) << 1) |
+                                    sponge.squeeze_byte();
+                            }
+                        }
+                        return static_cast<Integral>(result);
+                    }
+
+                    template<typename Field, std::size_t N>
+                    std::array<typename Field::value_type, N> challenges() {
+
+                        std::array<typename Field::value_type, N> result;
+                        for (auto &ch : result) {
+                            ch = challenge<Field>();
+                        }
+
+                        return result;
+                    }
+
+                    template<typename Field>
+                    std::vector<typename Field::value_type> challenges(std::size_t N) {
+
+                        std::vector<typename Field::value_type> result;
+                        for (std::size_t i = 0; i < N; ++i) {
+                            result.push_back(challenge<Field>());
+                        }
+
+                        return result;
+                    }
+
+                    /**
+                     * State reached by the transcript, as bytes of a fixed size. A transcript given it with
+                     * set_state() draws the same challenges from then on, which lets a saved proof be resumed.
+                     */
+                    transcript_state_type get_state() const {
+                        return sponge.get_state();
+                    }
+
+                    void set_state(const transcript_state_type &new_state) {
+                        sponge.set_state(new_state);
+                    }
+
+                private:
+                    template<typename T>
+                    void absorb(const T &data) {
+                        if constexpr (algebra::is_curve_element<T>::value) {
+                            auto affine = data.to_affine();
+                            absorb(affine.X);
+                            absorb(affine.Y);
+                        } else if constexpr (algebra::is_extended_field_element<T>::value) {
+                            for (const auto &component : data.data) {
+                                absorb(component);
+                            }
+                        } else if constexpr (algebra::is_field_element<T>::value) {
+                            sponge.absorb_element(data);
+                        } else if constexpr (std::is_integral_v<T>) {
+                            for (std::size_t i = sizeof(T); i != 0; --i) {
+                                sponge.absorb_byte(static_cast<std::uint8_t>(
+                                    static_cast<std::make_unsigned_t<T>>(data) >> (CHAR_BIT * (i - 1))));
+                            }
+                        } else {
+                            static_assert(detail::is_absorbable_range<T>::value,
+                                          "Transcript absorbs field and curve elements, integers and their ranges");
+                            for (const auto &value : data) {
+                                absorb(value);
+                            }
+                        }
+                    }
+
+                    sponge_type sponge;
+                };
+
+            }    // namespace transcript
+        }        // namespace zk
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ZK_TRANSCRIPT_DUPLEX_SPONGE_HPP
@@ -0,0 +1,82 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation <info@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+// Test verification of several proofs of one circuit at once
+//
+
+#define BOOST_TEST_MODULE placeholder_batch_verifier_test
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/hash/algorithm/hash.hpp>
+#include <nil/crypto3/hash/poseidon.hpp>
+
+#include <nil/crypto3/zk/snark/systems/plonk/placeholder/batch_verifier.hpp>
+
+#include <nil/crypto3/test_tools/random_test_initializer.hpp>
+
+#include "circuits.hpp"
+#include "placeholder_test_runner.hpp"
+
+BOOST_AUTO_TEST_SUITE(placeholder_batch_verifier)
+
+    using curve_type = algebra::curves::pallas;
+    using field_type = typename curve_type::base_field_type;
+    using poseidon_type = hashes::poseidon<nil::crypto3::hashes::detail::mina_poseidon_policy<field_type>>;
+
+    BOOST_AUTO_TEST_CASE(batch_with_invalid_proof)
+    {
+        using test_runner_type = placeholder_test_runner<field_type, poseidon_type, poseidon_type>;
+        using placeholder_params_type = typename test_runner_type::lpc_placeholder_params_type;
+        using lpc_scheme_type = typename test_runner_type::lpc_scheme_type;
+        using batch_verifier_type =
+            nil::crypto3::zk::snark::placeholder_batch_verifier<field_type, placeholder_params_type>;
+
+        test_tools::random_test_initializer<field_type> random_test_initializer;
+        auto circuit = circuit_test_1<field_type>(
+                random_test_initializer.alg_random_engines.template get_alg_engine<field_type>(),
+                random_test_initializer.generic_random_engine
+        );
+        test_runner_type runner(circuit);
+
+        lpc_scheme_type lpc_scheme(runner.fri_params);
+        auto public_data = placeholder_public_preprocessor<field_type, placeholder_params_type>::process(
+            runner.constraint_system, runner.assignments.public_table(), runner.desc, lpc_scheme);
+        auto private_data = placeholder_private_preprocessor<field_type, placeholder_params_type>::process(
+            runner.constraint_system, runner.assignments.private_table(), runner.desc);
+        lpc_scheme_type prover_scheme = lpc_scheme;
+        auto proof = placeholder_prover<field_type, placeholder_params_type>::process(
+            public_data, std::move(private_data), runner.desc, runner.constraint_system, prover_scheme);
+
+        auto tampered_proof = proof;
+        tampered_proof.eval_proof.eval_proof.z.set(
+            VARIABLE_VALUES_BATCH, 0, 0,
+            tampered_proof.eval_proof.eval_proof.z.get(VARIABLE_VALUES_BATCH, 0, 0) + field_type::value_type::one());
+
+        std::vector<bool> results = batch_verifier_type::process(
+            public_data.common_data, {proof, tampered_proof}, runner.desc, runner.constraint_system,
+            lpc_scheme_type(runner.fri_params));
+        BOOST_CHECK((results == std::vector<bool>{true, false}));
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
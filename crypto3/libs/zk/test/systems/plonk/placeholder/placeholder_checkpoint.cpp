@@ -0,0 +1,148 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation <info@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+// Test resuming the Placeholder prover from its checkpoints
+//
+
+#define BOOST_TEST_MODULE placeholder_checkpoint_test
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/hash/algorithm/hash.hpp>
+#include <nil/crypto3/hash/poseidon.hpp>
+#include <nil/crypto3/hash/keccak.hpp>
+
+#include <nil/crypto3/test_tools/random_test_initializer.hpp>
+
+#include "circuits.hpp"
+#include "placeholder_test_runner.hpp"
+
+template<typename TestRunnerType>
+struct checkpoint_fixture {
+    using field_type = typename TestRunnerType::field_type;
+    using placeholder_params_type = typename TestRunnerType::lpc_placeholder_params_type;
+    using lpc_scheme_type = typename TestRunnerType::lpc_scheme_type;
+    using prover_type = placeholder_prover<field_type, placeholder_params_type>;
+    using proof_type = placeholder_proof<field_type, placeholder_params_type>;
+    using transcript_type = transcript::fiat_shamir_heuristic_sequential<
+        typename placeholder_params_type::transcript_hash_type>;
+
+    // Owning copy of a checkpoint. The transcript goes through its state, as it would through a file.
+    struct saved_checkpoint {
+        placeholder_prover_stage stage;
+        typename transcript_type::transcript_state_type transcript_state;
+        proof_type proof;
+        typename prover_type::F_parts_type F_dfs;
+        lpc_scheme_type commitment_scheme;
+    };
+
+    checkpoint_fixture(const typename TestRunnerType::circuit_type &circuit)
+        : runner(circuit), lpc_scheme(runner.fri_params),
+          public_data(placeholder_public_preprocessor<field_type, placeholder_params_type>::process(
+              runner.constraint_system, runner.assignments.public_table(), runner.desc, lpc_scheme)),
+          private_data(placeholder_private_preprocessor<field_type, placeholder_params_type>::process(
+              runner.constraint_system, runner.assignments.private_table(), runner.desc)) {
+    }
+
+    proof_type prove(std::vector<saved_checkpoint> *checkpoints = nullptr) {
+        prover_type prover(public_data, private_data, runner.desc, runner.constraint_system, lpc_scheme);
+        if (checkpoints) {
+            prover.set_checkpoint_handler([checkpoints](const typename prover_type::checkpoint_type &checkpoint) {
+                checkpoints->push_back({checkpoint.stage, checkpoint.transcript.get_state(), checkpoint.proof,
+                                        checkpoint.F_dfs, checkpoint.commitment_scheme});
+            });
+        }
+        return prover.process();
+    }
+
+    proof_type resume(const saved_checkpoint &checkpoint) {
+        prover_type prover(public_data, private_data, runner.desc, runner.constraint_system,
+                           checkpoint.commitment_scheme);
+        transcript_type resumed_transcript;
+        resumed_transcript.set_state(checkpoint.transcript_state);
+        prover.resume(checkpoint.stage, resumed_transcript, checkpoint.proof, checkpoint.F_dfs);
+        return prover.process();
+    }
+
+    bool verify(const proof_type &proof) {
+        lpc_scheme_type verifier_scheme(runner.fri_params);
+        return placeholder_verifier<field_type, placeholder_params_type>::process(
+            public_data.common_data, proof, runner.desc, runner.constraint_system, verifier_scheme);
+    }
+
+    void check_resumed_proofs() {
+        std::vector<saved_checkpoint> checkpoints;
+        proof_type proof = prove(&checkpoints);
+        BOOST_CHECK(verify(proof));
+
+        BOOST_REQUIRE_EQUAL(checkpoints.size(), 4);
+        BOOST_CHECK(checkpoints[0].stage == placeholder_prover_stage::variable_values_committed);
+        BOOST_CHECK(checkpoints[1].stage == placeholder_prover_stage::permutation_committed);
+        BOOST_CHECK(checkpoints[2].stage == placeholder_prover_stage::quotient_committed);
+        BOOST_CHECK(checkpoints[3].stage == placeholder_prover_stage::evaluated);
+
+        for (const auto &checkpoint : checkpoints) {
+            BOOST_CHECK(resume(checkpoint) == proof);
+        }
+    }
+
+    TestRunnerType runner;
+    lpc_scheme_type lpc_scheme;
+    typename placeholder_public_preprocessor<field_type, placeholder_params_type>::preprocessed_data_type public_data;
+    typename placeholder_private_preprocessor<field_type, placeholder_params_type>::preprocessed_data_type private_data;
+};
+
+BOOST_AUTO_TEST_SUITE(placeholder_checkpoint)
+
+    using curve_type = algebra::curves::pallas;
+    using field_type = typename curve_type::base_field_type;
+    using poseidon_type = hashes::poseidon<nil::crypto3::hashes::detail::mina_poseidon_policy<field_type>>;
+    using keccak_type = hashes::keccak_1600<256>;
+
+    BOOST_AUTO_TEST_CASE(resume_with_copy_constraints)
+    {
+        using test_runner_type = placeholder_test_runner<field_type, poseidon_type, poseidon_type>;
+
+        test_tools::random_test_initializer<field_type> random_test_initializer;
+        auto circuit = circuit_test_1<field_type>(
+                random_test_initializer.alg_random_engines.template get_alg_engine<field_type>(),
+                random_test_initializer.generic_random_engine
+        );
+        checkpoint_fixture<test_runner_type> fixture(circuit);
+        fixture.check_resumed_proofs();
+    }
+
+    BOOST_AUTO_TEST_CASE(resume_with_lookups)
+    {
+        using test_runner_type = placeholder_test_runner<field_type, keccak_type, keccak_type>;
+
+        test_tools::random_test_initializer<field_type> random_test_initializer;
+        auto circuit = circuit_test_3<field_type>(
+                random_test_initializer.alg_random_engines.template get_alg_engine<field_type>(),
+                random_test_initializer.generic_random_engine
+        );
+        checkpoint_fixture<test_runner_type> fixture(circuit);
+        fixture.check_resumed_proofs();
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -31,6 +31,8 @@
 
 #define BOOST_TEST_MODULE placeholder_gate_argument_test
 
+#include <filesystem>
+
 #include <boost/test/unit_test.hpp>
 #include <boost/test/data/test_case.hpp>
 #include <boost/test/data/monomorphic.hpp>
@@ -230,4 +232,105 @@ BOOST_AUTO_TEST_SUITE(placeholder_gate_argument)
         BOOST_CHECK(prover_res[0].evaluate(y) == verifier_res[0]);
     }
 
+    BOOST_FIXTURE_TEST_CASE(placeholder_gate_argument_column_cache_test, test_tools::random_test_initializer<field_type>) {
+        using polynomial_dfs_type = math::polynomial_dfs<typename field_type::value_type>;
+        using variable_type = plonk_variable<typename field_type::value_type>;
+
+        auto pi0 = alg_random_engines.template get_alg_engine<field_type>()();
+        auto circuit = circuit_test_t<field_type>(
+                pi0,
+                alg_random_engines.template get_alg_engine<field_type>(),
+                generic_random_engine
+        );
+
+        plonk_table_description<field_type> desc(
+                circuit.table.witnesses().size(),
+                circuit.table.public_inputs().size(),
+                circuit.table.constants().size(),
+                circuit.table.selectors().size(),
+                circuit.usable_rows,
+                circuit.table_rows);
+
+        std::size_t table_rows_log = std::log2(desc.rows_amount);
+
+        typename policy_type::constraint_system_type constraint_system(
+                circuit.gates, circuit.copy_constraints, circuit.lookup_gates);
+        typename policy_type::variable_assignment_type assignments = circuit.table;
+
+        typename lpc_type::fri_type::params_type fri_params(1, table_rows_log, placeholder_test_params::lambda, 4);
+        lpc_scheme_type lpc_scheme(fri_params);
+
+        typename placeholder_public_preprocessor<field_type, lpc_placeholder_params_type>::preprocessed_data_type
+                preprocessed_public_data = placeholder_public_preprocessor<field_type, lpc_placeholder_params_type>::process(
+                constraint_system, assignments.public_table(), desc, lpc_scheme
+        );
+
+        typename placeholder_private_preprocessor<field_type, lpc_placeholder_params_type>::preprocessed_data_type
+                preprocessed_private_data = placeholder_private_preprocessor<field_type, lpc_placeholder_params_type>::process(
+                constraint_system, assignments.private_table(), desc
+        );
+
+        auto polynomial_table =
+                plonk_polynomial_dfs_table<field_type>(
+                        preprocessed_private_data.private_polynomial_table,
+                        preprocessed_public_data.public_polynomial_table);
+
+        const auto &basic_domain = preprocessed_public_data.common_data.basic_domain;
+        polynomial_dfs_type mask_polynomial(0, basic_domain->m, typename field_type::value_type(1));
+        mask_polynomial -= preprocessed_public_data.q_last;
+        mask_polynomial -= preprocessed_public_data.q_blind;
+
+        zk::snark::detail::placeholder_column_cache<field_type> column_cache(polynomial_table, basic_domain);
+        column_cache.set_special_selectors(mask_polynomial, preprocessed_public_data.common_data.lagrange_0);
+
+        std::vector<std::uint8_t> init_blob{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+        auto prove = [&](zk::snark::detail::placeholder_column_cache<field_type> *cache) {
+            transcript_type transcript(init_blob);
+            return placeholder_gates_argument<field_type, lpc_placeholder_params_type>::prove_eval(
+                    constraint_system, polynomial_table, basic_domain,
+                    preprocessed_public_data.common_data.max_gates_degree,
+                    mask_polynomial,
+                    preprocessed_public_data.common_data.lagrange_0,
+                    transcript,
+                    cache)[0];
+        };
+
+        polynomial_dfs_type expected = prove(nullptr);
+        BOOST_CHECK(prove(&column_cache) == expected);
+
+        // The extensions are released once evaluated, only the coefficients of the columns stay.
+        const std::size_t columns_number = desc.witness_columns + desc.public_input_columns +
+                                           desc.constant_columns + desc.selector_columns + 2;
+        const std::size_t coefficients_usage = column_cache.memory_usage();
+        BOOST_CHECK(coefficients_usage <= columns_number * basic_domain->m * sizeof(typename field_type::value_type));
+        BOOST_CHECK(prove(&column_cache) == expected);
+        BOOST_CHECK_EQUAL(column_cache.memory_usage(), coefficients_usage);
+
+        // A smaller extension is read from a larger one with a stride.
+        variable_type witness(0, 0, false, variable_type::column_type::witness);
+        polynomial_dfs_type extended = polynomial_table.witness(0);
+        extended.resize(2 * basic_domain->m);
+        column_cache.get(witness, 4 * basic_domain->m);
+        std::size_t fft_count = column_cache.fft_count();
+        BOOST_CHECK(*column_cache.get(witness, 2 * basic_domain->m) == extended);
+        BOOST_CHECK_EQUAL(column_cache.fft_count(), fft_count);
+
+        // Evicted values stay valid for their holders and are recomputed on demand.
+        auto held = column_cache.get(witness, 16 * basic_domain->m);
+        column_cache.set_memory_budget(1);
+        column_cache.get(variable_type(1, 0, false, variable_type::column_type::witness), 16 * basic_domain->m);
+        BOOST_CHECK(column_cache.memory_usage() <= 17 * basic_domain->m * sizeof(typename field_type::value_type));
+        BOOST_CHECK(*column_cache.get(witness, 16 * basic_domain->m) == *held);
+        BOOST_CHECK_EQUAL(column_cache.fft_count(), fft_count + 3);
+
+        // With a spill storage evicted values are read back instead.
+        auto spill_storage = std::make_shared<zk::detail::spill_storage>(std::filesystem::temp_directory_path());
+        column_cache.set_spill_storage(spill_storage);
+        column_cache.get(variable_type(1, 0, false, variable_type::column_type::witness), 16 * basic_domain->m);
+        fft_count = column_cache.fft_count();
+        BOOST_CHECK(*column_cache.get(witness, 16 * basic_domain->m) == *held);
+        BOOST_CHECK_EQUAL(column_cache.fft_count(), fft_count);
+        BOOST_CHECK(spill_storage->bytes_spilled() >= 16 * basic_domain->m * sizeof(typename field_type::value_type));
+    }
+
 BOOST_AUTO_TEST_SUITE_END()
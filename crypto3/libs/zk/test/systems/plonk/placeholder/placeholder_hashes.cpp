@@ -27,7 +27,7 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 // SOFTWARE.
 //---------------------------------------------------------------------------//
-// Test circuit1 on different hashes: poseidon, keccak<256>, keccak<512>, sha2
+// Test circuit1 on different hashes: poseidon, keccak<256>, keccak<512>, sha2, and on the duplex-sponge transcripts
 //
 
 #define BOOST_TEST_MODULE placeholder_hashes_test
@@ -44,6 +44,7 @@
 #include <nil/crypto3/hash/poseidon.hpp>
 #include <nil/crypto3/hash/sha2.hpp>
 #include <nil/crypto3/test_tools/random_test_initializer.hpp>
+#include <nil/crypto3/zk/transcript/duplex_sponge.hpp>
 
 #include "circuits.hpp"
 #include "placeholder_test_runner.hpp"
@@ -70,13 +71,16 @@ using PallasTestRunners = boost::mpl::list<
     placeholder_test_runner<pallas_field_type, mina_poseidon_type, mina_poseidon_type>,
     placeholder_test_runner<pallas_field_type, keccak_256_type, keccak_256_type>,
     placeholder_test_runner<pallas_field_type, keccak_512_type, keccak_512_type>,
-    placeholder_test_runner<pallas_field_type, sha2_256_type, sha2_256_type>>;
+    placeholder_test_runner<pallas_field_type, sha2_256_type, sha2_256_type>,
+    placeholder_test_runner<pallas_field_type, mina_poseidon_type, transcript::duplex_sponge<mina_poseidon_type>>,
+    placeholder_test_runner<pallas_field_type, keccak_256_type, transcript::duplex_sponge<keccak_256_type>>>;
 
 using AltBnTestRunners = boost::mpl::list<
     placeholder_test_runner<alt_bn_field_type, original_poseidon_type, original_poseidon_type>,
     placeholder_test_runner<alt_bn_field_type, keccak_256_type, keccak_256_type>,
     placeholder_test_runner<alt_bn_field_type, keccak_512_type, keccak_512_type>,
-    placeholder_test_runner<alt_bn_field_type, sha2_256_type, sha2_256_type>>;
+    placeholder_test_runner<alt_bn_field_type, sha2_256_type, sha2_256_type>,
+    placeholder_test_runner<alt_bn_field_type, keccak_256_type, transcript::duplex_sponge<keccak_256_type>>>;
 
 BOOST_AUTO_TEST_CASE_TEMPLATE(hash_test_pallas, TestRunner, PallasTestRunners) {
     test_tools::random_test_initializer<pallas_field_type> random_test_initializer;
@@ -0,0 +1,159 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation <info@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+// Test the Placeholder prover under a memory budget
+//
+
+#define BOOST_TEST_MODULE placeholder_memory_budget_test
+
+#include <filesystem>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/hash/algorithm/hash.hpp>
+#include <nil/crypto3/hash/poseidon.hpp>
+#include <nil/crypto3/hash/keccak.hpp>
+
+#include <nil/crypto3/test_tools/random_test_initializer.hpp>
+
+#include "circuits.hpp"
+#include "placeholder_test_runner.hpp"
+
+template<typename TestRunnerType>
+struct memory_budget_fixture {
+    using field_type = typename TestRunnerType::field_type;
+    using placeholder_params_type = typename TestRunnerType::lpc_placeholder_params_type;
+    using lpc_scheme_type = typename TestRunnerType::lpc_scheme_type;
+    using prover_type = placeholder_prover<field_type, placeholder_params_type>;
+    using proof_type = placeholder_proof<field_type, placeholder_params_type>;
+
+    memory_budget_fixture(const typename TestRunnerType::circuit_type &circuit)
+        : runner(circuit), lpc_scheme(runner.fri_params),
+          public_data(placeholder_public_preprocessor<field_type, placeholder_params_type>::process(
+              runner.constraint_system, runner.assignments.public_table(), runner.desc, lpc_scheme)),
+          private_data(placeholder_private_preprocessor<field_type, placeholder_params_type>::process(
+              runner.constraint_system, runner.assignments.private_table(), runner.desc)) {
+    }
+
+    proof_type prove(std::size_t memory_budget, std::shared_ptr<zk::detail::spill_storage> spill_storage,
+                     bool read_checkpoints = false) {
+        prover_type prover(public_data, private_data, runner.desc, runner.constraint_system, lpc_scheme);
+        prover.set_memory_budget(memory_budget, spill_storage);
+        if (read_checkpoints) {
+            // Reads every batch of the scheme, as a checkpoint writer does.
+            prover.set_checkpoint_handler([](const typename prover_type::checkpoint_type &checkpoint) {
+                for (const auto &[index, polys] : checkpoint.commitment_scheme.polys_view()) {
+                    BOOST_CHECK(zk::detail::load_batch(polys) != nullptr);
+                }
+                for (const auto &[index, tree] : checkpoint.commitment_scheme.trees_view()) {
+                    BOOST_CHECK(zk::detail::load_batch(tree)->size() > 0);
+                }
+            });
+        }
+        proof_type proof = prover.process();
+        peak_memory_usage = prover.peak_memory_usage();
+        return proof;
+    }
+
+    bool verify(const proof_type &proof) {
+        lpc_scheme_type verifier_scheme(runner.fri_params);
+        return placeholder_verifier<field_type, placeholder_params_type>::process(
+            public_data.common_data, proof, runner.desc, runner.constraint_system, verifier_scheme);
+    }
+
+    // A budget of one byte spills everything which can be spilled, the proof must not change.
+    void check_spilled_proof() {
+        proof_type proof = prove(0, nullptr);
+
+        auto spill_storage = std::make_shared<zk::detail::spill_storage>(std::filesystem::temp_directory_path());
+        proof_type spilled_proof = prove(1, spill_storage);
+        BOOST_CHECK(spill_storage->bytes_spilled() > 0);
+        BOOST_CHECK(spilled_proof == proof);
+        BOOST_CHECK(verify(spilled_proof));
+
+        // The scheme passed to the prover keeps its batches.
+        BOOST_CHECK(!lpc_scheme.has_spilled_batches());
+    }
+
+    // A budget between the peaks with and without spilling must hold, checkpoints included.
+    void check_memory_peak() {
+        proof_type proof = prove(0, nullptr);
+        const std::size_t unlimited_peak = peak_memory_usage;
+
+        auto spill_storage = std::make_shared<zk::detail::spill_storage>(std::filesystem::temp_directory_path());
+        prove(1, spill_storage);
+        const std::size_t spilled_peak = peak_memory_usage;
+        BOOST_CHECK(spilled_peak < unlimited_peak);
+
+        const std::size_t memory_budget = (unlimited_peak + spilled_peak) / 2;
+        spill_storage = std::make_shared<zk::detail::spill_storage>(std::filesystem::temp_directory_path());
+        proof_type budget_proof = prove(memory_budget, spill_storage, true);
+        BOOST_CHECK(spill_storage->bytes_spilled() > 0);
+        BOOST_CHECK_LE(peak_memory_usage, memory_budget);
+        BOOST_CHECK(budget_proof == proof);
+    }
+
+    TestRunnerType runner;
+    lpc_scheme_type lpc_scheme;
+    typename placeholder_public_preprocessor<field_type, placeholder_params_type>::preprocessed_data_type public_data;
+    typename placeholder_private_preprocessor<field_type, placeholder_params_type>::preprocessed_data_type private_data;
+    // Of the last call to prove().
+    std::size_t peak_memory_usage = 0;
+};
+
+BOOST_AUTO_TEST_SUITE(placeholder_memory_budget)
+
+    using curve_type = algebra::curves::pallas;
+    using field_type = typename curve_type::base_field_type;
+    using poseidon_type = hashes::poseidon<nil::crypto3::hashes::detail::mina_poseidon_policy<field_type>>;
+    using keccak_type = hashes::keccak_1600<256>;
+
+    BOOST_AUTO_TEST_CASE(spill_with_copy_constraints)
+    {
+        using test_runner_type = placeholder_test_runner<field_type, poseidon_type, poseidon_type>;
+
+        test_tools::random_test_initializer<field_type> random_test_initializer;
+        auto circuit = circuit_test_1<field_type>(
+                random_test_initializer.alg_random_engines.template get_alg_engine<field_type>(),
+                random_test_initializer.generic_random_engine
+        );
+        memory_budget_fixture<test_runner_type> fixture(circuit);
+        fixture.check_spilled_proof();
+        fixture.check_memory_peak();
+    }
+
+    BOOST_AUTO_TEST_CASE(spill_with_lookups)
+    {
+        using test_runner_type = placeholder_test_runner<field_type, keccak_type, keccak_type>;
+
+        test_tools::random_test_initializer<field_type> random_test_initializer;
+        auto circuit = circuit_test_3<field_type>(
+                random_test_initializer.alg_random_engines.template get_alg_engine<field_type>(),
+                random_test_initializer.generic_random_engine
+        );
+        memory_budget_fixture<test_runner_type> fixture(circuit);
+        fixture.check_spilled_proof();
+        fixture.check_memory_peak();
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
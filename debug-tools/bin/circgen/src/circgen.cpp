@@ -50,6 +50,8 @@
 #include <nil/crypto3/marshalling/zk/types/plonk/assignment_table.hpp>
 #include <nil/crypto3/marshalling/zk/types/plonk/constraint_system.hpp>
 
+#include "synthetic_circuit.hpp"
+
 namespace po = boost::program_options;
 
 void usage(po::options_description const& desc)
@@ -83,6 +85,22 @@ Explanation:
    0
 
 The gate is enabled (with selector column) on rows from 1 to N-2.
+
+With --workload=synthetic a random circuit of the given shape is generated
+instead, for benchmarking the prover. Witness columns are split into free
+columns with random values and output columns computed by the gates:
+
+    c0 + c1 * x + c2 * y_1 * ... * y_d - out == 0
+
+where x and y_i are free cells of the current or the neighbour rows and d is
+--gate-degree. Gates are distributed over --gate-selectors selectors enabled
+on interleaved rows. Lookup tables live in the constant columns, lookups copy
+random table rows into the first --lookup-columns witness columns on a
+--lookup-density share of rows. --copy-density copy constraints per row tie
+random free cells together, and every public input is copied to a witness
+cell. The same options and --seed always give the same files.
+
+Use --log-rows=K to get a padded table of exactly 2^K rows.
 )#" << std::endl;
 
     std::cout << desc << std::endl;
@@ -161,8 +179,8 @@ generate_circuit(
     selectors_assignment[0] = table[2];
 
     auto circuit_table = plonk_assignment_table<FieldType>(
-            plonk_private_assignment_table<FieldType>(private_assignment),
-    plonk_public_assignment_table<FieldType>(
+            std::make_shared<plonk_private_assignment_table<FieldType>>(private_assignment),
+            std::make_shared<plonk_public_assignment_table<FieldType>>(
                 public_input_assignment, constant_assignment, selectors_assignment));
     auto padded_rows = zk_padding<FieldType, plonk_column<FieldType>>(circuit_table, alg_rnd);
     BOOST_LOG_TRIVIAL(info) << "Rows after padding: " << padded_rows;
@@ -211,9 +229,9 @@ bool encode_marshalling_to_file(
     std::vector<std::uint8_t> v;
     v.resize(data_for_marshalling.length(), 0x00);
     auto write_iter = v.begin();
-    nil::marshalling::status_type status = data_for_marshalling.write(write_iter, v.size());
+    nil::crypto3::marshalling::status_type status = data_for_marshalling.write(write_iter, v.size());
 
-    if (status != nil::marshalling::status_type::success) {
+    if (status != nil::crypto3::marshalling::status_type::success) {
         BOOST_LOG_TRIVIAL(error) << "Marshalled structure encoding failed";
         return false;
     }
@@ -229,8 +247,11 @@ bool encode_marshalling_to_file(
 
 struct circgen_options {
     std::string field;
+    std::string workload;
     std::size_t rows;
+    std::size_t log_rows;
     std::string a, b;
+    synthetic_circuit_params synthetic;
     boost::filesystem::path output_dir, circuit, assignment_table;
 };
 
@@ -238,14 +259,14 @@ struct circgen_options {
 template<typename circuit_field>
 int run_main(circgen_options const& opts)
 {
-    using endianness = nil::marshalling::option::big_endian;
+    using endianness = nil::crypto3::marshalling::option::big_endian;
 
     using constraint_system = plonk_constraint_system<circuit_field>;
     using assignment_table = plonk_assignment_table<circuit_field>;
     using column = nil::crypto3::zk::snark::plonk_column<circuit_field>;
     using plonk_table = nil::crypto3::zk::snark::plonk_table<circuit_field, column>;
 
-    using marshalling_field_type = nil::marshalling::field_type<endianness>;
+    using marshalling_field_type = nil::crypto3::marshalling::field_type<endianness>;
     using mcs = nil::crypto3::marshalling::types::plonk_constraint_system<marshalling_field_type, constraint_system>;
     using mat = nil::crypto3::marshalling::types::plonk_assignment_table<marshalling_field_type, assignment_table>;
 
@@ -261,12 +282,26 @@ int run_main(circgen_options const& opts)
         }
     }
 
-    value_type a (integral_type(opts.a)), b (integral_type(opts.b));
-
     BOOST_LOG_TRIVIAL(info) << "Generating circuit and assignment table for " << opts.rows << " rows.";
-    BOOST_LOG_TRIVIAL(info) << "Public inputs: a = " << a << ", b = " << b;
 
-    auto circuit = generate_circuit<circuit_field>(opts.rows, a, b);
+    std::pair<constraint_system, assignment_table> circuit;
+    if (opts.workload == "fibonacci") {
+        value_type a (integral_type(opts.a)), b (integral_type(opts.b));
+        BOOST_LOG_TRIVIAL(info) << "Public inputs: a = " << a << ", b = " << b;
+        circuit = generate_circuit<circuit_field>(opts.rows, a, b);
+    } else if (opts.workload == "synthetic") {
+        synthetic_circuit_params params = opts.synthetic;
+        params.rows = opts.rows;
+        try {
+            circuit = generate_synthetic_circuit<circuit_field>(params);
+        } catch (const std::invalid_argument& e) {
+            BOOST_LOG_TRIVIAL(error) << e.what();
+            return 1;
+        }
+    } else {
+        BOOST_LOG_TRIVIAL(error) << "Unknown workload: '" << opts.workload << "'";
+        return 1;
+    }
 
     mcs marshalled_cs = nil::crypto3::marshalling::types::fill_plonk_constraint_system<endianness>(circuit.first);
     mat marshalled_at = nil::crypto3::marshalling::types::fill_assignment_table<endianness, plonk_table>(opts.rows, circuit.second);
@@ -294,9 +329,25 @@ po::options_description define_options(circgen_options &opts)
     desc.add_options()
         ("help", "Print help")
         ("field", make_defaulted_option(opts.field), "Circuit field")
+        ("workload", make_defaulted_option(opts.workload), "Circuit to generate: fibonacci or synthetic")
         ("rows", make_defaulted_option(opts.rows), "Number of rows to generate")
-        ("a", make_defaulted_option(opts.a), "Public input a")
-        ("b", make_defaulted_option(opts.b), "Public input b")
+        ("log-rows", make_defaulted_option(opts.log_rows), "Generate 2^K - 1 rows, padded to 2^K (overrides --rows)")
+        ("a", make_defaulted_option(opts.a), "Public input a (fibonacci)")
+        ("b", make_defaulted_option(opts.b), "Public input b (fibonacci)")
+        ("witness-columns", make_defaulted_option(opts.synthetic.witness_columns), "Witness columns (synthetic)")
+        ("public-input-columns", make_defaulted_option(opts.synthetic.public_input_columns), "Public input columns (synthetic)")
+        ("public-inputs", make_defaulted_option(opts.synthetic.public_inputs), "Values in each public input column (synthetic)")
+        ("constant-columns", make_defaulted_option(opts.synthetic.constant_columns), "Random constant columns besides the lookup tables (synthetic)")
+        ("gates", make_defaulted_option(opts.synthetic.gates), "Number of gates (synthetic)")
+        ("gate-selectors", make_defaulted_option(opts.synthetic.gate_selectors), "Number of gate selectors (synthetic)")
+        ("gate-degree", make_defaulted_option(opts.synthetic.gate_degree), "Degree of gate constraints without the selector (synthetic)")
+        ("constraints-per-gate", make_defaulted_option(opts.synthetic.constraints_per_gate), "Constraints in each gate (synthetic)")
+        ("copy-density", make_defaulted_option(opts.synthetic.copy_density), "Copy constraints per row (synthetic)")
+        ("lookup-tables", make_defaulted_option(opts.synthetic.lookup_tables), "Number of lookup tables (synthetic)")
+        ("lookup-table-size", make_defaulted_option(opts.synthetic.lookup_table_size), "Rows in each lookup table (synthetic)")
+        ("lookup-columns", make_defaulted_option(opts.synthetic.lookup_columns), "Columns in each lookup table (synthetic)")
+        ("lookup-density", make_defaulted_option(opts.synthetic.lookup_density), "Share of rows with a lookup (synthetic)")
+        ("seed", make_defaulted_option(opts.synthetic.seed), "Random seed (synthetic)")
         ("output-dir", make_defaulted_option(opts.output_dir), "Output directory")
         ("circuit", make_defaulted_option(opts.circuit), "Circuit filename")
         ("assignment", make_defaulted_option(opts.assignment_table), "Assignment table filename")
@@ -311,9 +362,28 @@ int main(int argc, char *argv[])
 
     circgen_options opts {
         .field = "pallas",
+        .workload = "fibonacci",
         .rows = 127,
+        .log_rows = 0,
         .a = "1",
         .b = "1",
+        .synthetic = {
+            .rows = 0,
+            .witness_columns = 15,
+            .public_input_columns = 1,
+            .public_inputs = 2,
+            .constant_columns = 0,
+            .gates = 8,
+            .gate_selectors = 4,
+            .gate_degree = 3,
+            .constraints_per_gate = 1,
+            .copy_density = 0.25,
+            .lookup_tables = 1,
+            .lookup_table_size = 256,
+            .lookup_columns = 2,
+            .lookup_density = 0.25,
+            .seed = 0
+        },
         .output_dir = ".",
         .circuit = "circuit.crct",
         .assignment_table = "assignment.tbl"
@@ -330,6 +400,14 @@ int main(int argc, char *argv[])
         return 0;
     }
 
+    if (opts.log_rows != 0) {
+        if (opts.log_rows < 3 || opts.log_rows > 31) {
+            std::cerr << "--log-rows must be between 3 and 31" << std::endl;
+            return 1;
+        }
+        opts.rows = (std::size_t(1) << opts.log_rows) - 1;
+    }
+
     if (opts.field == "bn_base") {
         using curve_type = nil::crypto3::algebra::curves::alt_bn128_254;
         using circuit_field = typename curve_type::base_field_type;
@@ -0,0 +1,334 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation <info@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CIRCGEN_SYNTHETIC_CIRCUIT_HPP
+#define CIRCGEN_SYNTHETIC_CIRCUIT_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/log/trivial.hpp>
+#include <boost/random/bernoulli_distribution.hpp>
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
+
+#include <nil/crypto3/random/algebraic_engine.hpp>
+
+#include <nil/crypto3/zk/snark/arithmetization/plonk/assignment.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/plonk/constraint_system.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/plonk/copy_constraint.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/plonk/gate.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/plonk/lookup_constraint.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/plonk/lookup_gate.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/plonk/lookup_table.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/plonk/padding.hpp>
+
+/**
+ * Shape of a synthetic circuit. Everything random in the circuit and the assignment table is derived from seed,
+ * the same parameters always give the same files.
+ */
+struct synthetic_circuit_params {
+    std::size_t rows;                   // usable rows, the table is padded to the next power of two
+    std::size_t witness_columns;
+    std::size_t public_input_columns;
+    std::size_t public_inputs;          // values in each public input column, copied into the witness
+    std::size_t constant_columns;       // besides the lookup table columns
+    std::size_t gates;
+    std::size_t gate_selectors;
+    std::size_t gate_degree;            // degree of a constraint without its selector
+    std::size_t constraints_per_gate;
+    double copy_density;                // copy constraints per row
+    std::size_t lookup_tables;
+    std::size_t lookup_table_size;      // rows in each lookup table
+    std::size_t lookup_columns;
+    double lookup_density;              // share of rows with a lookup
+    std::uint64_t seed;
+};
+
+/**
+ * Witness columns are split into output columns followed by free columns filled with random values. Every gate
+ * constraint computes one output cell from the free cells of the current and the neighbour rows:
+ *
+ *     c0 + c1 * x + c2 * y_1 * ... * y_degree - out == 0
+ *
+ * Gate g uses selector g % gate_selectors, selector s is enabled on rows 1 .. rows-2 with row % gate_selectors == s,
+ * so every output cell is written by at most one constraint.
+ *
+ * Lookup tables are stacked in the constant columns after the reserved zero row, each one with its own tag selector.
+ * Row 0 of the table column holds the index of the table row, the others are random. A lookup copies a random
+ * table row to the first lookup_columns free columns and enables the lookup selector of its table on that row.
+ *
+ * Copy constraints and public input copies connect free cells not used by anything else, so no cell needs two values.
+ */
+template<typename FieldType>
+std::pair<nil::crypto3::zk::snark::plonk_constraint_system<FieldType>,
+          nil::crypto3::zk::snark::plonk_assignment_table<FieldType>>
+generate_synthetic_circuit(synthetic_circuit_params const& params)
+{
+    using namespace nil::crypto3::zk::snark;
+
+    using value_type = typename FieldType::value_type;
+    using variable_type = plonk_variable<value_type>;
+    using constraint_type = plonk_constraint<FieldType>;
+    using term_type = typename constraint_type::term_type;
+    using gate_type = plonk_gate<FieldType, constraint_type>;
+    using lookup_constraint_type = plonk_lookup_constraint<FieldType>;
+    using lookup_gate_type = plonk_lookup_gate<FieldType, lookup_constraint_type>;
+
+    const std::size_t rows = params.rows;
+    const std::size_t gate_selectors = std::min(params.gate_selectors, params.gates);
+    const std::size_t output_columns = params.gates == 0 ? 0 :
+        (params.gates + gate_selectors - 1) / gate_selectors * params.constraints_per_gate;
+    const std::size_t free_columns = params.witness_columns - std::min(params.witness_columns, output_columns);
+    const std::size_t lookup_columns = params.lookup_tables == 0 ? 0 : params.lookup_columns;
+    const std::size_t constant_columns = lookup_columns + params.constant_columns;
+    const std::size_t selector_columns = gate_selectors + 2 * params.lookup_tables;
+
+    if (rows < 4) {
+        throw std::invalid_argument("Synthetic circuit needs at least 4 rows");
+    }
+    if (params.gates != 0 && (gate_selectors == 0 || params.constraints_per_gate == 0 || params.gate_degree == 0)) {
+        throw std::invalid_argument("Gate selectors, constraints per gate and gate degree must be positive");
+    }
+    if (free_columns == 0 || free_columns < lookup_columns) {
+        throw std::invalid_argument(
+            "Not enough witness columns: " + std::to_string(output_columns) + " are gate outputs, " +
+            std::to_string(std::max<std::size_t>(lookup_columns, 1)) + " more are needed for the inputs");
+    }
+    if (params.lookup_tables != 0 &&
+        (lookup_columns == 0 || params.lookup_table_size == 0 ||
+         1 + params.lookup_tables * params.lookup_table_size > rows)) {
+        throw std::invalid_argument("Lookup tables must be non-empty and fit into the usable rows");
+    }
+    if (params.public_inputs > rows) {
+        throw std::invalid_argument("More public inputs than rows");
+    }
+
+    boost::random::mt19937_64 gen(params.seed);
+    // The field element engine takes 32-bit seeds, both halves of the seed go into it.
+    std::seed_seq engine_seed{static_cast<std::uint32_t>(params.seed), static_cast<std::uint32_t>(params.seed >> 32)};
+    nil::crypto3::random::algebraic_engine<FieldType> alg_rnd(engine_seed);
+    auto uniform = [&gen](std::size_t bound) {
+        return boost::random::uniform_int_distribution<std::size_t>(0, bound - 1)(gen);
+    };
+
+    std::vector<plonk_column<FieldType>> witnesses(params.witness_columns, plonk_column<FieldType>(rows));
+    std::vector<plonk_column<FieldType>> public_inputs(params.public_input_columns, plonk_column<FieldType>(rows));
+    std::vector<plonk_column<FieldType>> constants(constant_columns, plonk_column<FieldType>(rows));
+    std::vector<plonk_column<FieldType>> selectors(selector_columns, plonk_column<FieldType>(rows));
+
+    for (auto& column : witnesses) {
+        for (auto& value : column) {
+            value = alg_rnd();
+        }
+    }
+    for (std::size_t i = lookup_columns; i < constant_columns; ++i) {
+        for (auto& value : constants[i]) {
+            value = alg_rnd();
+        }
+    }
+
+    // Free cells already bound by a lookup or a copy constraint.
+    std::vector<bool> used(free_columns * rows, false);
+    auto cell = [rows](std::size_t column, std::size_t row) { return column * rows + row; };
+
+    /* Lookup tables and lookups */
+    std::vector<plonk_lookup_table<FieldType>> lookup_tables;
+    std::vector<lookup_gate_type> lookup_gates;
+    std::size_t lookups = 0;
+    if (params.lookup_tables != 0) {
+        const std::size_t lookup_selector = gate_selectors;
+        const std::size_t tag_selector = gate_selectors + params.lookup_tables;
+
+        std::vector<variable_type> lookup_inputs, table_columns;
+        for (std::size_t i = 0; i < lookup_columns; ++i) {
+            lookup_inputs.emplace_back(output_columns + i, 0, true, variable_type::column_type::witness);
+            table_columns.emplace_back(i, 0, true, variable_type::column_type::constant);
+        }
+
+        for (std::size_t t = 0; t < params.lookup_tables; ++t) {
+            const std::size_t start = 1 + t * params.lookup_table_size;
+            for (std::size_t i = 0; i < params.lookup_table_size; ++i) {
+                constants[0][start + i] = value_type(i);
+                for (std::size_t j = 1; j < lookup_columns; ++j) {
+                    constants[j][start + i] = alg_rnd();
+                }
+                selectors[tag_selector + t][start + i] = value_type::one();
+            }
+
+            plonk_lookup_table<FieldType> table(lookup_columns, tag_selector + t);
+            table.append_option(table_columns);
+            lookup_tables.push_back(table);
+
+            lookup_constraint_type lookup_constraint;
+            for (const auto& input : lookup_inputs) {
+                lookup_constraint.lookup_input.push_back(input);
+            }
+            lookup_constraint.table_id = t + 1;
+            lookup_gates.emplace_back(lookup_selector + t, std::vector<lookup_constraint_type>{lookup_constraint});
+        }
+
+        boost::random::bernoulli_distribution<double> has_lookup(params.lookup_density);
+        for (std::size_t row = 0; row < rows; ++row) {
+            if (!has_lookup(gen)) {
+                continue;
+            }
+            const std::size_t t = uniform(params.lookup_tables);
+            const std::size_t table_row = 1 + t * params.lookup_table_size + uniform(params.lookup_table_size);
+            for (std::size_t j = 0; j < lookup_columns; ++j) {
+                witnesses[output_columns + j][row] = constants[j][table_row];
+                used[cell(j, row)] = true;
+            }
+            selectors[lookup_selector + t][row] = value_type::one();
+            ++lookups;
+        }
+    }
+
+    /* Public inputs and copy constraints */
+    auto pick_free_cell = [&]() -> std::optional<std::pair<std::size_t, std::size_t>> {
+        // Give up after a few tries, the density is approximate anyway.
+        for (std::size_t attempt = 0; attempt < 16; ++attempt) {
+            const std::size_t column = uniform(free_columns);
+            const std::size_t row = uniform(rows);
+            if (!used[cell(column, row)]) {
+                used[cell(column, row)] = true;
+                return std::make_pair(output_columns + column, row);
+            }
+        }
+        return std::nullopt;
+    };
+
+    std::vector<plonk_copy_constraint<FieldType>> copy_constraints;
+    for (std::size_t i = 0; i < params.public_input_columns; ++i) {
+        for (std::size_t row = 0; row < params.public_inputs; ++row) {
+            auto target = pick_free_cell();
+            if (!target) {
+                throw std::invalid_argument("Not enough free witness cells for the public inputs");
+            }
+            public_inputs[i][row] = alg_rnd();
+            witnesses[target->first][target->second] = public_inputs[i][row];
+            copy_constraints.emplace_back(
+                variable_type(target->first, target->second, false, variable_type::column_type::witness),
+                variable_type(i, row, false, variable_type::column_type::public_input));
+        }
+    }
+
+    const std::size_t copy_constraints_amount = static_cast<std::size_t>(params.copy_density * rows);
+    for (std::size_t i = 0; i < copy_constraints_amount; ++i) {
+        auto source = pick_free_cell();
+        auto target = source ? pick_free_cell() : std::nullopt;
+        if (!target) {
+            continue;
+        }
+        witnesses[target->first][target->second] = witnesses[source->first][source->second];
+        copy_constraints.emplace_back(
+            variable_type(target->first, target->second, false, variable_type::column_type::witness),
+            variable_type(source->first, source->second, false, variable_type::column_type::witness));
+    }
+
+    /* Gates */
+    struct synthetic_constraint {
+        std::size_t output;
+        value_type c0, c1, c2;
+        std::pair<std::size_t, int> x;
+        std::vector<std::pair<std::size_t, int>> y;
+    };
+    auto random_input = [&]() {
+        return std::make_pair(output_columns + uniform(free_columns), static_cast<int>(uniform(3)) - 1);
+    };
+    auto input_variable = [](const std::pair<std::size_t, int>& input) {
+        return variable_type(input.first, input.second, true, variable_type::column_type::witness);
+    };
+
+    std::vector<std::vector<synthetic_constraint>> gate_constraints(params.gates);
+    std::vector<gate_type> gates;
+    for (std::size_t g = 0; g < params.gates; ++g) {
+        std::vector<constraint_type> constraints;
+        for (std::size_t j = 0; j < params.constraints_per_gate; ++j) {
+            synthetic_constraint c {(g / gate_selectors) * params.constraints_per_gate + j,
+                                    alg_rnd(), alg_rnd(), alg_rnd(), random_input(), {}};
+            std::vector<variable_type> y_variables;
+            for (std::size_t k = 0; k < params.gate_degree; ++k) {
+                c.y.push_back(random_input());
+                y_variables.push_back(input_variable(c.y.back()));
+            }
+
+            constraint_type constraint;
+            constraint += term_type(c.c0);
+            constraint += term_type({input_variable(c.x)}, c.c1);
+            constraint += term_type(y_variables, c.c2);
+            constraint -= term_type(variable_type(c.output, 0, true, variable_type::column_type::witness));
+            constraints.push_back(constraint);
+            gate_constraints[g].push_back(std::move(c));
+        }
+        gates.emplace_back(g % gate_selectors, constraints);
+    }
+
+    // Free columns are final now, outputs only read them.
+    for (std::size_t row = 1; row + 1 < rows && params.gates != 0; ++row) {
+        const std::size_t selector = row % gate_selectors;
+        selectors[selector][row] = value_type::one();
+        for (std::size_t g = selector; g < params.gates; g += gate_selectors) {
+            for (const auto& c : gate_constraints[g]) {
+                auto at = [&](const std::pair<std::size_t, int>& input) -> const value_type& {
+                    return witnesses[input.first][row + input.second];
+                };
+                value_type product = c.c2;
+                for (const auto& y : c.y) {
+                    product *= at(y);
+                }
+                witnesses[c.output][row] = c.c0 + c.c1 * at(c.x) + product;
+            }
+        }
+    }
+
+    BOOST_LOG_TRIVIAL(info) << "Synthetic circuit: " << params.witness_columns << " witness (" << output_columns
+                            << " output), " << params.public_input_columns << " public input, "
+                            << constant_columns << " constant, " << selector_columns << " selector columns";
+    BOOST_LOG_TRIVIAL(info) << params.gates << " gates of degree " << params.gate_degree + 1 << " with "
+                            << params.constraints_per_gate << " constraints each, " << copy_constraints.size()
+                            << " copy constraints, " << lookups << " lookups into " << params.lookup_tables
+                            << " tables";
+
+    auto circuit_table = plonk_assignment_table<FieldType>(
+        std::make_shared<plonk_private_assignment_table<FieldType>>(std::move(witnesses)),
+        std::make_shared<plonk_public_assignment_table<FieldType>>(std::move(public_inputs), std::move(constants),
+                                                                   std::move(selectors)));
+    auto padded_rows = zk_padding<FieldType, plonk_column<FieldType>>(circuit_table, alg_rnd);
+    BOOST_LOG_TRIVIAL(info) << "Rows after padding: " << padded_rows;
+
+    plonk_constraint_system<FieldType> cs(gates, copy_constraints, lookup_gates, lookup_tables);
+
+    return {cs, circuit_table};
+}
+
+#endif // CIRCGEN_SYNTHETIC_CIRCUIT_HPP
@@ -0,0 +1,143 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation <info@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+#define BOOST_TEST_MODULE merkle_tree_benchmark
+
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/pallas.hpp>
+
+#include <nil/crypto3/hash/algorithm/hash.hpp>
+#include <nil/crypto3/hash/keccak.hpp>
+#include <nil/crypto3/hash/poseidon.hpp>
+#include <nil/crypto3/hash/sha2.hpp>
+#include <nil/crypto3/hash/two_to_one_compressor.hpp>
+
+#include <nil/crypto3/container/merkle/tree.hpp>
+
+#include <nil/actor/core/parallelization_utils.hpp>
+
+#include <nil/crypto3/bench/benchmark_test_case.hpp>
+
+using namespace nil::crypto3;
+
+// Builds the interior nodes of binary Merkle trees over 2^20 .. 2^26 leaves, once hashing each node through the
+// accumulator, as before, and once through the fixed-length compression, and reports the nodes hashed per second
+// for every size. Both builds overwrite the interior nodes of the same tree, 4 GiB for 2^26 leaves of 32-byte
+// digests. MERKLE_BENCHMARK_MAX_LOG_LEAVES lowers the largest size for a quicker run.
+struct merkle_tree_fixture {
+    const std::size_t MIN_LOG_LEAVES = 20;
+    const std::size_t MAX_LOG_LEAVES = max_log_leaves();
+
+    static std::size_t max_log_leaves() {
+        const char *value = std::getenv("MERKLE_BENCHMARK_MAX_LOG_LEAVES");
+        return value != nullptr ? std::stoul(value) : 26;
+    }
+
+    template<typename Hash>
+    static std::vector<typename Hash::digest_type> make_tree(std::size_t leaves) {
+        std::vector<typename Hash::digest_type> tree(2 * leaves - 1);
+        parallel_for(0, leaves, [&tree](std::size_t i) {
+            if constexpr (algebra::is_field_element<typename Hash::digest_type>::value) {
+                tree[i] = typename Hash::digest_type(i);
+            } else {
+                std::array<std::uint8_t, sizeof(std::uint64_t)> leaf;
+                for (std::size_t j = 0; j < leaf.size(); ++j) {
+                    leaf[j] = static_cast<std::uint8_t>(i >> (8 * j));
+                }
+                tree[i] = nil::crypto3::hash<Hash>(leaf);
+            }
+        });
+        return tree;
+    }
+
+    template<typename Hash, typename NodeHash>
+    static void build_levels(std::vector<typename Hash::digest_type> &tree, std::size_t leaves, NodeHash node_hash) {
+        std::size_t row_begin = 0;
+        for (std::size_t row_size = leaves / 2; row_size > 0; row_size /= 2) {
+            const std::size_t next_row_begin = row_begin + 2 * row_size;
+            parallel_for(0, row_size, [&tree, &node_hash, row_begin, next_row_begin](std::size_t i) {
+                tree[next_row_begin + i] = node_hash(tree.begin() + row_begin + 2 * i);
+            });
+            row_begin = next_row_begin;
+        }
+    }
+
+    template<typename Hash>
+    void run(test_case_base &test_case, const std::string &name, std::size_t max_log_leaves) const {
+        using iterator = typename std::vector<typename Hash::digest_type>::iterator;
+        for (std::size_t log_leaves = MIN_LOG_LEAVES; log_leaves <= max_log_leaves; ++log_leaves) {
+            const std::size_t leaves = std::size_t(1) << log_leaves;
+            const std::string size = " 2^" + std::to_string(log_leaves);
+            auto tree = make_tree<Hash>(leaves);
+
+            const std::string accumulator_flag = name + size + " accumulator";
+            test_case.timers[accumulator_flag].start();
+            build_levels<Hash>(tree, leaves, [](iterator it) {
+                return containers::detail::generate_hash<Hash>(it, it + 2);
+            });
+            test_case.timers[accumulator_flag].stop();
+            const auto root = tree.back();
+
+            const std::string compression_flag = name + size + " compression";
+            test_case.timers[compression_flag].start();
+            build_levels<Hash>(tree, leaves, [](iterator it) {
+                return containers::detail::generate_node_hash<Hash, 2>(it);
+            });
+            test_case.timers[compression_flag].stop();
+
+            BOOST_CHECK(tree.back() == root);
+            for (const auto &flag : {accumulator_flag, compression_flag}) {
+                std::cout << flag << ": " << std::fixed << std::setprecision(0)
+                          << (leaves - 1) / (test_case.timers[flag].elapsed().wall * 1.0e-9) << " nodes/s\n";
+            }
+        }
+    }
+};
+
+BOOST_FIXTURE_TEST_SUITE(merkle_tree_benchmark_test_suite, merkle_tree_fixture)
+
+BENCHMARK_AUTO_TEST_CASE(keccak_256_test, 3) {
+    run<hashes::keccak_1600<256>>(*this, "keccak_256", MAX_LOG_LEAVES);
+}
+
+BENCHMARK_AUTO_TEST_CASE(sha2_256_test, 3) {
+    run<hashes::sha2<256>>(*this, "sha2_256", MAX_LOG_LEAVES);
+}
+
+BENCHMARK_AUTO_TEST_CASE(poseidon_test, 1) {
+    using field_type = algebra::curves::pallas::base_field_type;
+    run<hashes::poseidon<hashes::detail::mina_poseidon_policy<field_type>>>(*this, "poseidon", MAX_LOG_LEAVES);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,118 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation <info@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+#define BOOST_TEST_MODULE merkle_tree_benchmark
+#define BOOST_TEST_MODULE multiexp_benchmark
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/algebra/curves/alt_bn128.hpp>
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/multiexp/multiexp.hpp>
+#include <nil/crypto3/algebra/multiexp/policies.hpp>
+#include <nil/crypto3/algebra/random_element.hpp>
+
+#include <nil/actor/core/parallelization_utils.hpp>
+
+using namespace nil::crypto3;
+using namespace nil::crypto3::algebra;
+
+// Sizes are 2^16..2^MULTIEXP_BENCHMARK_MAX_LOG_SIZE, 2^22 by default.
+std::size_t max_log_size() {
+    const char* value = std::getenv("MULTIEXP_BENCHMARK_MAX_LOG_SIZE");
+    return value != nullptr ? std::stoul(value) : 22;
+}
+
+// Consecutive multiples of a random point: cheap to generate, but unlike a repeated point they do not make every
+// bucket addition a doubling.
+template<typename GroupType>
+std::vector<typename GroupType::value_type> generate_distinct_group_elements(std::size_t size) {
+    std::vector<typename GroupType::value_type> result(size);
+    typename GroupType::value_type x = random_element<GroupType>();
+    result[0] = x;
+    for (std::size_t i = 1; i < size; i++) {
+        result[i] = result[i - 1] + x;
+    }
+    return result;
+}
+
+template<typename MultiexpMethod, typename GroupValueType, typename FieldValueType>
+GroupValueType timed_multiexp(const std::vector<GroupValueType>& bases, const std::vector<FieldValueType>& scalars,
+                              long long& milliseconds) {
+    auto start = std::chrono::high_resolution_clock::now();
+    GroupValueType result =
+        multiexp<MultiexpMethod>(bases.cbegin(), bases.cend(), scalars.cbegin(), scalars.cend(), 1);
+    milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::high_resolution_clock::now() - start).count();
+    return result;
+}
+
+// BDLO12 is only run up to 2^18 points as a reference, above that it takes minutes per size.
+template<typename GroupType, typename FieldType>
+void compare_pippenger(std::size_t expn_start, std::size_t expn_end) {
+    using pool_pippenger = policies::basic_multiexp_method_pippenger<thread_pool_tasks<>>;
+    constexpr std::size_t expn_end_bdlo12 = 18;
+
+    std::printf("%zu threads\n", thread_pool_tasks<>::workers_count());
+    std::printf("log2(n)\tBDLO12, ms\tPippenger 1 thread, ms\tPippenger on thread pool, ms\n");
+    for (std::size_t expn = expn_start; expn <= expn_end; expn++) {
+        std::vector<typename GroupType::value_type> bases = generate_distinct_group_elements<GroupType>(1 << expn);
+        std::vector<typename FieldType::value_type> scalars(1 << expn);
+        for (auto& scalar : scalars) {
+            scalar = random_element<FieldType>();
+        }
+
+        long long sequential_ms, pool_ms, bdlo12_ms;
+        auto sequential_result = timed_multiexp<policies::multiexp_method_pippenger>(bases, scalars, sequential_ms);
+        auto pool_result = timed_multiexp<pool_pippenger>(bases, scalars, pool_ms);
+        BOOST_CHECK(sequential_result == pool_result);
+
+        std::string bdlo12_column = "-";
+        if (expn <= expn_end_bdlo12) {
+            auto bdlo12_result = timed_multiexp<policies::multiexp_method_BDLO12>(bases, scalars, bdlo12_ms);
+            BOOST_CHECK(bdlo12_result == pool_result);
+            bdlo12_column = std::to_string(bdlo12_ms);
+        }
+        std::printf("%zu\t%s\t%lld\t%lld\n", expn, bdlo12_column.c_str(), sequential_ms, pool_ms);
+        std::fflush(stdout);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(multiexp_benchmark_test_suite)
+
+BOOST_AUTO_TEST_CASE(pippenger_bls12_381_g1) {
+    compare_pippenger<curves::bls12<381>::g1_type<>, curves::bls12<381>::scalar_field_type>(16, max_log_size());
+}
+
+BOOST_AUTO_TEST_CASE(pippenger_alt_bn128_g1) {
+    compare_pippenger<curves::alt_bn128<254>::g1_type<>, curves::alt_bn128<254>::scalar_field_type>(
+        16, max_log_size());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
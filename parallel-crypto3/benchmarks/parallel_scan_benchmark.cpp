@@ -0,0 +1,107 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation <info@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+#define BOOST_TEST_MODULE parallel_scan_benchmark
+
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/algebra/fields/arithmetic_params/bls12.hpp>
+#include <nil/crypto3/random/algebraic_engine.hpp>
+
+#include <nil/actor/core/parallelization_utils.hpp>
+
+#include <nil/crypto3/bench/benchmark_test_case.hpp>
+
+using namespace nil::crypto3;
+
+struct F {
+    using FieldType = algebra::fields::bls12_fr<381>;
+    using value_type = typename FieldType::value_type;
+    const std::size_t SEED = 1337;
+    // The size of a grand product of a circuit with 2^22 rows.
+    const std::size_t SIZE = 1 << 22;
+
+    F() : alg_rnd_engine(SEED) {
+        values.reserve(SIZE);
+        for (std::size_t i = 0; i < SIZE; ++i) {
+            values.emplace_back(alg_rnd_engine());
+        }
+    }
+
+    random::algebraic_engine<FieldType> alg_rnd_engine;
+    std::vector<value_type> values;
+};
+
+BOOST_FIXTURE_TEST_SUITE(parallel_scan_benchmark_test_suite, F)
+
+BENCHMARK_AUTO_TEST_CASE(grand_product_scan_test, 10) {
+    std::vector<value_type> serial(SIZE);
+    START_TIMER("grand_product_serial")
+    std::inclusive_scan(values.begin(), values.end(), serial.begin(), std::multiplies<value_type>());
+    STOP_TIMER("grand_product_serial")
+
+    std::vector<value_type> parallel(SIZE);
+    START_TIMER("grand_product_parallel")
+    parallel_inclusive_scan(values.begin(), values.end(), parallel.begin(), std::multiplies<value_type>());
+    STOP_TIMER("grand_product_parallel")
+
+    BOOST_CHECK(serial == parallel);
+}
+
+BENCHMARK_AUTO_TEST_CASE(running_sum_scan_test, 10) {
+    std::vector<value_type> serial(SIZE);
+    START_TIMER("running_sum_serial")
+    std::inclusive_scan(values.begin(), values.end(), serial.begin(), std::plus<value_type>());
+    STOP_TIMER("running_sum_serial")
+
+    std::vector<value_type> parallel(SIZE);
+    START_TIMER("running_sum_parallel")
+    parallel_inclusive_scan(values.begin(), values.end(), parallel.begin(), std::plus<value_type>());
+    STOP_TIMER("running_sum_parallel")
+
+    BOOST_CHECK(serial == parallel);
+}
+
+BENCHMARK_AUTO_TEST_CASE(product_reduce_test, 10) {
+    START_TIMER("product_reduce_serial")
+    value_type serial = std::accumulate(
+        values.begin(), values.end(), value_type::one(), std::multiplies<value_type>());
+    STOP_TIMER("product_reduce_serial")
+
+    START_TIMER("product_reduce_parallel")
+    value_type parallel = parallel_reduce(
+        values.begin(), values.end(), value_type::one(), std::multiplies<value_type>());
+    STOP_TIMER("product_reduce_parallel")
+
+    BOOST_CHECK(serial == parallel);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
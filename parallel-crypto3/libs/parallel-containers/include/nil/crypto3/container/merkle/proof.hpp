@@ -35,10 +35,14 @@
 #include <algorithm>
 #include <vector>
 #include <stack>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
 
 #include <boost/variant.hpp>
 
 #include <nil/crypto3/hash/type_traits.hpp>
+#include <nil/crypto3/hash/two_to_one_compressor.hpp>
 #include <nil/crypto3/container/merkle/tree.hpp>
 
 namespace nil {
@@ -136,20 +140,41 @@ namespace nil {
                         using hash_type = typename NodeType::hash_type;
                         value_type d = crypto3::hash<hash_type>(a);
                         for (auto &it : _path) {
-                            accumulator_set<hash_type> acc;
-                            size_t i = 0;
-                            for (; (i < arity - 1) && i == it[i]._position; ++i) {
-                                crypto3::hash<hash_type>(it[i]._hash, acc);
-                            }
-                            crypto3::hash<hash_type>(d, acc);
-                            for (; i < arity - 1; ++i) {
-                                crypto3::hash<hash_type>(it[i]._hash, acc);
-                            }
-                            d = accumulators::extract::hash<hash_type>(acc);
+                            d = hash_layer(it, d);
                         }
                         return (d == _root);
                     }
 
+                    /**
+                     * @brief Same as validate(a), but stops as soon as the path reaches a node which is already
+                     * in 'verified_nodes'. Nodes of a successfully validated path are added there.
+                     */
+                    template<typename Hashable, typename VerifiedNodesType>
+                    bool validate(const Hashable &a, VerifiedNodesType &verified_nodes) const {
+                        if (_root != verified_nodes.root()) {
+                            return validate(a);
+                        }
+
+                        using hash_type = typename NodeType::hash_type;
+                        std::vector<value_type> nodes;
+                        nodes.reserve(_path.size());
+                        std::size_t index = _li;
+                        value_type d = crypto3::hash<hash_type>(a);
+                        for (auto &it : _path) {
+                            if (verified_nodes.contains(nodes.size(), index, d)) {
+                                return true;
+                            }
+                            nodes.push_back(d);
+                            d = hash_layer(it, d);
+                            index /= arity;
+                        }
+                        if (d != _root) {
+                            return false;
+                        }
+                        verified_nodes.insert(_li, nodes);
+                        return true;
+                    }
+
                     static std::vector<merkle_proof_impl>
                         generate_compressed_proofs(const containers::merkle_tree<NodeType, Arity> &tree,
                                                     std::vector<std::size_t> leaf_idxs) {
@@ -230,16 +255,7 @@ namespace nil {
                             value_type d = crypto3::hash<hash_type>(a[idx]);
                             std::vector<value_type> hashes = {d};
                             for (auto &it : path) {
-                                accumulator_set<hash_type> acc;
-                                std::size_t i = 0;
-                                for (; (i < Arity - 1) && i == it[i].position(); ++i) {
-                                    crypto3::hash<hash_type>(it[i].hash(), acc);
-                                }
-                                crypto3::hash<hash_type>(d.begin(), d.end(), acc);
-                                for (; i < Arity - 1; ++i) {
-                                    crypto3::hash<hash_type>(it[i].hash(), acc);
-                                }
-                                d = accumulators::extract::hash<hash_type>(acc);
+                                d = hash_layer(it, d);
                                 hashes.push_back(d);
                             }
                             while (!st.empty()) {
@@ -282,6 +298,25 @@ namespace nil {
                     }
 
                 private:
+                    // Hash of the node on the next level, 'd' is its child on the path, 'layer' has its siblings.
+                    static value_type hash_layer(const layer_type &layer, const value_type &d) {
+                        if constexpr (Arity == 2 && hashes::has_two_to_one_compressor<hash_type>::value) {
+                            return layer[0].position() == 0 ? hashes::compress<hash_type>(layer[0].hash(), d) :
+                                                              hashes::compress<hash_type>(d, layer[0].hash());
+                        } else {
+                            accumulator_set<hash_type> acc;
+                            std::size_t i = 0;
+                            for (; (i < Arity - 1) && i == layer[i].position(); ++i) {
+                                crypto3::hash<hash_type>(layer[i].hash(), acc);
+                            }
+                            crypto3::hash<hash_type>(d, acc);
+                            for (; i < Arity - 1; ++i) {
+                                crypto3::hash<hash_type>(layer[i].hash(), acc);
+                            }
+                            return accumulators::extract::hash<hash_type>(acc);
+                        }
+                    }
+
                     std::size_t _li;
                     value_type _root;
                     path_type _path;
@@ -294,6 +329,55 @@ namespace nil {
                 };
 
 
+                /**
+                 * @brief Nodes of one Merkle tree which were already authenticated against its root.
+                 *
+                 * Paths to different leaves of a tree share their upper part. Once a path was validated, all the
+                 * nodes on it are known to be correct, and validation of another path may stop as soon as it
+                 * computes one of them. This pays off when many proofs open the same commitment, e.g. the fixed
+                 * columns of a circuit. Can be shared between threads.
+                 */
+                template<typename NodeType, std::size_t Arity = 2>
+                class merkle_verified_nodes_impl {
+                public:
+                    typedef NodeType node_type;
+                    typedef typename node_type::value_type value_type;
+
+                    constexpr static const std::size_t arity = Arity;
+
+                    explicit merkle_verified_nodes_impl(const value_type &root) : _root(root) {
+                    }
+
+                    const value_type &root() const {
+                        return _root;
+                    }
+
+                    bool contains(std::size_t level, std::size_t index, const value_type &node) const {
+                        std::shared_lock<std::shared_mutex> lock(_mutex);
+                        if (level >= _levels.size()) {
+                            return false;
+                        }
+                        auto it = _levels[level].find(index);
+                        return it != _levels[level].end() && it->second == node;
+                    }
+
+                    /// @brief Adds the nodes of the path of leaf 'leaf_index', nodes[i] is the node on level i.
+                    void insert(std::size_t leaf_index, const std::vector<value_type> &nodes) {
+                        std::unique_lock<std::shared_mutex> lock(_mutex);
+                        if (_levels.size() < nodes.size()) {
+                            _levels.resize(nodes.size());
+                        }
+                        for (std::size_t level = 0; level < nodes.size(); ++level, leaf_index /= arity) {
+                            _levels[level].emplace(leaf_index, nodes[level]);
+                        }
+                    }
+
+                private:
+                    value_type _root;
+                    mutable std::shared_mutex _mutex;
+                    std::vector<std::unordered_map<std::size_t, value_type>> _levels;
+                };
+
             }    // namespace detail
 
             template<typename T, std::size_t Arity>
@@ -302,6 +386,12 @@ namespace nil {
                                           detail::merkle_proof_impl<detail::merkle_tree_node<T>, Arity>,
                                           detail::merkle_proof_impl<T, Arity>>::type;
 
+            template<typename T, std::size_t Arity>
+            using merkle_verified_nodes =
+                typename std::conditional<nil::crypto3::detail::is_hash<T>::value,
+                                          detail::merkle_verified_nodes_impl<detail::merkle_tree_node<T>, Arity>,
+                                          detail::merkle_verified_nodes_impl<T, Arity>>::type;
+
         }    // namespace containers
     }        // namespace crypto3
 }    // namespace nil
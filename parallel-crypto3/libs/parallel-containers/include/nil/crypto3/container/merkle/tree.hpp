@@ -41,6 +41,7 @@
 
 #include <nil/crypto3/hash/type_traits.hpp>
 #include <nil/crypto3/hash/algorithm/hash.hpp>
+#include <nil/crypto3/hash/two_to_one_compressor.hpp>
 #include <nil/crypto3/container/merkle/node.hpp>
 
 #include <nil/actor/core/thread_pool.hpp>
@@ -486,6 +487,17 @@ namespace nil {
                     return accumulators::extract::hash<T>(acc);
                 }
 
+                // Hash of the Arity nodes starting at 'first'. Binary trees use the fixed-length compression of
+                // the hash when there is one, it gives the same digest without the accumulator.
+                template<typename T, std::size_t Arity, typename NodeIterator>
+                typename T::digest_type generate_node_hash(NodeIterator first) {
+                    if constexpr (Arity == 2 && hashes::has_two_to_one_compressor<T>::value) {
+                        return hashes::compress<T>(first[0], first[1]);
+                    } else {
+                        return generate_hash<T>(first, first + Arity);
+                    }
+                }
+
                 template<typename T, std::size_t Arity, typename LeafIterator>
                 merkle_tree_impl<T, Arity> make_merkle_tree(LeafIterator first, LeafIterator last) {
                     typedef T node_type;
@@ -507,8 +519,8 @@ namespace nil {
 
                     for (size_t row_number = 1; row_number < ret.row_count(); ++row_number, row_size /= Arity) {
                         nil::crypto3::parallel_for(0, row_size, [&ret, it, next_row_start_index](std::size_t index) {
-                            ret[next_row_start_index + index] = generate_hash<hash_type>(
-                                it + index * Arity, it + (index + 1) * Arity);
+                            ret[next_row_start_index + index] =
+                                generate_node_hash<hash_type, Arity>(it + index * Arity);
                         });
                         next_row_start_index += row_size;
                         it += row_size * Arity;
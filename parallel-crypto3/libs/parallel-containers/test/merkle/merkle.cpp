@@ -94,6 +94,31 @@ void testing_validate_template_random_data(std::size_t leaf_number) {
     BOOST_CHECK(!wrong_data_validate);
 }
 
+template<typename Hash, size_t Arity, typename ValueType, std::size_t N>
+void testing_validate_template_random_data_verified_nodes(std::size_t leaf_number) {
+    std::array<ValueType, N> data_not_in_tree = {0u};
+    auto data = generate_random_data<ValueType, N>(leaf_number);
+    auto tree = make_merkle_tree<Hash, Arity>(data.begin(), data.end());
+    merkle_verified_nodes<Hash, Arity> verified_nodes(tree.root());
+
+    for (std::size_t proof_idx = 0; proof_idx < leaf_number; ++proof_idx) {
+        merkle_proof<Hash, Arity> proof(tree, proof_idx);
+        BOOST_CHECK(!proof.validate(data[(proof_idx + 1) % leaf_number], verified_nodes));
+        BOOST_CHECK(!proof.validate(data_not_in_tree, verified_nodes));
+        BOOST_CHECK(proof.validate(data[proof_idx], verified_nodes));
+        // The second time the leaf itself is found among the verified nodes.
+        BOOST_CHECK(proof.validate(data[proof_idx], verified_nodes));
+        BOOST_CHECK(!proof.validate(data_not_in_tree, verified_nodes));
+    }
+
+    // Proofs of other trees are validated as usual.
+    auto other_data = generate_random_data<ValueType, N>(leaf_number);
+    auto other_tree = make_merkle_tree<Hash, Arity>(other_data.begin(), other_data.end());
+    merkle_proof<Hash, Arity> other_proof(other_tree, 0);
+    BOOST_CHECK(other_proof.validate(other_data[0], verified_nodes));
+    BOOST_CHECK(!other_proof.validate(data[0], verified_nodes));
+}
+
 template<typename Hash, size_t Arity, typename Element>
 void testing_validate_template(std::vector<Element> data) {
     std::array<uint8_t, 7> data_not_in_tree = {'\x6d', '\x65', '\x73', '\x73', '\x61', '\x67', '\x65'};
@@ -247,6 +272,22 @@ void testing_validate_template_compressed_proofs(std::vector<Element> data) {
     BOOST_CHECK(!wrong_data_validate_compressed);
 }
 
+template<typename Hash, typename Element>
+void testing_two_to_one_compressor(const std::vector<Element> &data) {
+    BOOST_STATIC_ASSERT(hashes::has_two_to_one_compressor<Hash>::value);
+    std::vector<typename Hash::digest_type> digests;
+    for (const auto &element : data) {
+        digests.emplace_back(nil::crypto3::hash<Hash>(element));
+    }
+    for (std::size_t i = 0; i < digests.size(); ++i) {
+        for (std::size_t j = 0; j < digests.size(); ++j) {
+            std::array<typename Hash::digest_type, 2> children = {digests[i], digests[j]};
+            BOOST_CHECK(hashes::compress<Hash>(digests[i], digests[j]) ==
+                        containers::detail::generate_hash<Hash>(children.begin(), children.end()));
+        }
+    }
+}
+
 template<typename Hash, size_t Arity, typename Element>
 void testing_hash_template(std::vector<Element> data, std::string result) {
     merkle_tree<Hash, Arity> tree = make_merkle_tree<Hash, Arity>(data.begin(), data.end());
@@ -324,6 +365,12 @@ BOOST_AUTO_TEST_CASE(merkletree_validate_test_2) {
 }
 
 
+BOOST_AUTO_TEST_CASE(merkletree_validate_verified_nodes_test) {
+    testing_validate_template_random_data_verified_nodes<hashes::sha2<256>, 2, std::uint8_t, 1>(16);
+    testing_validate_template_random_data_verified_nodes<hashes::sha2<256>, 3, std::uint8_t, 1>(27);
+    testing_validate_template_random_data_verified_nodes<poseidon_type, 2, poseidon_type::word_type, 1>(16);
+}
+
 BOOST_AUTO_TEST_CASE(merkletree_validate_test_5) {
     std::vector<std::array<char, 1>> v = {{'0'}, {'1'}, {'2'}, {'3'}, {'4'}, {'5'}, {'6'}, {'7'}, {'8'}};
     testing_validate_template_compressed_proofs<hashes::sha2<256>, 3>(v);
@@ -358,6 +405,19 @@ BOOST_AUTO_TEST_CASE(merkletree_hash_test_1) {
     BOOST_CHECK(tree.root() == 0x6E7641F1EAE17C0DA8227840EFEA6E1D17FB5EBA600D9DC34F314D5400E5BF3_big_uint255);
 }
 
+BOOST_AUTO_TEST_CASE(merkletree_two_to_one_compressor_test) {
+    std::vector<std::array<char, 1>> v = {{'0'}, {'1'}, {'2'}, {'3'}};
+    testing_two_to_one_compressor<hashes::sha2<256>>(v);
+    testing_two_to_one_compressor<hashes::keccak_1600<256>>(v);
+    testing_two_to_one_compressor<hashes::keccak_1600<512>>(v);
+    std::vector<std::array<poseidon_type::word_type, 1>> v_field = {
+        {0x0_big_uint255}, {0x1_big_uint255}, {0x2_big_uint255}, {0x3_big_uint255}};
+    testing_two_to_one_compressor<poseidon_type>(v_field);
+
+    BOOST_STATIC_ASSERT(!hashes::has_two_to_one_compressor<hashes::sha2<512>>::value);
+    BOOST_STATIC_ASSERT(!hashes::has_two_to_one_compressor<original_poseidon_type>::value);
+}
+
 BOOST_AUTO_TEST_CASE(merkletree_hash_test_2) {
     std::vector<std::array<char, 1>> v = {{'0'}, {'1'}, {'2'}, {'3'}, {'4'}, {'5'}, {'6'}, {'7'}, {'8'}};
     testing_hash_template<hashes::sha2<256>, 3>(v, "6831d4d32538bedaa7a51970ac10474d5884701c840781f0a434e5b6868d4b73");
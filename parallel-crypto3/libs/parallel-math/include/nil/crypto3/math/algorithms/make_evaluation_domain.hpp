@@ -30,6 +30,12 @@
 #error "You're mixing parallel and non-parallel crypto3 versions"
 #endif
 
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
 #include <nil/crypto3/math/domains/evaluation_domain.hpp>
 #include <nil/crypto3/math/domains/arithmetic_sequence_domain.hpp>
 #include <nil/crypto3/math/domains/basic_radix2_domain.hpp>
@@ -105,9 +111,10 @@ namespace nil {
              |S| >= MinSize.
              The function get_evaluation_domain is chosen from different supported domains,
              depending on MinSize.
+             Always builds a new domain, see make_evaluation_domain.
             */
             template<typename FieldType, typename ValueType = typename FieldType::value_type>
-            std::shared_ptr<evaluation_domain<FieldType, ValueType>> make_evaluation_domain(std::size_t m) {
+            std::shared_ptr<evaluation_domain<FieldType, ValueType>> build_evaluation_domain(std::size_t m) {
 
                 typedef std::shared_ptr<evaluation_domain<FieldType, ValueType>> result_type;
 
@@ -164,6 +171,88 @@ namespace nil {
 
                 return result_type();
             }
+
+            namespace detail {
+                template<typename FieldType, typename ValueType>
+                struct resident_evaluation_domains_storage {
+                    std::atomic<std::size_t> scopes{0};
+                    std::mutex mutex;
+                    std::unordered_map<std::size_t, std::shared_ptr<evaluation_domain<FieldType, ValueType>>> domains;
+
+                    static resident_evaluation_domains_storage &instance() {
+                        static resident_evaluation_domains_storage storage;
+                        return storage;
+                    }
+                };
+            }    // namespace detail
+
+            /*!
+             * @brief While an object of this class exists, make_evaluation_domain returns the same radix-2 domain
+             * for the same size instead of building it and its FFT tables again.
+             *
+             * Meant for long-running processes which prove the same circuit over and over. Radix-2 domains build
+             * their FFT tables in the constructor and are not modified afterwards, so they are shared between threads. Other domains precompute their
+             * tables lazily and are always built anew. The domains are released when the last scope ends.
+             */
+            template<typename FieldType, typename ValueType = typename FieldType::value_type>
+            class resident_evaluation_domains {
+            public:
+                resident_evaluation_domains() {
+                    auto &storage = detail::resident_evaluation_domains_storage<FieldType, ValueType>::instance();
+                    std::lock_guard<std::mutex> lock(storage.mutex);
+                    ++storage.scopes;
+                }
+
+                resident_evaluation_domains(const resident_evaluation_domains &) = delete;
+                resident_evaluation_domains &operator=(const resident_evaluation_domains &) = delete;
+
+                ~resident_evaluation_domains() {
+                    auto &storage = detail::resident_evaluation_domains_storage<FieldType, ValueType>::instance();
+                    std::lock_guard<std::mutex> lock(storage.mutex);
+                    if (--storage.scopes == 0) {
+                        storage.domains.clear();
+                    }
+                }
+
+                /// @brief Number of domains kept.
+                static std::size_t size() {
+                    auto &storage = detail::resident_evaluation_domains_storage<FieldType, ValueType>::instance();
+                    std::lock_guard<std::mutex> lock(storage.mutex);
+                    return storage.domains.size();
+                }
+            };
+
+            /*!
+             * @brief Same as build_evaluation_domain, but while a resident_evaluation_domains scope exists,
+             * radix-2 domains are built once per size and shared.
+             */
+            template<typename FieldType, typename ValueType = typename FieldType::value_type>
+            std::shared_ptr<evaluation_domain<FieldType, ValueType>> make_evaluation_domain(std::size_t m) {
+                auto &storage = detail::resident_evaluation_domains_storage<FieldType, ValueType>::instance();
+                if (storage.scopes.load(std::memory_order_relaxed) == 0) {
+                    return build_evaluation_domain<FieldType, ValueType>(m);
+                }
+
+                {
+                    std::lock_guard<std::mutex> lock(storage.mutex);
+                    auto it = storage.domains.find(m);
+                    if (it != storage.domains.end()) {
+                        return it->second;
+                    }
+                }
+
+                // Built outside of the lock, if two threads race for the same size the first one is kept.
+                auto domain = build_evaluation_domain<FieldType, ValueType>(m);
+                const bool is_radix2 =
+                    std::dynamic_pointer_cast<basic_radix2_domain<FieldType, ValueType>>(domain) ||
+                    std::dynamic_pointer_cast<extended_radix2_domain<FieldType, ValueType>>(domain) ||
+                    std::dynamic_pointer_cast<step_radix2_domain<FieldType, ValueType>>(domain);
+                std::lock_guard<std::mutex> lock(storage.mutex);
+                if (!is_radix2 || storage.scopes == 0) {
+                    return domain;
+                }
+                return storage.domains.emplace(m, domain).first->second;
+            }
         }    // namespace math
     }        // namespace crypto3
 }    // namespace nil
@@ -33,7 +33,9 @@
 
 #include <algorithm>
 #include <limits>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <vector>
 #include <ostream>
 #include <iterator>
@@ -144,7 +146,7 @@ namespace nil {
                                      "DFS optimal polynomial size must be a power of two");
                 }
 
-                polynomial_dfs(size_t d, container_type&& c) : val(c), _d(d) {
+                polynomial_dfs(size_t d, container_type&& c) : val(std::move(c)), _d(d) {
                     BOOST_ASSERT_MSG(val.size() == detail::power_of_two(val.size()),
                                      "DFS optimal polynomial size must be a power of two");
                 }
@@ -169,7 +171,7 @@ namespace nil {
                 }
 
                 allocator_type get_allocator() const BOOST_NOEXCEPT {
-                    return this->val.__alloc();
+                    return this->val.get_allocator();
                 }
 
                 container_type& get_storage() {
@@ -358,14 +360,23 @@ namespace nil {
                         } else {
                             BOOST_ASSERT_MSG(old_domain->size() == this->size(), "Old domain size is not equal to the polynomial size");
                         }
-                        old_domain->inverse_fft(this->val);
-                        this->val.resize(_sz, FieldValueType::zero());
                         if (new_domain == nullptr) {
                             new_domain = make_evaluation_domain<FieldType>(_sz);
                         } else {
                             BOOST_ASSERT_MSG(new_domain->size() == _sz, "New domain size is not equal to the polynomial size");
                         }
-                        new_domain->fft(this->val);
+                        if constexpr (std::is_same<container_type, std::vector<FieldValueType>>::value) {
+                            old_domain->inverse_fft(this->val);
+                            this->val.resize(_sz, FieldValueType::zero());
+                            new_domain->fft(this->val);
+                        } else {
+                            // Evaluation domains work on std::vector only.
+                            std::vector<FieldValueType> tmp(this->val.begin(), this->val.end());
+                            old_domain->inverse_fft(tmp);
+                            tmp.resize(_sz, FieldValueType::zero());
+                            new_domain->fft(tmp);
+                            this->val.assign(tmp.begin(), tmp.end());
+                        }
                     }
                 }
 
@@ -577,6 +588,22 @@ namespace nil {
                     return *this;
                 }
 
+                /**
+                 * Multiplies by a polynomial given by its values on the same domain, e.g. by
+                 * a polynomial_dfs_rotated_view of a column, without copying these values.
+                 */
+                template<typename PolynomialDFSView>
+                polynomial_dfs& pointwise_multiplication(const PolynomialDFSView& other) {
+                    BOOST_ASSERT_MSG(other.size() == this->size(), "Pointwise multiplication requires equal domains");
+                    BOOST_ASSERT_MSG(this->_d + other.degree() < this->size(),
+                                     "Product degree does not fit the domain, resize the polynomial first");
+                    this->_d += other.degree();
+                    parallel_for(0, this->size(), [this, &other](std::size_t i) {
+                        this->val[i] *= other[i];
+                    }, ThreadPool::PoolLevel::LOW);
+                    return *this;
+                }
+
                 /**
                  * Perform the multiplication of two polynomials, polynomial A * constant alpha,
                  * and stores result in polynomial A.
@@ -603,7 +630,7 @@ namespace nil {
                     value_type omega = unity_root<FieldType>(n);
                     q.resize(n);
                     detail::basic_radix2_fft<FieldType>(q, omega);
-                    return polynomial_dfs(new_s - 1, q);
+                    return polynomial_dfs(new_s - 1, q.begin(), q.end());
                 }
 
                 /**
@@ -623,7 +650,7 @@ namespace nil {
                     value_type omega = unity_root<FieldType>(n);
                     r.resize(n);
                     detail::basic_radix2_fft<FieldType>(r, omega);
-                    return polynomial_dfs(new_s - 1, r);
+                    return polynomial_dfs(new_s - 1, r.begin(), r.end());
                 }
 
                 template<typename ContainerType>
@@ -685,7 +712,7 @@ namespace nil {
                      typename = typename std::enable_if<detail::is_field_element<FieldValueType>::value>::type>
             polynomial_dfs<FieldValueType, Allocator> operator+(const polynomial_dfs<FieldValueType, Allocator>& A,
                                                             const FieldValueType& B) {
-                polynomial_dfs<FieldValueType> result(A);
+                polynomial_dfs<FieldValueType, Allocator> result(A);
                 for( auto it = result.begin(); it != result.end(); it++ ){
                     *it += B;
                 }
@@ -696,7 +723,7 @@ namespace nil {
                      typename = typename std::enable_if<detail::is_field_element<FieldValueType>::value>::type>
             polynomial_dfs<FieldValueType, Allocator> operator+(const FieldValueType& A,
                                                             const polynomial_dfs<FieldValueType, Allocator>& B) {
-                polynomial_dfs<FieldValueType> result(B);
+                polynomial_dfs<FieldValueType, Allocator> result(B);
                 for( auto it = result.begin(); it != result.end(); it++ ){
                     *it += A;
                 }
@@ -708,7 +735,7 @@ namespace nil {
                      typename = typename std::enable_if<detail::is_field_element<FieldValueType>::value>::type>
             polynomial_dfs<FieldValueType, Allocator> operator-(const polynomial_dfs<FieldValueType, Allocator>& A,
                                                             const FieldValueType& B) {
-                polynomial_dfs<FieldValueType> result(A);
+                polynomial_dfs<FieldValueType, Allocator> result(A);
                 for( auto it = result.begin(); it != result.end(); it++ ){
                     *it -=  B;
                 }
@@ -719,7 +746,7 @@ namespace nil {
                      typename = typename std::enable_if<detail::is_field_element<FieldValueType>::value>::type>
             polynomial_dfs<FieldValueType, Allocator> operator-(const FieldValueType& A,
                                                             const polynomial_dfs<FieldValueType, Allocator>& B) {
-                polynomial_dfs<FieldValueType> result(B);
+                polynomial_dfs<FieldValueType, Allocator> result(B);
                 for( auto it = result.begin(); it != result.end(); it++ ){
                     *it = A - *it;
                 }
@@ -731,7 +758,7 @@ namespace nil {
             polynomial_dfs<FieldValueType, Allocator> operator*(const polynomial_dfs<FieldValueType, Allocator>& A,
                                                             const FieldValueType& B) {
 
-                polynomial_dfs<FieldValueType> result(A);
+                polynomial_dfs<FieldValueType, Allocator> result(A);
                 parallel_foreach(result.begin(), result.end(),
                     [&B](FieldValueType& v) {
                         v *= B;
@@ -751,7 +778,7 @@ namespace nil {
                      typename = typename std::enable_if<detail::is_field_element<FieldValueType>::value>::type>
             polynomial_dfs<FieldValueType, Allocator> operator/(const polynomial_dfs<FieldValueType, Allocator>& A,
                                                             const FieldValueType& B) {
-                polynomial_dfs<FieldValueType> result(A);
+                polynomial_dfs<FieldValueType, Allocator> result(A);
                 FieldValueType B_inversed = B.inversed();
                 parallel_foreach(result.begin(), result.end(),
                     [&B_inversed](FieldValueType& v) {
@@ -766,7 +793,7 @@ namespace nil {
             polynomial_dfs<FieldValueType, Allocator> operator/(const FieldValueType& A,
                                                             const polynomial_dfs<FieldValueType, Allocator>& B) {
 
-                return polynomial_dfs<FieldValueType>(0, B.size(), A) / B;
+                return polynomial_dfs<FieldValueType, Allocator>(0, B.size(), A) / B;
             }
 
             // Used in the unit tests, so we can use BOOST_CHECK_EQUALS, and see
@@ -793,108 +820,214 @@ namespace nil {
                 return os;
             }
 
-            template<typename FieldType>
-            static inline polynomial_dfs<typename FieldType::value_type> polynomial_sum(
-                    std::vector<math::polynomial_dfs<typename FieldType::value_type>> addends) {
-                using FieldValueType = typename FieldType::value_type;
+            namespace detail {
+
+                // Evaluation domains used by one operation. The operation creates the set and passes it down, so a
+                // domain and its FFT caches are built once per size and kept until the whole operation is done.
+                // Safe to use from the threads of the operation.
+                template<typename FieldType>
+                class evaluation_domain_set {
+                public:
+                    std::shared_ptr<evaluation_domain<FieldType>> get(std::size_t size) {
+                        std::lock_guard<std::mutex> lock(mutex_);
+                        std::shared_ptr<evaluation_domain<FieldType>>& domain = domains_[size];
+                        if (!domain) {
+                            domain = make_evaluation_domain<FieldType>(size);
+                        }
+                        return domain;
+                    }
+
+                private:
+                    std::mutex mutex_;
+                    std::unordered_map<std::size_t, std::shared_ptr<evaluation_domain<FieldType>>> domains_;
+                };
+
+                // Evaluates the polynomial with the given coefficients on the domain of size 'size', which must be
+                // a multiple of coefficients.size(). The large domain is a union of cosets omega^k * H of the small
+                // domain H, each coset is evaluated by an FFT of the small size. The value at point omega^(j * cosets + k)
+                // is passed to consume(j * cosets + k, value). Cosets before 'first_coset' are skipped.
+                template<typename FieldType, typename ConsumerType>
+                void evaluate_on_cosets(const std::vector<typename FieldType::value_type>& coefficients,
+                                        std::size_t size, evaluation_domain_set<FieldType>& domains,
+                                        ConsumerType consume, std::size_t first_coset = 0) {
+                    using FieldValueType = typename FieldType::value_type;
+
+                    const std::size_t small_size = coefficients.size();
+                    const std::size_t cosets = size / small_size;
+                    BOOST_ASSERT_MSG(cosets * small_size == size, "Domain size must be a multiple of the coefficients size");
+
+                    if (small_size == 1) {
+                        parallel_for(first_coset, size, [&coefficients, &consume](std::size_t i) {
+                            consume(i, coefficients[0]);
+                        }, ThreadPool::PoolLevel::LOW);
+                        return;
+                    }
 
-                if (addends.empty()) {
-                    return {};
+                    std::shared_ptr<evaluation_domain<FieldType>> small_domain = domains.get(small_size);
+                    const FieldValueType omega = unity_root<FieldType>(size);
+
+                    // Cosets are processed one by one, the FFT and the scaling are parallel inside. Running cosets
+                    // in parallel would need a pool level, but this is called from the HIGH level pool by polynomial_product.
+                    std::vector<FieldValueType> coset_values;
+                    for (std::size_t k = first_coset; k < cosets; ++k) {
+                        coset_values = coefficients;
+                        if (k != 0) {
+                            const FieldValueType shift = omega.pow(k);
+                            wait_for_all(parallel_run_in_chunks<void>(
+                                small_size,
+                                [&coset_values, &shift](std::size_t begin, std::size_t end) {
+                                    FieldValueType shift_power = shift.pow(begin);
+                                    for (std::size_t i = begin; i < end; ++i) {
+                                        coset_values[i] *= shift_power;
+                                        shift_power *= shift;
+                                    }
+                                }, ThreadPool::PoolLevel::LOW));
+                        }
+                        small_domain->fft(coset_values);
+                        parallel_for(0, small_size, [&coset_values, &consume, cosets, k](std::size_t j) {
+                            consume(j * cosets + k, coset_values[j]);
+                        }, ThreadPool::PoolLevel::LOW);
+                    }
                 }
 
-                // Since there are only ~20 addends, we will just use that many maps
-                std::vector<std::unordered_map<std::size_t, polynomial_dfs<FieldValueType>>> maps(addends.size());
-                for (size_t i = 0; i < addends.size(); ++i) {
-                    maps[i][addends[i].size()] = std::move(addends[i]);
+                // Resizes 'poly' to 'new_size', which must be a multiple of its size. The values on the old domain
+                // are the values on the first coset of the new one, so they are kept, and only the other cosets are
+                // computed. This is cheaper than a full inverse FFT followed by a forward FFT of the new size.
+                template<typename FieldType>
+                void extend_dfs_polynomial(polynomial_dfs<typename FieldType::value_type>& poly, std::size_t new_size,
+                                           evaluation_domain_set<FieldType>& domains) {
+                    using FieldValueType = typename FieldType::value_type;
+
+                    const std::size_t old_size = poly.size();
+                    if (old_size >= new_size) {
+                        return;
+                    }
+                    if (poly.degree() == 0 || old_size == 1) {
+                        poly.resize(new_size);
+                        return;
+                    }
+
+                    std::vector<FieldValueType> coefficients(poly.begin(), poly.end());
+                    domains.get(old_size)->inverse_fft(coefficients);
+
+                    const std::size_t cosets = new_size / old_size;
+                    std::vector<FieldValueType> values(new_size);
+                    parallel_for(0, old_size, [&values, &poly, cosets](std::size_t j) {
+                        values[j * cosets] = poly[j];
+                    }, ThreadPool::PoolLevel::LOW);
+                    evaluate_on_cosets<FieldType>(coefficients, new_size, domains,
+                        [&values](std::size_t i, const FieldValueType& value) {
+                            values[i] = value;
+                        }, 1);
+
+                    poly = polynomial_dfs<FieldValueType>(poly.degree(), std::move(values));
                 }
 
-                for (std::size_t stride = 1; stride < addends.size(); stride <<= 1) {
-                    std::size_t double_stride = stride << 1;
-                    std::size_t max_i = (addends.size() - stride) / double_stride;
-                    if ((addends.size() - stride) % double_stride != 0) {
-                        max_i++;
+                // Sums the addends, multiplied by 'scales' if they are given. Addends of the same size are added
+                // point by point in a single pass, without leaving the evaluation form. Groups of smaller sizes are
+                // interpolated once, added as coefficients and evaluated on the largest domain by the cosets.
+                template<typename FieldType>
+                polynomial_dfs<typename FieldType::value_type> polynomial_sum(
+                        std::vector<polynomial_dfs<typename FieldType::value_type>>& addends,
+                        const std::vector<typename FieldType::value_type>* scales) {
+                    using FieldValueType = typename FieldType::value_type;
+
+                    if (addends.empty()) {
+                        return {};
+                    }
+                    BOOST_ASSERT(scales == nullptr || scales->size() == addends.size());
+
+                    std::size_t max_degree = 0;
+                    std::map<std::size_t, std::vector<std::size_t>> size_groups;
+                    for (std::size_t i = 0; i < addends.size(); ++i) {
+                        max_degree = std::max(max_degree, addends[i].degree());
+                        size_groups[addends[i].size()].push_back(i);
                     }
 
-                    parallel_for(0, max_i, [&, stride, double_stride](std::size_t i) {
-                        std::size_t index1 = i * double_stride;
-                        std::size_t index2 = index1 + stride;
-                        if (index2 < addends.size()) {
-                            auto& map1 = maps[index1];
-                            auto& map2 = maps[index2];
-
-                            for (auto& entry : map2) {
-                                auto it = map1.find(entry.first);
-                                if (it != map1.end()) {
-                                    it->second += entry.second;
-                                } else {
-                                    map1[entry.first] = std::move(entry.second);
+                    // Adds up the group in the storage of its first addend.
+                    auto sum_group = [&addends, scales](const std::vector<std::size_t>& group) {
+                        std::vector<FieldValueType> values = std::move(addends[group[0]].get_storage());
+                        addends[group[0]] = polynomial_dfs<FieldValueType>();
+                        wait_for_all(parallel_run_in_chunks<void>(
+                            values.size(),
+                            [&values, &addends, &group, scales](std::size_t begin, std::size_t end) {
+                                for (std::size_t j = begin; j < end; ++j) {
+                                    FieldValueType value = values[j];
+                                    if (scales != nullptr) {
+                                        value *= (*scales)[group[0]];
+                                    }
+                                    for (std::size_t k = 1; k < group.size(); ++k) {
+                                        if (scales != nullptr) {
+                                            value += addends[group[k]][j] * (*scales)[group[k]];
+                                        } else {
+                                            value += addends[group[k]][j];
+                                        }
+                                    }
+                                    values[j] = value;
                                 }
-                            }
-                            map2.clear();
+                            }, ThreadPool::PoolLevel::LOW));
+                        for (std::size_t k = 1; k < group.size(); ++k) {
+                            addends[group[k]] = polynomial_dfs<FieldValueType>();
+                        }
+                        return values;
+                    };
+
+                    const std::size_t max_size = size_groups.rbegin()->first;
+                    std::vector<FieldValueType> result = sum_group(size_groups.rbegin()->second);
+                    size_groups.erase(max_size);
+
+                    if (!size_groups.empty()) {
+                        evaluation_domain_set<FieldType> domains;
+                        std::vector<std::vector<std::size_t>> groups;
+                        for (auto& [size, group] : size_groups) {
+                            groups.push_back(std::move(group));
                         }
-                    });
-                }
-
-                std::unordered_map<std::size_t, polynomial_dfs<FieldValueType>>& size_to_part_sum = maps[0];
-                std::vector<polynomial_dfs<FieldValueType>> grouped_addends;
 
-                std::size_t max_size = 0;
-                for (const auto& [size, partial_sum] : size_to_part_sum) {
-                    max_size = std::max(max_size, size);
-                    grouped_addends.push_back(std::move(partial_sum));
-                }
+                        std::vector<std::vector<FieldValueType>> groups_coefficients(groups.size());
+                        parallel_for(0, groups.size(), [&](std::size_t i) {
+                            groups_coefficients[i] = sum_group(groups[i]);
+                            if (groups_coefficients[i].size() > 1) {
+                                domains.get(groups_coefficients[i].size())->inverse_fft(groups_coefficients[i]);
+                            }
+                        }, ThreadPool::PoolLevel::HIGH);
 
-                std::vector<polynomial<FieldValueType>> grouped_addends_coefs(grouped_addends.size());
+                        // Groups are ordered by size, the last one is the largest.
+                        std::vector<FieldValueType> coefficients = std::move(groups_coefficients.back());
+                        for (std::size_t i = 0; i + 1 < groups_coefficients.size(); ++i) {
+                            for (std::size_t j = 0; j < groups_coefficients[i].size(); ++j) {
+                                coefficients[j] += groups_coefficients[i][j];
+                            }
+                        }
 
-                nil::crypto3::parallel_for(0, grouped_addends.size(), [&grouped_addends_coefs, &grouped_addends] (std::size_t i) {
-                    grouped_addends_coefs[i] = grouped_addends[i].coefficients();
-                }, ThreadPool::PoolLevel::HIGH);
+                        evaluate_on_cosets<FieldType>(coefficients, max_size, domains,
+                            [&result](std::size_t i, const FieldValueType& value) {
+                                result[i] += value;
+                            });
+                    }
 
-                // We can parallelize this by adding pairwise, like it's done in multiplication, but it's pretty fast
-                // so skipping it for now.
-                polynomial<FieldValueType> coef_result;
-                for (const auto& partial_sum : grouped_addends_coefs) {
-                    coef_result += partial_sum;
+                    return polynomial_dfs<FieldValueType>(max_degree, std::move(result));
                 }
+            }    // namespace detail
 
-                polynomial_dfs<FieldValueType> dfs_result;
-                dfs_result.from_coefficients(coef_result.get_storage());
+            template<typename FieldType>
+            static inline polynomial_dfs<typename FieldType::value_type> polynomial_sum(
+                    std::vector<math::polynomial_dfs<typename FieldType::value_type>> addends) {
+                return detail::polynomial_sum<FieldType>(addends, nullptr);
+            }
 
-                return dfs_result;
+            // Computes sum(scales[i] * addends[i]), the multiplications are done in the same pass as the additions.
+            template<typename FieldType>
+            static inline polynomial_dfs<typename FieldType::value_type> polynomial_sum(
+                    std::vector<math::polynomial_dfs<typename FieldType::value_type>> addends,
+                    const std::vector<typename FieldType::value_type>& scales) {
+                return detail::polynomial_sum<FieldType>(addends, &scales);
             }
 
             template<typename FieldType>
             static inline polynomial_dfs<typename FieldType::value_type> polynomial_product(
                     std::vector<math::polynomial_dfs<typename FieldType::value_type>> multipliers) {
-                // Pre-create all the domains. We could do this on-the-go, but we want this function to be more
-                // parallelization-friendly. This single-threaded version may look a bit complicated,
-                // but it's now very similar to what we have in parallel code.
-                std::unordered_map<std::size_t, std::shared_ptr<evaluation_domain<FieldType>>> domain_cache;
-
-                std::size_t min_domain_size = std::numeric_limits<std::size_t>::max();
-                std::size_t max_domain_size = 0;
-                std::size_t total_degree = 0;
-                for (std::size_t i = 0; i < multipliers.size(); i++) {
-                    min_domain_size = std::min(min_domain_size, multipliers[i].size());
-                    max_domain_size = std::max(max_domain_size, multipliers[i].size());
-                    total_degree += multipliers[i].degree();
-                }
-                max_domain_size = std::max(max_domain_size, detail::power_of_two(total_degree + 1));
-
-                std::vector<std::size_t> needed_domain_sizes;
-                for (std::size_t i = min_domain_size; i <= max_domain_size; i *= 2) {
-                    needed_domain_sizes.push_back(i);
-                    // On the next line I want to create the tree structure, then create the evaluation domains.
-                    // This way filling of this structure can be done in parallel.
-                    domain_cache[i] = nullptr;
-                }
-
-                // We cannot use LOW level thread pool here, make_evaluation_domain uses it.
-                parallel_foreach(needed_domain_sizes.begin(), needed_domain_sizes.end(),
-                    [&domain_cache](std::size_t domain_size) {
-                        domain_cache[domain_size] = make_evaluation_domain<FieldType>(domain_size);
-                    }, ThreadPool::PoolLevel::HIGH);
-
+                // Every level of the tree extends to the next size, the domains are kept for the whole product.
+                detail::evaluation_domain_set<FieldType> domains;
                 for (std::size_t stride = 1; stride < multipliers.size(); stride <<= 1) {
                     const std::size_t double_stride = stride << 1;
                     // This loop will run in parallel.
@@ -902,25 +1035,23 @@ namespace nil {
                     if ((multipliers.size() - stride) % double_stride != 0)
                         max_i++;
 
-                    // We can't use LOW level thread pool here, it's used in cached_multiplication.
+                    // We can't use LOW level thread pool here, it's used in the multiplication.
                     parallel_for(0, max_i,
-                        [&multipliers, &domain_cache, stride, double_stride](std::size_t i) {
+                        [&multipliers, &domains, stride, double_stride](std::size_t i) {
                             std::size_t index1 = i * double_stride;
                             std::size_t index2 = index1 + stride;
 
-                            const std::size_t current_domain_size = multipliers[index1].size();
-                            const std::size_t next_domain_size = multipliers[index2].size();
                             const std::size_t new_domain_size =
                                 detail::power_of_two(std::max(
-                                    {current_domain_size,
-                                     next_domain_size,
+                                    {multipliers[index1].size(),
+                                     multipliers[index2].size(),
                                      multipliers[index1].degree() + multipliers[index2].degree() + 1}));
 
-                            multipliers[index1].cached_multiplication(
-                                multipliers[index2],
-                                domain_cache[current_domain_size],
-                                domain_cache[next_domain_size],
-                                domain_cache[new_domain_size]);
+                            // Both factors are brought to the product domain by evaluating only the new cosets,
+                            // then the multiplication itself does no FFTs.
+                            detail::extend_dfs_polynomial<FieldType>(multipliers[index1], new_domain_size, domains);
+                            detail::extend_dfs_polynomial<FieldType>(multipliers[index2], new_domain_size, domains);
+                            multipliers[index1] *= multipliers[index2];
 
                             // Free the memory we are not going to use anymore.
                             multipliers[index2] = polynomial_dfs<typename FieldType::value_type>();
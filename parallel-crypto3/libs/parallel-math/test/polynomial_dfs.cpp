@@ -271,6 +271,30 @@ BOOST_AUTO_TEST_CASE(polynomial_dfs_sum) {
     }
     BOOST_CHECK_EQUAL(native_sum, polynomial_sum<FieldType>(polynomials));
 }
+
+BOOST_AUTO_TEST_CASE(polynomial_dfs_sum_different_sizes) {
+    std::vector<polynomial_dfs<typename FieldType::value_type>> polynomials;
+    for (std::size_t degree : {0, 3, 7, 6, 15, 30, 1, 12}) {
+        std::vector<typename FieldType::value_type> coefficients(degree + 1);
+        for (auto& c : coefficients) {
+            c = nil::crypto3::algebra::random_element<FieldType>();
+        }
+        polynomial_dfs<typename FieldType::value_type> poly;
+        poly.from_coefficients(coefficients);
+        polynomials.push_back(poly);
+    }
+
+    std::vector<typename FieldType::value_type> scales;
+    auto native_sum = polynomial_dfs<typename FieldType::value_type>::zero();
+    auto native_scaled_sum = polynomial_dfs<typename FieldType::value_type>::zero();
+    for (const auto& p : polynomials) {
+        scales.push_back(nil::crypto3::algebra::random_element<FieldType>());
+        native_sum += p;
+        native_scaled_sum += p * scales.back();
+    }
+    BOOST_CHECK_EQUAL(native_sum, polynomial_sum<FieldType>(polynomials));
+    BOOST_CHECK_EQUAL(native_scaled_sum, polynomial_sum<FieldType>(polynomials, scales));
+}
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE(polynomial_dfs_addition_eq_test_suite)
@@ -831,9 +855,29 @@ BOOST_AUTO_TEST_CASE(polynomial_dfs_multiplication_resize_both) {
 
     BOOST_CHECK_EQUAL(c_res, c);
 }
+
+BOOST_AUTO_TEST_CASE(polynomial_dfs_product) {
+    std::vector<polynomial_dfs<typename FieldType::value_type>> polynomials;
+    for (std::size_t degree : {3, 7, 0, 6, 15, 2, 1}) {
+        std::vector<typename FieldType::value_type> coefficients(degree + 1);
+        for (auto& c : coefficients) {
+            c = nil::crypto3::algebra::random_element<FieldType>();
+        }
+        polynomial_dfs<typename FieldType::value_type> poly;
+        poly.from_coefficients(coefficients);
+        polynomials.push_back(poly);
+    }
+
+    auto native_product = polynomial_dfs<typename FieldType::value_type>::one();
+    for (const auto& p : polynomials) {
+        native_product *= p;
+    }
+    BOOST_CHECK_EQUAL(native_product, polynomial_product<FieldType>(polynomials));
+}
 BOOST_AUTO_TEST_SUITE_END()
 
 
+
 BOOST_AUTO_TEST_SUITE(polynomial_dfs_multiplication_eq_test_suite)
 BOOST_AUTO_TEST_CASE(polynomial_dfs_multiplication_eq_without_resize) {
 
@@ -1255,6 +1299,67 @@ BOOST_AUTO_TEST_CASE(polynomial_dfs_pow_eq_test) {
 
 BOOST_AUTO_TEST_SUITE_END()
 
+// Allocator which is not std::allocator, to check that polynomial_dfs keeps it through the operations.
+template<typename T>
+struct counting_allocator {
+    typedef T value_type;
+
+    static inline std::size_t allocations = 0;
+
+    counting_allocator() noexcept = default;
+
+    template<typename U>
+    counting_allocator(const counting_allocator<U>&) noexcept {
+    }
+
+    T* allocate(std::size_t n) {
+        ++allocations;
+        return std::allocator<T>().allocate(n);
+    }
+
+    void deallocate(T* p, std::size_t n) noexcept {
+        std::allocator<T>().deallocate(p, n);
+    }
+
+    template<typename U>
+    bool operator==(const counting_allocator<U>&) const noexcept {
+        return true;
+    }
+
+    template<typename U>
+    bool operator!=(const counting_allocator<U>&) const noexcept {
+        return false;
+    }
+};
+
+BOOST_AUTO_TEST_SUITE(polynomial_dfs_allocator_test_suite)
+BOOST_AUTO_TEST_CASE(polynomial_dfs_custom_allocator_arithmetic) {
+    using value_type = typename FieldType::value_type;
+    using custom_polynomial_dfs = polynomial_dfs<value_type, counting_allocator<value_type>>;
+
+    std::vector<value_type> a_coefficients(100), b_coefficients(70);
+    for (auto& c : a_coefficients) {
+        c = nil::crypto3::algebra::random_element<FieldType>();
+    }
+    for (auto& c : b_coefficients) {
+        c = nil::crypto3::algebra::random_element<FieldType>();
+    }
+    polynomial_dfs<value_type> a, b;
+    a.from_coefficients(a_coefficients);
+    b.from_coefficients(b_coefficients);
+    custom_polynomial_dfs custom_a(a.degree(), a.begin(), a.end());
+    custom_polynomial_dfs custom_b(b.degree(), b.begin(), b.end());
+
+    const std::size_t allocations_before = counting_allocator<value_type>::allocations;
+    polynomial_dfs<value_type> expected = (a + b) * a - b;
+    custom_polynomial_dfs result = (custom_a + custom_b) * custom_a - custom_b;
+    BOOST_CHECK_GT(counting_allocator<value_type>::allocations, allocations_before);
+    BOOST_CHECK_EQUAL(expected.degree(), result.degree());
+    BOOST_CHECK(std::equal(expected.begin(), expected.end(), result.begin(), result.end()));
+    BOOST_CHECK(a.coefficients() == custom_a.coefficients());
+}
+BOOST_AUTO_TEST_SUITE_END()
+
 BOOST_AUTO_TEST_SUITE(polynomial_evaluation_test_suite)
 
 BOOST_AUTO_TEST_CASE(polynomial_dfs_evaluate_after_resize_test) {
@@ -214,26 +214,27 @@ namespace nil {
 
                     void eval_polys() {
                         for(auto const &[k, poly] : _polys) {
-                            _z.set_batch_size(k, poly.size());
-                            auto const &point = _points.at(k);
-
-                            BOOST_ASSERT(poly.size() == point.size() || point.size() == 1);
+                            eval_batch(k, poly);
+                        }
+                    }
 
-                            for (std::size_t i = 0; i < poly.size(); ++i) {
-                                _z.set_poly_points_number(k, i, point[i].size());
-                            }
+                    // Evaluates the polynomials of batch 'k' at its points, they may be stored outside of _polys.
+                    void eval_batch(std::size_t k, const std::vector<polynomial_type>& poly) {
+                        _z.set_batch_size(k, poly.size());
+                        auto const &point = _points.at(k);
 
-                            // Lambda in parallel_for can not capture structured bindings [k, poly], until C++20
-                            auto k_capture = k;
-                            auto poly_capture = poly;
+                        BOOST_ASSERT(poly.size() == point.size() || point.size() == 1);
 
-                            // We use HIGH level thread pool here, because "evaluate" may use the lower level one.
-                            parallel_for(0, poly.size(), [this, &point, k_capture, &poly_capture](std::size_t i) {
-                                for (std::size_t j = 0; j < point[i].size(); j++) {
-                                    _z.set(k_capture, i, j, poly_capture[i].evaluate(point[i][j]));
-                                }
-                            }, ThreadPool::PoolLevel::HIGH);
+                        for (std::size_t i = 0; i < poly.size(); ++i) {
+                            _z.set_poly_points_number(k, i, point[i].size());
                         }
+
+                        // We use HIGH level thread pool here, because "evaluate" may use the lower level one.
+                        parallel_for(0, poly.size(), [this, &point, k, &poly](std::size_t i) {
+                            for (std::size_t j = 0; j < point[i].size(); j++) {
+                                _z.set(k, i, j, poly[i].evaluate(point[i][j]));
+                            }
+                        }, ThreadPool::PoolLevel::HIGH);
                     }
 
                 public:
@@ -358,13 +358,10 @@ namespace nil {
                         F -= rsum * CommitmentSchemeType::single_commitment_type::one();
                         F -= this->get_V(_merged_points).evaluate(theta_2) * proof.pi_1;
 
-                        auto left_side_pairing = nil::crypto3::algebra::pair_reduced<typename CommitmentSchemeType::curve_type>
-                                (F + theta_2 * proof.pi_2, verification_key_type::one());
-
-                        auto right_side_pairing = nil::crypto3::algebra::pair_reduced<typename CommitmentSchemeType::curve_type>
-                                (proof.pi_2, _params.verification_key[1]);
-
-                        return left_side_pairing == right_side_pairing;
+                        // e(F + theta_2 * pi_2, g2) == e(pi_2, [x]_2)
+                        return nil::crypto3::algebra::pairing_product_is_one<typename CommitmentSchemeType::curve_type>(
+                                {F + theta_2 * proof.pi_2, -proof.pi_2},
+                                {verification_key_type::one(), _params.verification_key[1]});
                     }
 
                     const params_type &get_commitment_params() const {
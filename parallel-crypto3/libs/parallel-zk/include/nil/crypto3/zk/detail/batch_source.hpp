@@ -0,0 +1,74 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation <info@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef PARALLEL_CRYPTO3_ZK_DETAIL_BATCH_SOURCE_HPP
+#define PARALLEL_CRYPTO3_ZK_DETAIL_BATCH_SOURCE_HPP
+
+#ifdef CRYPTO3_ZK_DETAIL_BATCH_SOURCE_HPP
+#error "You're mixing parallel and non-parallel crypto3 versions"
+#endif
+
+#include <functional>
+#include <memory>
+
+namespace nil {
+    namespace crypto3 {
+        namespace zk {
+            namespace detail {
+
+                /**
+                 * A batch of polynomials or a Merkle tree of a commitment scheme which is either in memory or read
+                 * on demand, e.g. from a spill file. Read it through load_batch() and keep the result only while
+                 * the batch is needed, so that at most one such batch is in memory at a time.
+                 */
+                template<typename T>
+                struct batch_source {
+                    const T *in_memory = nullptr;
+                    std::function<std::shared_ptr<const T>()> load;
+                };
+
+                // Batches passed by value or by pointer are in memory, they are never copied.
+                template<typename T>
+                std::shared_ptr<const T> load_batch(const T &batch) {
+                    return std::shared_ptr<const T>(std::shared_ptr<const T>(), &batch);
+                }
+
+                template<typename T>
+                std::shared_ptr<const T> load_batch(const T *batch) {
+                    return std::shared_ptr<const T>(std::shared_ptr<const T>(), batch);
+                }
+
+                template<typename T>
+                std::shared_ptr<const T> load_batch(const batch_source<T> &batch) {
+                    if (batch.in_memory != nullptr) {
+                        return load_batch(batch.in_memory);
+                    }
+                    return batch.load();
+                }
+            }    // namespace detail
+        }        // namespace zk
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // PARALLEL_CRYPTO3_ZK_DETAIL_BATCH_SOURCE_HPP
@@ -0,0 +1,115 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation <info@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef PARALLEL_CRYPTO3_ZK_PLONK_PLACEHOLDER_BATCH_VERIFIER_HPP
+#define PARALLEL_CRYPTO3_ZK_PLONK_PLACEHOLDER_BATCH_VERIFIER_HPP
+
+#ifdef CRYPTO3_ZK_PLONK_PLACEHOLDER_BATCH_VERIFIER_HPP
+#error "You're mixing parallel and non-parallel crypto3 versions"
+#endif
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <boost/assert.hpp>
+
+#include <nil/crypto3/zk/commitments/type_traits.hpp>
+#include <nil/crypto3/zk/snark/systems/plonk/placeholder/proof.hpp>
+#include <nil/crypto3/zk/snark/systems/plonk/placeholder/verifier.hpp>
+
+#include <nil/actor/core/thread_pool.hpp>
+#include <nil/actor/core/parallelization_utils.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace zk {
+            namespace snark {
+                /**
+                 * @brief Verifies many Placeholder proofs of the same circuit.
+                 *
+                 * Common data, the constraint system and the commitment scheme parameters are shared by all the
+                 * proofs. Proofs are verified in parallel. When the commitment scheme is LPC, Merkle nodes of the fixed values
+                 * commitment authenticated for one proof are reused by all the others.
+                 */
+                template<typename FieldType, typename ParamsType>
+                class placeholder_batch_verifier {
+                    using verifier_type = placeholder_verifier<FieldType, ParamsType>;
+                    using public_preprocessor_type = placeholder_public_preprocessor<FieldType, ParamsType>;
+                    using commitment_scheme_type = typename ParamsType::commitment_scheme_type;
+
+                public:
+                    using common_data_type = typename public_preprocessor_type::preprocessed_data_type::common_data_type;
+                    using proof_type = placeholder_proof<FieldType, ParamsType>;
+                    using public_input_type = std::vector<std::vector<typename FieldType::value_type>>;
+
+                    /**
+                     * @param commitment_scheme Scheme with the verifier parameters, every proof is checked with its
+                     *        own copy of it.
+                     * @param public_inputs Either empty, or the public input of every proof.
+                     * @return Verification result of every proof, in the order of 'proofs'.
+                     */
+                    static std::vector<bool> process(
+                        const common_data_type &common_data,
+                        const std::vector<proof_type> &proofs,
+                        const plonk_table_description<FieldType> &table_description,
+                        const plonk_constraint_system<FieldType> &constraint_system,
+                        const commitment_scheme_type &commitment_scheme,
+                        const std::vector<public_input_type> &public_inputs = {}
+                    ) {
+                        BOOST_ASSERT(public_inputs.empty() || public_inputs.size() == proofs.size());
+
+                        commitment_scheme_type shared_scheme = commitment_scheme;
+                        if constexpr (nil::crypto3::zk::is_lpc<commitment_scheme_type>) {
+                            using verified_nodes_type = typename commitment_scheme_type::fri_type::merkle_verified_nodes_type;
+                            shared_scheme.set_verified_nodes(
+                                std::make_shared<verified_nodes_type>(common_data.commitments.fixed_values));
+                        }
+
+                        auto verify = [&](std::size_t i) -> bool {
+                            commitment_scheme_type scheme = shared_scheme;
+                            if (public_inputs.empty()) {
+                                return verifier_type::process(
+                                    common_data, proofs[i], table_description, constraint_system, scheme);
+                            }
+                            return verifier_type::process(
+                                common_data, proofs[i], table_description, constraint_system, scheme,
+                                public_inputs[i]);
+                        };
+
+                        // std::vector<bool> can not be written from several threads.
+                        std::vector<std::uint8_t> results(proofs.size());
+                        // The verifier submits its own tasks to the LOW and HIGH pools only.
+                        parallel_for(0, proofs.size(), [&results, &verify](std::size_t i) {
+                            results[i] = verify(i);
+                        }, ThreadPool::PoolLevel::LASTPOOL);
+                        return std::vector<bool>(results.begin(), results.end());
+                    }
+                };
+            }    // namespace snark
+        }        // namespace zk
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // PARALLEL_CRYPTO3_ZK_PLONK_PLACEHOLDER_BATCH_VERIFIER_HPP
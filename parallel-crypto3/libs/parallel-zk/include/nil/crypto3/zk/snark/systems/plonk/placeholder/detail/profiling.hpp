@@ -146,7 +146,7 @@ namespace nil {
                         res.quotient_size = res.batches_sizes[cur++] = max_quotient_size < common_data.max_quotient_chunks? max_quotient_size: common_data.max_quotient_chunks;
                     }
 
-                    if(res.use_lookups) res.batches_sizes[cur++] = constraint_system.sorted_lookup_columns_number();
+                    if(res.use_lookups) res.batches_sizes[cur++] = lookup_batch_columns_number<PlaceholderParams>(constraint_system);
                     res.round_proof_layers_num = 0;
                     for(std::size_t i = 0; i < fri_params.r; i++ ){
                         res.round_proof_layers_num += log2(fri_params.D[i]->m) -1;
@@ -212,9 +212,9 @@ namespace nil {
                         res.points_num += res.lookup_poly_amount + 1;
                     }
                     res.points_num += res.quotient_size;
-                    res.points_num += constraint_system.sorted_lookup_columns_number() * 3;
+                    res.points_num += lookup_batch_columns_number<PlaceholderParams>(constraint_system) * 3;
 
-                    res.sorted_poly_amount = constraint_system.sorted_lookup_columns_number();
+                    res.sorted_poly_amount = lookup_batch_columns_number<PlaceholderParams>(constraint_system);
 
                     res.quotient_poly_first_index = 2 * res.permutation_size + 4 + res.table_values_num;
                     if( res.use_permutations ) res.quotient_poly_first_index += res.permutation_poly_amount + 1;
@@ -33,11 +33,13 @@
 #endif
 
 #include <unordered_map>
+#include <unordered_set>
 #include <iostream>
 #include <memory>
 
 #include <nil/crypto3/math/polynomial/polynomial.hpp>
 #include <nil/crypto3/math/polynomial/shift.hpp>
+#include <nil/crypto3/math/polynomial/polynomial_dfs_view.hpp>
 #include <nil/crypto3/math/domains/evaluation_domain.hpp>
 #include <nil/crypto3/math/algorithms/make_evaluation_domain.hpp>
 #include <nil/crypto3/zk/snark/arithmetization/plonk/assignment.hpp>
@@ -51,11 +53,13 @@
 #include <nil/crypto3/zk/snark/arithmetization/plonk/constraint_system.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/params.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/detail/placeholder_policy.hpp>
+#include <nil/crypto3/zk/snark/systems/plonk/placeholder/detail/column_cache.hpp>
 #include <nil/crypto3/zk/snark/arithmetization/plonk/constraint.hpp>
 #include <nil/crypto3/zk/math/expression.hpp>
 #include <nil/crypto3/zk/math/expression_evaluator.hpp>
 #include <nil/crypto3/zk/math/expression_visitors.hpp>
 
+#include <nil/crypto3/bench/memory_usage.hpp>
 #include <nil/crypto3/bench/scoped_profiler.hpp>
 
 #include <nil/actor/core/thread_pool.hpp>
@@ -82,30 +86,37 @@ namespace nil {
 
                     constexpr static const std::size_t argument_size = 1;
 
+                    using column_view_type = math::polynomial_dfs_rotated_view<polynomial_dfs_type>;
+                    using column_cache_type = detail::placeholder_column_cache<FieldType>;
+                    using column_ptr = typename column_cache_type::column_ptr;
+
+                    // Only unrotated columns are extended, every variable gets a view into its column, so
+                    // a column used with several rotations is stored and interpolated once.
                     static inline void build_variable_value_map(
                         const math::expression<variable_type>& expr,
                         const plonk_polynomial_dfs_table<FieldType>& assignments,
                         std::shared_ptr<math::evaluation_domain<FieldType>> domain,
                         std::size_t extended_domain_size,
-                        std::unordered_map<variable_type, polynomial_dfs_type>& variable_values_out,
+                        std::unordered_map<variable_type, column_ptr>& variable_values_out,
+                        std::unordered_map<variable_type, column_view_type>& variable_views_out,
                         const polynomial_dfs_type &mask_polynomial,
-                        const polynomial_dfs_type &lagrange_0
+                        const polynomial_dfs_type &lagrange_0,
+                        column_cache_type *column_cache = nullptr
                     ) {
 
-                        std::unordered_map<variable_type, size_t> variable_counts;
+                        std::unordered_set<variable_type> referenced_variables;
                         std::vector<variable_type> variables;
 
                         math::expression_for_each_variable_visitor<variable_type> visitor(
-                            [&variable_counts, &variables, &variable_values_out](const variable_type& var) {
-                                // Create the structure of the map so we can change the values later.
-                                if (variable_counts[var] == 0) {
-                                    variables.push_back(var);
-                                    // Create the structure of the map, so its values can be filled in parallel.
-                                    if (variable_values_out.find(var) == variable_values_out.end()) {
-                                        variable_values_out[var] = polynomial_dfs_type();
-                                    }
+                            [&referenced_variables, &variables, &variable_values_out](const variable_type& var) {
+                                referenced_variables.insert(var);
+                                variable_type column_var = var;
+                                column_var.rotation = 0;
+                                // Create the structure of the map, so its values can be filled in parallel.
+                                if (variable_values_out.find(column_var) == variable_values_out.end()) {
+                                    variables.push_back(column_var);
+                                    variable_values_out[column_var] = nullptr;
                                 }
-                                variable_counts[var]++;
                         });
 
                         visitor.visit(expr);
@@ -114,7 +125,7 @@ namespace nil {
                             math::make_evaluation_domain<FieldType>(extended_domain_size);
 
                         parallel_for(0, variables.size(),
-                            [&variables, &variable_values_out, &assignments, &domain, &extended_domain, extended_domain_size, &mask_polynomial, &lagrange_0](std::size_t i) {
+                            [&variables, &variable_values_out, &assignments, &domain, &extended_domain, extended_domain_size, &mask_polynomial, &lagrange_0, column_cache](std::size_t i) {
                                 const variable_type& var = variables[i];
 
                                 // Convert the variable to polynomial_dfs variable type.
@@ -122,19 +133,32 @@ namespace nil {
                                     static_cast<typename polynomial_dfs_variable_type::column_type>(
                                         static_cast<std::uint8_t>(var.type)));
 
+                                if (column_cache != nullptr) {
+                                    // The cache also holds the special selectors, see placeholder_prover.
+                                    variable_values_out[var] = column_cache->get(var_dfs, extended_domain_size);
+                                    return;
+                                }
+
                                 polynomial_dfs_type assignment;
                                 if( var.index == PLONK_SPECIAL_SELECTOR_ALL_USABLE_ROWS_SELECTED && var.type == variable_type::column_type::selector){
                                     assignment = mask_polynomial;
                                 } else if( var.index == PLONK_SPECIAL_SELECTOR_ALL_NON_FIRST_USABLE_ROWS_SELECTED && var.type == variable_type::column_type::selector) {
                                     assignment = mask_polynomial - lagrange_0;
                                 } else
-                                    assignment = assignments.get_variable_value(var_dfs, domain);
+                                    assignment = assignments.get_variable_value_without_rotation(var_dfs);
 
                                 // In parallel version we always resize the assignment poly, it's better for parallelization.
                                 // if (count > 1) {
                                 assignment.resize(extended_domain_size, domain, extended_domain);
-                                variable_values_out[var] = std::move(assignment);
+                                variable_values_out[var] = std::make_shared<polynomial_dfs_type>(std::move(assignment));
                             }, ThreadPool::PoolLevel::HIGH);
+
+                        for (const auto& var : referenced_variables) {
+                            variable_type column_var = var;
+                            column_var.rotation = 0;
+                            variable_views_out.emplace(
+                                var, column_view_type(*variable_values_out.at(column_var), var.rotation, domain->m));
+                        }
                     }
 
                     static inline std::array<polynomial_dfs_type, argument_size> prove_eval(
@@ -144,14 +168,41 @@ namespace nil {
                         std::uint32_t max_gates_degree,
                         const polynomial_dfs_type &mask_polynomial,
                         const polynomial_dfs_type &lagrange_0,
-                        transcript_type& transcript
+                        transcript_type& transcript,
+                        column_cache_type *column_cache = nullptr
+                    ) {
+                        typename FieldType::value_type theta = transcript.template challenge<FieldType>();
+
+                        std::array<polynomial_dfs_type, argument_size> F;
+                        F[0] = polynomial_dfs_type::zero();
+                        accumulate_eval(
+                            constraint_system, column_polynomials, original_domain, max_gates_degree,
+                            mask_polynomial, lagrange_0, theta, FieldType::value_type::one(), F[0], column_cache);
+                        return F;
+                    }
+
+                    /**
+                     * Adds alpha * F to 'accumulator', where F is the result of prove_eval with the challenge theta.
+                     * Lets the prover add the gates straight into the quotient, without a polynomial of their own.
+                     */
+                    static inline void accumulate_eval(
+                        const typename policy_type::constraint_system_type &constraint_system,
+                        const plonk_polynomial_dfs_table<FieldType> &column_polynomials,
+                        std::shared_ptr<math::evaluation_domain<FieldType>> original_domain,
+                        std::uint32_t max_gates_degree,
+                        const polynomial_dfs_type &mask_polynomial,
+                        const polynomial_dfs_type &lagrange_0,
+                        const typename FieldType::value_type &theta,
+                        const typename FieldType::value_type &alpha,
+                        polynomial_dfs_type &accumulator,
+                        column_cache_type *column_cache = nullptr
                     ) {
                         PROFILE_SCOPE("gate_argument_time");
+                        PROFILE_MEMORY_PHASE("gate_argument");
 
                         // max_gates_degree that comes from the outside does not take into account multiplication
                         // by selector.
                         ++max_gates_degree;
-                        typename FieldType::value_type theta = transcript.template challenge<FieldType>();
 
                         auto value_type_to_polynomial_dfs = [](
                             const typename variable_type::assignment_type& coeff) {
@@ -169,7 +220,8 @@ namespace nil {
                         extended_domain_sizes.push_back(max_domain_size / 2);
 
                         std::vector<math::expression<variable_type>> expressions(extended_domain_sizes.size());
-                        auto theta_acc = FieldType::value_type::one();
+                        // Alpha is folded into the powers of theta, it costs no extra pass.
+                        auto theta_acc = alpha;
 
                         // Every constraint has variable type 'variable_type', but we want it to use
                         // 'polynomial_dfs_variable_type' instead. The only difference is the coefficient type
@@ -205,39 +257,43 @@ namespace nil {
                             }
                         }
 
-                        std::array<polynomial_dfs_type, argument_size> F;
-
-                        F[0] = polynomial_dfs_type::zero();
                         for (std::size_t i = 0; i < extended_domain_sizes.size(); ++i) {
-                            std::unordered_map<variable_type, polynomial_dfs_type> variable_values;
+                            std::unordered_map<variable_type, column_ptr> variable_values;
+                            std::unordered_map<variable_type, column_view_type> variable_views;
 
                             build_variable_value_map(
                                 expressions[i], column_polynomials, original_domain,
-                                extended_domain_sizes[i], variable_values,
-                                mask_polynomial, lagrange_0
+                                extended_domain_sizes[i], variable_values, variable_views,
+                                mask_polynomial, lagrange_0, column_cache
                             );
+                            // The smaller extensions are read from the larger ones, which are not needed after that.
+                            if (column_cache != nullptr && i != 0) {
+                                column_cache->release(extended_domain_sizes[i - 1]);
+                            }
 
                             polynomial_dfs_type result(extended_domain_sizes[i] - 1, extended_domain_sizes[i]);
                             wait_for_all(parallel_run_in_chunks<void>(
                                 extended_domain_sizes[i],
-                                [&variable_values, &extended_domain_sizes, &result, &expressions, i]
+                                [&variable_views, &extended_domain_sizes, &result, &expressions, i]
                                 (std::size_t begin, std::size_t end) {
                                     for (std::size_t j = begin; j < end; ++j) {
                                         // Don't use cache here. In practice it's slower to maintain the cache
                                         // than to re-compute the subexpression value when value type is field element.
                                         math::expression_evaluator<variable_type> evaluator(
                                             expressions[i],
-                                            [&assignments=variable_values, j]
+                                            [&views=variable_views, j]
                                                 (const variable_type &var) -> const typename FieldType::value_type& {
-                                                    return assignments[var][j];
+                                                    return views.at(var)[j];
                                             });
                                         result[j] = evaluator.evaluate();
                                     }
                             }, ThreadPool::PoolLevel::HIGH));
 
-                            F[0] += result;
+                            accumulator += result;
                         };
-                        return F;
+                        if (column_cache != nullptr) {
+                            column_cache->release(extended_domain_sizes.back());
+                        }
                     }
 
                     static inline std::array<typename FieldType::value_type, argument_size>
@@ -0,0 +1,474 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation <info@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef PARALLEL_CRYPTO3_ZK_PLONK_PLACEHOLDER_LOGUP_ARGUMENT_HPP
+#define PARALLEL_CRYPTO3_ZK_PLONK_PLACEHOLDER_LOGUP_ARGUMENT_HPP
+
+#ifdef CRYPTO3_ZK_PLONK_PLACEHOLDER_LOGUP_ARGUMENT_HPP
+#error "You're mixing parallel and non-parallel crypto3 versions"
+#endif
+
+#include <algorithm>
+#include <numeric>
+#include <unordered_map>
+
+#include <nil/crypto3/math/polynomial/polynomial.hpp>
+#include <nil/crypto3/math/polynomial/shift.hpp>
+
+#include <nil/crypto3/zk/transcript/fiat_shamir.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/plonk/lookup_constraint.hpp>
+#include <nil/crypto3/zk/snark/systems/plonk/placeholder/params.hpp>
+#include <nil/crypto3/zk/snark/systems/plonk/placeholder/detail/placeholder_policy.hpp>
+#include <nil/crypto3/zk/snark/systems/plonk/placeholder/preprocessor.hpp>
+#include <nil/crypto3/zk/snark/systems/plonk/placeholder/lookup_argument.hpp>
+
+#include <nil/crypto3/bench/scoped_profiler.hpp>
+
+#include <nil/actor/core/thread_pool.hpp>
+#include <nil/actor/core/parallelization_utils.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace zk {
+            namespace snark {
+                namespace detail {
+                    // Replaces values[begin..end) with their inverses using a single field inversion (Montgomery's trick).
+                    template<typename ValueType, typename ContainerType>
+                    void batch_inverse_range(ContainerType &values, std::size_t begin, std::size_t end) {
+                        if (begin >= end) {
+                            return;
+                        }
+                        std::vector<ValueType> prefix_products(end - begin);
+                        ValueType acc = ValueType::one();
+                        for (std::size_t i = begin; i < end; ++i) {
+                            prefix_products[i - begin] = acc;
+                            acc *= values[i];
+                        }
+                        BOOST_ASSERT(!acc.is_zero());
+                        acc = acc.inversed();
+                        for (std::size_t i = end; i-- > begin;) {
+                            ValueType inversed = acc * prefix_products[i - begin];
+                            acc *= values[i];
+                            values[i] = inversed;
+                        }
+                    }
+                }    // namespace detail
+
+                /**
+                 * LogUp lookup argument, an alternative to placeholder_lookup_argument_prover.
+                 *
+                 * For compressed lookup inputs f_i, compressed table columns t_j and multiplicities m_j
+                 * it proves that on the usable rows
+                 *     \sum_i 1 / (gamma + f_i) - \sum_j m_j / (gamma + t_j) = 0
+                 * with a running sum S: S(1) = 0, S(omega * X) = S(X) + (sum of the row terms), S(omega^usable_rows) = 0.
+                 * Terms are split into the same parts as the Plookup ones, every part but the last one gets
+                 * a committed helper column h_k equal to the sum of its terms.
+                 *
+                 * The argument occupies the same places in the proof as Plookup: multiplicities are committed in
+                 * LOOKUP_BATCH instead of sorted columns, S and h_k are put into PERMUTATION_BATCH instead of V_L
+                 * and its parts. Theta is drawn by the base class constructor, no sorting is needed.
+                 */
+                template<typename FieldType, typename CommitmentSchemeTypePermutation, typename ParamsType>
+                class placeholder_logup_argument_prover
+                    : public placeholder_lookup_argument_prover<FieldType, CommitmentSchemeTypePermutation, ParamsType> {
+                    using base_type = placeholder_lookup_argument_prover<FieldType, CommitmentSchemeTypePermutation, ParamsType>;
+                    using value_type = typename FieldType::value_type;
+                    using polynomial_dfs_type = math::polynomial_dfs<value_type>;
+                    using commitment_scheme_type = CommitmentSchemeTypePermutation;
+
+                public:
+                    using prover_lookup_result = typename base_type::prover_lookup_result;
+
+                    using base_type::base_type;
+
+                    prover_lookup_result prove_eval() {
+                        PROFILE_SCOPE("LogUp argument prove eval time");
+
+                        const auto &common_data = this->preprocessed_data.common_data;
+                        const std::size_t domain_size = this->basic_domain->m;
+                        const std::size_t usable_rows = common_data.desc.usable_rows_amount;
+
+                        polynomial_dfs_type one_polynomial(0, domain_size, value_type::one());
+                        polynomial_dfs_type mask_assignment =
+                            one_polynomial - this->preprocessed_data.q_last - this->preprocessed_data.q_blind;
+
+                        std::unique_ptr<std::vector<polynomial_dfs_type>> lookup_value_ptr =
+                            this->prepare_lookup_value();
+                        std::unique_ptr<std::vector<polynomial_dfs_type>> lookup_input_ptr =
+                            this->prepare_lookup_input();
+                        const auto &lookup_value = *lookup_value_ptr;
+                        const auto &lookup_input = *lookup_input_ptr;
+
+                        // Terms of the argument on the basic domain: lookup inputs first, then table columns,
+                        // the order lookup_parts splits them in.
+                        std::vector<polynomial_dfs_type> terms(lookup_input.size() + lookup_value.size());
+                        parallel_for(0, terms.size(), [this, &terms, &lookup_input, &lookup_value, domain_size](std::size_t t) {
+                            terms[t] = this->reduce_dfs_polynomial_domain(
+                                t < lookup_input.size() ? lookup_input[t] : lookup_value[t - lookup_input.size()], domain_size);
+                        }, ThreadPool::PoolLevel::HIGH);
+
+                        // 1. Commit multiplicities
+                        std::vector<polynomial_dfs_type> multiplicities =
+                            compute_multiplicities(terms, lookup_input.size(), usable_rows);
+                        for (const auto &m : multiplicities) {
+                            this->commitment_scheme.append_to_batch(LOOKUP_BATCH, m);
+                        }
+                        typename commitment_scheme_type::commitment_type lookup_commitment =
+                            this->commitment_scheme.commit(LOOKUP_BATCH);
+                        this->transcript(lookup_commitment);
+
+                        // 2. Challenges
+                        value_type gamma = this->transcript.template challenge<FieldType>();
+
+                        auto part_sizes = this->constraint_system.lookup_parts(common_data.max_quotient_chunks);
+                        std::vector<value_type> lookup_alphas;
+                        for (std::size_t i = 0; i < part_sizes.size() - 1; i++) {
+                            lookup_alphas.push_back(this->transcript.template challenge<FieldType>());
+                        }
+                        BOOST_ASSERT(std::accumulate(part_sizes.begin(), part_sizes.end(), std::size_t(0)) == terms.size());
+
+                        // 3. Running sum and partial sums
+                        std::vector<polynomial_dfs_type> part_sums = compute_part_sums(
+                            std::move(terms), multiplicities, lookup_input.size(), gamma, part_sizes, usable_rows);
+
+                        polynomial_dfs_type S(domain_size - 1, domain_size, value_type::zero());
+                        parallel_for(0, usable_rows, [&S, &part_sums](std::size_t r) {
+                            for (const auto &part_sum : part_sums) {
+                                S[r + 1] += part_sum[r];
+                            }
+                        }, ThreadPool::PoolLevel::LOW);
+                        parallel_inclusive_scan(S.begin(), S.begin() + usable_rows + 1, S.begin(),
+                            std::plus<value_type>(), ThreadPool::PoolLevel::LOW);
+                        BOOST_ASSERT(S[usable_rows].is_zero());
+
+                        this->commitment_scheme.append_to_batch(PERMUTATION_BATCH, S);
+                        for (std::size_t i = 0; i < lookup_alphas.size(); i++) {
+                            this->commitment_scheme.append_to_batch(PERMUTATION_BATCH, part_sums[i]);
+                        }
+
+                        // 4. Constraints
+                        decltype(prover_lookup_result::F_dfs) F_dfs;
+                        F_dfs[0] = common_data.lagrange_0 * S;
+                        F_dfs[1] = this->preprocessed_data.q_last * S;
+
+                        // Part k with terms c_t / (gamma + a_t) gives numerator N_k and denominator D_k, and
+                        //     h_k * D_k - N_k = 0,                                  k < parts - 1,
+                        //     (S(omega * X) - S(X) - \sum_k h_k) * D_k - N_k = 0,   k = parts - 1.
+                        polynomial_dfs_type last_part_sum = math::polynomial_shift(S, 1, domain_size) - S;
+                        for (std::size_t k = 0; k < lookup_alphas.size(); k++) {
+                            last_part_sum -= part_sums[k];
+                        }
+                        std::vector<std::size_t> part_begins(1, 0);
+                        for (std::size_t k = 0; k < part_sizes.size(); k++) {
+                            part_begins.push_back(part_begins[k] + part_sizes[k]);
+                        }
+                        std::vector<polynomial_dfs_type> F_dfs_2_parts(part_sizes.size());
+                        parallel_for(0, part_sizes.size(),
+                            [this, &F_dfs_2_parts, &part_begins, &part_sums, &last_part_sum, &lookup_alphas,
+                             &lookup_input, &lookup_value, &multiplicities, &gamma](std::size_t k) {
+                                polynomial_dfs_type numerator;
+                                polynomial_dfs_type denominator;
+                                compute_part_fraction(lookup_input, lookup_value, multiplicities, gamma,
+                                                      part_begins[k], part_begins[k + 1], numerator, denominator);
+                                if (k < lookup_alphas.size()) {
+                                    F_dfs_2_parts[k] = lookup_alphas[k] * (part_sums[k] * denominator - numerator);
+                                } else {
+                                    F_dfs_2_parts[k] = last_part_sum * denominator - numerator;
+                                }
+                            }, ThreadPool::PoolLevel::LASTPOOL);
+                        F_dfs[2] = polynomial_sum<FieldType>(std::move(F_dfs_2_parts));
+                        F_dfs[2] *= mask_assignment;
+
+                        F_dfs[3] = polynomial_dfs_type(0, domain_size, value_type::zero());
+
+                        return {
+                            std::move(F_dfs),
+                            std::move(lookup_commitment)
+                        };
+                    }
+
+                private:
+                    // Counts how many times every compressed table value is looked up. The count is put on the
+                    // first occurrence of the value in the tables, other occurrences get zero.
+                    std::vector<polynomial_dfs_type> compute_multiplicities(
+                        const std::vector<polynomial_dfs_type> &terms,
+                        std::size_t inputs_count,
+                        std::size_t usable_rows
+                    ) {
+                        PROFILE_SCOPE("LogUp argument compute multiplicities");
+
+                        const std::size_t domain_size = this->basic_domain->m;
+                        std::unordered_map<value_type, std::size_t> counts;
+                        for (std::size_t i = 0; i < inputs_count; i++) {
+                            for (std::size_t r = 0; r < usable_rows; r++) {
+                                counts[terms[i][r]]++;
+                            }
+                        }
+
+                        std::vector<polynomial_dfs_type> multiplicities(
+                            terms.size() - inputs_count,
+                            polynomial_dfs_type(domain_size - 1, domain_size, value_type::zero()));
+                        for (std::size_t j = 0; j < multiplicities.size(); j++) {
+                            for (std::size_t r = 0; r < usable_rows; r++) {
+                                auto it = counts.find(terms[inputs_count + j][r]);
+                                if (it != counts.end() && it->second != 0) {
+                                    multiplicities[j][r] = value_type(it->second);
+                                    it->second = 0;
+                                }
+                            }
+                        }
+                        // Every looked up value must be present in some table.
+                        BOOST_ASSERT(std::all_of(counts.begin(), counts.end(),
+                                                 [](const auto &count) { return count.second == 0; }));
+                        return multiplicities;
+                    }
+
+                    // Sums c_t / (gamma + a_t) over the terms of every part on the usable rows, where c_t is 1
+                    // for lookup inputs and -m_j for table columns. Inverses are found with batch inversion.
+                    std::vector<polynomial_dfs_type> compute_part_sums(
+                        std::vector<polynomial_dfs_type> terms,
+                        const std::vector<polynomial_dfs_type> &multiplicities,
+                        std::size_t inputs_count,
+                        const value_type &gamma,
+                        const std::vector<std::size_t> &part_sizes,
+                        std::size_t usable_rows
+                    ) {
+                        PROFILE_SCOPE("LogUp argument compute part sums");
+
+                        const std::size_t domain_size = this->basic_domain->m;
+                        // Every chunk of rows pays for one field inversion.
+                        parallel_for(0, terms.size(), [&terms, &multiplicities, &gamma, inputs_count, usable_rows](std::size_t t) {
+                            auto &term = terms[t];
+                            wait_for_all(parallel_run_in_chunks<void>(
+                                usable_rows,
+                                [&term, &multiplicities, &gamma, inputs_count, t](std::size_t begin, std::size_t end) {
+                                    for (std::size_t r = begin; r < end; r++) {
+                                        term[r] += gamma;
+                                    }
+                                    detail::batch_inverse_range<value_type>(term, begin, end);
+                                    if (t >= inputs_count) {
+                                        const auto &m = multiplicities[t - inputs_count];
+                                        for (std::size_t r = begin; r < end; r++) {
+                                            term[r] *= -m[r];
+                                        }
+                                    }
+                                }, ThreadPool::PoolLevel::LOW));
+                        }, ThreadPool::PoolLevel::HIGH);
+
+                        std::vector<std::size_t> part_begins(1, 0);
+                        for (std::size_t k = 0; k < part_sizes.size(); k++) {
+                            part_begins.push_back(part_begins[k] + part_sizes[k]);
+                        }
+                        std::vector<polynomial_dfs_type> part_sums(
+                            part_sizes.size(), polynomial_dfs_type(domain_size - 1, domain_size, value_type::zero()));
+                        parallel_for(0, usable_rows, [&terms, &part_sums, &part_begins](std::size_t r) {
+                            for (std::size_t k = 0; k < part_sums.size(); k++) {
+                                for (std::size_t t = part_begins[k]; t < part_begins[k + 1]; t++) {
+                                    part_sums[k][r] += terms[t][r];
+                                }
+                            }
+                        }, ThreadPool::PoolLevel::LOW);
+                        return part_sums;
+                    }
+
+                    // Brings terms [begin, end) to a common denominator: \sum c_t / (gamma + a_t) = numerator / denominator.
+                    // All factors are moved to one domain large enough for the constraint of the part, so the
+                    // numerator and the denominator are accumulated pointwise, without a resize on every step.
+                    void compute_part_fraction(
+                        const std::vector<polynomial_dfs_type> &lookup_input,
+                        const std::vector<polynomial_dfs_type> &lookup_value,
+                        const std::vector<polynomial_dfs_type> &multiplicities,
+                        const value_type &gamma,
+                        std::size_t begin,
+                        std::size_t end,
+                        polynomial_dfs_type &numerator,
+                        polynomial_dfs_type &denominator
+                    ) {
+                        PROFILE_SCOPE("LogUp argument compute part fraction");
+
+                        auto term = [&lookup_input, &lookup_value](std::size_t t) -> const polynomial_dfs_type& {
+                            return t < lookup_input.size() ? lookup_input[t] : lookup_value[t - lookup_input.size()];
+                        };
+
+                        std::size_t denominator_degree = 0;
+                        for (std::size_t t = begin; t < end; t++) {
+                            denominator_degree += term(t).degree();
+                        }
+                        // The constraint multiplies the denominator by h_k or S, both of degree rows_amount - 1.
+                        const std::size_t degree = denominator_degree + this->basic_domain->m - 1;
+                        const std::size_t size = math::detail::power_of_two(degree + 1);
+                        auto domain = math::make_evaluation_domain<FieldType>(size);
+
+                        numerator = polynomial_dfs_type(degree, size, value_type::zero());
+                        denominator = polynomial_dfs_type(denominator_degree, size, value_type::one());
+                        for (std::size_t t = begin; t < end; t++) {
+                            polynomial_dfs_type factor = term(t);
+                            factor.resize(size, nullptr, domain);
+                            if (t < lookup_input.size()) {
+                                parallel_for(0, size, [&numerator, &denominator, &factor, &gamma](std::size_t i) {
+                                    factor[i] += gamma;
+                                    numerator[i] = numerator[i] * factor[i] + denominator[i];
+                                    denominator[i] *= factor[i];
+                                }, ThreadPool::PoolLevel::LOW);
+                            } else {
+                                polynomial_dfs_type m = multiplicities[t - lookup_input.size()];
+                                m.resize(size, nullptr, domain);
+                                parallel_for(0, size, [&numerator, &denominator, &factor, &m, &gamma](std::size_t i) {
+                                    factor[i] += gamma;
+                                    numerator[i] = numerator[i] * factor[i] - m[i] * denominator[i];
+                                    denominator[i] *= factor[i];
+                                }, ThreadPool::PoolLevel::LOW);
+                            }
+                        }
+                    }
+                };
+
+                template<typename FieldType, typename CommitmentSchemeTypePermutation, typename ParamsType>
+                class placeholder_logup_argument_verifier {
+                    using transcript_hash_type = typename ParamsType::transcript_hash_type;
+                    using transcript_type = transcript::fiat_shamir_heuristic_sequential<transcript_hash_type>;
+                    using value_type = typename FieldType::value_type;
+                    using VariableType = plonk_variable<value_type>;
+
+                    static constexpr std::size_t argument_size = 4;
+
+                    typedef detail::placeholder_policy<FieldType, ParamsType> policy_type;
+
+                public:
+                    // Takes the same arguments as placeholder_lookup_argument_verifier::verify_eval, 'sorted' holds
+                    // evaluations of the multiplicities, 'V_L_values' of the running sum and 'parts_values' of the
+                    // partial sums.
+                    std::array<value_type, argument_size> verify_eval(
+                        const typename placeholder_public_preprocessor<FieldType, ParamsType>::preprocessed_data_type::common_data_type &common_data,
+                        const std::vector<value_type> &special_selector_values,
+                        const std::vector<value_type> &special_selector_values_shifted,
+                        const plonk_constraint_system<FieldType> &constraint_system,
+                        // y
+                        const value_type &challenge,
+                        typename policy_type::evaluation_map &evaluations,
+                        // multiplicities at y, omega * y, omega^usable_rows * y
+                        const std::vector<std::vector<value_type>> &sorted,
+                        // S(y), S(omega * y)
+                        std::vector<value_type> V_L_values,
+                        // h_k(y)
+                        std::vector<value_type> parts_values,
+                        const typename CommitmentSchemeTypePermutation::commitment_type &lookup_commitment,
+                        transcript_type &transcript = transcript_type()
+                    ) {
+                        const auto &lookup_gates = constraint_system.lookup_gates();
+                        const auto &lookup_tables = constraint_system.lookup_tables();
+                        std::array<value_type, argument_size> F;
+
+                        value_type theta = transcript.template challenge<FieldType>();
+                        transcript(lookup_commitment);
+
+                        const value_type one = value_type::one();
+                        value_type theta_acc;
+
+                        std::vector<value_type> lookup_input;
+                        for (const auto &gate : lookup_gates) {
+                            auto key = std::tuple(gate.tag_index, 0, VariableType::column_type::selector);
+                            value_type selector_value = evaluations[key];
+                            for (const auto &constraint : gate.constraints) {
+                                value_type l = selector_value * constraint.table_id;
+                                theta_acc = theta;
+                                for (std::size_t k = 0; k < constraint.lookup_input.size(); k++) {
+                                    l += selector_value * theta_acc * constraint.lookup_input[k].evaluate(evaluations);
+                                    theta_acc *= theta;
+                                }
+                                lookup_input.push_back(l);
+                            }
+                        }
+
+                        std::vector<value_type> lookup_value;
+                        for (std::size_t t_id = 0; t_id < lookup_tables.size(); t_id++) {
+                            const auto &table = lookup_tables[t_id];
+                            auto key = std::tuple(table.tag_index, 0, VariableType::column_type::selector);
+                            value_type selector_value = evaluations[key];
+                            for (const auto &option : table.lookup_options) {
+                                value_type v = selector_value * (t_id + 1);
+                                theta_acc = theta;
+                                BOOST_ASSERT(option.size() == table.columns_number);
+                                for (const auto &column : option) {
+                                    auto column_key = std::tuple(column.index, 0, column.type);
+                                    v += theta_acc * evaluations[column_key] * selector_value;
+                                    theta_acc *= theta;
+                                }
+                                lookup_value.push_back(v);
+                            }
+                        }
+                        BOOST_ASSERT(lookup_value.size() == sorted.size());
+
+                        value_type gamma = transcript.template challenge<FieldType>();
+
+                        auto parts = constraint_system.lookup_parts(common_data.max_quotient_chunks);
+                        std::vector<value_type> lookup_alphas;
+                        for (std::size_t i = 0; i < parts.size() - 1; i++) {
+                            lookup_alphas.push_back(transcript.template challenge<FieldType>());
+                        }
+                        BOOST_ASSERT(lookup_alphas.size() == parts_values.size());
+
+                        const value_type &S_value = V_L_values[0];
+                        const value_type &S_shifted_value = V_L_values[1];
+
+                        F[2] = value_type::zero();
+                        value_type last_part_sum = S_shifted_value - S_value;
+                        std::size_t t = 0;
+                        for (std::size_t k = 0; k < parts.size(); k++) {
+                            value_type numerator = value_type::zero();
+                            value_type denominator = one;
+                            for (std::size_t i = 0; i < parts[k]; i++, t++) {
+                                if (t < lookup_input.size()) {
+                                    value_type factor = gamma + lookup_input[t];
+                                    numerator = numerator * factor + denominator;
+                                    denominator *= factor;
+                                } else {
+                                    const std::size_t j = t - lookup_input.size();
+                                    value_type factor = gamma + lookup_value[j];
+                                    numerator = numerator * factor - sorted[j][0] * denominator;
+                                    denominator *= factor;
+                                }
+                            }
+                            if (k < lookup_alphas.size()) {
+                                F[2] += lookup_alphas[k] * (parts_values[k] * denominator - numerator);
+                                last_part_sum -= parts_values[k];
+                            } else {
+                                F[2] += last_part_sum * denominator - numerator;
+                            }
+                        }
+                        BOOST_ASSERT(t == lookup_input.size() + lookup_value.size());
+                        F[2] *= one - (special_selector_values[1] + special_selector_values[2]);
+
+                        F[0] = special_selector_values[0] * S_value;
+                        F[1] = special_selector_values[1] * S_value;
+                        F[3] = value_type::zero();
+                        return F;
+                    }
+                };
+            }    // namespace snark
+        }        // namespace zk
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // PARALLEL_CRYPTO3_ZK_PLONK_PLACEHOLDER_LOGUP_ARGUMENT_HPP
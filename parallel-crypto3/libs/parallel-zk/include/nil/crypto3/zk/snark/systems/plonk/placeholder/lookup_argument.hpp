@@ -35,11 +35,16 @@
 #error "You're mixing parallel and non-parallel crypto3 versions"
 #endif
 
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <stdexcept>
 #include <unordered_map>
 #include <thread>
 
 #include <nil/crypto3/math/polynomial/polynomial.hpp>
 #include <nil/crypto3/math/polynomial/shift.hpp>
+#include <nil/crypto3/math/polynomial/polynomial_dfs_view.hpp>
 #include <nil/crypto3/math/domains/evaluation_domain.hpp>
 #include <nil/crypto3/math/algorithms/make_evaluation_domain.hpp>
 
@@ -51,6 +56,7 @@
 #include <nil/crypto3/zk/snark/arithmetization/plonk/lookup_constraint.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/params.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/detail/placeholder_policy.hpp>
+#include <nil/crypto3/zk/snark/systems/plonk/placeholder/detail/column_cache.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/preprocessor.hpp>
 
 #include <nil/crypto3/bench/scoped_profiler.hpp>
@@ -124,6 +130,7 @@ namespace nil {
                     using VariableType = plonk_variable<typename FieldType::value_type>;
                     using DfsVariableType = plonk_variable<polynomial_dfs_type>;
                     using commitment_scheme_type = CommitmentSchemeTypePermutation;
+                    using column_cache_type = detail::placeholder_column_cache<FieldType>;
 
 
                     static constexpr std::size_t argument_size = 4;
@@ -144,7 +151,8 @@ namespace nil {
                                 &preprocessed_data,
                             const plonk_polynomial_dfs_table<FieldType>& plonk_columns,
                             commitment_scheme_type &commitment_scheme,
-                            transcript_type &transcript)
+                            transcript_type &transcript,
+                            column_cache_type *column_cache = nullptr)
                         : constraint_system(constraint_system)
                         , preprocessed_data(preprocessed_data)
                         , plonk_columns(plonk_columns)
@@ -154,29 +162,40 @@ namespace nil {
                         , lookup_gates(constraint_system.lookup_gates())
                         , lookup_tables(constraint_system.lookup_tables())
                         , lookup_chunks(0)
+                        , column_cache(column_cache)
                     {
+                        // Without a cache shared with the other arguments, the extensions are only shared
+                        // between lookup inputs and values.
+                        if (this->column_cache == nullptr) {
+                            own_column_cache = std::make_unique<column_cache_type>(plonk_columns, basic_domain);
+                            polynomial_dfs_type mask_assignment(0, basic_domain->m, FieldType::value_type::one());
+                            mask_assignment -= preprocessed_data.q_last;
+                            mask_assignment -= preprocessed_data.q_blind;
+                            own_column_cache->set_special_selectors(
+                                mask_assignment, preprocessed_data.common_data.lagrange_0);
+                            this->column_cache = own_column_cache.get();
+                        }
+
                         // $/theta = \challenge$
                         theta = transcript.template challenge<FieldType>();
                     }
 
                     prover_lookup_result prove_eval() {
                         PROFILE_SCOPE("Lookup argument prove eval time");
+                        PROFILE_SCOPE_CALLS("Lookup argument prove eval");
 
                         // Construct lookup gates
                         polynomial_dfs_type one_polynomial(
                             0, basic_domain->m, FieldType::value_type::one());
                         polynomial_dfs_type zero_polynomial(
                             0, basic_domain->m, FieldType::value_type::zero());
-                        polynomial_dfs_type mask_assignment =
-                            one_polynomial -  preprocessed_data.q_last - preprocessed_data.q_blind;
-                        polynomial_dfs_type lagrange0 = preprocessed_data.common_data.lagrange_0;
 
                         std::unique_ptr<std::vector<polynomial_dfs_type>> lookup_value_ptr =
-                            prepare_lookup_value(mask_assignment, lagrange0);
+                            prepare_lookup_value();
                         auto& lookup_value = *lookup_value_ptr;
 
                         std::unique_ptr<std::vector<polynomial_dfs_type>> lookup_input_ptr =
-                            prepare_lookup_input(mask_assignment, lagrange0);
+                            prepare_lookup_input();
                         auto& lookup_input = *lookup_input_ptr;
 
 
@@ -331,10 +350,12 @@ namespace nil {
 
                         std::vector<polynomial_dfs_type> F_dfs_3_parts(std::next(sorted.begin(), 1), sorted.end());
                         parallel_for(0, F_dfs_3_parts.size(), [this, &F_dfs_3_parts, &alpha_challenges, &sorted](std::size_t i) {
-                            polynomial_dfs_type sorted_shifted = math::polynomial_shift(
+                            math::polynomial_dfs_rotated_view<polynomial_dfs_type> sorted_shifted(
                                 sorted[i], preprocessed_data.common_data.desc.usable_rows_amount,
                                 basic_domain->m);
-                            F_dfs_3_parts[i] -= sorted_shifted;
+                            parallel_for(0, F_dfs_3_parts[i].size(), [&F_dfs_3_parts, &sorted_shifted, i](std::size_t j) {
+                                F_dfs_3_parts[i][j] -= sorted_shifted[j];
+                            }, ThreadPool::PoolLevel::LOW);
                             F_dfs_3_parts[i] *= alpha_challenges[i] * preprocessed_data.common_data.lagrange_0;
                         }, ThreadPool::PoolLevel::HIGH);
 
@@ -381,9 +402,8 @@ namespace nil {
                                         g_multipliers[i - lookup_part_start_indices[current_part]] =
                                             (one + beta) * (gamma + lookup_input[i]);
                                     } else {
-                                        auto lookup_shifted = math::polynomial_shift(lookup_value[i - lookup_input.size()], 1, this->basic_domain->m);
                                         g_multipliers[i - lookup_part_start_indices[current_part]] =
-                                            part1 + lookup_value[i - lookup_input.size()] + beta * lookup_shifted;
+                                            this->shifted_combination(lookup_value[i - lookup_input.size()], part1, beta);
                                     }
                                 }, ThreadPool::PoolLevel::HIGH);
                                 result[current_part] = math::polynomial_product<FieldType>(std::move(g_multipliers));
@@ -418,9 +438,8 @@ namespace nil {
 
                                 parallel_for(lookup_part_start_indices[current_part], lookup_part_start_indices[current_part + 1],
                                     [&sorted, &h_multipliers, &one, &beta, &gamma, &lookup_part_start_indices, &current_part, this](std::size_t i) {
-                                    auto sorted_shifted = math::polynomial_shift(sorted[i], 1, this->basic_domain->m);
                                     h_multipliers[i - lookup_part_start_indices[current_part]] =
-                                        (one + beta) * gamma + sorted[i] + beta * sorted_shifted;
+                                        this->shifted_combination(sorted[i], (one + beta) * gamma, beta);
 
                                 }, ThreadPool::PoolLevel::HIGH);
                                 result[current_part] = math::polynomial_product<FieldType>(std::move(h_multipliers));
@@ -464,55 +483,57 @@ namespace nil {
                             V_L[k] *= h_tmp.inversed();
                         }, ThreadPool::PoolLevel::HIGH);
 
-                        // TODO(martun): we can parallize the lower loop as well, but it's fast enough to ignore for now.
-                        for (std::size_t k = 1; k <= preprocessed_data.common_data.desc.usable_rows_amount; k++) {
-                            V_L[k] *= V_L[k-1];
-                        }
+                        parallel_inclusive_scan(V_L.begin(),
+                            V_L.begin() + preprocessed_data.common_data.desc.usable_rows_amount + 1, V_L.begin(),
+                            std::multiplies<typename FieldType::value_type>(), ThreadPool::PoolLevel::LOW);
 
                         return V_L;
                     }
 
-                    std::unique_ptr<std::vector<polynomial_dfs_type>> prepare_lookup_value(
-                        const polynomial_dfs_type &mask_assignment,
-                        const polynomial_dfs_type &lagrange0
-                    ) {
+                    std::unique_ptr<std::vector<polynomial_dfs_type>> prepare_lookup_value() {
                         PROFILE_SCOPE("Lookup argument preparing lookup value");
 
                         // Prepare lookup value
                         auto lookup_value_ptr = std::make_unique<std::vector<polynomial_dfs_type>>();
                         for (std::size_t t_id = 0; t_id < lookup_tables.size(); t_id++) {
                             const plonk_lookup_table<FieldType> &l_table = lookup_tables[t_id];
-                            polynomial_dfs_type lookup_tag;
-                            if(l_table.tag_index == PLONK_SPECIAL_SELECTOR_ALL_USABLE_ROWS_SELECTED )
-                                lookup_tag = mask_assignment;
-                            else if( l_table.tag_index == PLONK_SPECIAL_SELECTOR_ALL_NON_FIRST_USABLE_ROWS_SELECTED )
-                                lookup_tag = mask_assignment - lagrange0;
-                            else
-                                lookup_tag = plonk_columns.selector(l_table.tag_index);
+                            const VariableType tag_var(
+                                l_table.tag_index, 0, false, VariableType::column_type::selector);
+                            const std::size_t tag_degree = column_cache->get(tag_var, basic_domain->m)->degree();
 
                             // Increase the size to fit the next table values.
                             std::size_t lookup_values_used = lookup_value_ptr->size();
                             lookup_value_ptr->resize(lookup_values_used + l_table.lookup_options.size());
 
                             parallel_for(0, l_table.lookup_options.size(),
-                                [&l_table, t_id, &lookup_tag, this, &mask_assignment, &lookup_value_ptr, lookup_values_used](std::size_t o_id) {
-                                    polynomial_dfs_type v = (typename FieldType::value_type(t_id + 1)) * lookup_tag;
+                                [&l_table, t_id, &tag_var, tag_degree, this, &lookup_value_ptr, lookup_values_used](std::size_t o_id) {
+                                    // All the products are taken on the domain of the one of the highest degree,
+                                    // the tag and the columns are extended to it once, by the column cache.
+                                    std::size_t columns_degree = 0;
+                                    for (std::size_t i = 0; i < l_table.columns_number; i++) {
+                                        columns_degree = std::max(columns_degree, column_cache->get(
+                                            l_table.lookup_options[o_id][i], basic_domain->m)->degree());
+                                    }
+                                    const std::size_t size = math::detail::power_of_two(
+                                        std::max<std::size_t>(basic_domain->m, tag_degree + columns_degree + 1));
+                                    auto lookup_tag = column_cache->get(tag_var, size);
+
+                                    polynomial_dfs_type v = (typename FieldType::value_type(t_id + 1)) * *lookup_tag;
                                     typename FieldType::value_type theta_acc = this->theta;
                                     for (std::size_t i = 0; i < l_table.columns_number; i++) {
-                                        v += theta_acc * lookup_tag * plonk_columns.get_variable_value_without_rotation(
-                                            l_table.lookup_options[o_id][i]);
+                                        polynomial_dfs_type c = *column_cache->get(l_table.lookup_options[o_id][i], size);
+                                        c *= *lookup_tag;
+                                        c *= theta_acc;
+                                        v += c;
                                         theta_acc *= this->theta;
                                     }
-                                    (*lookup_value_ptr)[lookup_values_used + o_id] = v;
+                                    (*lookup_value_ptr)[lookup_values_used + o_id] = std::move(v);
                                 }, ThreadPool::PoolLevel::HIGH);
                         }
                         return std::move(lookup_value_ptr);
                     }
 
-                    std::unique_ptr<std::vector<polynomial_dfs_type>> prepare_lookup_input(
-                        const polynomial_dfs_type &mask_assignment,
-                        const polynomial_dfs_type &lagrange0
-                    ) {
+                    std::unique_ptr<std::vector<polynomial_dfs_type>> prepare_lookup_input() {
                         PROFILE_SCOPE("Lookup argument preparing lookup input");
 
                         using polynomial_dfs_variable_type = plonk_variable<polynomial_dfs_type>;
@@ -520,14 +541,9 @@ namespace nil {
                         // Prepare lookup input
                         auto lookup_input_ptr = std::make_unique<std::vector<polynomial_dfs_type>>();
                         for (const auto &gate : lookup_gates) {
-                            polynomial_dfs_type lookup_selector;
-                            if( gate.tag_index == PLONK_SPECIAL_SELECTOR_ALL_USABLE_ROWS_SELECTED ){
-                                lookup_selector = mask_assignment;
-                            } else if( gate.tag_index == PLONK_SPECIAL_SELECTOR_ALL_NON_FIRST_USABLE_ROWS_SELECTED ){
-                                lookup_selector = mask_assignment - lagrange0;
-                            } else {
-                                lookup_selector = plonk_columns.selector(gate.tag_index);
-                            }
+                            const VariableType selector_var(
+                                gate.tag_index, 0, false, VariableType::column_type::selector);
+                            const polynomial_dfs_type &lookup_selector = *column_cache->get(selector_var, basic_domain->m);
 
                             // Increase the size to fit the next table values.
                             std::size_t lookup_inputs_used = lookup_input_ptr->size();
@@ -535,7 +551,7 @@ namespace nil {
 
                             // Do NOT capture converter by reference.
                             parallel_for(0, gate.constraints.size(),
-                                [&lookup_input_ptr, this, &gate, &lookup_selector, lookup_inputs_used](std::size_t index) {
+                                [&lookup_input_ptr, this, &gate, &selector_var, &lookup_selector, lookup_inputs_used](std::size_t index) {
                                     // Create the converter.
                                     auto value_type_to_polynomial_dfs = [](const typename VariableType::assignment_type& coeff) {
                                         return polynomial_dfs_type(0, 1, coeff);
@@ -549,29 +565,23 @@ namespace nil {
                                     for(std::size_t k = 0; k < constraint.lookup_input.size(); k++){
                                         math::expression<DfsVariableType> expr = converter.convert(constraint.lookup_input[k]);
 
-                                        // For each variable with a rotation pre-compute its value.
-                                        std::unordered_map<polynomial_dfs_variable_type, polynomial_dfs_type> rotated_variable_values;
-
-                                        math::expression_for_each_variable_visitor<polynomial_dfs_variable_type> visitor(
-                                            [&rotated_variable_values, &assignments=plonk_columns, &domain=basic_domain]
-                                            (const polynomial_dfs_variable_type& var) {
-                                                if (var.rotation == 0)
-                                                    return;
-                                                rotated_variable_values[var] = assignments.get_variable_value(var, domain);
-                                        });
-                                        visitor.visit(expr);
-
+                                        // Rotated variables are read through views of the columns.
                                         math::cached_expression_evaluator<DfsVariableType> evaluator(expr,
-                                            [&domain=basic_domain, &assignments=plonk_columns, &rotated_variable_values]
+                                            [&assignments=plonk_columns]
                                             (const polynomial_dfs_variable_type &var) -> const polynomial_dfs_type& {
-                                                if (var.rotation == 0) {
-                                                    return assignments.get_variable_value_without_rotation(var);
-                                                }
-                                                return rotated_variable_values[var];
-                                            }
+                                                return assignments.get_variable_value_without_rotation(var);
+                                            },
+                                            this->basic_domain->m
                                         );
 
-                                        l += theta_acc * lookup_selector * evaluator.evaluate();
+                                        // The selector is extended to the domain of the product by the column cache.
+                                        polynomial_dfs_type input = evaluator.evaluate();
+                                        const std::size_t size = math::detail::power_of_two(std::max(
+                                            {this->basic_domain->m, input.size(), lookup_selector.degree() + input.degree() + 1}));
+                                        input.resize(size);
+                                        input *= *column_cache->get(selector_var, size);
+                                        input *= theta_acc;
+                                        l += input;
                                         theta_acc *= this->theta;
                                     }
                                     (*lookup_input_ptr)[lookup_inputs_used + index] = l;
@@ -581,7 +591,21 @@ namespace nil {
                     }
 
 
-                private:
+                protected:
+
+                    // constant + column(X) + beta * column(omega * X) in one pass, the shifted column is not copied.
+                    polynomial_dfs_type shifted_combination(
+                        const polynomial_dfs_type &column,
+                        const typename FieldType::value_type &constant,
+                        const typename FieldType::value_type &beta
+                    ) const {
+                        math::polynomial_dfs_rotated_view<polynomial_dfs_type> shifted(column, 1, basic_domain->m);
+                        polynomial_dfs_type result(column.degree(), column.size());
+                        parallel_for(0, column.size(), [&result, &column, &shifted, &constant, &beta](std::size_t j) {
+                            result[j] = constant + column[j] + beta * shifted[j];
+                        }, ThreadPool::PoolLevel::LOW);
+                        return result;
+                    }
 
                     polynomial_dfs_type reduce_dfs_polynomial_domain(
                         const polynomial_dfs_type &polynomial,
@@ -649,6 +673,10 @@ namespace nil {
                     // similar values only with negligible probability.
                     // So similar values in compressed lookup tables vectors repeated values may be only in one column
                     // near each other.
+                    //
+                    // The values are split into shards by their hash, the hash is taken over the raw (Montgomery) limbs,
+                    // so no conversion is done. Every shard is counted by a single thread with its own small map, then
+                    // the output position of every table value is found by a prefix sum and the values are written in parallel.
                     std::vector<polynomial_dfs_type> sort_polynomials(
                         const std::vector<polynomial_dfs_type>& reduced_input,
                         const std::vector<polynomial_dfs_type>& reduced_value,
@@ -656,49 +684,126 @@ namespace nil {
                         std::size_t usable_rows_amount
                     ) {
                         PROFILE_SCOPE("Sort Polynomials");
+                        PROFILE_SCOPE_CALLS("Lookup argument sort polynomials");
 
-                        //  Build sorting map
-                        std::unordered_map<typename FieldType::value_type, std::size_t> sorting_map;
-                        for (std::size_t i = 0; i < reduced_value.size(); i++) {
-                            for (std::size_t j = 0; j < usable_rows_amount; j++) {
-                                sorting_map[reduced_value[i][j]] = 1;
-                            }
+                        using value_type = typename FieldType::value_type;
+
+                        const std::size_t workers = ThreadPool::get_instance(ThreadPool::PoolLevel::HIGH).get_pool_size();
+                        std::size_t shards_bits = 0;
+                        while ((std::size_t(1) << shards_bits) < 4 * workers) {
+                            shards_bits++;
                         }
+                        const std::size_t shards_count = std::size_t(1) << shards_bits;
+
+                        auto shard_of = [shards_bits](const value_type& value) -> std::uint32_t {
+                            if (shards_bits == 0) {
+                                return 0;
+                            }
+                            // Fibonacci hashing, so that the shard does not depend on the same bits as the buckets
+                            // of the maps inside the shards.
+                            std::uint64_t h = std::hash<value_type>()(value);
+                            return (h * 0x9E3779B97F4A7C15ull) >> (64 - shards_bits);
+                        };
+
+                        // Returns the flat indices of the first 'usable_rows_amount' rows of 'polys', grouped by shard.
+                        // Inside a shard the indices are increasing. 'shard_begin[s]' is the start of shard 's'.
+                        auto partition_by_shard = [&](const std::vector<polynomial_dfs_type>& polys,
+                                                      std::vector<std::size_t>& shard_begin) {
+                            const std::size_t total = polys.size() * usable_rows_amount;
+                            const std::size_t chunks = std::max<std::size_t>(1, std::min(workers, total));
+                            std::vector<std::uint32_t> shards(total);
+                            std::vector<std::vector<std::size_t>> counts(chunks, std::vector<std::size_t>(shards_count, 0));
+
+                            parallel_for(0, chunks, [&](std::size_t chunk) {
+                                for (std::size_t k = total * chunk / chunks; k < total * (chunk + 1) / chunks; k++) {
+                                    shards[k] = shard_of(polys[k / usable_rows_amount][k % usable_rows_amount]);
+                                    counts[chunk][shards[k]]++;
+                                }
+                            }, ThreadPool::PoolLevel::HIGH);
+
+                            // Turn counts into write offsets, ordered by shard first and by chunk second.
+                            shard_begin.assign(shards_count + 1, 0);
+                            std::size_t offset = 0;
+                            for (std::size_t s = 0; s < shards_count; s++) {
+                                shard_begin[s] = offset;
+                                for (std::size_t chunk = 0; chunk < chunks; chunk++) {
+                                    std::size_t count = counts[chunk][s];
+                                    counts[chunk][s] = offset;
+                                    offset += count;
+                                }
+                            }
+                            shard_begin[shards_count] = offset;
 
-                        for (std::size_t i = 0; i < reduced_input.size(); i++) {
-                            for (std::size_t j = 0; j < usable_rows_amount; j++) {
-                                // This assert means that every value \in keys of sorting_map = set of values of reduced_value
-                                BOOST_ASSERT(sorting_map.find(reduced_input[i][j]) != sorting_map.end());
-                                sorting_map[reduced_input[i][j]]++;
+                            std::vector<std::size_t> order(total);
+                            parallel_for(0, chunks, [&](std::size_t chunk) {
+                                for (std::size_t k = total * chunk / chunks; k < total * (chunk + 1) / chunks; k++) {
+                                    order[counts[chunk][shards[k]]++] = k;
+                                }
+                            }, ThreadPool::PoolLevel::HIGH);
+                            return order;
+                        };
+
+                        std::vector<std::size_t> value_shard_begin;
+                        std::vector<std::size_t> value_order = partition_by_shard(reduced_value, value_shard_begin);
+                        std::vector<std::size_t> input_shard_begin;
+                        std::vector<std::size_t> input_order = partition_by_shard(reduced_input, input_shard_begin);
+
+                        // Number of times each table value is written to the sorted polynomials. The first occurrence
+                        // of a value gets all the matching inputs, repeated occurrences are written once.
+                        const std::size_t values_total = reduced_value.size() * usable_rows_amount;
+                        std::vector<std::size_t> repeats(values_total, 1);
+                        std::atomic<bool> input_missing(false);
+
+                        parallel_for(0, shards_count, [&](std::size_t s) {
+                            std::unordered_map<value_type, std::size_t> first_occurrence;
+                            first_occurrence.reserve(value_shard_begin[s + 1] - value_shard_begin[s]);
+                            for (std::size_t k = value_shard_begin[s]; k < value_shard_begin[s + 1]; k++) {
+                                std::size_t index = value_order[k];
+                                first_occurrence.emplace(
+                                    reduced_value[index / usable_rows_amount][index % usable_rows_amount], index);
+                            }
+                            for (std::size_t k = input_shard_begin[s]; k < input_shard_begin[s + 1]; k++) {
+                                std::size_t index = input_order[k];
+                                auto it = first_occurrence.find(
+                                    reduced_input[index / usable_rows_amount][index % usable_rows_amount]);
+                                if (it == first_occurrence.end()) {
+                                    input_missing.store(true, std::memory_order_relaxed);
+                                    continue;
+                                }
+                                repeats[it->second]++;
                             }
+                        }, ThreadPool::PoolLevel::HIGH);
+
+                        // Every input value must be present in the lookup tables, otherwise the table is not satisfied.
+                        if (input_missing) {
+                            throw std::invalid_argument("Lookup input value is not present in the lookup tables.");
+                        }
+
+                        value_order = std::vector<std::size_t>();
+                        input_order = std::vector<std::size_t>();
+
+                        // Exclusive prefix sum, 'repeats[k]' becomes the first output position of value 'k'.
+                        std::size_t position = 0;
+                        for (std::size_t k = 0; k < values_total; k++) {
+                            std::size_t count = repeats[k];
+                            repeats[k] = position;
+                            position += count;
                         }
+                        BOOST_ASSERT(position == (reduced_input.size() + reduced_value.size()) * usable_rows_amount);
 
                         polynomial_dfs_type zero_poly(
                             domain_size-1, domain_size, FieldType::value_type::zero());
                         std::vector<polynomial_dfs_type> sorted(
                             reduced_input.size() + reduced_value.size(), zero_poly
                         );
-                        std::size_t i1 = 0;
-                        std::size_t j1 = 0;
-                        auto append_to_sorted = [usable_rows_amount, &sorted, &i1, &j1] (
-                                const typename FieldType::value_type& value) {
-                            sorted[i1][j1] = value;
-                            j1++;
-                            if (j1 >= usable_rows_amount){
-                                i1++; j1 = 0;
-                            }
-                        };
 
-                        for (std::size_t i = 0; i < reduced_value.size(); i++) {
-                            for (std::size_t j = 0; j < usable_rows_amount; j++) {
-                                typename FieldType::value_type val = reduced_value[i][j];
-                                for (std::size_t k = 0; k < sorting_map[val]; k++) {
-                                    BOOST_ASSERT(j1 < usable_rows_amount);
-                                    append_to_sorted(val);
-                                }
-                                sorting_map[val] = 1;
+                        parallel_for(0, values_total, [&](std::size_t k) {
+                            const value_type& value = reduced_value[k / usable_rows_amount][k % usable_rows_amount];
+                            std::size_t end = (k + 1 < values_total) ? repeats[k + 1] : position;
+                            for (std::size_t p = repeats[k]; p < end; p++) {
+                                sorted[p / usable_rows_amount][p % usable_rows_amount] = value;
                             }
-                        }
+                        }, ThreadPool::PoolLevel::LOW);
 
                         for (std::size_t i = 0; i < sorted.size() - 1; i++) {
                             sorted[i][usable_rows_amount] = sorted[i+1][0];
@@ -716,6 +821,8 @@ namespace nil {
                     const std::vector<plonk_lookup_table<FieldType>>& lookup_tables;
                     typename FieldType::value_type theta;
                     std::size_t lookup_chunks;
+                    column_cache_type *column_cache;
+                    std::unique_ptr<column_cache_type> own_column_cache;
                 };
 
                 template<typename FieldType, typename CommitmentSchemeTypePermutation, typename ParamsType>
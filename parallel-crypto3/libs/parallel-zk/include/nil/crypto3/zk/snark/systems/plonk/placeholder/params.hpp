@@ -51,7 +51,16 @@ namespace nil {
                     using assignment_table_type = plonk_table<field_type, plonk_column<field_type>>;
                 };
 
-                template<typename CircuitParams, typename CommitmentScheme>
+                /**
+                 * Lookup argument used by the prover and the verifier.
+                 * PLOOKUP commits sorted columns and proves a grand product over them.
+                 * LOGUP commits multiplicities of the table rows and proves a running sum of inverses,
+                 * it needs fewer committed columns and no sorting.
+                 */
+                enum class lookup_argument_type { PLOOKUP, LOGUP };
+
+                template<typename CircuitParams, typename CommitmentScheme,
+                         lookup_argument_type LookupArgument = lookup_argument_type::PLOOKUP>
                 struct placeholder_params {
                     using field_type = typename CircuitParams::field_type;
 
@@ -64,7 +73,18 @@ namespace nil {
 
                     using transcript_hash_type = typename CommitmentScheme::transcript_hash_type;
                     using circuit_params_type = CircuitParams;
+
+                    static constexpr lookup_argument_type lookup_argument = LookupArgument;
                 };
+
+                // Number of polynomials the lookup argument puts into LOOKUP_BATCH.
+                template<typename ParamsType>
+                std::size_t lookup_batch_columns_number(const typename ParamsType::constraint_system_type &constraint_system) {
+                    if (ParamsType::lookup_argument == lookup_argument_type::LOGUP) {
+                        return constraint_system.lookup_gates().size() == 0 ? 0 : constraint_system.lookup_options_num();
+                    }
+                    return constraint_system.sorted_lookup_columns_number();
+                }
             }    // namespace snark
         }        // namespace zk
     }            // namespace crypto3
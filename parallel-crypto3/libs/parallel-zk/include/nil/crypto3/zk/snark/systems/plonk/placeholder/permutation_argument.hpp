@@ -36,6 +36,7 @@
 #include <nil/crypto3/math/polynomial/polynomial.hpp>
 #include <nil/crypto3/math/polynomial/polynomial_dfs.hpp>
 #include <nil/crypto3/math/polynomial/shift.hpp>
+#include <nil/crypto3/math/polynomial/polynomial_dfs_view.hpp>
 #include <nil/crypto3/math/domains/evaluation_domain.hpp>
 #include <nil/crypto3/math/algorithms/make_evaluation_domain.hpp>
 
@@ -49,6 +50,7 @@
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/preprocessor.hpp>
 #include <nil/crypto3/zk/snark/arithmetization/plonk/assignment.hpp>
 
+#include <nil/crypto3/bench/memory_usage.hpp>
 #include <nil/crypto3/bench/scoped_profiler.hpp>
 
 #include <nil/actor/core/thread_pool.hpp>
@@ -86,6 +88,7 @@ namespace nil {
                         transcript_type& transcript
                     ) {
                         PROFILE_SCOPE("permutation_argument_prove_eval_time");
+                        PROFILE_MEMORY_PHASE("permutation_argument_prove_eval");
 
                         const std::vector<math::polynomial_dfs<typename FieldType::value_type>> &S_sigma =
                             preprocessed_data.permutation_polynomials;
@@ -130,10 +133,9 @@ namespace nil {
                             h_v[i] += column_polynomials[global_indices[i]];
                         }, ThreadPool::PoolLevel::HIGH);
 
-                        V_P[0] = FieldType::value_type::one();
-
                         auto V_P_parts = std::make_unique<std::vector<typename FieldType::value_type>>(
                             basic_domain->size(), FieldType::value_type::zero());
+                        (*V_P_parts)[0] = FieldType::value_type::one();
                         parallel_for(1, basic_domain->size(), [&g_v, &h_v, &S_id, &V_P_parts](std::size_t j) {
                             typename FieldType::value_type nom = FieldType::value_type::one();
                             typename FieldType::value_type denom = FieldType::value_type::one();
@@ -145,8 +147,8 @@ namespace nil {
                             (*V_P_parts)[j] = nom * denom.inversed();
                         }, ThreadPool::PoolLevel::LOW);
 
-                        for (std::size_t j = 1; j < basic_domain->size(); ++j)
-                            V_P[j] = V_P[j - 1] * (*V_P_parts)[j];
+                        parallel_inclusive_scan(V_P_parts->begin(), V_P_parts->end(), V_P.begin(),
+                            std::multiplies<typename FieldType::value_type>(), ThreadPool::PoolLevel::LOW);
                         V_P_parts.reset(nullptr);
 
                         // 4. Compute and add commitment to $V_P$ to $\text{transcript}$.
@@ -180,9 +182,6 @@ namespace nil {
                         math::polynomial_dfs<typename FieldType::value_type> one_polynomial(
                             0, V_P.size(), FieldType::value_type::one());
                         std::array<math::polynomial_dfs<typename FieldType::value_type>, argument_size> F_dfs;
-                        math::polynomial_dfs<typename FieldType::value_type> V_P_shifted =
-                            math::polynomial_shift(V_P, 1, basic_domain->m);
-
                         /* F_dfs[0] = preprocessed_data.common_data.lagrange_0 * (one_polynomial - V_P); */
 
                         F_dfs[0] = one_polynomial;
@@ -197,15 +196,14 @@ namespace nil {
                         if ( preprocessed_data.common_data.permutation_parts == 1 ){
                             auto &g = gs[0];
                             auto &h = hs[0];
-                            math::polynomial_dfs<typename FieldType::value_type> t1 = V_P;
-                            t1 *= g;
-                            V_P_shifted *= h;
-                            V_P_shifted -= t1;
+                            g *= V_P;
+                            multiply_by_shifted(h, V_P, basic_domain->m);
+                            h -= g;
 
                             F_dfs[1] = one_polynomial;
                             F_dfs[1] -= preprocessed_data.q_last;
                             F_dfs[1] -= preprocessed_data.q_blind;
-                            F_dfs[1] *= V_P_shifted;
+                            F_dfs[1] *= h;
                         } else {
                             PROFILE_SCOPE("PERMUTATION ARGUMENT else block");
                             math::polynomial_dfs<typename FieldType::value_type> previous_poly = V_P;
@@ -243,7 +241,10 @@ namespace nil {
                             std::size_t last = permutation_alphas.size();
                             auto &g = gs[last];
                             auto &h = hs[last];
-                            F_dfs_1_parts.back() = previous_poly * g - V_P_shifted * h;
+                            g *= previous_poly;
+                            multiply_by_shifted(h, V_P, basic_domain->m);
+                            g -= h;
+                            F_dfs_1_parts.back() = std::move(g);
                             F_dfs[1] += polynomial_sum<FieldType>(std::move(F_dfs_1_parts));
                             F_dfs[1] *= (preprocessed_data.q_last + preprocessed_data.q_blind) - one_polynomial;
                         }
@@ -367,6 +368,23 @@ namespace nil {
                         return F;
                     }
 
+                    // h *= V_P(omega * X). V_P is interpolated to the domain of the product and its rotation is
+                    // read through a view, so no shifted copy of V_P is kept on either domain.
+                    static void multiply_by_shifted(
+                        math::polynomial_dfs<typename FieldType::value_type> &h,
+                        const math::polynomial_dfs<typename FieldType::value_type> &V_P,
+                        std::size_t domain_size
+                    ) {
+                        const std::size_t product_size = math::detail::power_of_two(
+                            std::max(h.size(), h.degree() + V_P.degree() + 1));
+                        h.resize(product_size);
+                        math::polynomial_dfs<typename FieldType::value_type> V_P_extended = V_P;
+                        V_P_extended.resize(product_size);
+                        h.pointwise_multiplication(
+                            math::polynomial_dfs_rotated_view<math::polynomial_dfs<typename FieldType::value_type>>(
+                                V_P_extended, 1, domain_size));
+                    }
+
                     static math::polynomial_dfs<typename FieldType::value_type> reduce_dfs_polynomial_domain(
                         const math::polynomial_dfs<typename FieldType::value_type> &polynomial,
                         const std::size_t &new_domain_size
@@ -32,7 +32,9 @@
 #error "You're mixing parallel and non-parallel crypto3 versions"
 #endif
 
+#include <algorithm>
 #include <chrono>
+#include <functional>
 #include <set>
 
 #include <nil/crypto3/math/polynomial/polynomial.hpp>
@@ -41,15 +43,19 @@
 
 #include <nil/crypto3/zk/commitments/polynomial/lpc.hpp>
 #include <nil/crypto3/zk/transcript/fiat_shamir.hpp>
+#include <nil/crypto3/zk/detail/spill_storage.hpp>
 #include <nil/crypto3/zk/snark/arithmetization/plonk/constraint.hpp>
 #include <nil/crypto3/zk/snark/arithmetization/plonk/assignment.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/detail/placeholder_policy.hpp>
+#include <nil/crypto3/zk/snark/systems/plonk/placeholder/detail/column_cache.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/permutation_argument.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/lookup_argument.hpp>
+#include <nil/crypto3/zk/snark/systems/plonk/placeholder/logup_argument.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/gates_argument.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/params.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/preprocessor.hpp>
 
+#include <nil/crypto3/bench/memory_usage.hpp>
 #include <nil/crypto3/bench/scoped_profiler.hpp>
 
 namespace nil {
@@ -74,6 +80,18 @@ namespace nil {
                     }
                 }    // namespace detail
 
+                /**
+                 * Points of the proof generation at which the prover reports its state, in the order they are
+                 * reached. The prover may be resumed from any of them.
+                 */
+                enum class placeholder_prover_stage {
+                    started = 0,
+                    variable_values_committed = 1,
+                    permutation_committed = 2,
+                    quotient_committed = 3,
+                    evaluated = 4
+                };
+
                 template<typename FieldType, typename ParamsType>
                 class placeholder_prover {
                     using transcript_hash_type = typename ParamsType::transcript_hash_type;
@@ -90,12 +108,39 @@ namespace nil {
                     using public_preprocessor_type = placeholder_public_preprocessor<FieldType, ParamsType>;
                     using private_preprocessor_type = placeholder_private_preprocessor<FieldType, ParamsType>;
 
+                    using column_cache_type = detail::placeholder_column_cache<FieldType>;
+
+                    using lookup_argument_prover_type = typename std::conditional<
+                        ParamsType::lookup_argument == lookup_argument_type::LOGUP,
+                        placeholder_logup_argument_prover<FieldType, commitment_scheme_type, ParamsType>,
+                        placeholder_lookup_argument_prover<FieldType, commitment_scheme_type, ParamsType>>::type;
+
                     constexpr static const std::size_t gate_parts = 1;
                     constexpr static const std::size_t permutation_parts = 3;
                     constexpr static const std::size_t lookup_parts = 6;
                     constexpr static const std::size_t f_parts = 8;
+                    // Index of the gates argument part, it comes after the permutation and lookup parts.
+                    constexpr static const std::size_t gates_F_part = f_parts - 1;
 
                 public:
+                    using F_parts_type = std::array<polynomial_dfs_type, f_parts>;
+
+                    /**
+                     * State of the prover once a stage is done. Together with the preprocessed data, the table and
+                     * the constraint system it is everything the rest of the proof depends on, so passing it to
+                     * resume() produces the same proof as an uninterrupted run.
+                     */
+                    struct checkpoint_type {
+                        placeholder_prover_stage stage;
+                        const transcript_type &transcript;
+                        const placeholder_proof<FieldType, ParamsType> &proof;
+                        const F_parts_type &F_dfs;
+                        const commitment_scheme_type &commitment_scheme;
+                    };
+
+                    using checkpoint_handler_type = std::function<void(const checkpoint_type &)>;
+
+                    using spill_storage_type = zk::detail::spill_storage;
 
                     static inline placeholder_proof<FieldType, ParamsType> process(
                         const typename public_preprocessor_type::preprocessed_data_type &preprocessed_public_data,
@@ -137,100 +182,245 @@ namespace nil {
 
                         // Setup commitment scheme. LPC adds an additional point here.
                         _commitment_scheme.setup(transcript, preprocessed_public_data.common_data.commitment_scheme_data);
+
+                        _column_cache = std::make_unique<column_cache_type>(
+                            *_polynomial_table, preprocessed_public_data.common_data.basic_domain);
+                        polynomial_dfs_type mask_polynomial(
+                            0, preprocessed_public_data.common_data.basic_domain->m,
+                            typename FieldType::value_type(1u)
+                        );
+                        mask_polynomial -= preprocessed_public_data.q_last;
+                        mask_polynomial -= preprocessed_public_data.q_blind;
+                        _column_cache->set_special_selectors(
+                            mask_polynomial, preprocessed_public_data.common_data.lagrange_0);
+                    }
+
+                    /**
+                     * Limits the memory taken by the column extensions shared by the lookup and gates arguments,
+                     * zero means no limit. With a memory budget as well the cache takes the smaller of both.
+                     */
+                    void set_column_cache_memory_budget(std::size_t memory_budget) {
+                        _column_cache_memory_budget = memory_budget;
+                        _column_cache->set_memory_budget(memory_budget);
+                    }
+
+                    /**
+                     * Keeps the polynomials held by the prover under 'memory_budget' bytes where it can, zero means
+                     * no limit. Committed LPC batches are moved to 'spill_storage', the coldest first, and the
+                     * evaluation proof reads them back one at a time. The column cache gets what remains of the
+                     * budget, spilling the extensions which do not fit. The preprocessed data, the quotient batch
+                     * and the values the arguments are computing are not limited.
+                     */
+                    void set_memory_budget(std::size_t memory_budget, std::shared_ptr<spill_storage_type> spill_storage) {
+                        _memory_budget = memory_budget;
+                        _spill_storage = std::move(spill_storage);
+                        _column_cache->set_spill_storage(_spill_storage);
+                    }
+
+                    /**
+                     * Calls 'handler' each time process() reaches a stage. The evaluated stage is only reported
+                     * for LPC, other commitment schemes evaluate and prove in one step.
+                     */
+                    void set_checkpoint_handler(checkpoint_handler_type handler) {
+                        _checkpoint_handler = std::move(handler);
+                    }
+
+                    /**
+                     * Makes process() continue from a checkpoint instead of starting over. The prover must be
+                     * constructed from the same data as the one which reported the checkpoint, except for the
+                     * commitment scheme, which is the one of the checkpoint.
+                     */
+                    void resume(placeholder_prover_stage stage,
+                                transcript_type resumed_transcript,
+                                placeholder_proof<FieldType, ParamsType> proof,
+                                F_parts_type F_dfs) {
+                        BOOST_ASSERT(stage != placeholder_prover_stage::evaluated ||
+                                     nil::crypto3::zk::is_lpc<commitment_scheme_type>);
+                        _resumed_stage = stage;
+                        transcript = std::move(resumed_transcript);
+                        _proof = std::move(proof);
+                        _F_dfs = std::move(F_dfs);
                     }
 
                     placeholder_proof<FieldType, ParamsType> process() {
                         PROFILE_SCOPE("Placeholder prover, total time");
+                        PROFILE_MEMORY_PHASE("Placeholder prover");
                         BOOST_LOG_TRIVIAL(info) << "running mutithreaded mode";
 
-                        // 2. Commit witness columns and public_input columns
-                        _commitment_scheme.append_to_batch(VARIABLE_VALUES_BATCH, _polynomial_table->witnesses());
-                        _commitment_scheme.append_to_batch(VARIABLE_VALUES_BATCH, _polynomial_table->public_inputs());
-                        {
-                            PROFILE_SCOPE("variable_values_precommit_time");
-                            _proof.commitments[VARIABLE_VALUES_BATCH] = _commitment_scheme.commit(VARIABLE_VALUES_BATCH);
+                        fit_memory_budget();
+                        if (_resumed_stage < placeholder_prover_stage::variable_values_committed) {
+                            // 2. Commit witness columns and public_input columns
+                            _commitment_scheme.append_to_batch(VARIABLE_VALUES_BATCH, _polynomial_table->witnesses());
+                            _commitment_scheme.append_to_batch(VARIABLE_VALUES_BATCH, _polynomial_table->public_inputs());
+                            {
+                                PROFILE_SCOPE("variable_values_precommit_time");
+                                _proof.commitments[VARIABLE_VALUES_BATCH] = _commitment_scheme.commit(VARIABLE_VALUES_BATCH);
+                            }
+                            transcript(_proof.commitments[VARIABLE_VALUES_BATCH]);
+                            fit_memory_budget();
+                            report_checkpoint(placeholder_prover_stage::variable_values_committed);
                         }
-                        transcript(_proof.commitments[VARIABLE_VALUES_BATCH]);
 
-                        // 4. permutation_argument
-                        if( constraint_system.copy_constraints().size() > 0 ){
-                            auto permutation_argument = placeholder_permutation_argument<FieldType, ParamsType>::prove_eval(
-                                constraint_system,
-                                preprocessed_public_data,
-                                table_description,
-                                *_polynomial_table,
-                                _commitment_scheme,
-                                transcript);
+                        if (_resumed_stage < placeholder_prover_stage::permutation_committed) {
+                            // 4. permutation_argument
+                            if( constraint_system.copy_constraints().size() > 0 ){
+                                auto permutation_argument = placeholder_permutation_argument<FieldType, ParamsType>::prove_eval(
+                                    constraint_system,
+                                    preprocessed_public_data,
+                                    table_description,
+                                    *_polynomial_table,
+                                    _commitment_scheme,
+                                    transcript);
+
+                                _F_dfs[0] = std::move(permutation_argument.F_dfs[0]);
+                                _F_dfs[1] = std::move(permutation_argument.F_dfs[1]);
+                                _F_dfs[2] = std::move(permutation_argument.F_dfs[2]);
+                            }
 
-                            _F_dfs[0] = std::move(permutation_argument.F_dfs[0]);
-                            _F_dfs[1] = std::move(permutation_argument.F_dfs[1]);
-                            _F_dfs[2] = std::move(permutation_argument.F_dfs[2]);
-                        }
+                            // 5. lookup_argument
+                            {
+                                auto lookup_argument_result = lookup_argument();
+                                _F_dfs[3] = std::move(lookup_argument_result.F_dfs[0]);
+                                _F_dfs[4] = std::move(lookup_argument_result.F_dfs[1]);
+                                _F_dfs[5] = std::move(lookup_argument_result.F_dfs[2]);
+                                _F_dfs[6] = std::move(lookup_argument_result.F_dfs[3]);
+                            }
 
-                        // 5. lookup_argument
-                        {
-                            auto lookup_argument_result = lookup_argument();
-                            _F_dfs[3] = std::move(lookup_argument_result.F_dfs[0]);
-                            _F_dfs[4] = std::move(lookup_argument_result.F_dfs[1]);
-                            _F_dfs[5] = std::move(lookup_argument_result.F_dfs[2]);
-                            _F_dfs[6] = std::move(lookup_argument_result.F_dfs[3]);
+                            if( constraint_system.copy_constraints().size() > 0 || constraint_system.lookup_gates().size() > 0){
+                                _proof.commitments[PERMUTATION_BATCH] = _commitment_scheme.commit(PERMUTATION_BATCH);
+                                transcript(_proof.commitments[PERMUTATION_BATCH]);
+                            }
+                            fit_memory_budget();
+                            report_checkpoint(placeholder_prover_stage::permutation_committed);
                         }
 
-                        if( constraint_system.copy_constraints().size() > 0 || constraint_system.lookup_gates().size() > 0){
-                            _proof.commitments[PERMUTATION_BATCH] = _commitment_scheme.commit(PERMUTATION_BATCH);
-                            transcript(_proof.commitments[PERMUTATION_BATCH]);
-                        }
+                        if (_resumed_stage < placeholder_prover_stage::quotient_committed) {
+                            // 6. circuit-satisfability
+                            // The challenge of the gates argument and the alphas are drawn in a row, as the verifier does,
+                            // so the gates can be added straight into the consolidated F, multiplied by their alpha.
+                            typename FieldType::value_type theta = transcript.template challenge<FieldType>();
 
-                        // 6. circuit-satisfability
+                            // 7.1. Get $\alpha_0, \dots, \alpha_8 \in \mathbb{F}$ from $hash(\text{transcript})$
+                            std::array<typename FieldType::value_type, f_parts> alphas =
+                                transcript.template challenges<FieldType, f_parts>();
+
+#ifdef ZK_PLACEHOLDER_DEBUG_ENABLED
+                            // The consolidation consumes the parts, the debug output needs them afterwards.
+                            F_parts_type debug_F_dfs = _F_dfs;
+#endif
+                            polynomial_dfs_type F_consolidated_dfs = consolidate_F_parts(alphas);
+
+                            polynomial_dfs_type mask_polynomial(
+                                0, preprocessed_public_data.common_data.basic_domain->m,
+                                typename FieldType::value_type(1u)
+                            );
+                            mask_polynomial -= preprocessed_public_data.q_last;
+                            mask_polynomial -= preprocessed_public_data.q_blind;
+                            placeholder_gates_argument<FieldType, ParamsType>::accumulate_eval(
+                                constraint_system, *_polynomial_table,
+                                preprocessed_public_data.common_data.basic_domain,
+                                preprocessed_public_data.common_data.max_gates_degree,
+                                mask_polynomial,
+                                preprocessed_public_data.common_data.lagrange_0,
+                                theta, alphas[gates_F_part],
+                                F_consolidated_dfs,
+                                _column_cache.get()
+                            );
 
-                        polynomial_dfs_type mask_polynomial(
-                            0, preprocessed_public_data.common_data.basic_domain->m,
-                            typename FieldType::value_type(1u)
-                        );
-                        mask_polynomial -= preprocessed_public_data.q_last;
-                        mask_polynomial -= preprocessed_public_data.q_blind;
-                        _F_dfs[7] = placeholder_gates_argument<FieldType, ParamsType>::prove_eval(
-                            constraint_system, *_polynomial_table,
-                            preprocessed_public_data.common_data.basic_domain,
-                            preprocessed_public_data.common_data.max_gates_degree,
-                            mask_polynomial,
-                            preprocessed_public_data.common_data.lagrange_0,
-                            transcript
-                        )[0];
-
-                        _polynomial_table.reset(); // We don't need it anymore, release memory
-
-                        /////TEST
 #ifdef ZK_PLACEHOLDER_DEBUG_ENABLED
-                        placeholder_debug_output();
+                            // The gates have no part of their own, compute it alone for the debug output.
+                            _F_dfs = std::move(debug_F_dfs);
+                            placeholder_gates_argument<FieldType, ParamsType>::accumulate_eval(
+                                constraint_system, *_polynomial_table,
+                                preprocessed_public_data.common_data.basic_domain,
+                                preprocessed_public_data.common_data.max_gates_degree,
+                                mask_polynomial,
+                                preprocessed_public_data.common_data.lagrange_0,
+                                theta, FieldType::value_type::one(),
+                                _F_dfs[gates_F_part],
+                                _column_cache.get()
+                            );
+                            placeholder_debug_output();
 #endif
 
-                        // 7. Aggregate quotient polynomial
-                        {
-                            std::vector<polynomial_dfs_type> T_splitted_dfs =
-                                quotient_polynomial_split_dfs();
+                            _column_cache.reset();
+                            _polynomial_table.reset(); // We don't need it anymore, release memory
+
+                            // 7. Aggregate quotient polynomial
+                            {
+                                std::vector<polynomial_dfs_type> T_splitted_dfs =
+                                    quotient_polynomial_split_dfs(std::move(F_consolidated_dfs));
 
-                            _proof.commitments[QUOTIENT_BATCH] = T_commit(T_splitted_dfs);
+                                _proof.commitments[QUOTIENT_BATCH] = T_commit(T_splitted_dfs);
+                            }
+                            transcript(_proof.commitments[QUOTIENT_BATCH]);
+                            fit_memory_budget();
+                            report_checkpoint(placeholder_prover_stage::quotient_committed);
                         }
-                        transcript(_proof.commitments[QUOTIENT_BATCH]);
+                        // Also not needed when resumed past the quotient.
+                        _column_cache.reset();
+                        _polynomial_table.reset();
 
                         // 8. Run evaluation proofs
-                        _proof.eval_proof.challenge = transcript.template challenge<FieldType>();
-                        generate_evaluation_points();
-
-                        if (!_skip_commitment_scheme_eval_proofs) {
-                            _proof.eval_proof.eval_proof = _commitment_scheme.proof_eval(transcript);
-                        } else {
-                            if constexpr (nil::crypto3::zk::is_lpc<commitment_scheme_type>) {
-                                // This is required for aggregated prover. If we do not run the LPC proof right now,
-                                // we still need to push the merkle tree roots into the transcript.
+                        if constexpr (nil::crypto3::zk::is_lpc<commitment_scheme_type>) {
+                            if (_resumed_stage < placeholder_prover_stage::evaluated) {
+                                _proof.eval_proof.challenge = transcript.template challenge<FieldType>();
+                                generate_evaluation_points();
+                                // The aggregated prover skips the LPC proof, but still needs the merkle tree roots
+                                // in the transcript.
                                 _commitment_scheme.eval_polys_and_add_roots_to_transcipt(transcript);
+                                report_checkpoint(placeholder_prover_stage::evaluated);
+                            }
+                            if (!_skip_commitment_scheme_eval_proofs) {
+                                _proof.eval_proof.eval_proof = _commitment_scheme.proof_eval_from_evaluations(transcript);
+                            }
+                        } else {
+                            _proof.eval_proof.challenge = transcript.template challenge<FieldType>();
+                            generate_evaluation_points();
+                            if (!_skip_commitment_scheme_eval_proofs) {
+                                _proof.eval_proof.eval_proof = _commitment_scheme.proof_eval(transcript);
                             }
                         }
 
+                        sample_memory_usage();
                         return _proof;
                     }
 
+                    // Bytes taken by the polynomials the prover holds, except for the preprocessed data.
+                    std::size_t memory_usage() const {
+                        std::size_t result = 0;
+                        auto add = [&result](const auto &polys) {
+                            for (const auto &poly : polys) {
+                                result += poly.size() * sizeof(typename FieldType::value_type);
+                            }
+                        };
+                        if (_polynomial_table) {
+                            add(_polynomial_table->witnesses());
+                            add(_polynomial_table->public_inputs());
+                            add(_polynomial_table->constants());
+                            add(_polynomial_table->selectors());
+                        }
+                        add(_F_dfs);
+                        if constexpr (nil::crypto3::zk::is_lpc<commitment_scheme_type>) {
+                            for (std::size_t batch : spill_order) {
+                                result += _commitment_scheme.batch_memory_usage(batch);
+                            }
+                            result += _commitment_scheme.batch_memory_usage(QUOTIENT_BATCH);
+                        }
+                        if (_column_cache) {
+                            result += _column_cache->memory_usage();
+                        }
+                        return result;
+                    }
+
+                    /**
+                     * The largest memory_usage() seen by process(), sampled after each commitment and at each
+                     * checkpoint. A batch the evaluation proof reads back from the spill storage is not included.
+                     */
+                    std::size_t peak_memory_usage() const {
+                        return _peak_memory_usage;
+                    }
+
                     commitment_scheme_type& get_commitment_scheme() {
                         return _commitment_scheme;
                     }
@@ -240,12 +430,50 @@ namespace nil {
                     }
 
                 private:
-                    std::vector<polynomial_dfs_type> quotient_polynomial_split_dfs() {
+                    void report_checkpoint(placeholder_prover_stage stage) {
+                        if (_checkpoint_handler) {
+                            // Spilled batches stay spilled, the handler reads them through the views of the scheme.
+                            _checkpoint_handler(checkpoint_type{stage, transcript, _proof, _F_dfs, _commitment_scheme});
+                            sample_memory_usage();
+                        }
+                    }
+
+                    void sample_memory_usage() {
+                        _peak_memory_usage = std::max(_peak_memory_usage, memory_usage());
+                    }
+
+                    // Spills committed batches while the prover is over its memory budget and leaves the rest of
+                    // the budget to the column cache. Called after each commitment.
+                    void fit_memory_budget() {
+                        if (_memory_budget != 0) {
+                            if constexpr (nil::crypto3::zk::is_lpc<commitment_scheme_type>) {
+                                for (std::size_t batch : spill_order) {
+                                    if (memory_usage() <= _memory_budget) {
+                                        break;
+                                    }
+                                    _commitment_scheme.spill_batch(batch, _spill_storage);
+                                }
+                            }
+                            if (_column_cache) {
+                                const std::size_t used = memory_usage() - _column_cache->memory_usage();
+                                // The cache takes a zero budget for no limit, one byte keeps only the values in use.
+                                std::size_t cache_budget = used < _memory_budget ? _memory_budget - used : 1;
+                                if (_column_cache_memory_budget != 0) {
+                                    cache_budget = std::min(cache_budget, _column_cache_memory_budget);
+                                }
+                                _column_cache->set_memory_budget(cache_budget);
+                            }
+                        }
+                        sample_memory_usage();
+                    }
+
+                    std::vector<polynomial_dfs_type> quotient_polynomial_split_dfs(polynomial_dfs_type &&F_consolidated_dfs) {
                         PROFILE_SCOPE("quotient_polynomial_split_dfs");
+                        PROFILE_MEMORY_PHASE("quotient_polynomial_split_dfs");
 
                         // TODO: pass max_degree parameter placeholder
                         std::vector<polynomial_type> T_splitted = detail::split_polynomial<FieldType>(
-                            quotient_polynomial(), table_description.rows_amount - 1
+                            quotient_polynomial(std::move(F_consolidated_dfs)), table_description.rows_amount - 1
                         );
 
                         std::size_t split_polynomial_size = std::max(
@@ -284,27 +512,30 @@ namespace nil {
                         return T_splitted_dfs;
                     }
 
-                    polynomial_type quotient_polynomial() {
-                        PROFILE_SCOPE("quotient_polynomial_time");
-
-                        // 7.1. Get $\alpha_0, \dots, \alpha_8 \in \mathbb{F}$ from $hash(\text{transcript})$
-                        std::array<typename FieldType::value_type, f_parts> alphas =
-                            transcript.template challenges<FieldType, f_parts>();
-
-                        // 7.2. Compute F_consolidated
-                        std::vector<polynomial_dfs_type> F_consolidated_dfs_parts(_F_dfs.size(), polynomial_dfs_type());
-                        parallel_for(0, F_consolidated_dfs_parts.size(),
-                            [this, &F_consolidated_dfs_parts, &alphas](std::size_t i) {
-                                F_consolidated_dfs_parts[i] = _F_dfs[i];
-                                if (_F_dfs[i].is_zero()) {
-                                    return;
-                                }
-                                F_consolidated_dfs_parts[i] *= alphas[i];
-                        }, ThreadPool::PoolLevel::HIGH);
+                    // 7.2. Compute F_consolidated of the permutation and lookup parts. The parts are moved out and
+                    // released while they are summed, the gates part is added afterwards by the gates argument.
+                    polynomial_dfs_type consolidate_F_parts(
+                            const std::array<typename FieldType::value_type, f_parts> &alphas) {
+                        PROFILE_SCOPE("F_consolidation_time");
+                        PROFILE_MEMORY_PHASE("F_consolidation");
+
+                        // Multiplication by alphas is done in the same pass as the summation.
+                        std::vector<polynomial_dfs_type> F_consolidated_dfs_parts;
+                        F_consolidated_dfs_parts.reserve(gates_F_part);
+                        for (std::size_t i = 0; i < gates_F_part; ++i) {
+                            F_consolidated_dfs_parts.push_back(std::move(_F_dfs[i]));
+                            _F_dfs[i] = polynomial_dfs_type();
+                        }
+                        return polynomial_sum<FieldType>(
+                            std::move(F_consolidated_dfs_parts),
+                            std::vector<typename FieldType::value_type>(alphas.begin(), alphas.begin() + gates_F_part));
+                    }
 
-                        polynomial_dfs_type F_consolidated_dfs = polynomial_sum<FieldType>(std::move(F_consolidated_dfs_parts));
+                    polynomial_type quotient_polynomial(polynomial_dfs_type &&F_consolidated_dfs) {
+                        PROFILE_SCOPE("quotient_polynomial_time");
 
                         polynomial_type F_consolidated_normal(F_consolidated_dfs.coefficients());
+                        F_consolidated_dfs = polynomial_dfs_type();
 
                         polynomial_type T_consolidated =
                             F_consolidated_normal / preprocessed_public_data.common_data.Z;
@@ -312,14 +543,12 @@ namespace nil {
                         return T_consolidated;
                     }
 
-                    typename placeholder_lookup_argument_prover<FieldType, commitment_scheme_type, ParamsType>::prover_lookup_result
+                    typename lookup_argument_prover_type::prover_lookup_result
                     lookup_argument() {
                         PROFILE_SCOPE("lookup_argument_time");
+                        PROFILE_MEMORY_PHASE("lookup_argument");
 
-                        typename placeholder_lookup_argument_prover<
-                            FieldType,
-                            commitment_scheme_type,
-                            ParamsType>::prover_lookup_result lookup_argument_result;
+                        typename lookup_argument_prover_type::prover_lookup_result lookup_argument_result;
 
                         lookup_argument_result.F_dfs[0] = polynomial_dfs_type(0, table_description.rows_amount, FieldType::value_type::zero());
                         lookup_argument_result.F_dfs[1] = polynomial_dfs_type(0, table_description.rows_amount, FieldType::value_type::zero());
@@ -327,12 +556,13 @@ namespace nil {
                         lookup_argument_result.F_dfs[3] = polynomial_dfs_type(0, table_description.rows_amount, FieldType::value_type::zero());
 
                         if (_is_lookup_enabled) {
-                            placeholder_lookup_argument_prover<FieldType, commitment_scheme_type, ParamsType> lookup_argument_prover(
+                            lookup_argument_prover_type lookup_argument_prover(
                                 constraint_system,
                                 preprocessed_public_data,
                                 *_polynomial_table,
                                 _commitment_scheme,
-                                transcript
+                                transcript,
+                                _column_cache.get()
                             );
 
                             lookup_argument_result = lookup_argument_prover.prove_eval();
@@ -343,6 +573,7 @@ namespace nil {
 
                     commitment_type T_commit(const std::vector<polynomial_dfs_type>& T_splitted_dfs) {
                         PROFILE_SCOPE("T_split_precommit_time");
+                        PROFILE_MEMORY_PHASE("T_split_precommit");
                         _commitment_scheme.append_to_batch(QUOTIENT_BATCH, T_splitted_dfs);
                         return _commitment_scheme.commit(QUOTIENT_BATCH);
                     }
@@ -355,22 +586,6 @@ namespace nil {
                                 }
                             }
                         }
-
-                        const auto& gates = constraint_system.gates();
-
-                        for (std::size_t i = 0; i < gates.size(); i++) {
-                            for (std::size_t j = 0; j < gates[i].constraints.size(); j++) {
-                                polynomial_dfs_type constraint_result =
-                                    gates[i].constraints[j].evaluate(
-                                        _polynomial_table, preprocessed_public_data.common_data.basic_domain) *
-                                    _polynomial_table.selector(gates[i].selector_index);
-                                // for (std::size_t k = 0; k < table_description.rows_amount; k++) {
-                                if (constraint_result.evaluate(
-                                        preprocessed_public_data.common_data.basic_domain->get_domain_element(253)) !=
-                                    FieldType::value_type::zero()) {
-                                }
-                            }
-                        }
                     }
 
                     void generate_evaluation_points() {
@@ -500,14 +715,26 @@ namespace nil {
 
                     // Members created during proof generation.
                     std::unique_ptr<plonk_polynomial_dfs_table<FieldType>> _polynomial_table;
+                    // Column extensions shared by the lookup and gates arguments, released with the table.
+                    std::unique_ptr<column_cache_type> _column_cache;
+                    // Batches not needed before the evaluation proof, the coldest first. The quotient is committed
+                    // right before it, so it is never spilled.
+                    static constexpr std::array<std::size_t, 4> spill_order = {
+                        FIXED_VALUES_BATCH, VARIABLE_VALUES_BATCH, LOOKUP_BATCH, PERMUTATION_BATCH};
+                    std::size_t _memory_budget = 0;
+                    std::size_t _column_cache_memory_budget = 0;
+                    std::size_t _peak_memory_usage = 0;
+                    std::shared_ptr<spill_storage_type> _spill_storage;
                     placeholder_proof<FieldType, ParamsType> _proof;
-                    std::array<polynomial_dfs_type, f_parts> _F_dfs;
-                    transcript::fiat_shamir_heuristic_sequential<transcript_hash_type> transcript;
+                    F_parts_type _F_dfs;
+                    transcript_type transcript;
                     bool _is_lookup_enabled;
                     typename FieldType::value_type _omega;
                     std::vector<typename FieldType::value_type> _challenge_point;
                     commitment_scheme_type _commitment_scheme;
                     bool _skip_commitment_scheme_eval_proofs;
+                    placeholder_prover_stage _resumed_stage = placeholder_prover_stage::started;
+                    checkpoint_handler_type _checkpoint_handler;
                 };
             }    // namespace snark
         }        // namespace zk
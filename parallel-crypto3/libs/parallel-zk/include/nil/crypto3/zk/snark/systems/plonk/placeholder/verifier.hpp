@@ -41,6 +41,7 @@
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/detail/placeholder_policy.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/permutation_argument.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/lookup_argument.hpp>
+#include <nil/crypto3/zk/snark/systems/plonk/placeholder/logup_argument.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/gates_argument.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/params.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/preprocessor.hpp>
@@ -60,6 +61,10 @@ namespace nil {
 
                     using commitment_scheme_type = typename ParamsType::commitment_scheme_type;
                     using commitment_type = typename commitment_scheme_type::commitment_type;
+                    using lookup_argument_verifier_type = typename std::conditional<
+                        ParamsType::lookup_argument == lookup_argument_type::LOGUP,
+                        placeholder_logup_argument_verifier<FieldType, commitment_scheme_type, ParamsType>,
+                        placeholder_lookup_argument_verifier<FieldType, commitment_scheme_type, ParamsType>>::type;
 
                     constexpr static const std::size_t gate_parts = 1;
                     constexpr static const std::size_t permutation_parts = 3;
@@ -149,6 +154,32 @@ namespace nil {
                         }
                     }
 
+                    // Replaces every element with its inverse using a single field inversion (Montgomery's trick).
+                    static void batch_inverse(std::vector<typename FieldType::value_type> &values) {
+                        if (values.empty()) {
+                            return;
+                        }
+                        std::vector<typename FieldType::value_type> prefix_products(values.size());
+                        typename FieldType::value_type acc = FieldType::value_type::one();
+                        for (std::size_t i = 0; i < values.size(); ++i) {
+                            prefix_products[i] = acc;
+                            acc *= values[i];
+                        }
+                        if (acc.is_zero()) {
+                            // A zero element is practically impossible here, keep the element-wise behaviour for it.
+                            for (auto &value : values) {
+                                value = value.inversed();
+                            }
+                            return;
+                        }
+                        acc = acc.inversed();
+                        for (std::size_t i = values.size(); i-- > 0;) {
+                            typename FieldType::value_type inversed = acc * prefix_products[i];
+                            acc *= values[i];
+                            values[i] = inversed;
+                        }
+                    }
+
                     static inline bool process(
                         const typename public_preprocessor_type::preprocessed_data_type::common_data_type &common_data,
                         const placeholder_proof<FieldType, ParamsType> &proof,
@@ -170,15 +201,29 @@ namespace nil {
                             return false;
                         }
 
+                        // L_j(challenge) for all rows share the denominators (challenge - omega^j), invert them at once.
+                        std::vector<std::size_t> max_sizes(public_input.size());
+                        std::size_t max_rows = 0;
                         for (std::size_t i = 0; i < public_input.size(); ++i) {
-                            typename FieldType::value_type value = FieldType::value_type::zero();
-                            std::size_t max_size = public_input[i].size();
+                            max_sizes[i] = public_input[i].size();
                             if (constraint_system.public_input_sizes_num() != 0)
-                                max_size = std::min(max_size, constraint_system.public_input_size(i));
-                            auto omega_pow = FieldType::value_type::one();
-                            for( std::size_t j = 0; j < max_size; ++j ){
-                                value += (public_input[i][j] * omega_pow) * (challenge - omega_pow).inversed();
-                                omega_pow = omega_pow * omega;
+                                max_sizes[i] = std::min(max_sizes[i], constraint_system.public_input_size(i));
+                            max_rows = std::max(max_rows, max_sizes[i]);
+                        }
+                        std::vector<typename FieldType::value_type> omega_pows(max_rows);
+                        std::vector<typename FieldType::value_type> denominators(max_rows);
+                        auto omega_pow = FieldType::value_type::one();
+                        for (std::size_t j = 0; j < max_rows; ++j) {
+                            omega_pows[j] = omega_pow;
+                            denominators[j] = challenge - omega_pow;
+                            omega_pow = omega_pow * omega;
+                        }
+                        batch_inverse(denominators);
+
+                        for (std::size_t i = 0; i < public_input.size(); ++i) {
+                            typename FieldType::value_type value = FieldType::value_type::zero();
+                            for( std::size_t j = 0; j < max_sizes[i]; ++j ){
+                                value += (public_input[i][j] * omega_pows[j]) * denominators[j];
                             }
                             value *= numerator;
                             if (value != proof.eval_proof.eval_proof.z.get(VARIABLE_VALUES_BATCH, table_description.witness_columns + i, 0) )
@@ -387,7 +432,7 @@ namespace nil {
                                 i++
                             ) lookup_parts_values.push_back(proof.eval_proof.eval_proof.z.get(PERMUTATION_BATCH, i, 0));
 
-                            placeholder_lookup_argument_verifier<FieldType, commitment_scheme_type, ParamsType> lookup_argument_verifier;
+                            lookup_argument_verifier_type lookup_argument_verifier;
                             lookup_argument = lookup_argument_verifier.verify_eval(
                                 common_data,
                                 special_selector_values, special_selector_values_shifted,
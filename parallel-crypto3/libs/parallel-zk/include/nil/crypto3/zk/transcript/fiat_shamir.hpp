@@ -31,6 +31,8 @@
 #error "You're mixing parallel and non-parallel crypto3 versions"
 #endif
 
+#include <utility>
+
 #include <nil/marshalling/algorithms/pack.hpp>
 #include <nil/crypto3/marshalling/algebra/types/field_element.hpp>
 #include <nil/crypto3/marshalling/algebra/types/curve_element.hpp>
@@ -141,6 +143,7 @@ namespace nil {
                 {
                     typedef Hash hash_type;
                     typedef nil::crypto3::multiprecision::big_uint<hash_type::digest_bits> big_uint_of_hash_size;
+                    using transcript_state_type = typename hash_type::digest_type;
 
                     fiat_shamir_heuristic_sequential() : state(hash<hash_type>({0})) {
                     }
@@ -245,8 +248,20 @@ namespace nil {
                         return result;
                     }
 
+                    /**
+                     * State reached by the transcript. A transcript given it with set_state() draws the same
+                     * challenges from then on, which lets a saved proof be resumed.
+                     */
+                    const transcript_state_type &get_state() const {
+                        return state;
+                    }
+
+                    void set_state(const transcript_state_type &new_state) {
+                        state = new_state;
+                    }
+
                 private:
-                    typename hash_type::digest_type state;
+                    transcript_state_type state;
                 };
 
                 // Specialize for Nil Posseidon.
@@ -275,6 +290,8 @@ namespace nil {
                     using poseidon_policy = typename Hash::policy_type;
                     using permutation_type = nil::crypto3::hashes::detail::poseidon_permutation<poseidon_policy>;
                     using state_type = typename permutation_type::state_type;
+                    // The sponge words and how many of them are filled.
+                    using transcript_state_type = std::pair<state_type, std::size_t>;
 
                     fiat_shamir_heuristic_sequential() {
                     }
@@ -367,6 +384,14 @@ namespace nil {
                         return result;
                     }
 
+                    transcript_state_type get_state() const {
+                        return {sponge.state(), sponge.state_count()};
+                    }
+
+                    void set_state(const transcript_state_type &new_state) {
+                        sponge.set_state(new_state.first, new_state.second);
+                    }
+
                 public:
                     hashes::detail::poseidon_sponge_construction_custom<typename Hash::policy_type> sponge;
                 };
@@ -376,4 +401,6 @@ namespace nil {
     }            // namespace crypto3
 }    // namespace nil
 
+#include <nil/crypto3/zk/transcript/duplex_sponge.hpp>
+
 #endif    // CRYPTO3_ZK_TRANSCRIPT_FIAT_SHAMIR_HEURISTIC_HPP
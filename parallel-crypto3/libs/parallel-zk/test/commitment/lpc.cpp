@@ -459,6 +459,67 @@ BOOST_AUTO_TEST_SUITE(lpc_math_polynomial_suite);
         BOOST_CHECK(verifier_next_challenge == prover_next_challenge);
     }
 
+    BOOST_FIXTURE_TEST_CASE(lpc_dfs_shared_fixed_batch_test, test_fixture) {
+        typedef algebra::curves::bls12<381> curve_type;
+        typedef typename curve_type::scalar_field_type FieldType;
+
+        typedef hashes::sha2<256> merkle_hash_type;
+        typedef hashes::sha2<256> transcript_hash_type;
+
+        constexpr static const std::size_t lambda = 10;
+        constexpr static const std::size_t d = 16;
+        constexpr static const std::size_t m = 2;
+
+        typedef zk::commitments::fri<FieldType, merkle_hash_type, transcript_hash_type, m> fri_type;
+        typedef zk::commitments::
+        list_polynomial_commitment_params<merkle_hash_type, transcript_hash_type, m>
+                lpc_params_type;
+        typedef zk::commitments::list_polynomial_commitment<FieldType, lpc_params_type> lpc_type;
+
+        std::size_t degree_log = std::ceil(std::log2(d - 1));
+        // No grinding, its proof of work starts from a random value.
+        typename fri_type::params_type fri_params(1, degree_log, lambda, 2);
+
+        using lpc_scheme_type = nil::crypto3::zk::commitments::lpc_commitment_scheme<lpc_type>;
+        using transcript_type = zk::transcript::fiat_shamir_heuristic_sequential<transcript_hash_type>;
+
+        // The fixed batch is committed once, as by the preprocessor.
+        lpc_scheme_type preprocessed(fri_params);
+        preprocessed.append_to_batch(0, generate_random_polynomial_dfs_batch<FieldType>(
+                dist_type(1, 10)(test_global_rnd_engine), d, test_global_alg_rnd_engine<FieldType>));
+        preprocessed.commit(0);
+        preprocessed.mark_batch_as_fixed(0);
+        std::array<std::uint8_t, 96> x_data{};
+        transcript_type preprocessor_transcript(x_data);
+        transcript_type setup_transcript(x_data);
+        preprocessed.setup(setup_transcript, preprocessed.preprocess(preprocessor_transcript));
+
+        lpc_scheme_type shared = preprocessed;
+        shared.share_fixed_batches();
+        BOOST_CHECK_EQUAL(shared.batch_memory_usage(0), 0);
+
+        // Every proof made from a copy sharing the fixed batch is the same as without sharing.
+        auto point = algebra::fields::arithmetic_params<FieldType>::multiplicative_generator;
+        for (std::size_t proof_index = 0; proof_index < 2; ++proof_index) {
+            auto polys = generate_random_polynomial_dfs_batch<FieldType>(
+                dist_type(1, 10)(test_global_rnd_engine), d, test_global_alg_rnd_engine<FieldType>);
+
+            lpc_scheme_type copied = preprocessed;
+            lpc_scheme_type sharing = shared;
+            std::array<lpc_scheme_type*, 2> schemes = {&copied, &sharing};
+            std::vector<typename lpc_scheme_type::proof_type> proofs;
+            for (lpc_scheme_type* scheme : schemes) {
+                scheme->append_to_batch(1, polys);
+                scheme->commit(1);
+                scheme->append_eval_point(0, point);
+                scheme->append_eval_point(1, point);
+                transcript_type transcript(x_data);
+                proofs.push_back(scheme->proof_eval(transcript));
+            }
+            BOOST_CHECK(proofs[0] == proofs[1]);
+        }
+    }
+
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE(lpc_params_test_suite)
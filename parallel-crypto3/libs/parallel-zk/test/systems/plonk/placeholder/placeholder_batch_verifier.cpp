@@ -0,0 +1,132 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation <info@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+// Test verification of several proofs of one circuit at once
+//
+
+#define BOOST_TEST_MODULE placeholder_batch_verifier_test
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/hash/algorithm/hash.hpp>
+#include <nil/crypto3/hash/poseidon.hpp>
+#include <nil/crypto3/hash/keccak.hpp>
+
+#include <nil/crypto3/zk/snark/systems/plonk/placeholder/batch_verifier.hpp>
+
+#include <nil/crypto3/test_tools/random_test_initializer.hpp>
+
+#include "circuits.hpp"
+#include "placeholder_test_runner.hpp"
+
+template<typename TestRunnerType>
+struct batch_verifier_fixture {
+    using field_type = typename TestRunnerType::field_type;
+    using placeholder_params_type = typename TestRunnerType::lpc_placeholder_params_type;
+    using lpc_scheme_type = typename TestRunnerType::lpc_scheme_type;
+    using batch_verifier_type = placeholder_batch_verifier<field_type, placeholder_params_type>;
+    using proof_type = typename batch_verifier_type::proof_type;
+
+    batch_verifier_fixture(const typename TestRunnerType::circuit_type &circuit)
+        : runner(circuit), lpc_scheme(runner.fri_params),
+          public_data(placeholder_public_preprocessor<field_type, placeholder_params_type>::process(
+              runner.constraint_system, runner.assignments.public_table(), runner.desc, lpc_scheme)) {
+    }
+
+    proof_type prove() {
+        auto private_data = placeholder_private_preprocessor<field_type, placeholder_params_type>::process(
+            runner.constraint_system, runner.assignments.private_table(), runner.desc);
+        lpc_scheme_type prover_scheme = lpc_scheme;
+        return placeholder_prover<field_type, placeholder_params_type>::process(
+            public_data, std::move(private_data), runner.desc, runner.constraint_system, prover_scheme);
+    }
+
+    std::vector<bool> verify(const std::vector<proof_type> &proofs,
+                             const std::vector<typename batch_verifier_type::public_input_type> &public_inputs = {}) {
+        return batch_verifier_type::process(public_data.common_data, proofs, runner.desc,
+                                            runner.constraint_system, lpc_scheme_type(runner.fri_params),
+                                            public_inputs);
+    }
+
+    TestRunnerType runner;
+    lpc_scheme_type lpc_scheme;
+    typename placeholder_public_preprocessor<field_type, placeholder_params_type>::preprocessed_data_type public_data;
+};
+
+BOOST_AUTO_TEST_SUITE(placeholder_batch_verifier)
+
+    using curve_type = algebra::curves::pallas;
+    using field_type = typename curve_type::base_field_type;
+    using poseidon_type = hashes::poseidon<nil::crypto3::hashes::detail::mina_poseidon_policy<field_type>>;
+
+    BOOST_AUTO_TEST_CASE(batch_with_invalid_proof)
+    {
+        using test_runner_type = placeholder_test_runner<field_type, poseidon_type, poseidon_type>;
+
+        test_tools::random_test_initializer<field_type> random_test_initializer;
+        auto circuit = circuit_test_1<field_type>(
+                random_test_initializer.alg_random_engines.template get_alg_engine<field_type>(),
+                random_test_initializer.generic_random_engine
+        );
+        batch_verifier_fixture<test_runner_type> fixture(circuit);
+
+        auto proof = fixture.prove();
+        auto tampered_proof = proof;
+        tampered_proof.eval_proof.eval_proof.z.set(
+            VARIABLE_VALUES_BATCH, 0, 0,
+            tampered_proof.eval_proof.eval_proof.z.get(VARIABLE_VALUES_BATCH, 0, 0) + field_type::value_type::one());
+
+        std::vector<bool> results = fixture.verify({proof, tampered_proof, proof, proof});
+        BOOST_CHECK((results == std::vector<bool>{true, false, true, true}));
+
+        BOOST_CHECK(fixture.verify({}).empty());
+    }
+
+    BOOST_AUTO_TEST_CASE(batch_with_public_input)
+    {
+        using keccak_type = hashes::keccak_1600<256>;
+        using test_runner_type = placeholder_test_runner<field_type, keccak_type, keccak_type>;
+
+        test_tools::random_test_initializer<field_type> random_test_initializer;
+        auto pi0 = random_test_initializer.alg_random_engines.template get_alg_engine<field_type>()();
+        auto circuit = circuit_test_t<field_type>(
+                pi0,
+                random_test_initializer.alg_random_engines.template get_alg_engine<field_type>(),
+                random_test_initializer.generic_random_engine
+        );
+        batch_verifier_fixture<test_runner_type> fixture(circuit);
+
+        auto proof = fixture.prove();
+        std::vector<std::vector<typename field_type::value_type>> public_input;
+        for (const auto &column : circuit.table.public_inputs()) {
+            public_input.emplace_back(column.begin(), column.end());
+        }
+        auto wrong_public_input = public_input;
+        wrong_public_input[0][0] += field_type::value_type::one();
+
+        std::vector<bool> results = fixture.verify(
+            {proof, proof, proof}, {public_input, wrong_public_input, public_input});
+        BOOST_CHECK((results == std::vector<bool>{true, false, true}));
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -150,3 +150,86 @@ BOOST_AUTO_TEST_SUITE(placeholder_circuits)
         BOOST_CHECK(test_runner.run_test());
     }
 BOOST_AUTO_TEST_SUITE_END()
+
+// Circuits with lookups, proven with the LogUp lookup argument.
+BOOST_AUTO_TEST_SUITE(placeholder_circuits_logup)
+
+    using curve_type = algebra::curves::pallas;
+    using field_type = typename curve_type::base_field_type;
+    using hash_type = hashes::poseidon<nil::crypto3::hashes::detail::mina_poseidon_policy<field_type>>;
+    using test_runner_type = placeholder_test_runner<field_type, hash_type, hash_type, false, 0, lookup_argument_type::LOGUP>;
+
+    BOOST_AUTO_TEST_CASE(circuit3)
+    {
+        test_tools::random_test_initializer<field_type> random_test_initializer;
+        auto circuit = circuit_test_3<field_type>(
+                random_test_initializer.alg_random_engines.template get_alg_engine<field_type>(),
+                random_test_initializer.generic_random_engine
+        );
+        test_runner_type test_runner(circuit);
+        BOOST_CHECK(test_runner.run_test());
+    }
+
+    BOOST_AUTO_TEST_CASE(circuit3_invalid_lookup)
+    {
+        test_tools::random_test_initializer<field_type> random_test_initializer;
+        auto circuit = circuit_test_3<field_type>(
+                random_test_initializer.alg_random_engines.template get_alg_engine<field_type>(),
+                random_test_initializer.generic_random_engine
+        );
+        test_runner_type test_runner(circuit);
+
+        // The verifier looks up w0 + 1, so the selected row holds (2, 0, 0) which is not in the table.
+        auto lookup_gates = circuit.lookup_gates;
+        auto &lookup_input = lookup_gates[0].constraints[0].lookup_input;
+        lookup_input[0] = lookup_input[0] + field_type::value_type::one();
+        typename test_runner_type::policy_type::constraint_system_type invalid_constraint_system(
+                circuit.gates, circuit.copy_constraints, lookup_gates, circuit.lookup_tables);
+        BOOST_CHECK(!test_runner.run_test(invalid_constraint_system));
+    }
+
+    BOOST_AUTO_TEST_CASE(circuit4)
+    {
+        test_tools::random_test_initializer<field_type> random_test_initializer;
+        auto circuit = circuit_test_4<field_type>(
+                random_test_initializer.alg_random_engines.template get_alg_engine<field_type>(),
+                random_test_initializer.generic_random_engine
+        );
+        test_runner_type test_runner(circuit);
+        BOOST_CHECK(test_runner.run_test());
+    }
+
+    BOOST_AUTO_TEST_CASE(circuit6)
+    {
+        test_tools::random_test_initializer<field_type> random_test_initializer;
+        auto circuit = circuit_test_6<field_type>(
+                random_test_initializer.alg_random_engines.template get_alg_engine<field_type>(),
+                random_test_initializer.generic_random_engine
+        );
+        test_runner_type test_runner(circuit);
+        BOOST_CHECK(test_runner.run_test());
+    }
+
+    BOOST_AUTO_TEST_CASE(circuit7)
+    {
+        test_tools::random_test_initializer<field_type> random_test_initializer;
+        auto circuit = circuit_test_7<field_type>(
+                random_test_initializer.alg_random_engines.template get_alg_engine<field_type>(),
+                random_test_initializer.generic_random_engine
+        );
+        test_runner_type test_runner(circuit);
+        BOOST_CHECK(test_runner.run_test());
+    }
+
+    BOOST_AUTO_TEST_CASE(circuit8)
+    {
+        test_tools::random_test_initializer<field_type> random_test_initializer;
+        auto circuit = circuit_test_8<field_type>(
+                random_test_initializer.alg_random_engines.template get_alg_engine<field_type>(),
+                random_test_initializer.generic_random_engine
+        );
+        test_runner_type test_runner(circuit);
+        BOOST_CHECK(test_runner.run_test());
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
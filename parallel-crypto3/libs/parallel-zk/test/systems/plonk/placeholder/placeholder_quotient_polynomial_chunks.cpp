@@ -59,7 +59,9 @@ BOOST_AUTO_TEST_SUITE(placeholder_quotient_polynomial_chunks)
             placeholder_test_runner<field_type, hash_type, hash_type, true, 8>,
             placeholder_test_runner<field_type, hash_type, hash_type, true, 10>,
             placeholder_test_runner<field_type, hash_type, hash_type, true, 30>,
-            placeholder_test_runner<field_type, hash_type, hash_type, true, 50>
+            placeholder_test_runner<field_type, hash_type, hash_type, true, 50>,
+            placeholder_test_runner<field_type, hash_type, hash_type, true, 8, lookup_argument_type::LOGUP>,
+            placeholder_test_runner<field_type, hash_type, hash_type, true, 30, lookup_argument_type::LOGUP>
     >;
 
     BOOST_AUTO_TEST_CASE_TEMPLATE(quotient_polynomial_test, TestRunner, TestRunners) {
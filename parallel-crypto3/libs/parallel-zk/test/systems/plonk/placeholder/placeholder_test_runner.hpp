@@ -53,7 +53,8 @@ template<typename FieldType,
         typename merkle_hash_type,
         typename transcript_hash_type,
         bool UseGrinding = false,
-        std::size_t max_quotient_poly_chunks = 0>
+        std::size_t max_quotient_poly_chunks = 0,
+        lookup_argument_type LookupArgument = lookup_argument_type::PLOOKUP>
 struct placeholder_test_runner {
     using field_type = FieldType;
 
@@ -73,7 +74,7 @@ struct placeholder_test_runner {
 
     using lpc_type = commitments::list_polynomial_commitment<field_type, lpc_params_type>;
     using lpc_scheme_type = typename commitments::lpc_commitment_scheme<lpc_type>;
-    using lpc_placeholder_params_type = nil::crypto3::zk::snark::placeholder_params<circuit_params, lpc_scheme_type>;
+    using lpc_placeholder_params_type = nil::crypto3::zk::snark::placeholder_params<circuit_params, lpc_scheme_type, LookupArgument>;
     using policy_type = zk::snark::detail::placeholder_policy<field_type, lpc_placeholder_params_type>;
     using circuit_type = circuit_description<field_type, placeholder_circuit_params<field_type>>;
 
@@ -90,6 +91,11 @@ struct placeholder_test_runner {
     }
 
     bool run_test() {
+        return run_test(constraint_system);
+    }
+
+    // Proves the circuit and checks the proof against verifier_constraint_system.
+    bool run_test(const typename policy_type::constraint_system_type &verifier_constraint_system) {
         lpc_scheme_type lpc_scheme(fri_params);
 
         typename placeholder_public_preprocessor<field_type, lpc_placeholder_params_type>::preprocessed_data_type
@@ -108,7 +114,8 @@ struct placeholder_test_runner {
         lpc_scheme_type verifier_lpc_scheme(fri_params);
 
         bool verifier_res = placeholder_verifier<field_type, lpc_placeholder_params_type>::process(
-                lpc_preprocessed_public_data.common_data, lpc_proof, desc, constraint_system, verifier_lpc_scheme);
+                lpc_preprocessed_public_data.common_data, lpc_proof, desc, verifier_constraint_system,
+                verifier_lpc_scheme);
         return verifier_res;
     }
 
@@ -121,6 +121,109 @@ BOOST_AUTO_TEST_CASE(zk_poseidon_transcript_no_init_test) {
 
 BOOST_AUTO_TEST_SUITE_END()
 
+BOOST_AUTO_TEST_SUITE(zk_duplex_sponge_transcript_test_suite)
+
+template<typename hash_type, typename field_type>
+void test_duplex_sponge_transcript() {
+    using transcript_type = transcript::fiat_shamir_heuristic_sequential<transcript::duplex_sponge<hash_type>>;
+
+    std::vector<std::uint8_t> init_blob {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    const typename field_type::value_type element = 0x123456789abcdef_big_uint64;
+
+    // Prover and verifier absorbing the same messages get the same challenges.
+    transcript_type prover(init_blob);
+    transcript_type verifier(init_blob);
+    prover(element);
+    verifier(element);
+    auto ch1 = prover.template challenge<field_type>();
+    BOOST_CHECK_EQUAL(ch1, verifier.template challenge<field_type>());
+    auto ch2 = prover.template challenge<field_type>();
+    BOOST_CHECK_EQUAL(ch2, verifier.template challenge<field_type>());
+    BOOST_CHECK(ch1 != ch2);
+    BOOST_CHECK_EQUAL(prover.template int_challenge<std::uint64_t>(), verifier.template int_challenge<std::uint64_t>());
+    auto ch_n = prover.template challenges<field_type, 3>();
+    BOOST_CHECK(ch_n == (verifier.template challenges<field_type, 3>()));
+    BOOST_CHECK(prover.template challenges<field_type>(5) == verifier.template challenges<field_type>(5));
+
+    // Any difference in the absorbed data changes the challenges.
+    transcript_type other(init_blob);
+    other(element + field_type::value_type::one());
+    BOOST_CHECK(other.template challenge<field_type>() != ch1);
+
+    transcript_type other_init(std::vector<std::uint8_t>{0, 1, 2, 3, 4, 5, 6, 7, 8, 8});
+    other_init(element);
+    BOOST_CHECK(other_init.template challenge<field_type>() != ch1);
+
+    // Absorbing after squeezing goes on from the squeezed state.
+    prover(init_blob);
+    verifier(init_blob.begin(), init_blob.end());
+    BOOST_CHECK_EQUAL(prover.template challenge<field_type>(), verifier.template challenge<field_type>());
+
+    // A copy continues independently from the state at the time of copying.
+    transcript_type copy = prover;
+    prover(element);
+    copy(element);
+    BOOST_CHECK_EQUAL(prover.template challenge<field_type>(), copy.template challenge<field_type>());
+    copy(element);
+    BOOST_CHECK(prover.template challenge<field_type>() != copy.template challenge<field_type>());
+
+    // A transcript restored from the state of another one goes on exactly as the original, whether the state
+    // was taken while absorbing or while squeezing.
+    transcript_type absorbing(init_blob);
+    absorbing(element);
+    transcript_type restored;
+    restored.set_state(absorbing.get_state());
+    BOOST_CHECK(restored.get_state() == absorbing.get_state());
+    BOOST_CHECK_EQUAL(restored.template challenge<field_type>(), absorbing.template challenge<field_type>());
+    transcript_type squeezed;
+    squeezed.set_state(absorbing.get_state());
+    BOOST_CHECK_EQUAL(squeezed.template int_challenge<std::uint64_t>(), absorbing.template int_challenge<std::uint64_t>());
+    squeezed(init_blob);
+    absorbing(init_blob);
+    BOOST_CHECK(squeezed.template challenges<field_type>(3) == absorbing.template challenges<field_type>(3));
+
+    // Challenges differ from the ones of the compatibility mode.
+    transcript::fiat_shamir_heuristic_sequential<hash_type> sequential(init_blob);
+    sequential(element);
+    BOOST_CHECK(sequential.template challenge<field_type>() != ch1);
+}
+
+BOOST_AUTO_TEST_CASE(keccak_duplex_sponge_test) {
+    using field_type = algebra::curves::alt_bn128_254::scalar_field_type;
+    test_duplex_sponge_transcript<hashes::keccak_1600<256>, field_type>();
+    test_duplex_sponge_transcript<hashes::keccak_1600<512>, field_type>();
+}
+
+BOOST_AUTO_TEST_CASE(poseidon_duplex_sponge_test) {
+    using field_type = algebra::curves::pallas::base_field_type;
+    using poseidon_type = hashes::poseidon<nil::crypto3::hashes::detail::mina_poseidon_policy<field_type>>;
+    test_duplex_sponge_transcript<poseidon_type, field_type>();
+}
+
+BOOST_AUTO_TEST_CASE(duplex_sponge_curve_elements_test) {
+    using curve_type = algebra::curves::bls12_381;
+    using field_type = typename curve_type::scalar_field_type;
+    using g1_type = typename curve_type::template g1_type<>;
+    using g2_type = typename curve_type::template g2_type<>;
+    using transcript_type =
+        transcript::fiat_shamir_heuristic_sequential<transcript::duplex_sponge<hashes::keccak_1600<256>>>;
+
+    transcript_type tr1, tr2, tr3;
+    tr1(g1_type::value_type::one());
+    tr1(g2_type::value_type::one());
+    // Same point with other projective coordinates.
+    tr2(g1_type::value_type::one() + g1_type::value_type::one() - g1_type::value_type::one());
+    tr2(g2_type::value_type::one());
+    tr3(g1_type::value_type::one() + g1_type::value_type::one());
+    tr3(g2_type::value_type::one());
+
+    auto ch = tr1.challenge<field_type>();
+    BOOST_CHECK_EQUAL(ch, tr2.challenge<field_type>());
+    BOOST_CHECK(ch != tr3.challenge<field_type>());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
 /* TODO: Write more elaborate tests for transcript of curve elements */
 BOOST_AUTO_TEST_SUITE(transcript_test_curves)
 
@@ -25,7 +25,10 @@
 #ifndef CRYPTO3_PARALLELIZATION_UTILS_HPP
 #define CRYPTO3_PARALLELIZATION_UTILS_HPP
 
+#include <atomic>
 #include <future>
+#include <iterator>
+#include <vector>
 
 #include <nil/actor/core/thread_pool.hpp>
 
@@ -185,6 +188,158 @@ namespace nil {
                 }, pool_id));
         }
 
+        // Similar to std::reduce, returns init op x_0 op x_1 ... op x_{n-1}. BinaryOperation must be associative,
+        // but not necessarily commutative, the operands are never reordered.
+        template<class InputIt, class T, class BinaryOperation>
+        T parallel_reduce(InputIt first, InputIt last, T init, BinaryOperation binary_op,
+                          ThreadPool::PoolLevel pool_id = ThreadPool::PoolLevel::LOW) {
+            if (first == last) {
+                return init;
+            }
+
+            // Each chunk is reduced from its first element, so 'op' needs no identity element.
+            std::vector<T> chunk_results = wait_for_all(parallel_run_in_chunks<T>(
+                std::distance(first, last),
+                [first, binary_op](std::size_t begin, std::size_t end) mutable {
+                    std::advance(first, begin);
+                    T result = *first;
+                    for (std::size_t i = begin + 1; i < end; i++) {
+                        ++first;
+                        result = binary_op(result, *first);
+                    }
+                    return result;
+                }, pool_id));
+
+            for (const auto& chunk_result : chunk_results) {
+                init = binary_op(init, chunk_result);
+            }
+            return init;
+        }
+
+        namespace detail {
+            // Two-pass blocked scan: the first pass reduces each chunk, the totals are scanned serially, then
+            // the second pass scans each chunk seeded with the total of the chunks before it. Both passes
+            // use the same chunks, since parallel_run_in_chunks splits the same range the same way.
+            // Each element is read twice and written once, so the output may alias the input.
+            template<bool Inclusive, class InputIt, class OutputIt, class T, class BinaryOperation>
+            void parallel_scan(InputIt first, InputIt last, OutputIt d_first, const T* init,
+                               BinaryOperation binary_op, ThreadPool::PoolLevel pool_id) {
+                const std::size_t elements_count = std::distance(first, last);
+                if (elements_count == 0) {
+                    return;
+                }
+
+                // The total of the last chunk is not needed, so on a single chunk the first pass costs nothing.
+                std::vector<T> chunk_totals = wait_for_all(parallel_run_in_chunks<T>(
+                    elements_count,
+                    [first, binary_op, elements_count](std::size_t begin, std::size_t end) mutable {
+                        std::advance(first, begin);
+                        T result = *first;
+                        if (end == elements_count) {
+                            return result;
+                        }
+                        for (std::size_t i = begin + 1; i < end; i++) {
+                            ++first;
+                            result = binary_op(result, *first);
+                        }
+                        return result;
+                    }, pool_id));
+
+                // The seed of a chunk, an inclusive scan has no seed for the first chunk.
+                std::vector<T> seeds;
+                seeds.reserve(chunk_totals.size());
+                bool has_seed = (init != nullptr);
+                if (has_seed) {
+                    seeds.push_back(*init);
+                }
+                for (std::size_t i = 0; i + 1 < chunk_totals.size(); i++) {
+                    seeds.push_back(seeds.empty() ? chunk_totals[i] : binary_op(seeds.back(), chunk_totals[i]));
+                }
+
+                wait_for_all(parallel_run_in_chunks_with_thread_id<void>(
+                    elements_count,
+                    [first, d_first, &seeds, has_seed, binary_op](
+                            std::size_t chunk, std::size_t begin, std::size_t end) mutable {
+                        std::advance(first, begin);
+                        std::advance(d_first, begin);
+                        const bool seeded = has_seed || chunk > 0;
+                        const T* seed = seeded ? &seeds[has_seed ? chunk : chunk - 1] : nullptr;
+                        if constexpr (Inclusive) {
+                            T acc = seeded ? binary_op(*seed, *first) : T(*first);
+                            *d_first = acc;
+                            for (std::size_t i = begin + 1; i < end; i++) {
+                                ++first;
+                                ++d_first;
+                                acc = binary_op(acc, *first);
+                                *d_first = acc;
+                            }
+                        } else {
+                            T acc = *seed;
+                            for (std::size_t i = begin; i < end; i++) {
+                                T next = binary_op(acc, *first);
+                                *d_first = std::move(acc);
+                                acc = std::move(next);
+                                ++first;
+                                ++d_first;
+                            }
+                        }
+                    }, pool_id));
+            }
+        }    // namespace detail
+
+        // Similar to std::inclusive_scan, but in parallel: d_first[i] = x_0 op ... op x_i. BinaryOperation must be
+        // associative, it is applied about twice as many times as in the serial scan. d_first may be equal to first.
+        template<class InputIt, class OutputIt, class BinaryOperation>
+        void parallel_inclusive_scan(InputIt first, InputIt last, OutputIt d_first, BinaryOperation binary_op,
+                                     ThreadPool::PoolLevel pool_id = ThreadPool::PoolLevel::LOW) {
+            using value_type = typename std::iterator_traits<InputIt>::value_type;
+            detail::parallel_scan<true, InputIt, OutputIt, value_type>(
+                first, last, d_first, nullptr, binary_op, pool_id);
+        }
+
+        // Similar to std::exclusive_scan, but in parallel: d_first[i] = init op x_0 op ... op x_{i-1}.
+        template<class InputIt, class OutputIt, class T, class BinaryOperation>
+        void parallel_exclusive_scan(InputIt first, InputIt last, OutputIt d_first, T init, BinaryOperation binary_op,
+                                     ThreadPool::PoolLevel pool_id = ThreadPool::PoolLevel::LOW) {
+            detail::parallel_scan<false, InputIt, OutputIt, T>(
+                first, last, d_first, &init, binary_op, pool_id);
+        }
+
+        // Calls func(task) for every task in [0, tasks_count). Unlike parallel_for, the tasks are expected to be
+        // heavy and of different cost: all the threads of the pool are used however few tasks there are, and the
+        // tasks are handed out one by one.
+        template<class Func>
+        void parallel_for_each_task(std::size_t tasks_count, const Func& func,
+                                    ThreadPool::PoolLevel pool_id = ThreadPool::PoolLevel::LOW) {
+            auto& thread_pool = ThreadPool::get_instance(pool_id);
+            const std::size_t workers_count = std::min(tasks_count, thread_pool.get_pool_size());
+
+            std::atomic<std::size_t> next_task{0};
+            std::vector<std::future<void>> fut;
+            for (std::size_t i = 0; i < workers_count; i++) {
+                fut.emplace_back(thread_pool.post<void>([&next_task, tasks_count, &func]() {
+                    for (std::size_t task = next_task++; task < tasks_count; task = next_task++) {
+                        func(task);
+                    }
+                }));
+            }
+            wait_for_all(std::move(fut));
+        }
+
+        // Task runner running the tasks of an algorithm on a thread pool, see
+        // algebra::policies::basic_multiexp_method_pippenger.
+        template<ThreadPool::PoolLevel PoolId = ThreadPool::PoolLevel::LOW>
+        struct thread_pool_tasks {
+            static std::size_t workers_count() {
+                return ThreadPool::get_instance(PoolId).get_pool_size();
+            }
+
+            template<class Func>
+            static void run(std::size_t tasks_count, const Func& func) {
+                parallel_for_each_task(tasks_count, func, PoolId);
+            }
+        };
+
     }        // namespace crypto3
 }    // namespace nil
 
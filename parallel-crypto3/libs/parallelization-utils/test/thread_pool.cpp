@@ -27,6 +27,8 @@
 
 #include <vector>
 #include <cstdint>
+#include <numeric>
+#include <string>
 
 #include <boost/test/unit_test.hpp>
 #include <boost/test/data/test_case.hpp>
@@ -61,4 +63,78 @@ BOOST_AUTO_TEST_CASE(vector_multiplication_test) {
     }
 }
 
+// A prime modulus, multiplication modulo it stands for the field multiplication in the grand products.
+static constexpr std::uint64_t MODULUS = 2305843009213693951ull;
+
+static std::uint64_t mul_mod(std::uint64_t a, std::uint64_t b) {
+    return static_cast<std::uint64_t>(static_cast<unsigned __int128>(a) * b % MODULUS);
+}
+
+BOOST_AUTO_TEST_CASE(parallel_reduce_test) {
+    for (std::size_t size : {0, 1, 7, 4095, 4097, 131071}) {
+        std::vector<std::uint64_t> v(size);
+        for (std::size_t i = 0; i < size; ++i)
+            v[i] = i * i + 3;
+
+        for (auto pool_id : {nil::crypto3::ThreadPool::PoolLevel::LOW, nil::crypto3::ThreadPool::PoolLevel::HIGH}) {
+            BOOST_CHECK_EQUAL(
+                nil::crypto3::parallel_reduce(v.begin(), v.end(), std::uint64_t(5), mul_mod, pool_id),
+                std::accumulate(v.begin(), v.end(), std::uint64_t(5), mul_mod));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(parallel_scan_test) {
+    for (std::size_t size : {0, 1, 7, 4095, 4097, 131071}) {
+        std::vector<std::uint64_t> v(size);
+        for (std::size_t i = 0; i < size; ++i)
+            v[i] = i * i + 3;
+
+        std::vector<std::uint64_t> inclusive(size);
+        std::inclusive_scan(v.begin(), v.end(), inclusive.begin(), mul_mod);
+        std::vector<std::uint64_t> exclusive(size);
+        std::exclusive_scan(v.begin(), v.end(), exclusive.begin(), std::uint64_t(5), mul_mod);
+
+        for (auto pool_id : {nil::crypto3::ThreadPool::PoolLevel::LOW, nil::crypto3::ThreadPool::PoolLevel::HIGH}) {
+            std::vector<std::uint64_t> result(size);
+            nil::crypto3::parallel_inclusive_scan(v.begin(), v.end(), result.begin(), mul_mod, pool_id);
+            BOOST_CHECK(result == inclusive);
+
+            nil::crypto3::parallel_exclusive_scan(v.begin(), v.end(), result.begin(), std::uint64_t(5), mul_mod, pool_id);
+            BOOST_CHECK(result == exclusive);
+
+            // In place.
+            result = v;
+            nil::crypto3::parallel_inclusive_scan(result.begin(), result.end(), result.begin(), mul_mod, pool_id);
+            BOOST_CHECK(result == inclusive);
+
+            result = v;
+            nil::crypto3::parallel_exclusive_scan(
+                result.begin(), result.end(), result.begin(), std::uint64_t(5), mul_mod, pool_id);
+            BOOST_CHECK(result == exclusive);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(parallel_scan_non_commutative_test) {
+    // Concatenation is associative, but not commutative, so the operands must never be reordered.
+    std::size_t size = 1000;
+    std::vector<std::string> v(size);
+    for (std::size_t i = 0; i < size; ++i)
+        v[i] = std::string(1, 'a' + i % 26);
+
+    auto concat = [](const std::string& a, const std::string& b) { return a + b; };
+    std::vector<std::string> expected(size);
+    std::inclusive_scan(v.begin(), v.end(), expected.begin(), concat);
+
+    std::vector<std::string> result(size);
+    nil::crypto3::parallel_inclusive_scan(
+        v.begin(), v.end(), result.begin(), concat, nil::crypto3::ThreadPool::PoolLevel::HIGH);
+    BOOST_CHECK(result == expected);
+    BOOST_CHECK_EQUAL(
+        nil::crypto3::parallel_reduce(
+            v.begin(), v.end(), std::string(">"), concat, nil::crypto3::ThreadPool::PoolLevel::HIGH),
+        ">" + expected.back());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,165 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation <info@nil.foundation>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//---------------------------------------------------------------------------//
+
+#ifndef PROOF_GENERATOR_ARTIFACT_WRITER_HPP
+#define PROOF_GENERATOR_ARTIFACT_WRITER_HPP
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+
+#include <boost/log/trivial.hpp>
+
+namespace nil {
+    namespace proof_generator {
+
+        /**
+         * @brief Runs artifact writing jobs on a background I/O thread, so the prover can go on with the next stage
+         * while the previous artifact is serialized and written.
+         *
+         * At most max_pending jobs are in flight, submitting one more blocks until the oldest one is finished.
+         * That bounds the memory held by the artifacts waiting for the disk: with the default of 2 one artifact
+         * is written while the next one waits for it. With max_pending == 0 jobs run synchronously on the calling
+         * thread.
+         *
+         * A job reports failure by returning false or throwing. Jobs after a failed one are still run, and the
+         * failure is reported by the following submit() and by wait().
+         */
+        class artifact_writer {
+        public:
+            using job_type = std::function<bool()>;
+
+            explicit artifact_writer(std::size_t max_pending = 2) : max_pending_(max_pending) {
+            }
+
+            artifact_writer(const artifact_writer&) = delete;
+            artifact_writer& operator=(const artifact_writer&) = delete;
+
+            ~artifact_writer() {
+                {
+                    std::unique_lock lock(mutex_);
+                    stopping_ = true;
+                }
+                job_added_.notify_one();
+                if (thread_.joinable()) {
+                    thread_.join();
+                }
+            }
+
+            /**
+             * @brief Queues the job, the name is used in the error messages.
+             * @return false if one of the jobs already failed, so the caller can stop early.
+             */
+            bool submit(std::string name, job_type job) {
+                if (max_pending_ == 0) {
+                    run(name, job);
+                    std::unique_lock lock(mutex_);
+                    return !failed_;
+                }
+
+                std::unique_lock lock(mutex_);
+                if (!thread_.joinable()) {
+                    thread_ = std::thread([this] { worker(); });
+                }
+                job_done_.wait(lock, [this] { return unfinished_ < max_pending_; });
+                queue_.emplace_back(std::move(name), std::move(job));
+                ++unfinished_;
+                const bool ok = !failed_;
+                lock.unlock();
+                job_added_.notify_one();
+                return ok;
+            }
+
+            /**
+             * @brief Waits for all submitted jobs. Rethrows the first exception thrown by a job.
+             * @return false if any job failed.
+             */
+            bool wait() {
+                std::unique_lock lock(mutex_);
+                job_done_.wait(lock, [this] { return unfinished_ == 0; });
+                if (exception_) {
+                    std::rethrow_exception(std::exchange(exception_, nullptr));
+                }
+                return !failed_;
+            }
+
+        private:
+            void run(const std::string& name, const job_type& job) {
+                bool ok = false;
+                std::exception_ptr exception;
+                try {
+                    ok = job();
+                } catch (const std::exception& e) {
+                    BOOST_LOG_TRIVIAL(error) << "Writing " << name << " failed: " << e.what();
+                    exception = std::current_exception();
+                } catch (...) {
+                    exception = std::current_exception();
+                }
+                if (!ok && !exception) {
+                    BOOST_LOG_TRIVIAL(error) << "Writing " << name << " failed";
+                }
+
+                std::unique_lock lock(mutex_);
+                failed_ = failed_ || !ok;
+                if (exception && !exception_) {
+                    exception_ = exception;
+                }
+            }
+
+            void worker() {
+                std::unique_lock lock(mutex_);
+                while (true) {
+                    job_added_.wait(lock, [this] { return stopping_ || !queue_.empty(); });
+                    if (queue_.empty()) {
+                        return;
+                    }
+                    auto [name, job] = std::move(queue_.front());
+                    queue_.pop_front();
+                    lock.unlock();
+
+                    run(name, job);
+                    // Release the artifact before the next one is taken.
+                    job = nullptr;
+
+                    lock.lock();
+                    --unfinished_;
+                    job_done_.notify_all();
+                }
+            }
+
+            const std::size_t max_pending_;
+
+            std::mutex mutex_;
+            std::condition_variable job_added_;
+            std::condition_variable job_done_;
+            std::deque<std::pair<std::string, job_type>> queue_;
+            std::size_t unfinished_ = 0;
+            bool stopping_ = false;
+            bool failed_ = false;
+            std::exception_ptr exception_;
+            std::thread thread_;
+        };
+
+    } // namespace proof_generator
+} // namespace nil
+
+#endif // PROOF_GENERATOR_ARTIFACT_WRITER_HPP
@@ -0,0 +1,516 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation <info@nil.foundation>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//---------------------------------------------------------------------------//
+
+#ifndef PROOF_GENERATOR_BULK_ARTIFACTS_HPP
+#define PROOF_GENERATOR_BULK_ARTIFACTS_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <boost/assert.hpp>
+
+#include <nil/marshalling/field_type.hpp>
+#include <nil/marshalling/status_type.hpp>
+#include <nil/crypto3/marshalling/algebra/processing/field_element_vector.hpp>
+#include <nil/crypto3/marshalling/algebra/types/detail/parallel_chunks.hpp>
+#include <nil/crypto3/marshalling/zk/types/commitments/lpc.hpp>
+#include <nil/crypto3/marshalling/zk/types/placeholder/common_data.hpp>
+
+#include <nil/crypto3/zk/detail/batch_source.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/plonk/table_description.hpp>
+
+#ifdef PROOF_GENERATOR_MULTI_THREADED
+#include <nil/actor/core/parallelization_utils.hpp>
+#endif
+
+namespace nil {
+    namespace proof_generator {
+
+        /**
+         * Encoding of the assignment table, preprocessed data and commitment state files. MARSHALLING is the
+         * canonical marshalling format. BULK and RAW write the same data as a container of sections (see
+         * bulk_artifact_writer) in which the field element vectors are converted in chunks, BULK in the canonical
+         * byte format of the elements and RAW as their in-memory representation, which is only meant to be read
+         * back on the same kind of machine. Files in any of the encodings are recognized when read.
+         */
+        enum class ArtifactEncoding {
+            MARSHALLING = 0,
+            BULK = 1,
+            RAW = 2
+        };
+
+        namespace detail {
+
+            inline ArtifactEncoding artifact_encoding_from_string(const std::string& encoding) {
+                static std::unordered_map<std::string, ArtifactEncoding> encoding_map = {
+                    {"marshalling", ArtifactEncoding::MARSHALLING},
+                    {"bulk", ArtifactEncoding::BULK},
+                    {"raw", ArtifactEncoding::RAW}
+                };
+                auto it = encoding_map.find(encoding);
+                if (it == encoding_map.end()) {
+                    throw std::invalid_argument("Invalid artifact encoding: " + encoding);
+                }
+                return it->second;
+            }
+
+            // The multi-threaded prover converts the chunks of a vector on its thread pool.
+#ifdef PROOF_GENERATOR_MULTI_THREADED
+            using artifact_codec_tasks = nil::crypto3::thread_pool_tasks<>;
+#else
+            using artifact_codec_tasks = nil::crypto3::marshalling::types::detail::sequential_chunk_tasks;
+#endif
+
+            constexpr std::array<std::uint8_t, 8> bulk_artifact_magic = {'n', 'i', 'l', 'b', 'u', 'l', 'k', 'a'};
+            constexpr std::uint32_t bulk_artifact_version = 1;
+
+        } // namespace detail
+
+        // True if the data starts like a container written by bulk_artifact_writer, of any version and encoding.
+        inline bool is_bulk_artifact(const std::uint8_t* data, std::size_t size) {
+            return size >= detail::bulk_artifact_magic.size() &&
+                   std::equal(detail::bulk_artifact_magic.begin(), detail::bulk_artifact_magic.end(), data);
+        }
+
+        /**
+         * @brief Writes an artifact as a container of sections:
+         *
+         *   magic "nilbulka" | version: u32 | encoding: u32 | sections
+         *
+         * (header words and sizes are little-endian). A section is a size (u64), a marshalled structure (its
+         * length as u64, then its bytes) or a vector of field elements written by the codec of the encoding.
+         * Sections carry no tags, they are read back in the order they were written.
+         */
+        template<typename Endianness, typename FieldValueType>
+        class bulk_artifact_writer {
+        public:
+            explicit bulk_artifact_writer(ArtifactEncoding encoding) : encoding_(encoding) {
+                BOOST_ASSERT(encoding != ArtifactEncoding::MARSHALLING);
+                bytes_.insert(bytes_.end(), detail::bulk_artifact_magic.begin(), detail::bulk_artifact_magic.end());
+                write_word(detail::bulk_artifact_version, sizeof(std::uint32_t));
+                write_word(static_cast<std::uint32_t>(encoding), sizeof(std::uint32_t));
+            }
+
+            void write_size(std::uint64_t value) {
+                write_word(value, sizeof(value));
+            }
+
+            template<typename MarshallingType>
+            bool write_marshalled(const MarshallingType& value) {
+                const std::size_t length = value.length();
+                write_size(length);
+                const std::size_t offset = bytes_.size();
+                bytes_.resize(offset + length);
+                auto write_iter = bytes_.begin() + offset;
+                return value.write(write_iter, length) == nil::crypto3::marshalling::status_type::success;
+            }
+
+            bool write_values(const FieldValueType* values, std::size_t size) {
+                return encoding_ == ArtifactEncoding::RAW ? write_values<raw_codec_type>(values, size)
+                                                          : write_values<bulk_codec_type>(values, size);
+            }
+
+            template<typename PolynomialDFSType>
+            bool write_polynomial(const PolynomialDFSType& polynomial) {
+                write_size(polynomial.degree());
+                return write_values(polynomial.data(), polynomial.size());
+            }
+
+            template<typename PolynomialDFSType>
+            bool write_polynomials(const std::vector<PolynomialDFSType>& polynomials) {
+                write_size(polynomials.size());
+                return std::all_of(polynomials.begin(), polynomials.end(),
+                                   [this](const PolynomialDFSType& polynomial) { return write_polynomial(polynomial); });
+            }
+
+            std::vector<std::uint8_t>& bytes() {
+                return bytes_;
+            }
+
+        private:
+            using bulk_codec_type = nil::crypto3::marshalling::processing::field_element_vector_codec<
+                Endianness, FieldValueType, detail::artifact_codec_tasks>;
+            using raw_codec_type = nil::crypto3::marshalling::processing::raw_field_element_vector_codec<
+                FieldValueType, detail::artifact_codec_tasks>;
+
+            template<typename Codec>
+            bool write_values(const FieldValueType* values, std::size_t size) {
+                const std::size_t offset = bytes_.size();
+                bytes_.resize(offset + Codec::length(size));
+                return Codec::write(values, size, bytes_.data() + offset, Codec::length(size)) ==
+                       nil::crypto3::marshalling::status_type::success;
+            }
+
+            void write_word(std::uint64_t value, std::size_t length) {
+                for (std::size_t i = 0; i < length; ++i) {
+                    bytes_.push_back(static_cast<std::uint8_t>(value >> (8 * i)));
+                }
+            }
+
+            ArtifactEncoding encoding_;
+            std::vector<std::uint8_t> bytes_;
+        };
+
+        /**
+         * @brief Reads the sections of a container written by bulk_artifact_writer. Every read returns nothing
+         * (or false) once the data is exhausted or malformed.
+         */
+        template<typename Endianness, typename FieldValueType>
+        class bulk_artifact_reader {
+        public:
+            bulk_artifact_reader(const std::uint8_t* data, std::size_t size) : data_(data), size_(size) {
+            }
+
+            // Checks the header, false for another version or an unknown encoding.
+            bool read_header() {
+                if (!is_bulk_artifact(data_, size_)) {
+                    return false;
+                }
+                offset_ = detail::bulk_artifact_magic.size();
+                const auto version = read_word(sizeof(std::uint32_t));
+                const auto encoding = read_word(sizeof(std::uint32_t));
+                if (!version || *version != detail::bulk_artifact_version || !encoding) {
+                    return false;
+                }
+                if (*encoding != static_cast<std::uint32_t>(ArtifactEncoding::BULK) &&
+                    *encoding != static_cast<std::uint32_t>(ArtifactEncoding::RAW)) {
+                    return false;
+                }
+                encoding_ = static_cast<ArtifactEncoding>(*encoding);
+                return true;
+            }
+
+            std::optional<std::uint64_t> read_size() {
+                return read_word(sizeof(std::uint64_t));
+            }
+
+            template<typename MarshallingType>
+            std::optional<MarshallingType> read_marshalled() {
+                const auto length = read_size();
+                if (!length || *length > size_ - offset_) {
+                    return std::nullopt;
+                }
+                MarshallingType value;
+                auto read_iter = data_ + offset_;
+                if (value.read(read_iter, *length) != nil::crypto3::marshalling::status_type::success) {
+                    return std::nullopt;
+                }
+                offset_ += *length;
+                return value;
+            }
+
+            bool read_values(std::vector<FieldValueType>& values) {
+                return encoding_ == ArtifactEncoding::RAW ? read_values<raw_codec_type>(values)
+                                                          : read_values<bulk_codec_type>(values);
+            }
+
+            template<typename PolynomialDFSType>
+            std::optional<PolynomialDFSType> read_polynomial() {
+                const auto degree = read_size();
+                std::vector<FieldValueType> values;
+                if (!degree || !read_values(values)) {
+                    return std::nullopt;
+                }
+                return PolynomialDFSType(*degree, std::move(values));
+            }
+
+            template<typename PolynomialDFSType>
+            std::optional<std::vector<PolynomialDFSType>> read_polynomials() {
+                const auto count = read_size();
+                if (!count) {
+                    return std::nullopt;
+                }
+                std::vector<PolynomialDFSType> polynomials;
+                for (std::uint64_t i = 0; i < *count; ++i) {
+                    auto polynomial = read_polynomial<PolynomialDFSType>();
+                    if (!polynomial) {
+                        return std::nullopt;
+                    }
+                    polynomials.push_back(std::move(*polynomial));
+                }
+                return polynomials;
+            }
+
+            bool at_end() const {
+                return offset_ == size_;
+            }
+
+        private:
+            using bulk_codec_type = nil::crypto3::marshalling::processing::field_element_vector_codec<
+                Endianness, FieldValueType, detail::artifact_codec_tasks>;
+            using raw_codec_type = nil::crypto3::marshalling::processing::raw_field_element_vector_codec<
+                FieldValueType, detail::artifact_codec_tasks>;
+
+            template<typename Codec>
+            bool read_values(std::vector<FieldValueType>& values) {
+                if (Codec::read(values, data_ + offset_, size_ - offset_) !=
+                    nil::crypto3::marshalling::status_type::success) {
+                    return false;
+                }
+                offset_ += Codec::length(values.size());
+                return true;
+            }
+
+            std::optional<std::uint64_t> read_word(std::size_t length) {
+                if (size_ - offset_ < length) {
+                    return std::nullopt;
+                }
+                std::uint64_t value = 0;
+                for (std::size_t i = 0; i < length; ++i) {
+                    value |= std::uint64_t(data_[offset_++]) << (8 * i);
+                }
+                return value;
+            }
+
+            const std::uint8_t* data_;
+            std::size_t size_;
+            std::size_t offset_ = 0;
+            ArtifactEncoding encoding_ = ArtifactEncoding::BULK;
+        };
+
+        /**
+         * @brief Assignment table: the table description, then the witness, public input, constant and selector
+         * columns. Columns are cut to 'rows_amount' when written and padded with zeros when read, as in the
+         * canonical format.
+         */
+        template<typename Endianness, typename AssignmentTable>
+        std::optional<std::vector<std::uint8_t>> encode_bulk_assignment_table(
+            ArtifactEncoding encoding,
+            const AssignmentTable& table,
+            std::size_t usable_rows_amount,
+            std::size_t rows_amount
+        ) {
+            bulk_artifact_writer<Endianness, typename AssignmentTable::field_type::value_type> writer(encoding);
+            writer.write_size(table.witnesses_amount());
+            writer.write_size(table.public_inputs_amount());
+            writer.write_size(table.constants_amount());
+            writer.write_size(table.selectors_amount());
+            writer.write_size(usable_rows_amount);
+            writer.write_size(rows_amount);
+            for (const auto* columns : {&table.witnesses(), &table.public_inputs(), &table.constants(),
+                                        &table.selectors()}) {
+                for (const auto& column : *columns) {
+                    if (!writer.write_values(column.data(), std::min(column.size(), rows_amount))) {
+                        return std::nullopt;
+                    }
+                }
+            }
+            return std::move(writer.bytes());
+        }
+
+        template<typename Endianness, typename AssignmentTable>
+        std::optional<std::pair<nil::crypto3::zk::snark::plonk_table_description<typename AssignmentTable::field_type>,
+                                AssignmentTable>>
+        decode_bulk_assignment_table(const std::uint8_t* data, std::size_t size) {
+            using value_type = typename AssignmentTable::field_type::value_type;
+
+            bulk_artifact_reader<Endianness, value_type> reader(data, size);
+            if (!reader.read_header()) {
+                return std::nullopt;
+            }
+            std::array<std::uint64_t, 6> sizes;
+            for (auto& value : sizes) {
+                const auto read_value = reader.read_size();
+                if (!read_value) {
+                    return std::nullopt;
+                }
+                value = *read_value;
+            }
+            nil::crypto3::zk::snark::plonk_table_description<typename AssignmentTable::field_type> desc(
+                sizes[0], sizes[1], sizes[2], sizes[3], sizes[4], sizes[5]);
+            if (desc.usable_rows_amount >= desc.rows_amount) {
+                return std::nullopt;
+            }
+
+            auto read_columns = [&reader, &desc](std::size_t columns_amount)
+                    -> std::optional<std::vector<std::vector<value_type>>> {
+                std::vector<std::vector<value_type>> columns;
+                for (std::size_t i = 0; i < columns_amount; ++i) {
+                    std::vector<value_type> column;
+                    if (!reader.read_values(column) || column.size() > desc.rows_amount) {
+                        return std::nullopt;
+                    }
+                    column.resize(desc.rows_amount, value_type::zero());
+                    columns.push_back(std::move(column));
+                }
+                return columns;
+            };
+            auto witnesses = read_columns(desc.witness_columns);
+            auto public_inputs = witnesses ? read_columns(desc.public_input_columns) : std::nullopt;
+            auto constants = public_inputs ? read_columns(desc.constant_columns) : std::nullopt;
+            auto selectors = constants ? read_columns(desc.selector_columns) : std::nullopt;
+            if (!selectors || !reader.at_end()) {
+                return std::nullopt;
+            }
+
+            using private_table = typename AssignmentTable::private_table_type;
+            using public_table = typename AssignmentTable::public_table_type;
+            return std::make_pair(desc, AssignmentTable(
+                std::make_shared<private_table>(std::move(*witnesses)),
+                std::make_shared<public_table>(std::move(*public_inputs), std::move(*constants),
+                                               std::move(*selectors))));
+        }
+
+        /**
+         * @brief Preprocessed public data: the polynomials of the public table, the permutation and identity
+         * polynomials, q_last and q_blind, then the common data in the canonical format.
+         */
+        template<typename Endianness, typename PublicPreprocessedData>
+        std::optional<std::vector<std::uint8_t>> encode_bulk_preprocessed_public_data(
+            ArtifactEncoding encoding,
+            const PublicPreprocessedData& preprocessed_data
+        ) {
+            using common_data_type = typename PublicPreprocessedData::common_data_type;
+
+            bulk_artifact_writer<Endianness, typename PublicPreprocessedData::polynomial_dfs_type::value_type> writer(
+                encoding);
+            const auto& public_table = *preprocessed_data.public_polynomial_table;
+            const bool written =
+                writer.write_polynomials(public_table.public_inputs()) &&
+                writer.write_polynomials(public_table.constants()) &&
+                writer.write_polynomials(public_table.selectors()) &&
+                writer.write_polynomials(preprocessed_data.permutation_polynomials) &&
+                writer.write_polynomials(preprocessed_data.identity_polynomials) &&
+                writer.write_polynomial(preprocessed_data.q_last) &&
+                writer.write_polynomial(preprocessed_data.q_blind) &&
+                writer.write_marshalled(
+                    nil::crypto3::marshalling::types::fill_placeholder_common_data<Endianness, common_data_type>(
+                        preprocessed_data.common_data));
+            if (!written) {
+                return std::nullopt;
+            }
+            return std::move(writer.bytes());
+        }
+
+        template<typename Endianness, typename PublicPreprocessedData>
+        std::optional<PublicPreprocessedData> decode_bulk_preprocessed_public_data(
+            const std::uint8_t* data, std::size_t size
+        ) {
+            using polynomial_dfs_type = typename PublicPreprocessedData::polynomial_dfs_type;
+            using public_table_type = typename PublicPreprocessedData::plonk_public_polynomial_dfs_table_type;
+            using common_data_type = typename PublicPreprocessedData::common_data_type;
+            using common_data_marshalling_type = nil::crypto3::marshalling::types::placeholder_common_data<
+                nil::crypto3::marshalling::field_type<Endianness>, common_data_type>;
+
+            bulk_artifact_reader<Endianness, typename polynomial_dfs_type::value_type> reader(data, size);
+            if (!reader.read_header()) {
+                return std::nullopt;
+            }
+            auto public_inputs = reader.template read_polynomials<polynomial_dfs_type>();
+            auto constants = reader.template read_polynomials<polynomial_dfs_type>();
+            auto selectors = reader.template read_polynomials<polynomial_dfs_type>();
+            auto permutation_polynomials = reader.template read_polynomials<polynomial_dfs_type>();
+            auto identity_polynomials = reader.template read_polynomials<polynomial_dfs_type>();
+            auto q_last = reader.template read_polynomial<polynomial_dfs_type>();
+            auto q_blind = reader.template read_polynomial<polynomial_dfs_type>();
+            auto common_data = reader.template read_marshalled<common_data_marshalling_type>();
+            if (!public_inputs || !constants || !selectors || !permutation_polynomials || !identity_polynomials ||
+                !q_last || !q_blind || !common_data || !reader.at_end()) {
+                return std::nullopt;
+            }
+
+            return PublicPreprocessedData({
+                std::make_shared<public_table_type>(std::move(*public_inputs), std::move(*constants),
+                                                    std::move(*selectors)),
+                std::move(*permutation_polynomials),
+                std::move(*identity_polynomials),
+                std::move(*q_last),
+                std::move(*q_blind),
+                nil::crypto3::marshalling::types::make_placeholder_common_data<Endianness, common_data_type>(
+                    *common_data)
+            });
+        }
+
+        /**
+         * @brief Commitment scheme state: the state without the polynomials in the canonical format, then the
+         * polynomials of each batch. The Merkle trees stay in the canonical part. Spilled batches are read back
+         * one at a time.
+         */
+        template<typename Endianness, typename LpcScheme>
+        std::optional<std::vector<std::uint8_t>> encode_bulk_commitment_scheme(
+            ArtifactEncoding encoding,
+            const LpcScheme& scheme
+        ) {
+            using polynomial_type = typename LpcScheme::polynomial_type;
+
+            bulk_artifact_writer<Endianness, typename LpcScheme::value_type> writer(encoding);
+            if (!writer.write_marshalled(nil::crypto3::marshalling::types::fill_commitment_scheme<Endianness, LpcScheme>(
+                    scheme, std::map<std::size_t, std::vector<polynomial_type>>{}))) {
+                return std::nullopt;
+            }
+            const auto polys = scheme.polys_view();
+            writer.write_size(polys.size());
+            for (const auto& [index, batch] : polys) {
+                writer.write_size(index);
+                if (!writer.write_polynomials(*nil::crypto3::zk::detail::load_batch(batch))) {
+                    return std::nullopt;
+                }
+            }
+            return std::move(writer.bytes());
+        }
+
+        template<typename Endianness, typename LpcScheme>
+        std::optional<LpcScheme> decode_bulk_commitment_scheme(const std::uint8_t* data, std::size_t size) {
+            using polynomial_type = typename LpcScheme::polynomial_type;
+            using commitment_state_marshalling_type = typename nil::crypto3::marshalling::types::commitment_scheme_state<
+                nil::crypto3::marshalling::field_type<Endianness>, LpcScheme>::type;
+
+            bulk_artifact_reader<Endianness, typename LpcScheme::value_type> reader(data, size);
+            if (!reader.read_header()) {
+                return std::nullopt;
+            }
+            auto state = reader.template read_marshalled<commitment_state_marshalling_type>();
+            if (!state) {
+                return std::nullopt;
+            }
+            auto scheme = nil::crypto3::marshalling::types::make_commitment_scheme<Endianness, LpcScheme>(*state);
+            if (!scheme) {
+                return std::nullopt;
+            }
+            std::optional<LpcScheme> result;
+            result.emplace(std::move(scheme.value()));
+
+            const auto batches_count = reader.read_size();
+            if (!batches_count) {
+                return std::nullopt;
+            }
+            for (std::uint64_t i = 0; i < *batches_count; ++i) {
+                const auto index = reader.read_size();
+                auto polys = index ? reader.template read_polynomials<polynomial_type>() : std::nullopt;
+                if (!polys) {
+                    return std::nullopt;
+                }
+                result->_polys[*index] = std::move(*polys);
+            }
+            if (!reader.at_end()) {
+                return std::nullopt;
+            }
+            return result;
+        }
+
+    } // namespace proof_generator
+} // namespace nil
+
+#endif // PROOF_GENERATOR_BULK_ARTIFACTS_HPP
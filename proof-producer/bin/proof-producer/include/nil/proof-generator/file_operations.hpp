@@ -17,18 +17,38 @@
 #ifndef PROOF_GENERATOR_FILE_OPERATIONS_HPP
 #define PROOF_GENERATOR_FILE_OPERATIONS_HPP
 
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
 #include <fstream>
-#include <iomanip>
 #include <iostream>
 #include <limits>
+#include <memory>
 #include <optional>
+#include <string>
 #include <vector>
 
 #include <boost/filesystem.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
 #include <boost/log/trivial.hpp>
 
+#include <fcntl.h>
+#include <unistd.h>
+
 namespace nil {
     namespace proof_generator {
+        // How artifact files are written to the disk.
+        struct write_options {
+            // Flush the file to the device before reporting success.
+            bool sync = false;
+            // Bypass the page cache with O_DIRECT where the file system supports it.
+            bool direct_io = false;
+        };
+
         inline bool is_valid_path(const std::string& path) {
             if (path.length() >= PATH_MAX) {
                 BOOST_LOG_TRIVIAL(error) << path << ": file path is too long. Maximum allowed length is " << PATH_MAX
@@ -121,70 +141,245 @@ namespace nil {
             return v;
         }
 
-        bool write_vector_to_file(const std::vector<std::uint8_t>& vector, const std::string& path) {
+        // Reads the stream till the end. Works for pipes and other sources with unknown size.
+        inline std::optional<std::vector<std::uint8_t>> read_stream_to_vector(std::istream& stream) {
+            static constexpr std::size_t chunk_size = 1 << 20;
 
-            auto file = open_file<std::ofstream>(path, std::ios_base::out | std::ios_base::binary);
-            if (!file.has_value()) {
-                return false;
+            std::vector<std::uint8_t> v;
+            while (stream) {
+                const std::size_t offset = v.size();
+                v.resize(offset + chunk_size);
+                stream.read(reinterpret_cast<char*>(v.data() + offset), chunk_size);
+                v.resize(offset + static_cast<std::size_t>(stream.gcount()));
             }
 
-            std::ofstream& stream = file.value();
-            stream.write(reinterpret_cast<const char*>(vector.data()), vector.size());
+            if (stream.bad()) {
+                return std::nullopt;
+            }
+            return v;
+        }
 
-            if (stream.fail()) {
-                BOOST_LOG_TRIVIAL(error) << "Error occured during writing file " << path;
-                return false;
+        /**
+         * @brief Read-only memory mapping of a whole regular file. Pages are loaded by the kernel on access,
+         * so large inputs can be decoded without copying them into an intermediate buffer first.
+         */
+        class mapped_file {
+        public:
+            explicit mapped_file(const std::string& path)
+                : mapping_(path.c_str(), boost::interprocess::read_only),
+                  region_(mapping_, boost::interprocess::read_only) {
+                region_.advise(boost::interprocess::mapped_region::advice_sequential);
             }
 
-            return true;
-        }
+            const std::uint8_t* data() const {
+                return static_cast<const std::uint8_t*>(region_.get_address());
+            }
 
-        // HEX data format is not efficient, we will remove it later
-        std::optional<std::vector<std::uint8_t>> read_hex_file_to_vector(const std::string& path) {
-            auto file = open_file<std::ifstream>(path, std::ios_base::in);
-            if (!file.has_value()) {
+            std::size_t size() const {
+                return region_.get_size();
+            }
+
+        private:
+            boost::interprocess::file_mapping mapping_;
+            boost::interprocess::mapped_region region_;
+        };
+
+        inline std::optional<mapped_file> map_file(const std::string& path) {
+            try {
+                return std::optional<mapped_file>(std::in_place, path);
+            } catch (const boost::interprocess::interprocess_exception& e) {
+                BOOST_LOG_TRIVIAL(error) << "Unable to map file " << path << ": " << e.what();
                 return std::nullopt;
             }
+        }
 
-            std::ifstream& stream = file.value();
-            std::vector<uint8_t> result;
-            std::string line;
-            while (std::getline(stream, line)) {
-                if (line.rfind("0x", 0) == 0 && line.length() >= 3) {
-                    for (size_t i = 2; i < line.length(); i += 2) {
-                        std::string hex_string = line.substr(i, 2);
-                        uint8_t byte = static_cast<uint8_t>(std::stoul(hex_string, nullptr, 16));
-                        result.push_back(byte);
+        namespace detail {
+            inline bool write_all(int fd, const std::uint8_t* data, std::size_t size) {
+                while (size > 0) {
+                    const ssize_t written = ::write(fd, data, size);
+                    if (written < 0) {
+                        if (errno == EINTR) {
+                            continue;
+                        }
+                        return false;
                     }
-                } else {
-                    BOOST_LOG_TRIVIAL(error) << "File contains non-hex string";
-                    return std::nullopt;
+                    data += written;
+                    size -= static_cast<std::size_t>(written);
                 }
+                return true;
             }
 
-            return result;
+            // O_DIRECT requires block aligned buffers and sizes, so the aligned part of the data goes through an
+            // aligned bounce buffer, and the tail is written after O_DIRECT is switched off.
+            inline bool write_all_direct(int fd, const std::uint8_t* data, std::size_t size) {
+                static constexpr std::size_t alignment = 4096;
+                static constexpr std::size_t bounce_size = 4 << 20;
+
+                const std::size_t aligned_size = size & ~(alignment - 1);
+                if (aligned_size > 0) {
+                    std::unique_ptr<std::uint8_t, decltype(&std::free)> bounce(
+                        static_cast<std::uint8_t*>(std::aligned_alloc(alignment, bounce_size)), &std::free);
+                    if (!bounce) {
+                        return false;
+                    }
+                    for (std::size_t offset = 0; offset < aligned_size; offset += bounce_size) {
+                        const std::size_t chunk = std::min(bounce_size, aligned_size - offset);
+                        std::memcpy(bounce.get(), data + offset, chunk);
+                        if (!write_all(fd, bounce.get(), chunk)) {
+                            return false;
+                        }
+                    }
+                }
+                if (aligned_size == size) {
+                    return true;
+                }
+                const int flags = ::fcntl(fd, F_GETFL);
+                if (flags < 0 || ::fcntl(fd, F_SETFL, flags & ~O_DIRECT) < 0) {
+                    return false;
+                }
+                return write_all(fd, data + aligned_size, size - aligned_size);
+            }
+        } // namespace detail
+
+        inline bool write_buffer_to_file(const std::uint8_t* data, std::size_t size, const std::string& path,
+                                         const write_options& options = {}) {
+            const int flags = O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC;
+            int fd = -1;
+            bool direct = false;
+            if (options.direct_io) {
+                fd = ::open(path.c_str(), flags | O_DIRECT, 0666);
+                direct = fd >= 0;
+                if (!direct && errno == EINVAL) {
+                    BOOST_LOG_TRIVIAL(debug) << path << ": O_DIRECT is not supported, writing through the page cache";
+                }
+            }
+            if (fd < 0) {
+                fd = ::open(path.c_str(), flags, 0666);
+            }
+            if (fd < 0) {
+                BOOST_LOG_TRIVIAL(error) << "Unable to open file: " << path << ": " << std::strerror(errno);
+                return false;
+            }
+
+            bool ok = direct ? detail::write_all_direct(fd, data, size) : detail::write_all(fd, data, size);
+            if (ok && options.sync) {
+                ok = ::fsync(fd) == 0;
+            }
+            int error = ok ? 0 : errno;
+            if (::close(fd) != 0 && ok) {
+                ok = false;
+                error = errno;
+            }
+            if (!ok) {
+                BOOST_LOG_TRIVIAL(error) << "Error occurred during writing file " << path << ": " << std::strerror(error);
+            }
+            return ok;
         }
 
-        bool write_vector_to_hex_file(const std::vector<std::uint8_t>& vector, const std::string& path) {
-            auto file = open_file<std::ofstream>(path, std::ios_base::out);
-            if (!file.has_value()) {
-                return false;
+        bool write_vector_to_file(const std::vector<std::uint8_t>& vector, const std::string& path,
+                                  const write_options& options = {}) {
+            return write_buffer_to_file(vector.data(), vector.size(), path, options);
+        }
+
+        namespace detail {
+            // Maps every byte to its two lower-case hex digits, so encoding is a single table lookup per byte.
+            inline const std::array<std::array<char, 2>, 256>& hex_encode_table() {
+                static const std::array<std::array<char, 2>, 256> table = [] {
+                    constexpr char digits[] = "0123456789abcdef";
+                    std::array<std::array<char, 2>, 256> t{};
+                    for (std::size_t i = 0; i < 256; ++i) {
+                        t[i] = {digits[i >> 4], digits[i & 0x0F]};
+                    }
+                    return t;
+                }();
+                return table;
             }
 
-            std::ofstream& stream = file.value();
+            // Maps an ASCII character to its nibble value, or 0xFF if it's not a hex digit.
+            inline const std::array<std::uint8_t, 256>& hex_decode_table() {
+                static const std::array<std::uint8_t, 256> table = [] {
+                    std::array<std::uint8_t, 256> t{};
+                    t.fill(0xFF);
+                    for (std::uint8_t c = 0; c < 10; ++c) {
+                        t['0' + c] = c;
+                    }
+                    for (std::uint8_t c = 0; c < 6; ++c) {
+                        t['a' + c] = 10 + c;
+                        t['A' + c] = 10 + c;
+                    }
+                    return t;
+                }();
+                return table;
+            }
+        } // namespace detail
 
-            stream << "0x" << std::hex;
-            for (auto it = vector.cbegin(); it != vector.cend(); ++it) {
-                stream << std::setfill('0') << std::setw(2) << std::right << int(*it);
+        // Encodes the bytes into 2 * size hex characters at out.
+        inline void encode_hex(const std::uint8_t* data, std::size_t size, char* out) {
+            const auto& table = detail::hex_encode_table();
+            for (std::size_t i = 0; i < size; ++i) {
+                std::memcpy(out + 2 * i, table[data[i]].data(), 2);
             }
-            stream << std::dec;
+        }
 
-            if (stream.fail()) {
-                BOOST_LOG_TRIVIAL(error) << "Error occurred during writing to file " << path;
-                return false;
+        // Decodes 2 * size hex characters into size bytes at out. Returns false on a non-hex character.
+        inline bool decode_hex(const char* data, std::size_t size, std::uint8_t* out) {
+            const auto& table = detail::hex_decode_table();
+            std::uint8_t invalid = 0;
+            for (std::size_t i = 0; i < size; ++i) {
+                const std::uint8_t hi = table[static_cast<std::uint8_t>(data[2 * i])];
+                const std::uint8_t lo = table[static_cast<std::uint8_t>(data[2 * i + 1])];
+                // Invalid digits are accumulated instead of checked per byte to keep the loop branch-free.
+                invalid |= (hi | lo) & 0xF0;
+                out[i] = static_cast<std::uint8_t>((hi << 4) | lo);
             }
+            return invalid == 0;
+        }
 
-            return true;
+        // HEX data format is not efficient, it's kept for compatibility only. Use binary format for new artifacts.
+        std::optional<std::vector<std::uint8_t>> read_hex_file_to_vector(const std::string& path) {
+            auto text = read_file_to_vector(path);
+            if (!text.has_value()) {
+                return std::nullopt;
+            }
+
+            std::vector<std::uint8_t> result;
+            result.reserve(text->size() / 2);
+
+            // File consists of lines, each of them is "0x" followed by an even number of hex digits.
+            const char* cur = reinterpret_cast<const char*>(text->data());
+            const char* const end = cur + text->size();
+            while (cur != end) {
+                const char* line_end = static_cast<const char*>(std::memchr(cur, '\n', end - cur));
+                if (line_end == nullptr) {
+                    line_end = end;
+                }
+                const std::size_t line_length = line_end - cur;
+                if (line_length < 3 || cur[0] != '0' || cur[1] != 'x' || line_length % 2 != 0) {
+                    BOOST_LOG_TRIVIAL(error) << "File contains non-hex string";
+                    return std::nullopt;
+                }
+
+                const std::size_t bytes = (line_length - 2) / 2;
+                const std::size_t offset = result.size();
+                result.resize(offset + bytes);
+                if (!decode_hex(cur + 2, bytes, result.data() + offset)) {
+                    BOOST_LOG_TRIVIAL(error) << "File contains non-hex string";
+                    return std::nullopt;
+                }
+
+                cur = line_end == end ? end : line_end + 1;
+            }
+
+            return result;
+        }
+
+        bool write_vector_to_hex_file(const std::vector<std::uint8_t>& vector, const std::string& path,
+                                      const write_options& options = {}) {
+            std::string text(2 + 2 * vector.size(), '\0');
+            text[0] = '0';
+            text[1] = 'x';
+            encode_hex(vector.data(), vector.size(), text.data() + 2);
+            return write_buffer_to_file(reinterpret_cast<const std::uint8_t*>(text.data()), text.size(), path, options);
         }
 
     } // namespace proof_generator
@@ -0,0 +1,196 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation <info@nil.foundation>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//---------------------------------------------------------------------------//
+
+#ifndef PROOF_GENERATOR_POLYNOMIAL_AGGREGATION_HPP
+#define PROOF_GENERATOR_POLYNOMIAL_AGGREGATION_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <sys/socket.h>
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/local/stream_protocol.hpp>
+#include <boost/asio/read.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/log/trivial.hpp>
+
+namespace nil {
+    namespace proof_generator {
+
+        /**
+         * @brief Receives serialized artifacts over a local (Unix domain) socket. Every sender opens its own
+         * connection, writes one artifact and closes the connection, so the end of the stream marks the end of
+         * the artifact.
+         */
+        class local_socket_receiver {
+        public:
+            using protocol_type = boost::asio::local::stream_protocol;
+
+            /// @brief Starts listening on the given path. A stale socket file from a previous run is removed.
+            explicit local_socket_receiver(const std::string& path) : acceptor_(io_context_), path_(path) {
+                boost::filesystem::remove(path_);
+                protocol_type::endpoint endpoint(path_);
+                acceptor_.open(endpoint.protocol());
+                acceptor_.bind(endpoint);
+                acceptor_.listen();
+            }
+
+            local_socket_receiver(const local_socket_receiver&) = delete;
+            local_socket_receiver& operator=(const local_socket_receiver&) = delete;
+
+            ~local_socket_receiver() {
+                boost::system::error_code ec;
+                acceptor_.close(ec);
+                boost::filesystem::remove(path_, ec);
+            }
+
+            /// @brief Waits for the next sender and reads everything it sends. Can be called from several threads,
+            /// connections are accepted one at a time, but read concurrently.
+            std::optional<std::vector<std::uint8_t>> receive() {
+                protocol_type::socket socket(io_context_);
+                boost::system::error_code ec;
+                {
+                    std::lock_guard<std::mutex> lock(accept_mutex_);
+                    acceptor_.accept(socket, ec);
+                }
+                if (ec) {
+                    BOOST_LOG_TRIVIAL(error) << "Failed to accept connection on " << path_ << ": " << ec.message();
+                    return std::nullopt;
+                }
+
+                std::vector<std::uint8_t> result;
+                boost::asio::read(socket, boost::asio::dynamic_buffer(result), ec);
+                if (ec && ec != boost::asio::error::eof) {
+                    BOOST_LOG_TRIVIAL(error) << "Failed to read from " << path_ << ": " << ec.message();
+                    return std::nullopt;
+                }
+                return result;
+            }
+
+            /// @brief Wakes up the threads waiting in receive(), so they fail instead of waiting for senders which
+            /// will never come. Used to abort when some other input has failed.
+            void stop() {
+                ::shutdown(acceptor_.native_handle(), SHUT_RDWR);
+            }
+
+        private:
+            boost::asio::io_context io_context_;
+            protocol_type::acceptor acceptor_;
+            std::mutex accept_mutex_;
+            std::string path_;
+        };
+
+        namespace detail {
+            // The single-threaded prover loads and sums the inputs one by one on the calling thread.
+            inline std::size_t default_aggregation_workers() {
+#ifdef PROOF_GENERATOR_MULTI_THREADED
+                return std::thread::hardware_concurrency();
+#else
+                return 1;
+#endif
+            }
+
+            // Runs task(0), ..., task(count - 1) concurrently, or inline if there's only one of them.
+            template<typename Task>
+            void run_concurrently(std::size_t count, const Task& task) {
+                if (count == 1) {
+                    task(0);
+                    return;
+                }
+                std::vector<std::future<void>> futures;
+                futures.reserve(count);
+                for (std::size_t i = 0; i < count; ++i) {
+                    futures.emplace_back(std::async(std::launch::async, [&task, i]() { task(i); }));
+                }
+                for (auto& future : futures) {
+                    future.get();
+                }
+            }
+        } // namespace detail
+
+        /**
+         * @brief Sums 'sources_count' polynomials, produced by calls load(0), ..., load(sources_count - 1).
+         *
+         * Loaders are run on 'workers_count' threads. Each thread adds whatever it has loaded into its own partial
+         * sum, so reading and decoding of the next input overlaps with the additions and a slow source does not
+         * stall the rest. Partial sums are then added pairwise in a tree. Addition is exact, so the result does not
+         * depend on the order in which sources complete. With a single worker everything runs on the calling
+         * thread.
+         *
+         * @return The sum, or std::nullopt if any of the loaders failed.
+         */
+        template<typename PolynomialType>
+        std::optional<PolynomialType> parallel_sum_polynomials(
+                std::size_t sources_count,
+                const std::function<std::optional<PolynomialType>(std::size_t index)>& load,
+                std::size_t workers_count = detail::default_aggregation_workers()) {
+            if (sources_count == 0) {
+                return PolynomialType();
+            }
+            workers_count = std::clamp<std::size_t>(workers_count, 1, sources_count);
+
+            std::atomic<std::size_t> next_source{0};
+            std::atomic<bool> failed{false};
+            std::vector<std::optional<PolynomialType>> partial_sums(workers_count);
+
+            detail::run_concurrently(workers_count, [&](std::size_t worker) {
+                for (std::size_t i = next_source++; i < sources_count && !failed; i = next_source++) {
+                    std::optional<PolynomialType> poly = load(i);
+                    if (!poly) {
+                        failed = true;
+                        return;
+                    }
+                    if (!partial_sums[worker]) {
+                        partial_sums[worker] = std::move(poly);
+                    } else {
+                        *partial_sums[worker] += *poly;
+                    }
+                }
+            });
+            if (failed) {
+                return std::nullopt;
+            }
+
+            std::vector<PolynomialType> sums;
+            for (auto& partial_sum : partial_sums) {
+                if (partial_sum) {
+                    sums.emplace_back(std::move(*partial_sum));
+                }
+            }
+
+            while (sums.size() > 1) {
+                const std::size_t stride = (sums.size() + 1) / 2;
+                detail::run_concurrently(sums.size() - stride, [&sums, stride](std::size_t i) {
+                    sums[i] += sums[i + stride];
+                });
+                sums.erase(sums.begin() + stride, sums.end());
+            }
+            return std::move(sums.front());
+        }
+
+    } // namespace proof_generator
+} // namespace nil
+
+#endif // PROOF_GENERATOR_POLYNOMIAL_AGGREGATION_HPP
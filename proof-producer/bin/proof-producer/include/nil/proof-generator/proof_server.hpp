@@ -0,0 +1,480 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation <info@nil.foundation>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//---------------------------------------------------------------------------//
+
+#ifndef PROOF_GENERATOR_PROOF_SERVER_HPP
+#define PROOF_GENERATOR_PROOF_SERVER_HPP
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <csignal>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <poll.h>
+#include <sys/socket.h>
+
+#include <boost/asio/error.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/local/stream_protocol.hpp>
+#include <boost/asio/read.hpp>
+#include <boost/asio/signal_set.hpp>
+#include <boost/asio/write.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/log/trivial.hpp>
+
+#include <nil/crypto3/bench/memory_usage.hpp>
+
+namespace nil {
+    namespace proof_generator {
+        namespace detail {
+            // Messages are framed by an 8-byte big-endian length. A reply starts with a status byte, followed by a
+            // framed proof or error message.
+            constexpr std::size_t message_header_size = 8;
+            constexpr std::uint8_t reply_ok = 0;
+            constexpr std::uint8_t reply_error = 1;
+
+            inline std::array<std::uint8_t, message_header_size> encode_message_size(std::uint64_t size) {
+                std::array<std::uint8_t, message_header_size> header;
+                for (std::size_t i = 0; i < message_header_size; ++i) {
+                    header[i] = static_cast<std::uint8_t>(size >> (8 * (message_header_size - 1 - i)));
+                }
+                return header;
+            }
+
+            inline std::uint64_t decode_message_size(const std::array<std::uint8_t, message_header_size>& header) {
+                std::uint64_t size = 0;
+                for (std::uint8_t byte : header) {
+                    size = (size << 8) | byte;
+                }
+                return size;
+            }
+
+            template<typename Socket>
+            bool write_message(Socket& socket, const std::vector<std::uint8_t>& payload,
+                               boost::system::error_code& ec) {
+                const auto header = encode_message_size(payload.size());
+                boost::asio::write(socket, boost::asio::buffer(header), ec);
+                if (!ec) {
+                    boost::asio::write(socket, boost::asio::buffer(payload), ec);
+                }
+                return !ec;
+            }
+
+            // Waits until 'fd' is ready for 'events', failing with timed_out after 'timeout'.
+            inline bool wait_ready(int fd, short events, std::chrono::milliseconds timeout,
+                                   boost::system::error_code& ec) {
+                pollfd descriptor {fd, events, 0};
+                int result;
+                do {
+                    result = ::poll(&descriptor, 1, static_cast<int>(timeout.count()));
+                } while (result < 0 && errno == EINTR);
+                if (result < 0) {
+                    ec.assign(errno, boost::system::system_category());
+                    return false;
+                }
+                if (result == 0) {
+                    ec = boost::asio::error::timed_out;
+                    return false;
+                }
+                return true;
+            }
+
+            // Like boost::asio::read() and write(), but fail if the peer makes no progress for 'timeout'. Blocking
+            // asio calls retry on their own after SO_RCVTIMEO, so the wait is done here.
+            template<typename Socket>
+            void read_with_timeout(Socket& socket, boost::asio::mutable_buffer buffer,
+                                   std::chrono::milliseconds timeout, boost::system::error_code& ec) {
+                while (buffer.size() != 0 && wait_ready(socket.native_handle(), POLLIN, timeout, ec)) {
+                    buffer += socket.read_some(buffer, ec);
+                    if (ec) {
+                        return;
+                    }
+                }
+            }
+
+            template<typename Socket>
+            void write_with_timeout(Socket& socket, boost::asio::const_buffer buffer,
+                                    std::chrono::milliseconds timeout, boost::system::error_code& ec) {
+                while (buffer.size() != 0 && wait_ready(socket.native_handle(), POLLOUT, timeout, ec)) {
+                    buffer += socket.write_some(buffer, ec);
+                    if (ec) {
+                        return;
+                    }
+                }
+            }
+        } // namespace detail
+
+        /**
+         * @brief Limits how many requests a resident server works on at once, so their total memory stays below
+         * the budget.
+         *
+         * Memory of a request is taken to be proportional to its size. The first request is admitted alone and
+         * its peak RSS increase gives the factor. Afterwards a request is admitted if the resident data, the
+         * estimates of the running requests and its own estimate fit into the budget. A request is always
+         * admitted if nothing else is running, otherwise a request larger than the budget would wait forever.
+         */
+        class request_memory_budget {
+        public:
+            struct ticket {
+                std::size_t estimate = 0;
+                bool calibrating = false;
+            };
+
+            /// @param budget_bytes Budget for the whole process, 0 means unlimited.
+            /// @param resident_bytes Memory the process uses before any request is admitted.
+            request_memory_budget(std::size_t budget_bytes, std::size_t resident_bytes)
+                : budget_bytes_(budget_bytes), resident_bytes_(resident_bytes) {
+            }
+
+            /// @brief Waits until a request of 'request_size' bytes may run.
+            ticket acquire(std::size_t request_size) {
+                std::unique_lock<std::mutex> lock(mutex_);
+                if (budget_bytes_ == 0) {
+                    ++running_;
+                    return {};
+                }
+                ticket result;
+                released_.wait(lock, [&] {
+                    if (calibrating_) {
+                        return false;
+                    }
+                    if (bytes_per_request_byte_ == 0) {
+                        return running_ == 0;
+                    }
+                    result.estimate = estimate(request_size);
+                    return running_ == 0 || fits(result.estimate);
+                });
+                if (bytes_per_request_byte_ == 0) {
+                    calibrating_ = true;
+                    result.calibrating = true;
+                }
+                reserved_bytes_ += result.estimate;
+                ++running_;
+                return result;
+            }
+
+            /// @brief Ends the request admitted by acquire(). A calibrating request passes the memory it used.
+            void release(const ticket& admitted, std::size_t request_size, std::size_t used_bytes = 0) {
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    if (admitted.calibrating) {
+                        calibrating_ = false;
+                        bytes_per_request_byte_ =
+                            std::max<std::size_t>(1, used_bytes / std::max<std::size_t>(1, request_size));
+                        BOOST_LOG_TRIVIAL(info) << "Request memory calibrated: " << bytes_per_request_byte_
+                                                << " bytes per request byte";
+                    }
+                    reserved_bytes_ -= admitted.estimate;
+                    --running_;
+                }
+                released_.notify_all();
+            }
+
+            std::size_t bytes_per_request_byte() const {
+                std::lock_guard<std::mutex> lock(mutex_);
+                return bytes_per_request_byte_;
+            }
+
+        private:
+            // Saturates instead of overflowing, such a request only runs alone.
+            std::size_t estimate(std::size_t request_size) const {
+                if (request_size > std::numeric_limits<std::size_t>::max() / bytes_per_request_byte_) {
+                    return std::numeric_limits<std::size_t>::max();
+                }
+                return request_size * bytes_per_request_byte_;
+            }
+
+            bool fits(std::size_t estimate) const {
+                const std::size_t used = resident_bytes_ + reserved_bytes_;
+                return used <= budget_bytes_ && estimate <= budget_bytes_ - used;
+            }
+
+            const std::size_t budget_bytes_;
+            const std::size_t resident_bytes_;
+            mutable std::mutex mutex_;
+            std::condition_variable released_;
+            std::size_t reserved_bytes_ = 0;
+            std::size_t running_ = 0;
+            std::size_t bytes_per_request_byte_ = 0;
+            bool calibrating_ = false;
+        };
+
+        /**
+         * @brief Serves proof requests over a local (Unix domain) socket.
+         *
+         * Each connection carries one request: a framed assignment table, answered by a status byte and a framed
+         * proof or error message. Requests are handled by 'concurrency' threads, each accepting and proving on its
+         * own, within the memory budget. Requests larger than 'max_request_bytes' are rejected, and a client which
+         * sends or reads nothing for 'io_timeout' is dropped. serve() returns on SIGINT, SIGTERM or stop(), after
+         * the running requests are answered.
+         */
+        class proof_server {
+        public:
+            using protocol_type = boost::asio::local::stream_protocol;
+            // Returns the proof, std::nullopt or an exception if the request can't be proven.
+            using handler_type =
+                std::function<std::optional<std::vector<std::uint8_t>>(const std::vector<std::uint8_t>& request)>;
+
+            static constexpr std::size_t default_max_request_bytes = std::size_t(4) << 30;
+            static constexpr std::chrono::seconds default_io_timeout{60};
+
+            /// @brief Starts listening on the given path. A stale socket file from a previous run is removed.
+            proof_server(const std::string& path, std::size_t concurrency, std::size_t memory_budget_bytes,
+                         handler_type handler, std::size_t max_request_bytes = default_max_request_bytes,
+                         std::chrono::milliseconds io_timeout = default_io_timeout)
+                : acceptor_(io_context_)
+                , path_(path)
+                , concurrency_(std::max<std::size_t>(1, concurrency))
+                , max_request_bytes_(max_request_bytes)
+                , io_timeout_(io_timeout)
+                , budget_(memory_budget_bytes, nil::crypto3::bench::current_rss_bytes())
+                , handler_(std::move(handler)) {
+                boost::filesystem::remove(path_);
+                protocol_type::endpoint endpoint(path_);
+                acceptor_.open(endpoint.protocol());
+                acceptor_.bind(endpoint);
+                acceptor_.listen();
+            }
+
+            proof_server(const proof_server&) = delete;
+            proof_server& operator=(const proof_server&) = delete;
+
+            ~proof_server() {
+                boost::system::error_code ec;
+                acceptor_.close(ec);
+                boost::filesystem::remove(path_, ec);
+            }
+
+            /// @brief Handles requests until stopped. Returns false if any request failed.
+            bool serve() {
+                BOOST_LOG_TRIVIAL(info) << "Serving proofs on " << path_ << " with " << concurrency_ << " thread(s)";
+
+                boost::asio::signal_set signals(io_context_, SIGINT, SIGTERM);
+                signals.async_wait([this](const boost::system::error_code& ec, int signal) {
+                    if (!ec) {
+                        BOOST_LOG_TRIVIAL(info) << "Received signal " << signal << ", stopping the server";
+                        stop();
+                    }
+                });
+                std::thread signal_thread([this] { io_context_.run(); });
+
+                std::vector<std::thread> workers;
+                for (std::size_t i = 0; i < concurrency_; ++i) {
+                    workers.emplace_back([this] {
+                        while (serve_one()) {
+                        }
+                    });
+                }
+                for (auto& worker : workers) {
+                    worker.join();
+                }
+
+                io_context_.stop();
+                signal_thread.join();
+
+                BOOST_LOG_TRIVIAL(info) << "Server stopped: " << served_ << " request(s) proven, " << failed_
+                                        << " failed";
+                return failed_ == 0;
+            }
+
+            /// @brief Makes serve() return once the running requests are answered. Can be called from any thread.
+            void stop() {
+                stopping_ = true;
+                ::shutdown(acceptor_.native_handle(), SHUT_RDWR);
+            }
+
+            std::size_t requests_served() const {
+                return served_;
+            }
+
+            std::size_t requests_failed() const {
+                return failed_;
+            }
+
+        private:
+            // Accepts and answers one request. Returns false once the server is stopped.
+            bool serve_one() {
+                protocol_type::socket socket(io_context_);
+                boost::system::error_code ec;
+                {
+                    std::lock_guard<std::mutex> lock(accept_mutex_);
+                    if (stopping_) {
+                        return false;
+                    }
+                    acceptor_.accept(socket, ec);
+                }
+                if (stopping_) {
+                    return false;
+                }
+                if (ec) {
+                    BOOST_LOG_TRIVIAL(error) << "Failed to accept connection on " << path_ << ": " << ec.message();
+                    return true;
+                }
+
+                std::array<std::uint8_t, detail::message_header_size> header;
+                detail::read_with_timeout(socket, boost::asio::buffer(header), io_timeout_, ec);
+                if (ec) {
+                    BOOST_LOG_TRIVIAL(error) << "Failed to read request header: " << ec.message();
+                    ++failed_;
+                    return true;
+                }
+                const std::uint64_t request_size = detail::decode_message_size(header);
+                if (request_size > max_request_bytes_) {
+                    const std::string error = "Request of " + std::to_string(request_size) +
+                                              " bytes exceeds the limit of " + std::to_string(max_request_bytes_) +
+                                              " bytes";
+                    BOOST_LOG_TRIVIAL(error) << error;
+                    ++failed_;
+                    send_reply(socket, std::nullopt, error);
+                    return true;
+                }
+
+                // The table is read before the request is admitted, so a slow client can't hold a share of the
+                // budget. Each thread reads one table at a time, at most 'concurrency' of them wait in memory.
+                std::vector<std::uint8_t> request(request_size);
+                detail::read_with_timeout(socket, boost::asio::buffer(request), io_timeout_, ec);
+                if (ec) {
+                    BOOST_LOG_TRIVIAL(error) << "Failed to read request of " << request_size
+                                             << " bytes: " << ec.message();
+                    ++failed_;
+                    return true;
+                }
+
+                const auto ticket = budget_.acquire(request_size);
+                std::size_t rss_before = 0;
+                if (ticket.calibrating) {
+                    nil::crypto3::bench::reset_peak_rss();
+                    rss_before = nil::crypto3::bench::current_rss_bytes();
+                }
+
+                std::optional<std::vector<std::uint8_t>> proof;
+                std::string error = "Proof generation failed, see the server log";
+                auto start = std::chrono::high_resolution_clock::now();
+                try {
+                    proof = handler_(request);
+                } catch (const std::exception& e) {
+                    error = e.what();
+                }
+                auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(
+                    std::chrono::high_resolution_clock::now() - start);
+                request = std::vector<std::uint8_t>();
+
+                const std::size_t peak_rss = ticket.calibrating ? nil::crypto3::bench::peak_rss_bytes() : 0;
+                budget_.release(ticket, request_size, peak_rss > rss_before ? peak_rss - rss_before : 0);
+
+                if (proof) {
+                    ++served_;
+                    BOOST_LOG_TRIVIAL(info) << "Request of " << request_size << " bytes proven in "
+                                            << duration.count() << " ms";
+                } else {
+                    ++failed_;
+                    BOOST_LOG_TRIVIAL(error) << "Request of " << request_size << " bytes failed: " << error;
+                }
+                send_reply(socket, proof, error);
+                return true;
+            }
+
+            // A client which stops reading is dropped after io_timeout_, so it can't hold the thread.
+            void send_reply(protocol_type::socket& socket, const std::optional<std::vector<std::uint8_t>>& proof,
+                            const std::string& error) {
+                boost::system::error_code ec;
+                const std::uint8_t status = proof ? detail::reply_ok : detail::reply_error;
+                const auto header = detail::encode_message_size(proof ? proof->size() : error.size());
+                detail::write_with_timeout(socket, boost::asio::buffer(&status, 1), io_timeout_, ec);
+                if (!ec) {
+                    detail::write_with_timeout(socket, boost::asio::buffer(header), io_timeout_, ec);
+                }
+                if (!ec) {
+                    detail::write_with_timeout(
+                        socket, proof ? boost::asio::buffer(*proof) : boost::asio::buffer(error), io_timeout_, ec);
+                }
+                if (ec) {
+                    BOOST_LOG_TRIVIAL(error) << "Failed to send reply: " << ec.message();
+                }
+            }
+
+            boost::asio::io_context io_context_;
+            protocol_type::acceptor acceptor_;
+            std::mutex accept_mutex_;
+            std::string path_;
+            const std::size_t concurrency_;
+            const std::size_t max_request_bytes_;
+            const std::chrono::milliseconds io_timeout_;
+            request_memory_budget budget_;
+            handler_type handler_;
+            std::atomic<bool> stopping_{false};
+            std::atomic<std::size_t> served_{0};
+            std::atomic<std::size_t> failed_{0};
+        };
+
+        /**
+         * @brief Sends an assignment table to the server listening on 'path' and waits for the proof.
+         *
+         * @return The marshalled proof, or std::nullopt if the server could not be reached or failed the request.
+         */
+        inline std::optional<std::vector<std::uint8_t>> request_proof(const std::string& path,
+                                                                      const std::vector<std::uint8_t>& request) {
+            using protocol_type = boost::asio::local::stream_protocol;
+            boost::asio::io_context io_context;
+            protocol_type::socket socket(io_context);
+            boost::system::error_code ec;
+            socket.connect(protocol_type::endpoint(path), ec);
+            if (ec) {
+                BOOST_LOG_TRIVIAL(error) << "Failed to connect to " << path << ": " << ec.message();
+                return std::nullopt;
+            }
+            if (!detail::write_message(socket, request, ec)) {
+                BOOST_LOG_TRIVIAL(error) << "Failed to send request to " << path << ": " << ec.message();
+                return std::nullopt;
+            }
+
+            std::uint8_t status = detail::reply_error;
+            std::array<std::uint8_t, detail::message_header_size> header;
+            boost::asio::read(socket, boost::asio::buffer(&status, 1), ec);
+            if (!ec) {
+                boost::asio::read(socket, boost::asio::buffer(header), ec);
+            }
+            std::vector<std::uint8_t> reply;
+            if (!ec) {
+                reply.resize(detail::decode_message_size(header));
+                boost::asio::read(socket, boost::asio::buffer(reply), ec);
+            }
+            if (ec) {
+                BOOST_LOG_TRIVIAL(error) << "Failed to read reply from " << path << ": " << ec.message();
+                return std::nullopt;
+            }
+            if (status != detail::reply_ok) {
+                BOOST_LOG_TRIVIAL(error) << "Server failed the request: " << std::string(reply.begin(), reply.end());
+                return std::nullopt;
+            }
+            return reply;
+        }
+
+    } // namespace proof_generator
+} // namespace nil
+
+#endif // PROOF_GENERATOR_PROOF_SERVER_HPP
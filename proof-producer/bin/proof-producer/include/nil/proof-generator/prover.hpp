@@ -43,7 +43,10 @@
 #include <nil/crypto3/marshalling/zk/types/plonk/assignment_table.hpp>
 #include <nil/crypto3/marshalling/zk/types/plonk/constraint_system.hpp>
 
+#include <nil/crypto3/bench/memory_usage.hpp>
+
 #include <nil/crypto3/math/algorithms/calculate_domain_set.hpp>
+#include <nil/crypto3/math/algorithms/make_evaluation_domain.hpp>
 
 #include <nil/crypto3/zk/snark/arithmetization/plonk/constraint_system.hpp>
 #include <nil/crypto3/zk/snark/arithmetization/plonk/params.hpp>
@@ -54,9 +57,11 @@
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/proof.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/prover.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/verifier.hpp>
+#include <nil/crypto3/zk/snark/systems/plonk/placeholder/batch_verifier.hpp>
 #include <nil/crypto3/zk/transcript/fiat_shamir.hpp>
 
 #include <nil/blueprint/transpiler/recursive_verifier_generator.hpp>
+#include <nil/blueprint/utils/parallel_satisfiability_check.hpp>
 #include <nil/blueprint/transpiler/lpc_evm_verifier_gen.hpp>
 
 #include <nil/proof-generator/preset/preset.hpp>
@@ -65,13 +70,35 @@
 #include <nil/proof-generator/output_artifacts/assignment_table_writer.hpp>
 #include <nil/proof-generator/output_artifacts/circuit_writer.hpp>
 #include <nil/proof-generator/output_artifacts/output_artifacts.hpp>
+#include <nil/proof-generator/artifact_writer.hpp>
+#include <nil/proof-generator/bulk_artifacts.hpp>
 #include <nil/proof-generator/file_operations.hpp>
+#include <nil/proof-generator/polynomial_aggregation.hpp>
+#include <nil/proof-generator/proof_server.hpp>
+#include <nil/proof-generator/prover_checkpoint.hpp>
 
 #include <nil/blueprint/blueprint/plonk/circuit.hpp>
 
 namespace nil {
     namespace proof_generator {
         namespace detail {
+            template<typename MarshallingType>
+            std::optional<MarshallingType> decode_marshalling_from_buffer(
+                const std::uint8_t* data,
+                std::size_t size,
+                const boost::filesystem::path& source
+            ) {
+                MarshallingType marshalled_data;
+                auto read_iter = data;
+                auto status = marshalled_data.read(read_iter, size);
+                if (status != nil::crypto3::marshalling::status_type::success) {
+                    BOOST_LOG_TRIVIAL(error) << "When reading a Marshalled structure from file "
+                        << source << ", decoding step failed.";
+                    return std::nullopt;
+                }
+                return marshalled_data;
+            }
+
             template<typename MarshallingType>
             std::optional<MarshallingType> decode_marshalling_from_file(
                 const boost::filesystem::path& path,
@@ -82,22 +109,41 @@ namespace nil {
                     return std::nullopt;
                 }
 
-                MarshallingType marshalled_data;
-                auto read_iter = v->begin();
-                auto status = marshalled_data.read(read_iter, v->size());
-                if (status != nil::crypto3::marshalling::status_type::success) {
-                    BOOST_LOG_TRIVIAL(error) << "When reading a Marshalled structure from file "
-                        << path << ", decoding step failed.";
+                return decode_marshalling_from_buffer<MarshallingType>(v->data(), v->size(), path);
+            }
+
+            // Decodes a binary file through a memory mapping. Pipes and other non-regular files are read as a
+            // stream, so a producer may write into a named pipe and the consumer starts as soon as data arrives.
+            template<typename MarshallingType>
+            std::optional<MarshallingType> decode_marshalling_from_mapped_file(
+                const boost::filesystem::path& path
+            ) {
+                if (!boost::filesystem::is_regular_file(path)) {
+                    auto stream = open_file<std::ifstream>(path.string(), std::ios_base::in | std::ios_base::binary);
+                    if (!stream) {
+                        return std::nullopt;
+                    }
+                    const auto v = read_stream_to_vector(*stream);
+                    if (!v) {
+                        BOOST_LOG_TRIVIAL(error) << "Error occurred during reading file " << path;
+                        return std::nullopt;
+                    }
+                    return decode_marshalling_from_buffer<MarshallingType>(v->data(), v->size(), path);
+                }
+
+                const auto mapped = map_file(path.string());
+                if (!mapped) {
                     return std::nullopt;
                 }
-                return marshalled_data;
+                return decode_marshalling_from_buffer<MarshallingType>(mapped->data(), mapped->size(), path);
             }
 
             template<typename MarshallingType>
             bool encode_marshalling_to_file(
                 const boost::filesystem::path& path,
                 const MarshallingType& data_for_marshalling,
-                bool hex = false
+                bool hex = false,
+                const write_options& options = {}
             ) {
                 std::vector<std::uint8_t> v;
                 v.resize(data_for_marshalling.length(), 0x00);
@@ -108,7 +154,8 @@ namespace nil {
                     return false;
                 }
 
-                return hex ? write_vector_to_hex_file(v, path.c_str()) : write_vector_to_file(v, path.c_str());
+                return hex ? write_vector_to_hex_file(v, path.c_str(), options)
+                           : write_vector_to_file(v, path.c_str(), options);
             }
 
             enum class ProverStage {
@@ -124,7 +171,36 @@ namespace nil {
                 COMPUTE_COMBINED_Q = 9,
                 GENERATE_AGGREGATED_FRI_PROOF = 10,
                 GENERATE_CONSISTENCY_CHECKS_PROOF = 11,
-                MERGE_PROOFS = 12
+                MERGE_PROOFS = 12,
+                VERIFY_BATCH = 13,
+                CHECK = 14,
+                SERVE = 15,
+                REQUEST_PROOF = 16
+            };
+
+            enum class ProofFormat {
+                HEX = 0,
+                BINARY = 1
+            };
+
+            ProofFormat proof_format_from_string(const std::string& format) {
+                static std::unordered_map<std::string, ProofFormat> format_map = {
+                    {"hex", ProofFormat::HEX},
+                    {"binary", ProofFormat::BINARY}
+                };
+                auto it = format_map.find(format);
+                if (it == format_map.end()) {
+                    throw std::invalid_argument("Invalid proof format: " + format);
+                }
+                return it->second;
+            }
+
+            // Formats of the proof outputs, each of them may be chosen separately.
+            struct proof_formats {
+                // Proofs written by the "all" and "prove" stages and read by the verifier.
+                ProofFormat proof = ProofFormat::HEX;
+                // Partial proofs written by the "generate-partial-proof" stages and read by "merge-proofs".
+                ProofFormat partial_proof = ProofFormat::HEX;
             };
 
             ProverStage prover_stage_from_string(const std::string& stage) {
@@ -135,6 +211,10 @@ namespace nil {
                     {"preprocess", ProverStage::PREPROCESS},
                     {"prove", ProverStage::PROVE},
                     {"verify", ProverStage::VERIFY},
+                    {"verify-batch", ProverStage::VERIFY_BATCH},
+                    {"check", ProverStage::CHECK},
+                    {"serve", ProverStage::SERVE},
+                    {"request-proof", ProverStage::REQUEST_PROOF},
                     {"generate-aggregated-challenge", ProverStage::GENERATE_AGGREGATED_CHALLENGE},
                     {"generate-partial-proof", ProverStage::GENERATE_PARTIAL_PROOF},
                     {"fast-generate-partial-proof", ProverStage::FAST_GENERATE_PARTIAL_PROOF},
@@ -185,12 +265,53 @@ namespace nil {
                 std::size_t expand_factor,
                 std::size_t max_q_chunks,
                 std::size_t grind,
-                std::string circuit_name
+                std::string circuit_name,
+                detail::proof_formats proof_formats = {},
+                std::size_t output_buffers = 2,
+                write_options output_options = {}
             ) : expand_factor_(expand_factor),
                 max_quotient_chunks_(max_q_chunks),
                 lambda_(lambda),
                 grind_(grind),
-                circuit_name_(circuit_name){
+                circuit_name_(circuit_name),
+                proof_formats_(proof_formats),
+                output_options_(output_options),
+                writer_(output_buffers) {
+            }
+
+            // Makes generate_to_file() save the state of the proof to 'checkpoint_dir' after each stage. With
+            // 'resume' the proof goes on from the latest valid checkpoint there, otherwise old checkpoints are
+            // removed. They are also removed once the proof is written. An empty directory disables checkpoints.
+            void set_checkpoints(const boost::filesystem::path& checkpoint_dir, bool resume) {
+                checkpoint_dir_ = checkpoint_dir;
+                resume_from_checkpoint_ = resume;
+            }
+
+            // Keeps the polynomials and Merkle trees held by the prover within about 'memory_budget_bytes', the
+            // cold ones are moved to a scratch file in 'spill_dir' (the temporary directory if empty). Zero
+            // disables the budget.
+            void set_memory_budget(std::size_t memory_budget_bytes, const boost::filesystem::path& spill_dir) {
+                memory_budget_ = memory_budget_bytes;
+                spill_dir_ = spill_dir.empty() ? boost::filesystem::temp_directory_path() : spill_dir;
+            }
+
+            // Keeps the FFT extensions of the columns shared by the lookup and gates arguments within about
+            // 'budget_bytes', the least recently used ones are recomputed when needed again. Zero leaves them
+            // unlimited, they are still released after each domain size of the gates argument.
+            void set_column_cache_budget(std::size_t budget_bytes) {
+                column_cache_budget_ = budget_bytes;
+            }
+
+            // Writes the assignment table, preprocessed data and commitment state in 'encoding'. They are read in
+            // any encoding.
+            void set_artifact_encoding(ArtifactEncoding encoding) {
+                artifact_encoding_ = encoding;
+            }
+
+            // Artifacts are written in background, this waits for the ones still being written.
+            // Returns false if writing any of them failed.
+            bool wait_for_artifacts() {
+                return writer_.wait();
             }
 
             bool print_evm_verifier(
@@ -249,16 +370,49 @@ namespace nil {
                 BOOST_ASSERT(constraint_system_);
                 BOOST_ASSERT(lpc_scheme_);
 
+                if (!checkpoint_dir_.empty()) {
+                    checkpoint_digest_ = compute_checkpoint_digest();
+                }
+                // The commitment scheme is not assignable, so the checkpoint is constructed in place.
+                const bool resuming = !checkpoint_dir_.empty() && resume_from_checkpoint_;
+                std::optional<Checkpoint> resumed = resuming ? read_latest_checkpoint() : std::nullopt;
+                if (resuming && !resumed) {
+                    BOOST_LOG_TRIVIAL(info) << "No valid checkpoint in " << checkpoint_dir_ << ", starting over";
+                }
+                // Starting over, also when no checkpoint could be resumed from.
+                if (!checkpoint_dir_.empty() && !resumed && !clear_checkpoints()) {
+                    return false;
+                }
+
                 BOOST_LOG_TRIVIAL(info) << "Generating proof...";
-                nil::crypto3::zk::snark::placeholder_prover<BlueprintField, PlaceholderParams> prover(
+                PlaceholderProver prover(
                     *public_preprocessed_data_,
                     *private_preprocessed_data_,
                     *table_description_,
                     *constraint_system_,
-                    std::move(*lpc_scheme_)
+                    resumed ? std::move(resumed->commitment_scheme) : std::move(*lpc_scheme_)
                 );
+                if (resumed) {
+                    BOOST_LOG_TRIVIAL(info) << "Resuming proof after the " << checkpoint_stage_name(resumed->stage)
+                                            << " checkpoint";
+                    prover.resume(resumed->stage, std::move(resumed->transcript), std::move(resumed->proof),
+                                  std::move(resumed->F_dfs));
+                    resumed.reset();
+                }
+                if (!checkpoint_dir_.empty()) {
+                    prover.set_checkpoint_handler(
+                        [this](const typename PlaceholderProver::checkpoint_type& checkpoint) {
+                            save_checkpoint(checkpoint);
+                        });
+                }
+                std::shared_ptr<SpillStorage> spill_storage;
+                if (!apply_memory_budget(prover, spill_storage)) {
+                    return false;
+                }
+                nil::crypto3::bench::reset_peak_rss();
                 auto proof = prover.process();
                 BOOST_LOG_TRIVIAL(info) << "Proof generated";
+                log_prover_stats(spill_storage);
 
                 create_lpc_scheme(); // reset to default scheme to do the verification
                 bool verify_ok{};
@@ -276,18 +430,12 @@ namespace nil {
                 }
 
                 BOOST_LOG_TRIVIAL(info) << "Writing proof to " << proof_file_;
-                auto filled_placeholder_proof =
-                    nil::crypto3::marshalling::types::fill_placeholder_proof<Endianness, Proof>(proof, lpc_scheme_->get_fri_params());
-                bool res = detail::encode_marshalling_to_file(
+                bool res = write_artifact(
                     proof_file_,
-                    filled_placeholder_proof,
-                    true
+                    nil::crypto3::marshalling::types::fill_placeholder_proof<Endianness, Proof>(proof, lpc_scheme_->get_fri_params()),
+                    "Proof written.",
+                    hex_proofs()
                 );
-                if (res) {
-                    BOOST_LOG_TRIVIAL(info) << "Proof written.";
-                } else {
-                    BOOST_LOG_TRIVIAL(error) << "Failed to write proof to file.";
-                }
 
                 BOOST_LOG_TRIVIAL(info) << "Writing json proof to " << json_file_;
                 auto output_file = open_file<std::ofstream>(json_file_.string(), std::ios_base::out);
@@ -303,9 +451,109 @@ namespace nil {
                                       *table_description_
                 ).generate_input(*public_inputs_, proof, constraint_system_->public_input_sizes());
                 output_file->close();
+
+                // Once the proof is on disk the checkpoints are of no use, a later run must not resume from them.
+                if (res && !checkpoint_dir_.empty()) {
+                    res = writer_.wait() && remove_checkpoints();
+                }
                 return res;
             }
 
+            // Keeps the circuit, the preprocessed public data and the commitment scheme in memory and proves the
+            // assignment tables sent to 'socket_path' until SIGINT or SIGTERM. As in the "prove" stage, public
+            // inputs, constants and selectors come from the preprocessed data, only the private part of a received
+            // table is used.
+            bool serve(
+                    const boost::filesystem::path& socket_path,
+                    std::size_t concurrency,
+                    std::size_t memory_budget_bytes,
+                    std::size_t max_request_bytes) {
+                BOOST_ASSERT(public_preprocessed_data_);
+                BOOST_ASSERT(constraint_system_);
+                BOOST_ASSERT(lpc_scheme_);
+
+                // All requests use FFT domains of the same sizes, they are built once.
+                nil::crypto3::math::resident_evaluation_domains<BlueprintField> domains;
+                // The commitment scheme of each request shares the fixed batch instead of copying it.
+                lpc_scheme_->share_fixed_batches();
+                try {
+                    proof_server server(
+                        socket_path.string(), concurrency, memory_budget_bytes,
+                        [this](const std::vector<std::uint8_t>& table) { return prove_table(table); },
+                        max_request_bytes);
+                    return server.serve();
+                } catch (const boost::system::system_error& e) {
+                    BOOST_LOG_TRIVIAL(error) << "Can't serve on " << socket_path << ": " << e.what();
+                    return false;
+                }
+            }
+
+            // Proves an assignment table, marshalled or in a bulk container, and returns the binary marshalled
+            // proof. Only reads the loaded data, so requests may be proven concurrently.
+            std::optional<std::vector<std::uint8_t>> prove_table(const std::vector<std::uint8_t>& table_data) const {
+                auto decoded_table = decode_assignment_table(table_data.data(), table_data.size(), "request");
+                if (!decoded_table) {
+                    return std::nullopt;
+                }
+                auto& [table_description, assignment_table] = *decoded_table;
+
+                const auto& desc = public_preprocessed_data_->common_data.desc;
+                if (table_description.witness_columns != desc.witness_columns ||
+                    table_description.public_input_columns != desc.public_input_columns ||
+                    table_description.constant_columns != desc.constant_columns ||
+                    table_description.selector_columns != desc.selector_columns ||
+                    table_description.rows_amount != desc.rows_amount ||
+                    table_description.usable_rows_amount != desc.usable_rows_amount) {
+                    BOOST_LOG_TRIVIAL(error) << "Assignment table does not match the preprocessed circuit";
+                    return std::nullopt;
+                }
+
+                auto private_preprocessed_data =
+                    nil::crypto3::zk::snark::placeholder_private_preprocessor<BlueprintField, PlaceholderParams>::
+                        process(*constraint_system_, assignment_table.move_private_table(), table_description);
+
+                nil::crypto3::zk::snark::placeholder_prover<BlueprintField, PlaceholderParams> prover(
+                    *public_preprocessed_data_,
+                    private_preprocessed_data,
+                    table_description,
+                    *constraint_system_,
+                    LpcScheme(*lpc_scheme_) // cheap, the fixed batch is shared
+                );
+                if (column_cache_budget_ != 0) {
+                    prover.set_column_cache_memory_budget(column_cache_budget_);
+                }
+                auto marshalled_proof = nil::crypto3::marshalling::types::fill_placeholder_proof<Endianness, Proof>(
+                    prover.process(), lpc_scheme_->get_fri_params());
+
+                std::vector<std::uint8_t> result(marshalled_proof.length(), 0x00);
+                auto write_iter = result.begin();
+                if (marshalled_proof.write(write_iter, result.size()) != nil::crypto3::marshalling::status_type::success) {
+                    BOOST_LOG_TRIVIAL(error) << "Marshalled structure encoding failed";
+                    return std::nullopt;
+                }
+                return result;
+            }
+
+            // Sends the assignment table to a prover started with the "serve" stage and writes the proof it
+            // returns.
+            bool request_proof_to_file(
+                    const boost::filesystem::path& socket_path,
+                    const boost::filesystem::path& assignment_table_file,
+                    const boost::filesystem::path& proof_file_) {
+                const auto table = read_file_to_vector(assignment_table_file.string());
+                if (!table) {
+                    return false;
+                }
+                BOOST_LOG_TRIVIAL(info) << "Requesting proof from " << socket_path;
+                const auto proof = request_proof(socket_path.string(), *table);
+                if (!proof) {
+                    return false;
+                }
+                BOOST_LOG_TRIVIAL(info) << "Writing proof to " << proof_file_;
+                return hex_proofs() ? write_vector_to_hex_file(*proof, proof_file_.string(), output_options_)
+                                    : write_vector_to_file(*proof, proof_file_.string(), output_options_);
+            }
+
             // The caller must call the preprocessor or load the preprocessed data before calling this function.
             bool generate_partial_proof_to_file(
                     boost::filesystem::path proof_file_,
@@ -331,26 +579,26 @@ namespace nil {
                         *constraint_system_,
                         std::move(*lpc_scheme_),
                         true);
+                std::shared_ptr<SpillStorage> spill_storage;
+                if (!apply_memory_budget(prover, spill_storage)) {
+                    return false;
+                }
+                nil::crypto3::bench::reset_peak_rss();
                 Proof proof = prover.process();
                 auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - start);
                 std::cout << "POOF GENERATE: " << duration.count() << "\n";
                 BOOST_LOG_TRIVIAL(info) << "Proof generated";
+                log_prover_stats(spill_storage);
 
                 lpc_scheme_.emplace(prover.move_commitment_scheme()); // get back the commitment scheme used in prover
 
                 BOOST_LOG_TRIVIAL(info) << "Writing proof to " << proof_file_;
-                auto filled_placeholder_proof =
-                    nil::crypto3::marshalling::types::fill_placeholder_proof<Endianness, Proof>(proof, lpc_scheme_->get_fri_params());
-                bool res = detail::encode_marshalling_to_file(
+                bool res = write_artifact(
                     proof_file_,
-                    filled_placeholder_proof,
-                    true
+                    nil::crypto3::marshalling::types::fill_placeholder_proof<Endianness, Proof>(proof, lpc_scheme_->get_fri_params()),
+                    "Proof written.",
+                    hex_partial_proofs()
                 );
-                if (res) {
-                    BOOST_LOG_TRIVIAL(info) << "Proof written.";
-                } else {
-                    BOOST_LOG_TRIVIAL(error) << "Failed to write proof to file.";
-                }
 
                 if (!challenge_file_) {
                     BOOST_LOG_TRIVIAL(error) << "Challenge output file is not set.";
@@ -365,15 +613,8 @@ namespace nil {
                     nil::crypto3::marshalling::types::field_element<
                     TTypeBase, typename BlueprintField::value_type>;
 
-                challenge_marshalling_type marshalled_challenge(proof.eval_proof.challenge);
-
-                res = detail::encode_marshalling_to_file<challenge_marshalling_type>(
-                            *challenge_file_, marshalled_challenge);
-                if (res) {
-                    BOOST_LOG_TRIVIAL(info) << "Challenge written.";
-                } else {
-                    BOOST_LOG_TRIVIAL(error) << "Failed to write challenge to file.";
-                }
+                res = write_artifact(
+                    *challenge_file_, challenge_marshalling_type(proof.eval_proof.challenge), "Challenge written.");
 
                 lpc_scheme_.emplace(prover.move_commitment_scheme());
 
@@ -403,7 +644,7 @@ namespace nil {
                     placeholder_proof<nil::crypto3::marshalling::field_type<Endianness>, Proof>;
 
                 BOOST_LOG_TRIVIAL(info) << "Reading proof from file";
-                auto marshalled_proof = detail::decode_marshalling_from_file<ProofMarshalling>(proof_file_, true);
+                auto marshalled_proof = detail::decode_marshalling_from_file<ProofMarshalling>(proof_file_, hex_proofs());
                 if (!marshalled_proof) {
                     return false;
                 }
@@ -415,20 +656,86 @@ namespace nil {
                 return res;
             }
 
+            // Verifies many proofs of the loaded circuit. Common data and the commitment scheme parameters are
+            // shared by all of them, a failed proof does not stop verification of the rest.
+            bool verify_batch_from_files(const std::vector<boost::filesystem::path>& proof_files) {
+                create_lpc_scheme();
+
+                using ProofMarshalling = nil::crypto3::marshalling::types::
+                    placeholder_proof<nil::crypto3::marshalling::field_type<Endianness>, Proof>;
+                using BatchVerifier = nil::crypto3::zk::snark::placeholder_batch_verifier<BlueprintField, PlaceholderParams>;
+
+                BOOST_LOG_TRIVIAL(info) << "Reading " << proof_files.size() << " proofs";
+                std::vector<Proof> proofs;
+                proofs.reserve(proof_files.size());
+                for (const auto& proof_file : proof_files) {
+                    auto marshalled_proof = detail::decode_marshalling_from_file<ProofMarshalling>(proof_file, hex_proofs());
+                    if (!marshalled_proof) {
+                        return false;
+                    }
+                    proofs.emplace_back(nil::crypto3::marshalling::types::make_placeholder_proof<Endianness, Proof>(
+                        *marshalled_proof));
+                }
+
+                BOOST_LOG_TRIVIAL(info) << "Verifying " << proofs.size() << " proofs...";
+                auto start = std::chrono::high_resolution_clock::now();
+                std::vector<bool> results = BatchVerifier::process(
+                    public_preprocessed_data_.has_value() ? public_preprocessed_data_->common_data : *common_data_,
+                    proofs,
+                    *table_description_,
+                    *constraint_system_,
+                    *lpc_scheme_
+                );
+                auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+                    std::chrono::high_resolution_clock::now() - start);
+
+                std::size_t verified = 0;
+                for (std::size_t i = 0; i < results.size(); ++i) {
+                    if (results[i]) {
+                        ++verified;
+                        BOOST_LOG_TRIVIAL(info) << "Proof " << proof_files[i] << " is verified";
+                    } else {
+                        BOOST_LOG_TRIVIAL(error) << "Proof " << proof_files[i] << " verification failed";
+                    }
+                }
+
+                const double seconds = elapsed.count() / 1e6;
+                BOOST_LOG_TRIVIAL(info) << verified << " of " << results.size() << " proofs verified in "
+                    << elapsed.count() / 1000 << " ms, " << (seconds > 0 ? results.size() / seconds : 0)
+                    << " proofs per second";
+                return verified == results.size();
+            }
+
+            // Checks that the loaded assignment table satisfies the loaded circuit, without generating a proof.
+            bool check_satisfiability() {
+                if (!constraint_system_ || !assignment_table_) {
+                    BOOST_LOG_TRIVIAL(error) << "Circuit and assignment table must be loaded for the satisfiability check";
+                    return false;
+                }
+
+                BOOST_LOG_TRIVIAL(info) << "Checking satisfiability of " << assignment_table_->rows_amount() << " rows";
+                auto start = std::chrono::high_resolution_clock::now();
+                const bool satisfied = nil::blueprint::is_satisfied_parallel(*constraint_system_, *assignment_table_);
+                auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+                    std::chrono::high_resolution_clock::now() - start);
+
+                if (satisfied) {
+                    BOOST_LOG_TRIVIAL(info) << "Assignment table satisfies the circuit, checked in " << elapsed.count() << " ms";
+                } else {
+                    BOOST_LOG_TRIVIAL(error) << "Assignment table does not satisfy the circuit";
+                }
+                return satisfied;
+            }
+
             bool save_preprocessed_common_data_to_file(boost::filesystem::path preprocessed_common_data_file) {
                 BOOST_LOG_TRIVIAL(info) << "Writing preprocessed common data to " << preprocessed_common_data_file;
-                auto marshalled_common_data =
+                return write_artifact(
+                    preprocessed_common_data_file,
                     nil::crypto3::marshalling::types::fill_placeholder_common_data<Endianness, CommonData>(
                         public_preprocessed_data_->common_data
-                    );
-                bool res = detail::encode_marshalling_to_file(
-                    preprocessed_common_data_file,
-                    marshalled_common_data
+                    ),
+                    "Preprocessed common data written."
                 );
-                if (res) {
-                    BOOST_LOG_TRIVIAL(info) << "Preprocessed common data written.";
-                }
-                return res;
             }
 
             bool read_preprocessed_common_data_from_file(boost::filesystem::path preprocessed_common_data_file) {
@@ -456,18 +763,21 @@ namespace nil {
                 BOOST_LOG_TRIVIAL(info) << "Writing all preprocessed public data to " <<
                     preprocessed_data_file;
 
-                auto marshalled_preprocessed_public_data =
-                    fill_placeholder_preprocessed_public_data<Endianness, PublicPreprocessedData>(
-                        *public_preprocessed_data_
+                if (artifact_encoding_ != ArtifactEncoding::MARSHALLING) {
+                    return write_bulk_artifact(
+                        preprocessed_data_file,
+                        encode_bulk_preprocessed_public_data<Endianness, PublicPreprocessedData>(
+                            artifact_encoding_, *public_preprocessed_data_),
+                        "Preprocessed public data written."
                     );
-                bool res = detail::encode_marshalling_to_file(
+                }
+                return write_artifact(
                     preprocessed_data_file,
-                    marshalled_preprocessed_public_data
+                    fill_placeholder_preprocessed_public_data<Endianness, PublicPreprocessedData>(
+                        *public_preprocessed_data_
+                    ),
+                    "Preprocessed public data written."
                 );
-                if (res) {
-                    BOOST_LOG_TRIVIAL(info) << "Preprocessed public data written.";
-                }
-                return res;
             }
 
             bool read_public_preprocessed_data_from_file(boost::filesystem::path preprocessed_data_file) {
@@ -478,8 +788,23 @@ namespace nil {
                 using PublicPreprocessedDataMarshalling =
                     placeholder_preprocessed_public_data<TTypeBase, PublicPreprocessedData>;
 
-                auto marshalled_value = detail::decode_marshalling_from_file<PublicPreprocessedDataMarshalling>(
-                    preprocessed_data_file);
+                const auto data = read_file_to_vector(preprocessed_data_file.string());
+                if (!data) {
+                    return false;
+                }
+                if (is_bulk_artifact(data->data(), data->size())) {
+                    auto preprocessed_data = decode_bulk_preprocessed_public_data<Endianness, PublicPreprocessedData>(
+                        data->data(), data->size());
+                    if (!preprocessed_data) {
+                        BOOST_LOG_TRIVIAL(error) << "Error decoding preprocessed data from " << preprocessed_data_file;
+                        return false;
+                    }
+                    public_preprocessed_data_.emplace(std::move(*preprocessed_data));
+                    return true;
+                }
+
+                auto marshalled_value = detail::decode_marshalling_from_buffer<PublicPreprocessedDataMarshalling>(
+                    data->data(), data->size(), preprocessed_data_file);
                 if (!marshalled_value) {
                     return false;
                 }
@@ -495,16 +820,18 @@ namespace nil {
                 BOOST_LOG_TRIVIAL(info) << "Writing commitment_state to " <<
                     commitment_scheme_state_file;
 
-                auto marshalled_lpc_state = fill_commitment_scheme<Endianness, LpcScheme>(
-                    *lpc_scheme_);
-                bool res = detail::encode_marshalling_to_file(
+                if (artifact_encoding_ != ArtifactEncoding::MARSHALLING) {
+                    return write_bulk_artifact(
+                        commitment_scheme_state_file,
+                        encode_bulk_commitment_scheme<Endianness, LpcScheme>(artifact_encoding_, *lpc_scheme_),
+                        "Commitment scheme written."
+                    );
+                }
+                return write_artifact(
                     commitment_scheme_state_file,
-                    marshalled_lpc_state
+                    fill_commitment_scheme<Endianness, LpcScheme>(*lpc_scheme_),
+                    "Commitment scheme written."
                 );
-                if (res) {
-                    BOOST_LOG_TRIVIAL(info) << "Commitment scheme written.";
-                }
-                return res;
             }
 
             bool read_commitment_scheme_from_file(boost::filesystem::path commitment_scheme_state_file) {
@@ -514,8 +841,23 @@ namespace nil {
 
                 using CommitmentStateMarshalling = typename commitment_scheme_state<TTypeBase, LpcScheme>::type;
 
-                auto marshalled_value = detail::decode_marshalling_from_file<CommitmentStateMarshalling>(
-                    commitment_scheme_state_file);
+                const auto data = read_file_to_vector(commitment_scheme_state_file.string());
+                if (!data) {
+                    return false;
+                }
+                if (is_bulk_artifact(data->data(), data->size())) {
+                    auto commitment_scheme = decode_bulk_commitment_scheme<Endianness, LpcScheme>(
+                        data->data(), data->size());
+                    if (!commitment_scheme) {
+                        BOOST_LOG_TRIVIAL(error) << "Error decoding commitment scheme";
+                        return false;
+                    }
+                    lpc_scheme_.emplace(std::move(*commitment_scheme));
+                    return true;
+                }
+
+                auto marshalled_value = detail::decode_marshalling_from_buffer<CommitmentStateMarshalling>(
+                    data->data(), data->size(), commitment_scheme_state_file);
 
                 if (!marshalled_value) {
                     return false;
@@ -599,16 +941,16 @@ namespace nil {
             bool read_assignment_table(const boost::filesystem::path& assignment_table_file_path) {
                 BOOST_LOG_TRIVIAL(info) << "Read assignment table from " << assignment_table_file_path;
 
-                auto marshalled_table =
-                    detail::decode_marshalling_from_file<TableMarshalling>(assignment_table_file_path);
-                if (!marshalled_table) {
+                const auto data = read_file_to_vector(assignment_table_file_path.string());
+                if (!data) {
+                    return false;
+                }
+                auto decoded_table = decode_assignment_table(data->data(), data->size(), assignment_table_file_path);
+                if (!decoded_table) {
                     return false;
                 }
 
-                auto [table_description, assignment_table] =
-                    nil::crypto3::marshalling::types::make_assignment_table<Endianness, AssignmentTable>(
-                        *marshalled_table
-                    );
+                auto& [table_description, assignment_table] = *decoded_table;
                 table_description_.emplace(table_description);
                 assignment_table_.emplace(std::move(assignment_table));
                 public_inputs_.emplace(assignment_table_->public_inputs());
@@ -640,6 +982,18 @@ namespace nil {
                     return false;
                 }
 
+                if (artifact_encoding_ != ArtifactEncoding::MARSHALLING) {
+                    const auto usable_rows_amount = table_description_->usable_rows_amount;
+                    const auto data = encode_bulk_assignment_table<Endianness, AssignmentTable>(
+                        artifact_encoding_, assignment_table_.value(), usable_rows_amount,
+                        writer::padded_rows_amount(usable_rows_amount));
+                    if (!data) {
+                        BOOST_LOG_TRIVIAL(error) << "Assignment table encoding failed";
+                        return false;
+                    }
+                    return write_vector_to_file(*data, output_filename.string(), output_options_);
+                }
+
                 std::ofstream out(output_filename.string(), std::ios::binary | std::ios::out);
                 if (!out.is_open()) {
                     BOOST_LOG_TRIVIAL(error) << "Failed to open file " << output_filename;
@@ -702,18 +1056,13 @@ namespace nil {
             bool save_assignment_description(const boost::filesystem::path& assignment_description_file) {
                 BOOST_LOG_TRIVIAL(info) << "Writing assignment description to " << assignment_description_file;
 
-                auto marshalled_assignment_description =
+                return write_artifact(
+                    assignment_description_file,
                     nil::crypto3::marshalling::types::fill_assignment_table_description<Endianness, BlueprintField>(
                         *table_description_
-                    );
-                bool res = detail::encode_marshalling_to_file(
-                    assignment_description_file,
-                    marshalled_assignment_description
+                    ),
+                    "Assignment description written."
                 );
-                if (res) {
-                    BOOST_LOG_TRIVIAL(info) << "Assignment description written.";
-                }
-                return res;
             }
 
             bool read_assignment_description(const boost::filesystem::path& assignment_description_file_) {
@@ -881,6 +1230,41 @@ namespace nil {
                 return nil::crypto3::marshalling::types::make_polynomial<Endianness, PolynomialType>(marshalled_poly.value());
             }
 
+            // Same as read_poly_from_file, but maps the file instead of reading it and also accepts named pipes.
+            template <typename PolynomialType>
+            std::optional<PolynomialType> load_poly_from_file(const boost::filesystem::path &input_file) {
+                using polynomial_marshalling_type = typename nil::crypto3::marshalling::types::polynomial<
+                    TTypeBase, PolynomialType>::type;
+
+                auto marshalled_poly = detail::decode_marshalling_from_mapped_file<polynomial_marshalling_type>(
+                    input_file);
+                if (!marshalled_poly) {
+                    BOOST_LOG_TRIVIAL(error) << "Problem with de-marshalling a polynomial read from a file" << input_file;
+                    return std::nullopt;
+                }
+
+                return nil::crypto3::marshalling::types::make_polynomial<Endianness, PolynomialType>(marshalled_poly.value());
+            }
+
+            template <typename PolynomialType>
+            std::optional<PolynomialType> receive_poly(local_socket_receiver& receiver, const boost::filesystem::path& socket_path) {
+                using polynomial_marshalling_type = typename nil::crypto3::marshalling::types::polynomial<
+                    TTypeBase, PolynomialType>::type;
+
+                const auto v = receiver.receive();
+                if (!v) {
+                    return std::nullopt;
+                }
+                auto marshalled_poly = detail::decode_marshalling_from_buffer<polynomial_marshalling_type>(
+                    v->data(), v->size(), socket_path);
+                if (!marshalled_poly) {
+                    BOOST_LOG_TRIVIAL(error) << "Problem with de-marshalling a polynomial received from " << socket_path;
+                    return std::nullopt;
+                }
+
+                return nil::crypto3::marshalling::types::make_polynomial<Endianness, PolynomialType>(marshalled_poly.value());
+            }
+
             bool generate_combined_Q_to_file(
                 const boost::filesystem::path &aggregated_challenge_file,
                 std::size_t starting_power,
@@ -932,7 +1316,7 @@ namespace nil {
 
                 for(auto const& partial_proof_file: partial_proof_files) {
                     BOOST_LOG_TRIVIAL(info) << "Reading partial proof from file \"" << partial_proof_file << "\"";
-                    auto marshalled_partial_proof = detail::decode_marshalling_from_file<partial_proof_marshalled_type>(partial_proof_file, true);
+                    auto marshalled_partial_proof = detail::decode_marshalling_from_file<partial_proof_marshalled_type>(partial_proof_file, hex_partial_proofs());
                     if (!marshalled_partial_proof) {
                         BOOST_LOG_TRIVIAL(error) << "Error reading partial_proof from from \"" << partial_proof_file << "\"";
                         return false;
@@ -1043,9 +1427,14 @@ namespace nil {
                     typename BlueprintField::value_type, Endianness>(marshalled_challenges.value());
             }
 
+            // Combined-Q polynomials are taken from 'input_combined_Q_polynomial_files' and, if 'combined_Q_socket'
+            // is set, from 'combined_Q_socket_inputs' senders connecting to that local socket. All the inputs are
+            // loaded and summed concurrently.
             bool generate_aggregated_FRI_proof_to_file(
                 const boost::filesystem::path &aggregated_challenge_file,
                 const std::vector<boost::filesystem::path>& input_combined_Q_polynomial_files,
+                const boost::filesystem::path& combined_Q_socket,
+                std::size_t combined_Q_socket_inputs,
                 const boost::filesystem::path& aggregated_fri_proof_output_file,
                 const boost::filesystem::path& proof_of_work_output_file,
                 const boost::filesystem::path& consistency_checks_challenges_output_file) {
@@ -1063,17 +1452,42 @@ namespace nil {
 
                 transcript(aggregated_challenge.value());
 
-                // Sum up all the polynomials from the files.
-                polynomial_type sum_poly;
-                for (const auto& path : input_combined_Q_polynomial_files) {
-                    std::optional<polynomial_type> next_combined_Q = read_poly_from_file<polynomial_type>(path);
-                    if (!next_combined_Q) {
+                std::optional<local_socket_receiver> receiver;
+                if (!combined_Q_socket.empty() && combined_Q_socket_inputs != 0) {
+                    BOOST_LOG_TRIVIAL(info) << "Waiting for " << combined_Q_socket_inputs
+                                            << " combined-Q polynomials on " << combined_Q_socket;
+                    try {
+                        receiver.emplace(combined_Q_socket.string());
+                    } catch (const boost::system::system_error& e) {
+                        BOOST_LOG_TRIVIAL(error) << "Can't listen on " << combined_Q_socket << ": " << e.what();
                         return false;
                     }
-                    sum_poly += next_combined_Q.value();
                 }
+                const std::size_t files_count = input_combined_Q_polynomial_files.size();
+                const std::size_t sources_count = files_count + (receiver ? combined_Q_socket_inputs : 0);
+
+                // Sum up all the polynomials from the files and the socket.
+                auto start = std::chrono::high_resolution_clock::now();
+                std::optional<polynomial_type> sum_poly = parallel_sum_polynomials<polynomial_type>(
+                    sources_count,
+                    [&](std::size_t index) -> std::optional<polynomial_type> {
+                        std::optional<polynomial_type> poly = index < files_count ?
+                            load_poly_from_file<polynomial_type>(input_combined_Q_polynomial_files[index]) :
+                            receive_poly<polynomial_type>(*receiver, combined_Q_socket);
+                        if (!poly && receiver) {
+                            receiver->stop();
+                        }
+                        return poly;
+                    });
+                if (!sum_poly) {
+                    return false;
+                }
+                auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - start);
+                BOOST_LOG_TRIVIAL(info) << "Combined-Q polynomials from " << sources_count << " inputs summed in "
+                                        << duration.count() << " ms";
+
                 create_lpc_scheme();
-                auto [fri_proof, challenges] = lpc_scheme_->proof_eval_FRI_proof(sum_poly, transcript);
+                auto [fri_proof, challenges] = lpc_scheme_->proof_eval_FRI_proof(*sum_poly, transcript);
 
                 // And finally run proof of work.
                 typename FriType::grinding_type::output_type proof_of_work = nil::crypto3::zk::algorithms::run_grinding<FriType>(
@@ -1159,11 +1573,236 @@ namespace nil {
             }
 
         private:
+            using PlaceholderProver = nil::crypto3::zk::snark::placeholder_prover<BlueprintField, PlaceholderParams>;
+            using Transcript = nil::crypto3::zk::transcript::fiat_shamir_heuristic_sequential<
+                typename PlaceholderParams::transcript_hash_type>;
+            using SpillStorage = typename PlaceholderProver::spill_storage_type;
+            using CheckpointMarshalling = checkpoint_marshalling<
+                Endianness, Proof, LpcScheme, Transcript, typename PlaceholderProver::F_parts_type>;
+            using Checkpoint = typename CheckpointMarshalling::checkpoint;
+
+            // Checkpoints are written by the I/O thread under a temporary name and renamed once complete, so a
+            // checkpoint file is either whole or absent.
+            void save_checkpoint(const typename PlaceholderProver::checkpoint_type& checkpoint) {
+                auto data = std::make_shared<typename CheckpointMarshalling::type>(CheckpointMarshalling::fill(
+                    checkpoint, public_preprocessed_data_->common_data.vk.fixed_values_commitment,
+                    checkpoint_digest_));
+                const auto path = checkpoint_file(checkpoint_dir_, checkpoint.stage);
+                writer_.submit(path.string(), [path, data, options = output_options_] {
+                    boost::filesystem::path temporary_path = path;
+                    temporary_path += ".tmp";
+                    if (!detail::encode_marshalling_to_file(temporary_path, *data, false, options)) {
+                        return false;
+                    }
+                    boost::system::error_code ec;
+                    boost::filesystem::rename(temporary_path, path, ec);
+                    if (ec) {
+                        BOOST_LOG_TRIVIAL(error) << "Can't rename " << temporary_path << " to " << path << ": "
+                                                 << ec.message();
+                        return false;
+                    }
+                    BOOST_LOG_TRIVIAL(info) << "Checkpoint written to " << path;
+                    return true;
+                });
+            }
+
+            std::optional<Checkpoint> read_checkpoint(placeholder_prover_stage stage) {
+                auto marshalled = detail::decode_marshalling_from_file<typename CheckpointMarshalling::type>(
+                    checkpoint_file(checkpoint_dir_, stage));
+                if (!marshalled) {
+                    return std::nullopt;
+                }
+                auto checkpoint = CheckpointMarshalling::make(*marshalled);
+                if (!checkpoint) {
+                    return std::nullopt;
+                }
+
+                if (checkpoint->stage != stage) {
+                    BOOST_LOG_TRIVIAL(error) << "Checkpoint of another stage";
+                    return std::nullopt;
+                }
+                if (checkpoint->fixed_values_commitment !=
+                        public_preprocessed_data_->common_data.vk.fixed_values_commitment) {
+                    BOOST_LOG_TRIVIAL(error) << "Checkpoint of another circuit";
+                    return std::nullopt;
+                }
+                if (checkpoint->digest != checkpoint_digest_) {
+                    BOOST_LOG_TRIVIAL(error) << "Checkpoint of another assignment table or other prover options";
+                    return std::nullopt;
+                }
+                return checkpoint;
+            }
+
+            // Digest of the witnesses, the public inputs and the options the proof depends on.
+            std::vector<std::uint8_t> compute_checkpoint_digest() const {
+                checkpoint_digest<Endianness, BlueprintField> digest;
+                for (std::size_t option : {expand_factor_, max_quotient_chunks_, lambda_, grind_}) {
+                    digest.add_option(option);
+                }
+                const auto& witnesses = private_preprocessed_data_->private_polynomial_table->witnesses();
+                digest.add_option(witnesses.size());
+                for (const auto& column : witnesses) {
+                    digest.add_column(column);
+                }
+                digest.add_option(public_inputs_->size());
+                for (const auto& column : *public_inputs_) {
+                    digest.add_column(column);
+                }
+                return digest.value();
+            }
+
+            // Checkpoints of the later stages may be missing or torn if the run was killed while writing them, the
+            // latest one which reads back is used.
+            std::optional<Checkpoint> read_latest_checkpoint() {
+                for (placeholder_prover_stage stage : checkpoint_stages_latest_first) {
+                    const auto path = checkpoint_file(checkpoint_dir_, stage);
+                    if (!boost::filesystem::exists(path)) {
+                        continue;
+                    }
+                    BOOST_LOG_TRIVIAL(info) << "Reading checkpoint " << path;
+                    auto checkpoint = read_checkpoint(stage);
+                    if (checkpoint) {
+                        return checkpoint;
+                    }
+                    BOOST_LOG_TRIVIAL(warning) << "Skipping invalid checkpoint " << path;
+                }
+                return std::nullopt;
+            }
+
+            bool clear_checkpoints() {
+                boost::system::error_code ec;
+                boost::filesystem::create_directories(checkpoint_dir_, ec);
+                if (ec) {
+                    BOOST_LOG_TRIVIAL(error) << "Can't create checkpoint directory " << checkpoint_dir_ << ": "
+                                             << ec.message();
+                    return false;
+                }
+                return remove_checkpoints();
+            }
+
+            bool remove_checkpoints() {
+                boost::system::error_code ec;
+                for (placeholder_prover_stage stage : checkpoint_stages_latest_first) {
+                    const auto path = checkpoint_file(checkpoint_dir_, stage);
+                    for (const auto& file : {path, boost::filesystem::path(path.string() + ".tmp")}) {
+                        boost::filesystem::remove(file, ec);
+                        if (ec) {
+                            BOOST_LOG_TRIVIAL(error) << "Can't remove checkpoint " << file << ": " << ec.message();
+                            return false;
+                        }
+                    }
+                }
+                return true;
+            }
+
+            // Gives 'prover' the column cache budget, the memory budget and a fresh spill file, which
+            // 'spill_storage' keeps for the stats. Without a memory budget nothing is spilled.
+            bool apply_memory_budget(PlaceholderProver& prover, std::shared_ptr<SpillStorage>& spill_storage) {
+                if (column_cache_budget_ != 0) {
+                    prover.set_column_cache_memory_budget(column_cache_budget_);
+                }
+                if (memory_budget_ == 0) {
+                    return true;
+                }
+                try {
+                    spill_storage = std::make_shared<SpillStorage>(spill_dir_.string());
+                } catch (const std::runtime_error& e) {
+                    BOOST_LOG_TRIVIAL(error) << e.what();
+                    return false;
+                }
+                BOOST_LOG_TRIVIAL(info) << "Memory budget " << (memory_budget_ >> 20) << " MB, spilling to "
+                                        << spill_dir_;
+                prover.set_memory_budget(memory_budget_, spill_storage);
+                return true;
+            }
+
+            void log_prover_stats(const std::shared_ptr<SpillStorage>& spill_storage) const {
+                const std::size_t spilled = spill_storage ? spill_storage->bytes_spilled() : 0;
+                BOOST_LOG_TRIVIAL(info) << "Prover stats: peak RSS " << (nil::crypto3::bench::peak_rss_bytes() >> 20) << " MB, "
+                                        << (spilled >> 20) << " MB (" << spilled << " bytes) spilled";
+            }
+
+            // Proofs are written in hex by default for compatibility with existing consumers.
+            bool hex_proofs() const {
+                return proof_formats_.proof == detail::ProofFormat::HEX;
+            }
+
+            bool hex_partial_proofs() const {
+                return proof_formats_.partial_proof == detail::ProofFormat::HEX;
+            }
+
+            // Decodes an assignment table in any encoding.
+            std::optional<std::pair<TableDescription, AssignmentTable>> decode_assignment_table(
+                const std::uint8_t* data,
+                std::size_t size,
+                const boost::filesystem::path& source
+            ) const {
+                if (is_bulk_artifact(data, size)) {
+                    auto decoded_table = decode_bulk_assignment_table<Endianness, AssignmentTable>(data, size);
+                    if (!decoded_table) {
+                        BOOST_LOG_TRIVIAL(error) << "Error decoding assignment table from " << source;
+                    }
+                    return decoded_table;
+                }
+
+                auto marshalled_table = detail::decode_marshalling_from_buffer<TableMarshalling>(data, size, source);
+                if (!marshalled_table) {
+                    return std::nullopt;
+                }
+                return nil::crypto3::marshalling::types::make_assignment_table<Endianness, AssignmentTable>(
+                    *marshalled_table);
+            }
+
+            // The container is encoded by the caller and written on the I/O thread.
+            bool write_bulk_artifact(
+                const boost::filesystem::path& path,
+                std::optional<std::vector<std::uint8_t>>&& encoded,
+                std::string written_message
+            ) {
+                if (!encoded) {
+                    BOOST_LOG_TRIVIAL(error) << "Encoding of " << path << " failed";
+                    return false;
+                }
+                auto data = std::make_shared<std::vector<std::uint8_t>>(std::move(*encoded));
+                return writer_.submit(
+                    path.string(),
+                    [path, data, written_message = std::move(written_message), options = output_options_] {
+                        bool res = write_vector_to_file(*data, path.string(), options);
+                        if (res) {
+                            BOOST_LOG_TRIVIAL(info) << written_message;
+                        }
+                        return res;
+                    });
+            }
+
+            // The marshalled structure owns its data, so it's encoded and written on the I/O thread while the
+            // prover goes on.
+            template<typename MarshallingType>
+            bool write_artifact(
+                const boost::filesystem::path& path,
+                MarshallingType&& marshalled,
+                std::string written_message,
+                bool hex = false
+            ) {
+                auto data = std::make_shared<std::decay_t<MarshallingType>>(std::forward<MarshallingType>(marshalled));
+                return writer_.submit(
+                    path.string(),
+                    [path, data, written_message = std::move(written_message), hex, options = output_options_] {
+                        bool res = detail::encode_marshalling_to_file(path, *data, hex, options);
+                        if (res) {
+                            BOOST_LOG_TRIVIAL(info) << written_message;
+                        }
+                        return res;
+                    });
+            }
+
             const std::size_t expand_factor_;
             const std::size_t max_quotient_chunks_;
             const std::size_t lambda_;
             const std::size_t grind_;
             const std::string circuit_name_;
+            const detail::proof_formats proof_formats_;
+            const write_options output_options_;
 
             std::optional<PublicPreprocessedData> public_preprocessed_data_;
 
@@ -1177,6 +1816,19 @@ namespace nil {
             std::optional<ConstraintSystem> constraint_system_;
             std::optional<AssignmentTable> assignment_table_;
             std::optional<LpcScheme> lpc_scheme_;
+
+            boost::filesystem::path checkpoint_dir_;
+            bool resume_from_checkpoint_ = false;
+            std::vector<std::uint8_t> checkpoint_digest_;
+
+            std::size_t memory_budget_ = 0;
+            std::size_t column_cache_budget_ = 0;
+            boost::filesystem::path spill_dir_;
+
+            ArtifactEncoding artifact_encoding_ = ArtifactEncoding::MARSHALLING;
+
+            // Declared last, so pending artifacts are written before anything else is destroyed.
+            artifact_writer writer_;
         };
 
     } // namespace proof_generator
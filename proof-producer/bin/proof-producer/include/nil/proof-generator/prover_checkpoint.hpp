@@ -0,0 +1,317 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Nil Foundation <info@nil.foundation>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//---------------------------------------------------------------------------//
+
+#ifndef PROOF_GENERATOR_PROVER_CHECKPOINT_HPP
+#define PROOF_GENERATOR_PROVER_CHECKPOINT_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+#include <boost/log/trivial.hpp>
+
+#include <nil/marshalling/field_type.hpp>
+#include <nil/marshalling/types/bundle.hpp>
+#include <nil/marshalling/types/integral.hpp>
+#include <nil/crypto3/marshalling/algebra/types/field_element.hpp>
+#include <nil/crypto3/marshalling/math/types/polynomial.hpp>
+#include <nil/crypto3/marshalling/zk/types/commitments/lpc.hpp>
+#include <nil/crypto3/marshalling/zk/types/placeholder/proof.hpp>
+
+#include <nil/crypto3/hash/algorithm/hash.hpp>
+#include <nil/crypto3/hash/sha2.hpp>
+
+#include <nil/crypto3/zk/snark/systems/plonk/placeholder/prover.hpp>
+
+namespace nil {
+    namespace proof_generator {
+
+        using nil::crypto3::zk::snark::placeholder_prover_stage;
+
+        // Stages a proof is checkpointed at, the latest one first.
+        constexpr std::array<placeholder_prover_stage, 4> checkpoint_stages_latest_first = {
+            placeholder_prover_stage::evaluated,
+            placeholder_prover_stage::quotient_committed,
+            placeholder_prover_stage::permutation_committed,
+            placeholder_prover_stage::variable_values_committed,
+        };
+
+        inline std::string checkpoint_stage_name(placeholder_prover_stage stage) {
+            switch (stage) {
+                case placeholder_prover_stage::started:
+                    return "started";
+                case placeholder_prover_stage::variable_values_committed:
+                    return "variable-values";
+                case placeholder_prover_stage::permutation_committed:
+                    return "permutation";
+                case placeholder_prover_stage::quotient_committed:
+                    return "quotient";
+                case placeholder_prover_stage::evaluated:
+                    return "evaluations";
+            }
+            return "unknown";
+        }
+
+        // Checkpoint files are numbered by stage, so they sort in the order they are written.
+        inline boost::filesystem::path checkpoint_file(
+                const boost::filesystem::path& checkpoint_dir, placeholder_prover_stage stage) {
+            return checkpoint_dir / ("checkpoint-" + std::to_string(static_cast<int>(stage)) + "-" +
+                                     checkpoint_stage_name(stage) + ".dat");
+        }
+
+        /**
+         * Digest of the inputs of a proof which the fixed values commitment doesn't cover: the witnesses, the
+         * public inputs and the prover options. A checkpoint is only resumed by a run with the same digest.
+         */
+        template<typename Endianness, typename FieldType>
+        class checkpoint_digest {
+        public:
+            using hash_type = nil::crypto3::hashes::sha2<256>;
+
+            void add_option(std::uint64_t value) {
+                std::array<std::uint8_t, sizeof(value)> bytes;
+                for (std::size_t i = 0; i < bytes.size(); ++i) {
+                    bytes[i] = static_cast<std::uint8_t>(value >> (8 * i));
+                }
+                nil::crypto3::hash<hash_type>(bytes.begin(), bytes.end(), acc_);
+            }
+
+            // The size goes first, so values moved from one column to the next change the digest.
+            template<typename Column>
+            void add_column(const Column& column) {
+                add_option(column.size());
+                std::vector<std::uint8_t> bytes(chunk_size * element_type::length());
+                for (std::size_t begin = 0; begin < column.size(); begin += chunk_size) {
+                    const std::size_t end = std::min(begin + chunk_size, column.size());
+                    auto write_iter = bytes.begin();
+                    for (std::size_t i = begin; i < end; ++i) {
+                        element_type(column[i]).write(write_iter, element_type::length());
+                    }
+                    nil::crypto3::hash<hash_type>(bytes.begin(), write_iter, acc_);
+                }
+            }
+
+            std::vector<std::uint8_t> value() const {
+                const auto digest = nil::crypto3::accumulators::extract::hash<hash_type>(acc_);
+                return std::vector<std::uint8_t>(digest.begin(), digest.end());
+            }
+
+        private:
+            using element_type = nil::crypto3::marshalling::types::field_element<
+                nil::crypto3::marshalling::field_type<Endianness>, typename FieldType::value_type>;
+
+            static constexpr std::size_t chunk_size = 4096;
+
+            nil::crypto3::accumulator_set<hash_type> acc_;
+        };
+
+        namespace detail {
+
+            // Transcripts which chain digests, the state is the last digest.
+            template<typename Endianness, typename Transcript, typename Enable = void>
+            struct transcript_state_marshalling {
+                using TTypeBase = nil::crypto3::marshalling::field_type<Endianness>;
+                using type = nil::crypto3::marshalling::types::standard_array_list<
+                    TTypeBase, nil::crypto3::marshalling::types::integral<TTypeBase, std::uint8_t>>;
+
+                static type fill(const Transcript& transcript) {
+                    type result;
+                    for (std::uint8_t byte : transcript.get_state()) {
+                        result.value().emplace_back(byte);
+                    }
+                    return result;
+                }
+
+                static bool make(const type& filled, Transcript& transcript) {
+                    typename Transcript::transcript_state_type state;
+                    if (filled.value().size() != state.size()) {
+                        return false;
+                    }
+                    for (std::size_t i = 0; i < state.size(); ++i) {
+                        state[i] = filled.value()[i].value();
+                    }
+                    transcript.set_state(state);
+                    return true;
+                }
+            };
+
+            // Sponge transcripts, the state is the sponge words and how many of them are filled.
+            template<typename Endianness, typename Transcript>
+            struct transcript_state_marshalling<
+                    Endianness, Transcript, std::void_t<typename Transcript::transcript_state_type::first_type>> {
+                using TTypeBase = nil::crypto3::marshalling::field_type<Endianness>;
+                using words_type = typename Transcript::transcript_state_type::first_type;
+                using word_type = typename words_type::value_type;
+                using type = nil::crypto3::marshalling::types::bundle<
+                    TTypeBase,
+                    std::tuple<
+                        nil::crypto3::marshalling::types::field_element_vector<word_type, TTypeBase>,
+                        nil::crypto3::marshalling::types::integral<TTypeBase, std::size_t>
+                    >
+                >;
+
+                static type fill(const Transcript& transcript) {
+                    const auto state = transcript.get_state();
+                    return type(std::make_tuple(
+                        nil::crypto3::marshalling::types::fill_field_element_vector<word_type, Endianness>(
+                            std::vector<word_type>(state.first.begin(), state.first.end())),
+                        nil::crypto3::marshalling::types::integral<TTypeBase, std::size_t>(state.second)));
+                }
+
+                static bool make(const type& filled, Transcript& transcript) {
+                    const auto words = nil::crypto3::marshalling::types::make_field_element_vector<
+                        word_type, Endianness>(std::get<0>(filled.value()));
+                    const std::size_t count = std::get<1>(filled.value()).value();
+                    typename Transcript::transcript_state_type state;
+                    if (words.size() != state.first.size() || count == 0 || count > words.size()) {
+                        return false;
+                    }
+                    std::copy(words.begin(), words.end(), state.first.begin());
+                    state.second = count;
+                    transcript.set_state(state);
+                    return true;
+                }
+            };
+
+        } // namespace detail
+
+        /**
+         * A checkpoint file: the stage, what the checkpoint belongs to, i.e. the fixed values commitment and the
+         * checkpoint_digest, and the state of the prover after the stage.
+         */
+        template<typename Endianness, typename Proof, typename LpcScheme, typename Transcript, typename FParts>
+        struct checkpoint_marshalling {
+            using TTypeBase = nil::crypto3::marshalling::field_type<Endianness>;
+            using field_type = typename LpcScheme::field_type;
+            using commitment_type = typename LpcScheme::commitment_type;
+            using polynomial_dfs_type = typename FParts::value_type;
+            using transcript_marshalling = detail::transcript_state_marshalling<Endianness, Transcript>;
+            using digest_marshalling = nil::crypto3::marshalling::types::standard_array_list<
+                TTypeBase, nil::crypto3::marshalling::types::integral<TTypeBase, std::uint8_t>>;
+
+            using type = nil::crypto3::marshalling::types::bundle<
+                TTypeBase,
+                std::tuple<
+                    // stage
+                    nil::crypto3::marshalling::types::integral<TTypeBase, std::uint8_t>,
+                    // fixed values commitment
+                    typename nil::crypto3::marshalling::types::commitment<TTypeBase, LpcScheme>::type,
+                    // checkpoint_digest
+                    digest_marshalling,
+                    typename transcript_marshalling::type,
+                    // commitments of the proof
+                    nil::crypto3::marshalling::types::placeholder_partial_evaluation_proof<TTypeBase, Proof>,
+                    // evaluation challenge
+                    nil::crypto3::marshalling::types::field_element<TTypeBase, typename field_type::value_type>,
+                    // F parts
+                    nil::crypto3::marshalling::types::polynomial_vector<TTypeBase, polynomial_dfs_type>,
+                    typename nil::crypto3::marshalling::types::commitment_scheme_state<TTypeBase, LpcScheme>::type
+                >
+            >;
+
+            struct checkpoint {
+                placeholder_prover_stage stage;
+                commitment_type fixed_values_commitment;
+                std::vector<std::uint8_t> digest;
+                Transcript transcript;
+                Proof proof;
+                FParts F_dfs;
+                LpcScheme commitment_scheme;
+            };
+
+            // 'prover_checkpoint' is the checkpoint_type the placeholder prover hands to its checkpoint handler.
+            template<typename ProverCheckpoint>
+            static type fill(const ProverCheckpoint& prover_checkpoint,
+                             const commitment_type& fixed_values_commitment,
+                             const std::vector<std::uint8_t>& digest) {
+                using namespace nil::crypto3::marshalling::types;
+
+                digest_marshalling filled_digest;
+                for (std::uint8_t byte : digest) {
+                    filled_digest.value().emplace_back(byte);
+                }
+                return type(std::make_tuple(
+                    integral<TTypeBase, std::uint8_t>(static_cast<std::uint8_t>(prover_checkpoint.stage)),
+                    fill_commitment<Endianness, LpcScheme>(fixed_values_commitment),
+                    filled_digest,
+                    transcript_marshalling::fill(prover_checkpoint.transcript),
+                    fill_placeholder_partial_evaluation_proof<Endianness, Proof>(prover_checkpoint.proof),
+                    field_element<TTypeBase, typename field_type::value_type>(
+                        prover_checkpoint.proof.eval_proof.challenge),
+                    fill_polynomial_vector<Endianness, polynomial_dfs_type>(
+                        std::vector<polynomial_dfs_type>(prover_checkpoint.F_dfs.begin(),
+                                                         prover_checkpoint.F_dfs.end())),
+                    fill_commitment_scheme<Endianness, LpcScheme>(prover_checkpoint.commitment_scheme)
+                ));
+            }
+
+            static std::optional<checkpoint> make(type& filled) {
+                using namespace nil::crypto3::marshalling::types;
+
+                auto& [filled_stage, filled_fixed_values_commitment, filled_digest, filled_transcript,
+                       filled_commitments, filled_challenge, filled_F_dfs, filled_commitment_scheme] = filled.value();
+
+                if (filled_stage.value() > static_cast<std::uint8_t>(placeholder_prover_stage::evaluated)) {
+                    BOOST_LOG_TRIVIAL(error) << "Unknown checkpoint stage " << int(filled_stage.value());
+                    return std::nullopt;
+                }
+
+                std::vector<std::uint8_t> digest;
+                for (const auto& byte : filled_digest.value()) {
+                    digest.push_back(byte.value());
+                }
+
+                Transcript transcript;
+                if (!transcript_marshalling::make(filled_transcript, transcript)) {
+                    BOOST_LOG_TRIVIAL(error) << "Error decoding transcript state";
+                    return std::nullopt;
+                }
+
+                Proof proof;
+                static_cast<typename Proof::partial_proof_type&>(proof) =
+                    make_placeholder_partial_evaluation_proof<Endianness, Proof>(filled_commitments);
+                proof.eval_proof.challenge = filled_challenge.value();
+
+                auto F_dfs = make_polynomial_vector<Endianness, polynomial_dfs_type>(filled_F_dfs);
+                FParts F_parts;
+                if (F_dfs.size() != F_parts.size()) {
+                    BOOST_LOG_TRIVIAL(error) << "Error decoding F parts";
+                    return std::nullopt;
+                }
+                std::move(F_dfs.begin(), F_dfs.end(), F_parts.begin());
+
+                auto commitment_scheme = make_commitment_scheme<Endianness, LpcScheme>(filled_commitment_scheme);
+                if (!commitment_scheme) {
+                    BOOST_LOG_TRIVIAL(error) << "Error decoding commitment scheme";
+                    return std::nullopt;
+                }
+
+                return checkpoint{static_cast<placeholder_prover_stage>(filled_stage.value()),
+                                  make_commitment<Endianness, LpcScheme>(filled_fixed_values_commitment),
+                                  std::move(digest), std::move(transcript), std::move(proof), std::move(F_parts),
+                                  std::move(commitment_scheme.value())};
+            }
+        };
+    } // namespace proof_generator
+} // namespace nil
+
+#endif // PROOF_GENERATOR_PROVER_CHECKPOINT_HPP
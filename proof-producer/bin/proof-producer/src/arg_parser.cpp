@@ -22,6 +22,7 @@
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <limits>
 #include <string>
 #include <type_traits>
 
@@ -49,6 +50,13 @@ namespace nil {
             return po::value(&variable)->default_value(variable);
         }
 
+        // Sizes given in megabytes are converted to bytes with '<< 20'.
+        void check_megabytes_option(const std::string& name, std::size_t megabytes) {
+            if (megabytes > (std::numeric_limits<std::size_t>::max() >> 20)) {
+                throw std::logic_error("Option " + name + " is too large: " + std::to_string(megabytes) + " MB");
+            }
+        }
+
         std::optional<ProverOptions> parse_args(int argc, char* argv[]) {
             po::options_description options("Nil; Proof Generator Options");
             // Declare a group of options that will be
@@ -74,8 +82,14 @@ namespace nil {
             // clang-format off
             auto options_appender = config.add_options()
                 ("stage", make_defaulted_option(prover_options.stage),
-                 "Stage of the prover to run, one of (all, preprocess, prove, verify, generate-aggregated-challenge, generate-combined-Q, aggregated-FRI, consistency-checks). Defaults to 'all'.")
+                 "Stage of the prover to run, one of (all, preprocess, prove, serve, request-proof, verify, verify-batch, check, generate-aggregated-challenge, generate-combined-Q, aggregated-FRI, consistency-checks). Defaults to 'all'.")
                 ("proof,p", make_defaulted_option(prover_options.proof_file_path), "Proof file")
+                ("proof-format", make_defaulted_option(prover_options.proof_format),
+                 "Format of proof files, one of (hex, binary). Binary is faster to write and read, hex is kept for compatibility. Defaults to 'hex'.")
+                ("partial-proof-format", make_defaulted_option(prover_options.partial_proof_format),
+                 "Format of partial proof files written by 'generate-partial-proof' and read by 'merge-proofs', one of (hex, binary). Defaults to 'hex'.")
+                ("artifact-encoding", make_defaulted_option(prover_options.artifact_encoding),
+                 "Encoding of the assignment table, preprocessed data and commitment state files written, one of (marshalling, bulk, raw). Bulk and raw convert the field elements in chunks, raw files are only readable on the same kind of machine. Files in any encoding are read. Defaults to 'marshalling'.")
                 ("json,j", make_defaulted_option(prover_options.json_file_path), "JSON proof file")
                 ("common-data", make_defaulted_option(prover_options.preprocessed_common_data_path), "Preprocessed common data file")
                 ("preprocessed-data", make_defaulted_option(prover_options.preprocessed_public_data_path), "Preprocessed public data file")
@@ -114,11 +128,41 @@ namespace nil {
                  "Parts of aggregated proof. Used with 'merge-proofs' stage.")
                 ("initial-proof", po::value<std::vector<boost::filesystem::path>>(&prover_options.initial_proof_files)->multitoken(),
                  "Inital proofs, produced by consistency-check stage. Used with 'merge-proofs' stage.")
+                ("batch-proofs", po::value<std::vector<boost::filesystem::path>>(&prover_options.batch_proof_files)->multitoken(),
+                 "Proofs of the same circuit to verify at once. Used with 'verify-batch' stage.")
                 ("aggregated-FRI-proof", po::value<boost::filesystem::path>(&prover_options.aggregated_FRI_proof_file),
                  "Aggregated FRI proof part of the final proof. Used with 'merge-proofs' stage.")
                 ("input-combined-Q-polynomial-files", po::value<std::vector<boost::filesystem::path>>(&prover_options.input_combined_Q_polynomial_files),
-                 "Files containing polynomials combined-Q, 1 per prover instance.")
-                ("proof-of-work-file", make_defaulted_option(prover_options.proof_of_work_output_file), "File with proof of work.");
+                 "Files containing polynomials combined-Q, 1 per prover instance. Named pipes are accepted as well.")
+                ("combined-Q-socket", po::value<boost::filesystem::path>(&prover_options.combined_Q_socket_path),
+                 "Local socket to receive combined-Q polynomials on, each prover instance sends its polynomial in a separate connection. Used with 'aggregated-FRI' stage.")
+                ("combined-Q-socket-inputs", make_defaulted_option(prover_options.combined_Q_socket_inputs),
+                 "Number of combined-Q polynomials to receive through '--combined-Q-socket'.")
+                ("server-socket", make_defaulted_option(prover_options.server_socket_path),
+                 "Local socket the 'serve' stage listens on and the 'request-proof' stage sends assignment tables to.")
+                ("server-concurrency", make_defaulted_option(prover_options.server_concurrency),
+                 "Number of requests the 'serve' stage proves at once.")
+                ("server-memory-budget", make_defaulted_option(prover_options.server_memory_budget),
+                 "Memory budget of the 'serve' stage in megabytes, requests wait while it would be exceeded. 0 for no limit.")
+                ("server-max-request-size", make_defaulted_option(prover_options.server_max_request_size),
+                 "Largest assignment table the 'serve' stage accepts, in megabytes.")
+                ("checkpoint-dir", po::value(&prover_options.checkpoint_dir),
+                 "Directory to save the state of the proof to after each prover stage. Used with 'all' and 'prove' stages.")
+                ("resume", po::bool_switch(&prover_options.resume),
+                 "Continue the proof from the latest valid checkpoint in '--checkpoint-dir' instead of starting over.")
+                ("memory-budget", make_defaulted_option(prover_options.memory_budget),
+                 "Memory budget of the prover in megabytes, cold polynomials and Merkle trees are spilled to '--spill-dir' to stay under it. 0 for no limit.")
+                ("column-cache-budget", make_defaulted_option(prover_options.column_cache_budget),
+                 "Memory budget of the FFT extensions of the columns in megabytes, the least recently used ones are recomputed when needed again. 0 for no limit.")
+                ("spill-dir", po::value(&prover_options.spill_dir),
+                 "Directory for the scratch files of '--memory-budget', the system temporary directory by default.")
+                ("proof-of-work-file", make_defaulted_option(prover_options.proof_of_work_output_file), "File with proof of work.")
+                ("output-buffers", make_defaulted_option(prover_options.output_buffers),
+                 "Number of artifacts allowed to be in flight to the disk while the prover goes on, 0 to write them synchronously.")
+                ("output-fsync", po::bool_switch(&prover_options.output_fsync),
+                 "Flush each written artifact to the device before reporting success.")
+                ("output-direct-io", po::bool_switch(&prover_options.output_direct_io),
+                 "Write artifacts with O_DIRECT, bypassing the page cache. Falls back to buffered writes where not supported.");
 
             register_output_artifacts_cli_args(prover_options.output_artifacts, config);
 
@@ -175,6 +219,13 @@ namespace nil {
 
             try {
                 check_exclusive_options(vm, {"verification-only", "skip-verification"});
+                if (prover_options.resume && prover_options.checkpoint_dir.empty()) {
+                    throw std::logic_error("Option resume requires checkpoint-dir");
+                }
+                check_megabytes_option("memory-budget", prover_options.memory_budget);
+                check_megabytes_option("column-cache-budget", prover_options.column_cache_budget);
+                check_megabytes_option("server-memory-budget", prover_options.server_memory_budget);
+                check_megabytes_option("server-max-request-size", prover_options.server_max_request_size);
             } catch (const std::logic_error& e) {
                 std::cerr << e.what() << std::endl;
                 std::cout << cmdline_options << std::endl;
@@ -39,6 +39,9 @@ namespace nil {
             std::string stage = "all";
             std::string circuit_name = "bytecode";
             boost::filesystem::path proof_file_path = "proof.bin";
+            std::string proof_format = "hex";
+            std::string partial_proof_format = "hex";
+            std::string artifact_encoding = "marshalling";
             boost::filesystem::path json_file_path = "proof.json";
             boost::filesystem::path preprocessed_common_data_path = "preprocessed_common_data.dat";
             boost::filesystem::path preprocessed_public_data_path = "preprocessed_data.dat";
@@ -55,6 +58,7 @@ namespace nil {
             std::vector<boost::filesystem::path> partial_proof_files;
             std::vector<boost::filesystem::path> initial_proof_files;
             std::vector<boost::filesystem::path> aggregated_proof_files;
+            std::vector<boost::filesystem::path> batch_proof_files;
             boost::filesystem::path aggregated_FRI_proof_file = "aggregated_FRI_proof.bin";
             boost::filesystem::path aggregated_challenge_file = "aggregated_challenge.dat";
             boost::filesystem::path consistency_checks_challenges_file = "consistency_check_challenges.dat";
@@ -62,6 +66,17 @@ namespace nil {
             OutputArtifacts output_artifacts;
             std::size_t combined_Q_starting_power;
             std::vector<boost::filesystem::path> input_combined_Q_polynomial_files;
+            boost::filesystem::path combined_Q_socket_path;
+            std::size_t combined_Q_socket_inputs = 0;
+            boost::filesystem::path server_socket_path = "proof-producer.sock";
+            std::size_t server_concurrency = 1;
+            std::size_t server_memory_budget = 0;
+            std::size_t server_max_request_size = 4096;
+            boost::filesystem::path checkpoint_dir;
+            bool resume = false;
+            std::size_t memory_budget = 0;
+            std::size_t column_cache_budget = 0;
+            boost::filesystem::path spill_dir;
             boost::filesystem::path proof_of_work_output_file = "proof_of_work.dat";
             boost::log::trivial::severity_level log_level = boost::log::trivial::severity_level::info;
             CurvesVariant elliptic_curve_type = type_identity<nil::crypto3::algebra::curves::pallas>{};
@@ -71,6 +86,10 @@ namespace nil {
             std::size_t grind = 0;
             std::size_t expand_factor = 2;
             std::size_t max_quotient_chunks = 0;
+
+            std::size_t output_buffers = 2;
+            bool output_fsync = false;
+            bool output_direct_io = false;
         };
 
         std::optional<ProverOptions> parse_args(int argc, char* argv[]);
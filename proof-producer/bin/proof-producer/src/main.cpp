@@ -32,15 +32,26 @@ using namespace nil::proof_generator;
 template<typename CurveType, typename HashType>
 int run_prover(const nil::proof_generator::ProverOptions& prover_options) {
     auto prover_task = [&] {
-        auto prover = nil::proof_generator::Prover<CurveType, HashType>(
-            prover_options.lambda,
-            prover_options.expand_factor,
-            prover_options.max_quotient_chunks,
-            prover_options.grind,
-            prover_options.circuit_name
-        );
         bool prover_result;
         try {
+            auto prover = nil::proof_generator::Prover<CurveType, HashType>(
+                prover_options.lambda,
+                prover_options.expand_factor,
+                prover_options.max_quotient_chunks,
+                prover_options.grind,
+                prover_options.circuit_name,
+                nil::proof_generator::detail::proof_formats{
+                    nil::proof_generator::detail::proof_format_from_string(prover_options.proof_format),
+                    nil::proof_generator::detail::proof_format_from_string(prover_options.partial_proof_format)
+                },
+                prover_options.output_buffers,
+                nil::proof_generator::write_options{prover_options.output_fsync, prover_options.output_direct_io}
+            );
+            prover.set_checkpoints(prover_options.checkpoint_dir, prover_options.resume);
+            prover.set_memory_budget(prover_options.memory_budget << 20, prover_options.spill_dir);
+            prover.set_column_cache_budget(prover_options.column_cache_budget << 20);
+            prover.set_artifact_encoding(
+                nil::proof_generator::detail::artifact_encoding_from_string(prover_options.artifact_encoding));
             switch (nil::proof_generator::detail::prover_stage_from_string(prover_options.stage)) {
                 case nil::proof_generator::detail::ProverStage::ALL:
                     prover_result =
@@ -89,8 +100,7 @@ int run_prover(const nil::proof_generator::ProverOptions& prover_options) {
                         prover.preprocess_public_data() &&
                         prover.save_preprocessed_common_data_to_file(prover_options.preprocessed_common_data_path) &&
                         prover.save_public_preprocessed_data_to_file(prover_options.preprocessed_public_data_path) &&
-                        prover.save_commitment_state_to_file(prover_options.commitment_scheme_state_path)&&
-                        prover.save_assignment_description(prover_options.assignment_description_file_path) &&
+                        prover.save_commitment_state_to_file(prover_options.commitment_scheme_state_path) &&
                         prover.print_evm_verifier(prover_options.evm_verifier_path);
                     break;
                 case nil::proof_generator::detail::ProverStage::PROVE:
@@ -109,6 +119,24 @@ int run_prover(const nil::proof_generator::ProverOptions& prover_options) {
                             true/*skip verification*/)&&
                         prover.print_evm_verifier(prover_options.evm_verifier_path);
                     break;
+                case nil::proof_generator::detail::ProverStage::SERVE:
+                    prover_result =
+                        prover.read_circuit(prover_options.circuit_file_path) &&
+                        prover.read_public_preprocessed_data_from_file(prover_options.preprocessed_public_data_path) &&
+                        prover.read_commitment_scheme_from_file(prover_options.commitment_scheme_state_path) &&
+                        prover.serve(
+                            prover_options.server_socket_path,
+                            prover_options.server_concurrency,
+                            prover_options.server_memory_budget << 20,
+                            prover_options.server_max_request_size << 20);
+                    break;
+                case nil::proof_generator::detail::ProverStage::REQUEST_PROOF:
+                    prover_result =
+                        prover.request_proof_to_file(
+                            prover_options.server_socket_path,
+                            prover_options.assignment_table_file_path,
+                            prover_options.proof_file_path);
+                    break;
                 case nil::proof_generator::detail::ProverStage::GENERATE_PARTIAL_PROOF:
                     // Load preprocessed data from file and generate the proof.
                     prover_result =
@@ -146,6 +174,19 @@ int run_prover(const nil::proof_generator::ProverOptions& prover_options) {
                         prover.read_assignment_description(prover_options.assignment_description_file_path) &&
                         prover.verify_from_file(prover_options.proof_file_path);
                     break;
+                case nil::proof_generator::detail::ProverStage::VERIFY_BATCH:
+                    prover_result =
+                        prover.read_circuit(prover_options.circuit_file_path) &&
+                        prover.read_preprocessed_common_data_from_file(prover_options.preprocessed_common_data_path) &&
+                        prover.read_assignment_description(prover_options.assignment_description_file_path) &&
+                        prover.verify_batch_from_files(prover_options.batch_proof_files);
+                    break;
+                case nil::proof_generator::detail::ProverStage::CHECK:
+                    prover_result =
+                        prover.read_circuit(prover_options.circuit_file_path) &&
+                        prover.read_assignment_table(prover_options.assignment_table_file_path) &&
+                        prover.check_satisfiability();
+                    break;
                 case nil::proof_generator::detail::ProverStage::GENERATE_AGGREGATED_CHALLENGE:
                     prover_result =
                         prover.generate_aggregated_challenge_to_file(
@@ -174,6 +215,8 @@ int run_prover(const nil::proof_generator::ProverOptions& prover_options) {
                         prover.generate_aggregated_FRI_proof_to_file(
                             prover_options.aggregated_challenge_file,
                             prover_options.input_combined_Q_polynomial_files,
+                            prover_options.combined_Q_socket_path,
+                            prover_options.combined_Q_socket_inputs,
                             prover_options.proof_file_path,
                             prover_options.proof_of_work_output_file,
                             prover_options.consistency_checks_challenges_file);
@@ -188,6 +231,9 @@ int run_prover(const nil::proof_generator::ProverOptions& prover_options) {
                             );
                     break;
             }
+            // Artifacts are written in background, the stage is done only once all of them are on the disk.
+            const bool artifacts_written = prover.wait_for_artifacts();
+            prover_result = artifacts_written && prover_result;
         } catch (const std::exception& e) {
             BOOST_LOG_TRIVIAL(error) << e.what();
             throw e;
@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+
+#include <nil/proof-generator/artifact_writer.hpp>
+#include <nil/proof-generator/file_operations.hpp>
+
+using namespace nil::proof_generator;
+
+namespace {
+
+    class ArtifactWriterTests: public ::testing::Test {
+    protected:
+        void SetUp() override {
+            dir_ = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
+            boost::filesystem::create_directories(dir_);
+        }
+
+        void TearDown() override {
+            boost::filesystem::remove_all(dir_);
+        }
+
+        std::string path(const std::string& name) const {
+            return (dir_ / name).string();
+        }
+
+        boost::filesystem::path dir_;
+    };
+
+    std::vector<std::uint8_t> make_data(std::size_t size) {
+        std::vector<std::uint8_t> data(size);
+        for (std::size_t i = 0; i < size; ++i) {
+            data[i] = static_cast<std::uint8_t>(i * 131 + 7);
+        }
+        return data;
+    }
+
+} // namespace
+
+
+TEST_F(ArtifactWriterTests, WriteOptions) {
+    // Sizes around the O_DIRECT block size, the unaligned tail is written separately.
+    for (std::size_t size : {0, 1, 4095, 4096, 4097, 3 * 4096 + 100}) {
+        const auto data = make_data(size);
+        for (bool sync : {false, true}) {
+            for (bool direct_io : {false, true}) {
+                const std::string file = path("artifact.bin");
+                ASSERT_TRUE(write_vector_to_file(data, file, write_options{sync, direct_io}));
+                EXPECT_EQ(read_file_to_vector(file), data) << size << " " << sync << " " << direct_io;
+            }
+        }
+    }
+}
+
+TEST_F(ArtifactWriterTests, JobsRunInOrder) {
+    std::vector<std::size_t> order;
+    {
+        artifact_writer writer(2);
+        for (std::size_t i = 0; i < 16; ++i) {
+            const auto data = make_data(1000 + i);
+            ASSERT_TRUE(writer.submit("artifact", [this, i, data, &order] {
+                order.push_back(i);
+                return write_vector_to_file(data, path("artifact_" + std::to_string(i)));
+            }));
+        }
+        ASSERT_TRUE(writer.wait());
+    }
+    ASSERT_EQ(order.size(), 16);
+    for (std::size_t i = 0; i < 16; ++i) {
+        EXPECT_EQ(order[i], i);
+        EXPECT_EQ(read_file_to_vector(path("artifact_" + std::to_string(i))), make_data(1000 + i));
+    }
+}
+
+TEST_F(ArtifactWriterTests, PendingJobsAreBounded) {
+    std::atomic<std::size_t> running{0};
+    std::atomic<std::size_t> submitted{0};
+    artifact_writer writer(2);
+    for (std::size_t i = 0; i < 8; ++i) {
+        ++submitted;
+        writer.submit("artifact", [&] {
+            ++running;
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            // The job being run, one waiting for it and one blocked in submit().
+            EXPECT_LE(submitted.load() - running.load(), 2);
+            return true;
+        });
+    }
+    EXPECT_TRUE(writer.wait());
+}
+
+TEST_F(ArtifactWriterTests, FailureIsReported) {
+    artifact_writer writer(2);
+    EXPECT_TRUE(writer.submit("good", [] { return true; }));
+    writer.submit("bad", [this] { return write_vector_to_file({1, 2, 3}, path("missing/artifact.bin")); });
+    EXPECT_FALSE(writer.wait());
+    EXPECT_FALSE(writer.submit("good", [] { return true; }));
+}
+
+TEST_F(ArtifactWriterTests, ExceptionIsRethrown) {
+    artifact_writer writer(2);
+    writer.submit("throwing", []() -> bool { throw std::runtime_error("out of space"); });
+    EXPECT_THROW(writer.wait(), std::runtime_error);
+    EXPECT_FALSE(writer.wait());
+}
+
+TEST_F(ArtifactWriterTests, Synchronous) {
+    artifact_writer writer(0);
+    const auto caller = std::this_thread::get_id();
+    EXPECT_TRUE(writer.submit("artifact", [caller] { return std::this_thread::get_id() == caller; }));
+    EXPECT_FALSE(writer.submit("bad", [] { return false; }));
+    EXPECT_FALSE(writer.wait());
+}
@@ -0,0 +1,143 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <nil/crypto3/hash/keccak.hpp>
+
+#include <nil/proof-generator/bulk_artifacts.hpp>
+#include <nil/proof-generator/prover.hpp>
+
+using namespace nil::proof_generator;
+
+namespace {
+
+    using prover_type = Prover<nil::crypto3::algebra::curves::pallas, nil::crypto3::hashes::keccak_1600<256>>;
+    using field_type = prover_type::BlueprintField;
+    using value_type = typename field_type::value_type;
+    using Endianness = prover_type::Endianness;
+    using AssignmentTable = prover_type::AssignmentTable;
+    using Column = prover_type::Column;
+    using polynomial_dfs_type = prover_type::polynomial_type;
+
+    Column make_column(std::size_t seed, std::size_t size) {
+        Column column(size);
+        for (std::size_t i = 0; i < size; ++i) {
+            column[i] = value_type(seed * 100 + i + 1);
+        }
+        return column;
+    }
+
+    polynomial_dfs_type make_polynomial_dfs(std::size_t seed) {
+        const auto values = make_column(seed, 16);
+        return polynomial_dfs_type(values.size() - 1, values);
+    }
+
+    // Columns of 'rows_amount' rows except a shorter witness and an empty selector, as left by the assigner.
+    AssignmentTable make_table(std::size_t rows_amount) {
+        return AssignmentTable(
+            std::make_shared<AssignmentTable::private_table_type>(std::vector<Column>{
+                make_column(0, rows_amount), make_column(1, rows_amount - 3)}),
+            std::make_shared<AssignmentTable::public_table_type>(
+                std::vector<Column>{make_column(2, 1)},
+                std::vector<Column>{make_column(3, rows_amount)},
+                std::vector<Column>{make_column(4, rows_amount), Column()}));
+    }
+
+    AssignmentTable pad_table(const AssignmentTable& table, std::size_t rows_amount) {
+        auto pad = [rows_amount](std::vector<Column> columns) {
+            for (auto& column : columns) {
+                column.resize(rows_amount, value_type::zero());
+            }
+            return columns;
+        };
+        return AssignmentTable(
+            std::make_shared<AssignmentTable::private_table_type>(pad(table.witnesses())),
+            std::make_shared<AssignmentTable::public_table_type>(
+                pad(table.public_inputs()), pad(table.constants()), pad(table.selectors())));
+    }
+
+    void check_table_round_trip(ArtifactEncoding encoding) {
+        const auto table = make_table(14);
+        const auto data = encode_bulk_assignment_table<Endianness, AssignmentTable>(encoding, table, 13, 16);
+        ASSERT_TRUE(data.has_value());
+        ASSERT_TRUE(is_bulk_artifact(data->data(), data->size()));
+
+        const auto decoded = decode_bulk_assignment_table<Endianness, AssignmentTable>(data->data(), data->size());
+        ASSERT_TRUE(decoded.has_value());
+        const auto& [desc, read_back] = *decoded;
+        EXPECT_EQ(desc.witness_columns, 2);
+        EXPECT_EQ(desc.public_input_columns, 1);
+        EXPECT_EQ(desc.constant_columns, 1);
+        EXPECT_EQ(desc.selector_columns, 2);
+        EXPECT_EQ(desc.usable_rows_amount, 13);
+        EXPECT_EQ(desc.rows_amount, 16);
+        EXPECT_TRUE(read_back == pad_table(table, 16));
+    }
+
+    void check_commitment_scheme_round_trip(ArtifactEncoding encoding) {
+        using lpc_scheme_type = prover_type::LpcScheme;
+
+        // A fixed and a committed batch, as in the commitment state written by the preprocessor.
+        lpc_scheme_type scheme(prover_type::FriParams(1, 4, 2, 2));
+        scheme.append_to_batch(0, std::vector<polynomial_dfs_type>{make_polynomial_dfs(0), make_polynomial_dfs(1)});
+        scheme.commit(0);
+        scheme.mark_batch_as_fixed(0);
+        scheme.append_to_batch(1, make_polynomial_dfs(2));
+        scheme.commit(1);
+
+        const auto data = encode_bulk_commitment_scheme<Endianness, lpc_scheme_type>(encoding, scheme);
+        ASSERT_TRUE(data.has_value());
+        const auto read_back = decode_bulk_commitment_scheme<Endianness, lpc_scheme_type>(data->data(), data->size());
+        ASSERT_TRUE(read_back.has_value());
+        EXPECT_TRUE(*read_back == scheme);
+        EXPECT_EQ(read_back->_polys, scheme._polys);
+    }
+
+} // namespace
+
+
+TEST(BulkArtifactsTests, BulkAssignmentTableRoundTrip) {
+    check_table_round_trip(ArtifactEncoding::BULK);
+}
+
+TEST(BulkArtifactsTests, RawAssignmentTableRoundTrip) {
+    check_table_round_trip(ArtifactEncoding::RAW);
+}
+
+TEST(BulkArtifactsTests, BulkCommitmentSchemeRoundTrip) {
+    check_commitment_scheme_round_trip(ArtifactEncoding::BULK);
+}
+
+TEST(BulkArtifactsTests, RawCommitmentSchemeRoundTrip) {
+    check_commitment_scheme_round_trip(ArtifactEncoding::RAW);
+}
+
+TEST(BulkArtifactsTests, RejectsTruncatedAndLongerData) {
+    const auto data = encode_bulk_assignment_table<Endianness, AssignmentTable>(
+        ArtifactEncoding::BULK, make_table(14), 13, 16);
+    ASSERT_TRUE(data.has_value());
+
+    for (std::size_t size : {std::size_t(4), std::size_t(20), data->size() / 2, data->size() - 1}) {
+        EXPECT_FALSE((decode_bulk_assignment_table<Endianness, AssignmentTable>(data->data(), size).has_value()));
+    }
+    auto longer = *data;
+    longer.push_back(0);
+    EXPECT_FALSE((decode_bulk_assignment_table<Endianness, AssignmentTable>(longer.data(), longer.size())
+        .has_value()));
+
+    // The magic must be at the start of the data.
+    EXPECT_FALSE(is_bulk_artifact(data->data() + 1, data->size() - 1));
+}
+
+TEST(BulkArtifactsTests, EncodingFromString) {
+    using nil::proof_generator::detail::artifact_encoding_from_string;
+
+    EXPECT_EQ(artifact_encoding_from_string("marshalling"), ArtifactEncoding::MARSHALLING);
+    EXPECT_EQ(artifact_encoding_from_string("bulk"), ArtifactEncoding::BULK);
+    EXPECT_EQ(artifact_encoding_from_string("raw"), ArtifactEncoding::RAW);
+    EXPECT_THROW(artifact_encoding_from_string("hex"), std::invalid_argument);
+}
@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+
+#include <nil/proof-generator/file_operations.hpp>
+
+using namespace nil::proof_generator;
+
+namespace {
+
+    class FileOperationsTests: public ::testing::Test {
+    protected:
+        void SetUp() override {
+            dir_ = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
+            boost::filesystem::create_directories(dir_);
+        }
+
+        void TearDown() override {
+            boost::filesystem::remove_all(dir_);
+        }
+
+        std::string path(const std::string& name) const {
+            return (dir_ / name).string();
+        }
+
+        void write_text(const std::string& file, const std::string& text) const {
+            ASSERT_TRUE(write_buffer_to_file(reinterpret_cast<const std::uint8_t*>(text.data()), text.size(), file));
+        }
+
+        boost::filesystem::path dir_;
+    };
+
+} // namespace
+
+
+TEST(HexCodecTests, EncodeAllBytes) {
+    std::vector<std::uint8_t> data(256);
+    for (std::size_t i = 0; i < data.size(); ++i) {
+        data[i] = static_cast<std::uint8_t>(i);
+    }
+    std::string text(2 * data.size(), '\0');
+    encode_hex(data.data(), data.size(), text.data());
+
+    static constexpr char digits[] = "0123456789abcdef";
+    for (std::size_t i = 0; i < data.size(); ++i) {
+        EXPECT_EQ(text[2 * i], digits[i >> 4]) << i;
+        EXPECT_EQ(text[2 * i + 1], digits[i & 0x0F]) << i;
+    }
+
+    std::vector<std::uint8_t> decoded(data.size());
+    ASSERT_TRUE(decode_hex(text.data(), data.size(), decoded.data()));
+    EXPECT_EQ(decoded, data);
+}
+
+TEST(HexCodecTests, DecodeUpperCase) {
+    const std::string text = "00ABcdEf9a";
+    std::vector<std::uint8_t> decoded(text.size() / 2);
+    ASSERT_TRUE(decode_hex(text.data(), decoded.size(), decoded.data()));
+    EXPECT_EQ(decoded, (std::vector<std::uint8_t>{0x00, 0xAB, 0xCD, 0xEF, 0x9A}));
+}
+
+TEST(HexCodecTests, DecodeRejectsNonHex) {
+    for (const std::string text : {"0g", "g0", "x1", "1 ", "-1", "0:"}) {
+        std::uint8_t decoded;
+        EXPECT_FALSE(decode_hex(text.data(), 1, &decoded)) << text;
+    }
+    // A bad digit is reported wherever it is.
+    const std::string text = "00112233445566778z";
+    std::vector<std::uint8_t> decoded(text.size() / 2);
+    EXPECT_FALSE(decode_hex(text.data(), decoded.size(), decoded.data()));
+}
+
+TEST(HexCodecTests, EmptyInput) {
+    EXPECT_TRUE(decode_hex(nullptr, 0, nullptr));
+    encode_hex(nullptr, 0, nullptr);
+}
+
+TEST_F(FileOperationsTests, HexFileRoundTrip) {
+    for (std::size_t size : {1, 2, 31, 4096, 100000}) {
+        std::vector<std::uint8_t> data(size);
+        for (std::size_t i = 0; i < size; ++i) {
+            data[i] = static_cast<std::uint8_t>(i * 131 + 7);
+        }
+        const std::string file = path("proof.hex");
+        ASSERT_TRUE(write_vector_to_hex_file(data, file));
+        EXPECT_EQ(read_hex_file_to_vector(file), data) << size;
+    }
+}
+
+TEST_F(FileOperationsTests, HexFileMultipleLines) {
+    const std::string file = path("proof.hex");
+    write_text(file, "0x0102\n0xA0b0\n");
+    EXPECT_EQ(read_hex_file_to_vector(file), (std::vector<std::uint8_t>{0x01, 0x02, 0xA0, 0xB0}));
+}
+
+TEST_F(FileOperationsTests, HexFileRejectsMalformed) {
+    for (const std::string text : {"0102", "0x", "0x123", "0x12zz", "1x12", "0x12\n34"}) {
+        const std::string file = path("proof.hex");
+        write_text(file, text);
+        EXPECT_FALSE(read_hex_file_to_vector(file).has_value()) << text;
+    }
+}
@@ -0,0 +1,183 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <boost/asio/connect.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/local/stream_protocol.hpp>
+#include <boost/asio/write.hpp>
+#include <boost/filesystem.hpp>
+
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <nil/crypto3/math/polynomial/polynomial.hpp>
+
+#include <nil/proof-generator/polynomial_aggregation.hpp>
+
+using namespace nil::proof_generator;
+
+namespace {
+
+    using field_type = nil::crypto3::algebra::curves::pallas::base_field_type;
+    using polynomial_type = nil::crypto3::math::polynomial<typename field_type::value_type>;
+
+    polynomial_type make_polynomial(std::size_t index) {
+        // Polynomials of different degrees, so the sum has to grow the shorter ones.
+        std::vector<typename field_type::value_type> coefficients(3 + index % 5);
+        for (std::size_t i = 0; i < coefficients.size(); ++i) {
+            coefficients[i] = typename field_type::value_type(index * 1000 + i + 1);
+        }
+        return polynomial_type(coefficients);
+    }
+
+    polynomial_type sequential_sum(std::size_t count) {
+        polynomial_type sum;
+        for (std::size_t i = 0; i < count; ++i) {
+            sum += make_polynomial(i);
+        }
+        return sum;
+    }
+
+    void send(const std::string& path, const std::vector<std::uint8_t>& data) {
+        boost::asio::io_context io_context;
+        boost::asio::local::stream_protocol::socket socket(io_context);
+        socket.connect(boost::asio::local::stream_protocol::endpoint(path));
+        boost::asio::write(socket, boost::asio::buffer(data));
+    }
+
+    class LocalSocketReceiverTests: public ::testing::Test {
+    protected:
+        void SetUp() override {
+            dir_ = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
+            boost::filesystem::create_directories(dir_);
+        }
+
+        void TearDown() override {
+            boost::filesystem::remove_all(dir_);
+        }
+
+        std::string socket_path() const {
+            return (dir_ / "combined_Q.sock").string();
+        }
+
+        boost::filesystem::path dir_;
+    };
+
+} // namespace
+
+
+TEST(PolynomialAggregationTests, SumMatchesSequential) {
+    for (std::size_t sources_count : {1, 2, 5, 17}) {
+        for (std::size_t workers_count : {1, 2, 3, 8}) {
+            auto sum = parallel_sum_polynomials<polynomial_type>(
+                sources_count,
+                [](std::size_t index) -> std::optional<polynomial_type> { return make_polynomial(index); },
+                workers_count);
+            ASSERT_TRUE(sum.has_value());
+            EXPECT_EQ(*sum, sequential_sum(sources_count)) << sources_count << " " << workers_count;
+        }
+    }
+}
+
+TEST(PolynomialAggregationTests, EveryInputIsLoadedOnce) {
+    const std::size_t sources_count = 33;
+    std::vector<std::atomic<std::size_t>> loads(sources_count);
+    auto sum = parallel_sum_polynomials<polynomial_type>(
+        sources_count,
+        [&loads](std::size_t index) -> std::optional<polynomial_type> {
+            ++loads[index];
+            return make_polynomial(index);
+        },
+        4);
+    ASSERT_TRUE(sum.has_value());
+    for (std::size_t i = 0; i < sources_count; ++i) {
+        EXPECT_EQ(loads[i].load(), 1) << i;
+    }
+}
+
+TEST(PolynomialAggregationTests, NoInputs) {
+    auto sum = parallel_sum_polynomials<polynomial_type>(
+        0, [](std::size_t) -> std::optional<polynomial_type> { return std::nullopt; });
+    ASSERT_TRUE(sum.has_value());
+    EXPECT_EQ(*sum, polynomial_type());
+}
+
+TEST(PolynomialAggregationTests, FailedInput) {
+    for (std::size_t workers_count : {1, 4}) {
+        auto sum = parallel_sum_polynomials<polynomial_type>(
+            9,
+            [](std::size_t index) -> std::optional<polynomial_type> {
+                if (index == 6) {
+                    return std::nullopt;
+                }
+                return make_polynomial(index);
+            },
+            workers_count);
+        EXPECT_FALSE(sum.has_value()) << workers_count;
+    }
+}
+
+TEST_F(LocalSocketReceiverTests, ReceivesEverySender) {
+    local_socket_receiver receiver(socket_path());
+
+    const std::size_t senders_count = 6;
+    std::vector<std::vector<std::uint8_t>> sent(senders_count);
+    for (std::size_t i = 0; i < senders_count; ++i) {
+        // Large enough to take more than one read.
+        sent[i].resize(100000 + i);
+        for (std::size_t j = 0; j < sent[i].size(); ++j) {
+            sent[i][j] = static_cast<std::uint8_t>(i * 31 + j * 7);
+        }
+    }
+    std::vector<std::thread> senders;
+    for (std::size_t i = 0; i < senders_count; ++i) {
+        senders.emplace_back([this, &sent, i] { send(socket_path(), sent[i]); });
+    }
+
+    std::vector<std::vector<std::uint8_t>> received(senders_count);
+    std::vector<std::thread> receivers;
+    for (std::size_t i = 0; i < senders_count; ++i) {
+        receivers.emplace_back([&receiver, &received, i] {
+            auto data = receiver.receive();
+            if (data) {
+                received[i] = std::move(*data);
+            }
+        });
+    }
+    for (auto& thread : senders) {
+        thread.join();
+    }
+    for (auto& thread : receivers) {
+        thread.join();
+    }
+
+    std::sort(sent.begin(), sent.end());
+    std::sort(received.begin(), received.end());
+    EXPECT_EQ(received, sent);
+}
+
+TEST_F(LocalSocketReceiverTests, StaleSocketIsReplaced) {
+    // Left behind by a run which was killed.
+    std::ofstream(socket_path()) << "stale";
+    local_socket_receiver receiver(socket_path());
+    std::thread sender([this] { send(socket_path(), {1, 2, 3}); });
+    EXPECT_EQ(receiver.receive(), (std::vector<std::uint8_t>{1, 2, 3}));
+    sender.join();
+}
+
+TEST_F(LocalSocketReceiverTests, StopWakesWaitingReceivers) {
+    local_socket_receiver receiver(socket_path());
+    std::optional<std::vector<std::uint8_t>> result = std::vector<std::uint8_t>{};
+    std::thread waiting([&] { result = receiver.receive(); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    receiver.stop();
+    waiting.join();
+    EXPECT_FALSE(result.has_value());
+}
@@ -0,0 +1,226 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/local/stream_protocol.hpp>
+#include <boost/asio/write.hpp>
+#include <boost/filesystem.hpp>
+
+#include <nil/proof-generator/proof_server.hpp>
+
+using namespace nil::proof_generator;
+
+namespace {
+
+    class ProofServerTests: public ::testing::Test {
+    protected:
+        void SetUp() override {
+            dir_ = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
+            boost::filesystem::create_directories(dir_);
+        }
+
+        void TearDown() override {
+            boost::filesystem::remove_all(dir_);
+        }
+
+        std::string path(const std::string& name) const {
+            return (dir_ / name).string();
+        }
+
+        boost::filesystem::path dir_;
+    };
+
+    // Stands in for the prover: the "proof" is the request reversed, an empty request fails.
+    std::optional<std::vector<std::uint8_t>> reverse_handler(const std::vector<std::uint8_t>& request) {
+        if (request.empty()) {
+            return std::nullopt;
+        }
+        if (request.front() == 0xff) {
+            throw std::runtime_error("bad request");
+        }
+        return std::vector<std::uint8_t>(request.rbegin(), request.rend());
+    }
+
+} // namespace
+
+
+TEST_F(ProofServerTests, AnswersRequests) {
+    const std::string socket = path("server.sock");
+    proof_server server(socket, 2, 0, reverse_handler);
+    std::thread serving([&] { EXPECT_FALSE(server.serve()); });
+
+    std::vector<std::thread> clients;
+    std::atomic<std::size_t> answered{0};
+    for (std::size_t i = 0; i < 8; ++i) {
+        clients.emplace_back([&, i] {
+            std::vector<std::uint8_t> request(1000 * i + 1);
+            for (std::size_t j = 0; j < request.size(); ++j) {
+                request[j] = static_cast<std::uint8_t>(j % 251);
+            }
+            const auto reply = request_proof(socket, request);
+            ASSERT_TRUE(reply.has_value());
+            EXPECT_EQ(*reply, std::vector<std::uint8_t>(request.rbegin(), request.rend()));
+            ++answered;
+        });
+    }
+    for (auto& client : clients) {
+        client.join();
+    }
+    EXPECT_EQ(answered, 8);
+
+    // Failed requests are answered with an error and don't stop the server.
+    EXPECT_FALSE(request_proof(socket, {}).has_value());
+    EXPECT_FALSE(request_proof(socket, {0xff, 1}).has_value());
+    EXPECT_EQ(request_proof(socket, {1, 2, 3}), (std::vector<std::uint8_t>{3, 2, 1}));
+
+    server.stop();
+    serving.join();
+    EXPECT_EQ(server.requests_served(), 9);
+    EXPECT_EQ(server.requests_failed(), 2);
+}
+
+TEST_F(ProofServerTests, StopsWithoutRequests) {
+    proof_server server(path("idle.sock"), 4, 0, reverse_handler);
+    std::thread serving([&] { EXPECT_TRUE(server.serve()); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    server.stop();
+    serving.join();
+    EXPECT_FALSE(request_proof(path("idle.sock"), {1}).has_value());
+}
+
+TEST_F(ProofServerTests, RejectsOversizedRequest) {
+    const std::string socket = path("server.sock");
+    std::atomic<std::size_t> handled{0};
+    proof_server server(socket, 1, 0, [&](const std::vector<std::uint8_t>& request) {
+        ++handled;
+        return reverse_handler(request);
+    }, 100);
+    std::thread serving([&] { server.serve(); });
+
+    EXPECT_FALSE(request_proof(socket, std::vector<std::uint8_t>(101, 1)).has_value());
+    EXPECT_EQ(request_proof(socket, std::vector<std::uint8_t>(100, 1)), std::vector<std::uint8_t>(100, 1));
+
+    server.stop();
+    serving.join();
+    EXPECT_EQ(handled, 1);
+    EXPECT_EQ(server.requests_failed(), 1);
+}
+
+TEST_F(ProofServerTests, DropsStalledClient) {
+    const std::string socket = path("server.sock");
+    proof_server server(socket, 1, 0, reverse_handler, proof_server::default_max_request_bytes,
+                        std::chrono::milliseconds(100));
+    std::thread serving([&] { server.serve(); });
+
+    // Announces 1000 bytes, sends 10 and stalls while holding the only thread.
+    boost::asio::io_context io_context;
+    boost::asio::local::stream_protocol::socket stalled(io_context);
+    stalled.connect(boost::asio::local::stream_protocol::endpoint(socket));
+    const auto header = detail::encode_message_size(1000);
+    boost::asio::write(stalled, boost::asio::buffer(header));
+    boost::asio::write(stalled, boost::asio::buffer(std::vector<std::uint8_t>(10, 1)));
+
+    EXPECT_EQ(request_proof(socket, {1, 2, 3}), (std::vector<std::uint8_t>{3, 2, 1}));
+
+    server.stop();
+    serving.join();
+    EXPECT_EQ(server.requests_failed(), 1);
+}
+
+TEST_F(ProofServerTests, MemoryBudgetCalibratesOnFirstRequest) {
+    request_memory_budget budget(1000, 100);
+
+    auto first = budget.acquire(10);
+    EXPECT_TRUE(first.calibrating);
+
+    // Nothing is admitted while calibrating.
+    std::atomic<bool> second_admitted{false};
+    std::thread second([&] {
+        auto ticket = budget.acquire(10);
+        second_admitted = true;
+        EXPECT_FALSE(ticket.calibrating);
+        EXPECT_EQ(ticket.estimate, 200);
+        budget.release(ticket, 10);
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_FALSE(second_admitted);
+
+    budget.release(first, 10, 200);
+    second.join();
+    EXPECT_TRUE(second_admitted);
+    EXPECT_EQ(budget.bytes_per_request_byte(), 20);
+}
+
+TEST_F(ProofServerTests, MemoryBudgetLimitsConcurrentRequests) {
+    request_memory_budget budget(1000, 100);
+    budget.release(budget.acquire(10), 10, 100);
+
+    // 100 resident + 4 * 200 estimated fit, the fifth request waits.
+    std::vector<request_memory_budget::ticket> tickets;
+    for (std::size_t i = 0; i < 4; ++i) {
+        tickets.push_back(budget.acquire(20));
+    }
+    std::atomic<bool> fifth_admitted{false};
+    std::thread fifth([&] {
+        auto ticket = budget.acquire(20);
+        fifth_admitted = true;
+        budget.release(ticket, 20);
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_FALSE(fifth_admitted);
+
+    budget.release(tickets.back(), 20);
+    fifth.join();
+    EXPECT_TRUE(fifth_admitted);
+    for (std::size_t i = 0; i + 1 < tickets.size(); ++i) {
+        budget.release(tickets[i], 20);
+    }
+
+    // A request larger than the whole budget still runs alone.
+    auto huge = budget.acquire(1000);
+    EXPECT_EQ(huge.estimate, 10000);
+    budget.release(huge, 1000);
+}
+
+TEST_F(ProofServerTests, MemoryBudgetEstimateDoesNotOverflow) {
+    request_memory_budget budget(1000, 100);
+    budget.release(budget.acquire(1), 1, 1000);
+
+    auto huge = budget.acquire(std::numeric_limits<std::size_t>::max() / 2);
+    EXPECT_EQ(huge.estimate, std::numeric_limits<std::size_t>::max());
+
+    // Wrapped around, the estimate would have let this one run next to the huge one.
+    std::atomic<bool> second_admitted{false};
+    std::thread second([&] {
+        auto ticket = budget.acquire(std::numeric_limits<std::size_t>::max() / 1000 + 1);
+        second_admitted = true;
+        budget.release(ticket, 0);
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_FALSE(second_admitted);
+
+    budget.release(huge, 0);
+    second.join();
+    EXPECT_TRUE(second_admitted);
+}
+
+TEST_F(ProofServerTests, UnlimitedBudgetNeverWaits) {
+    request_memory_budget budget(0, 100);
+    std::vector<request_memory_budget::ticket> tickets;
+    for (std::size_t i = 0; i < 16; ++i) {
+        tickets.push_back(budget.acquire(1 << 20));
+        EXPECT_FALSE(tickets.back().calibrating);
+    }
+    for (const auto& ticket : tickets) {
+        budget.release(ticket, 1 << 20);
+    }
+}
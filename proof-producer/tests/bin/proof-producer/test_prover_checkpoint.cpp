@@ -0,0 +1,170 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <nil/crypto3/hash/keccak.hpp>
+#include <nil/crypto3/hash/poseidon.hpp>
+#include <nil/crypto3/zk/transcript/fiat_shamir.hpp>
+
+#include <nil/proof-generator/prover.hpp>
+#include <nil/proof-generator/prover_checkpoint.hpp>
+
+using namespace nil::proof_generator;
+
+namespace {
+
+    using field_type = nil::crypto3::algebra::curves::pallas::base_field_type;
+    using Endianness = nil::crypto3::marshalling::option::big_endian;
+
+    template<typename Hash>
+    using transcript_type = nil::crypto3::zk::transcript::fiat_shamir_heuristic_sequential<Hash>;
+
+    template<typename Polynomial>
+    Polynomial make_polynomial_dfs(std::size_t seed) {
+        std::vector<typename field_type::value_type> values(16);
+        for (std::size_t i = 0; i < values.size(); ++i) {
+            values[i] = typename field_type::value_type(seed * 100 + i + 1);
+        }
+        return Polynomial(values.size() - 1, values);
+    }
+
+    // Encodes the state of 'transcript', decodes it into a fresh transcript and checks both draw the same
+    // challenges afterwards.
+    template<typename Transcript>
+    void check_state_round_trip(Transcript transcript) {
+        using marshalling_type = nil::proof_generator::detail::transcript_state_marshalling<Endianness, Transcript>;
+
+        auto filled = marshalling_type::fill(transcript);
+        std::vector<std::uint8_t> bytes(filled.length());
+        auto write_iter = bytes.begin();
+        ASSERT_TRUE(filled.write(write_iter, bytes.size()) == nil::crypto3::marshalling::status_type::success);
+
+        typename marshalling_type::type read_back;
+        auto read_iter = bytes.cbegin();
+        ASSERT_TRUE(read_back.read(read_iter, bytes.size()) == nil::crypto3::marshalling::status_type::success);
+
+        Transcript restored;
+        ASSERT_TRUE(marshalling_type::make(read_back, restored));
+        for (std::size_t i = 0; i < 3; ++i) {
+            EXPECT_EQ(restored.template challenge<field_type>(), transcript.template challenge<field_type>());
+            restored(std::vector<std::uint8_t>{1, 2, std::uint8_t(i)});
+            transcript(std::vector<std::uint8_t>{1, 2, std::uint8_t(i)});
+        }
+    }
+
+} // namespace
+
+
+TEST(ProverCheckpointTests, DigestTranscriptStateRoundTrip) {
+    transcript_type<nil::crypto3::hashes::keccak_1600<256>> transcript(std::vector<std::uint8_t>{7, 7, 7});
+    transcript.template challenge<field_type>();
+    check_state_round_trip(transcript);
+}
+
+TEST(ProverCheckpointTests, SpongeTranscriptStateRoundTrip) {
+    using poseidon_type = nil::crypto3::hashes::poseidon<
+        nil::crypto3::hashes::detail::mina_poseidon_policy<field_type>>;
+
+    // Absorb a few elements so the sponge is in the middle of its rate.
+    transcript_type<poseidon_type> transcript(std::vector<std::uint8_t>{7, 7, 7});
+    transcript(field_type::value_type(5u));
+    check_state_round_trip(transcript);
+    transcript(field_type::value_type(6u));
+    check_state_round_trip(transcript);
+}
+
+TEST(ProverCheckpointTests, RejectsStateOfAnotherTranscript) {
+    using transcript = transcript_type<nil::crypto3::hashes::keccak_1600<256>>;
+    using marshalling_type = nil::proof_generator::detail::transcript_state_marshalling<Endianness, transcript>;
+
+    auto filled = marshalling_type::fill(transcript());
+    filled.value().pop_back();
+    transcript restored;
+    EXPECT_FALSE(marshalling_type::make(filled, restored));
+}
+
+TEST(ProverCheckpointTests, FilesSortInStageOrder) {
+    std::vector<std::string> names;
+    for (auto stage : checkpoint_stages_latest_first) {
+        names.push_back(checkpoint_file("dir", stage).filename().string());
+    }
+    EXPECT_EQ(names.front(), "checkpoint-4-evaluations.dat");
+    EXPECT_TRUE(std::is_sorted(names.rbegin(), names.rend()));
+}
+
+TEST(ProverCheckpointTests, CheckpointFileRoundTrip) {
+    using prover_type = Prover<nil::crypto3::algebra::curves::pallas, nil::crypto3::hashes::keccak_1600<256>>;
+    using lpc_scheme_type = prover_type::LpcScheme;
+    using proof_type = prover_type::Proof;
+    using polynomial_dfs_type = nil::crypto3::math::polynomial_dfs<typename field_type::value_type>;
+    using transcript = transcript_type<nil::crypto3::hashes::keccak_1600<256>>;
+    using placeholder_prover_type = nil::crypto3::zk::snark::placeholder_prover<
+        prover_type::BlueprintField, prover_type::PlaceholderParams>;
+    using marshalling_type = checkpoint_marshalling<
+        prover_type::Endianness, proof_type, lpc_scheme_type, transcript, placeholder_prover_type::F_parts_type>;
+
+    // A commitment scheme with a fixed and a committed batch, as after the variable values commitment.
+    lpc_scheme_type scheme(prover_type::FriParams(1, 4, 2, 2));
+    scheme.append_to_batch(0, std::vector<polynomial_dfs_type>{make_polynomial_dfs<polynomial_dfs_type>(0),
+                                                              make_polynomial_dfs<polynomial_dfs_type>(1)});
+    const auto fixed_values_commitment = scheme.commit(0);
+    scheme.mark_batch_as_fixed(0);
+    scheme.append_to_batch(1, make_polynomial_dfs<polynomial_dfs_type>(2));
+
+    proof_type proof;
+    proof.commitments[1] = scheme.commit(1);
+    proof.eval_proof.challenge = typename field_type::value_type(12345u);
+
+    transcript transcript_state(std::vector<std::uint8_t>{7, 7, 7});
+    transcript_state(proof.commitments[1]);
+
+    placeholder_prover_type::F_parts_type F_dfs;
+    for (std::size_t i = 0; i < F_dfs.size(); ++i) {
+        F_dfs[i] = make_polynomial_dfs<polynomial_dfs_type>(10 + i);
+    }
+
+    checkpoint_digest<prover_type::Endianness, field_type> digest;
+    digest.add_option(9);
+    digest.add_column(make_polynomial_dfs<polynomial_dfs_type>(3));
+
+    const auto path = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
+    ASSERT_TRUE(nil::proof_generator::detail::encode_marshalling_to_file(
+        path, marshalling_type::fill(
+            placeholder_prover_type::checkpoint_type{placeholder_prover_stage::quotient_committed, transcript_state,
+                                                     proof, F_dfs, scheme},
+            fixed_values_commitment, digest.value())));
+    auto read_back = nil::proof_generator::detail::decode_marshalling_from_file<marshalling_type::type>(path);
+    boost::filesystem::remove(path);
+    ASSERT_TRUE(read_back.has_value());
+    auto checkpoint = marshalling_type::make(*read_back);
+    ASSERT_TRUE(checkpoint.has_value());
+
+    EXPECT_EQ(checkpoint->stage, placeholder_prover_stage::quotient_committed);
+    EXPECT_EQ(checkpoint->fixed_values_commitment, fixed_values_commitment);
+    EXPECT_EQ(checkpoint->digest, digest.value());
+    EXPECT_TRUE(static_cast<const proof_type::partial_proof_type&>(checkpoint->proof) == proof);
+    EXPECT_EQ(checkpoint->proof.eval_proof.challenge, proof.eval_proof.challenge);
+    EXPECT_EQ(checkpoint->F_dfs, F_dfs);
+    EXPECT_TRUE(checkpoint->commitment_scheme == scheme);
+    EXPECT_EQ(checkpoint->transcript.template challenge<field_type>(),
+              transcript_state.template challenge<field_type>());
+}
+
+TEST(ProverCheckpointTests, DigestCoversValuesAndOptions) {
+    using polynomial_dfs_type = nil::crypto3::math::polynomial_dfs<typename field_type::value_type>;
+    auto digest_of = [](std::size_t option, std::size_t seed) {
+        checkpoint_digest<Endianness, field_type> digest;
+        digest.add_option(option);
+        digest.add_column(make_polynomial_dfs<polynomial_dfs_type>(seed));
+        return digest.value();
+    };
+    EXPECT_EQ(digest_of(1, 1), digest_of(1, 1));
+    EXPECT_NE(digest_of(1, 1), digest_of(2, 1));
+    EXPECT_NE(digest_of(1, 1), digest_of(1, 2));
+}